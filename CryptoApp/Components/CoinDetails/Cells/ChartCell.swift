@@ -17,6 +17,8 @@ final class ChartCell: UITableViewCell {
     private var currentChartType: ChartType = .line
     private var currentPoints: [Double] = []
     private var currentOHLCData: [OHLCData] = []
+    // Prepared model whose candle series is currentOHLCData (nil when data came in raw)
+    private var currentModel: ChartModel?
     private var currentRange: String = "24h"
     
     // Technical Indicators Pending Settings
@@ -73,6 +75,7 @@ final class ChartCell: UITableViewCell {
         // Clear any cached data
         currentPoints = []
         currentOHLCData = []
+        currentModel = nil
         currentRange = "24h"
         onRetryRequested = nil
         
@@ -371,6 +374,7 @@ final class ChartCell: UITableViewCell {
     func configure(ohlcData: [OHLCData], range: String) {
         self.currentOHLCData = ohlcData
         self.currentRange = range
+        self.currentModel = nil
         
         if !ohlcData.isEmpty {
             // Only update to data state if not currently loading
@@ -397,22 +401,48 @@ final class ChartCell: UITableViewCell {
         }
     }
     
+    // Configure from a prepared chart model (shared with the landscape chart)
+    func configure(model: ChartModel) {
+        currentPoints = model.points
+        currentOHLCData = model.ohlc
+        currentRange = model.key.range
+        currentModel = model
+        
+        let hasData = !model.points.isEmpty || !model.ohlc.isEmpty
+        if !model.points.isEmpty {
+            lineChartView.update(model)
+        }
+        if !model.ohlc.isEmpty {
+            candlestickChartView.update(model)
+            if showVolume {
+                updateVolumeData()
+            }
+        }
+        guard hasData else { return }
+        reapplyTechnicalIndicators()
+        
+        // Keep loading state during cell reuse - will be updated by view controller bindings
+        if case .loading = currentState { return }
+        currentState = .data
+        updateViewsForState()
+    }
+    
     // Switch chart type
     func switchChartType(to chartType: ChartType) {
-        print("🔄 ChartCell: switchChartType called - from \(currentChartType) to \(chartType)")
+        AppLogger.chart("🔄 ChartCell: switchChartType called - from \(currentChartType) to \(chartType)", level: .debug)
         guard chartType != currentChartType else { 
-            print("🔄 ChartCell: No change needed, already \(chartType)")
+            AppLogger.chart("🔄 ChartCell: No change needed, already \(chartType)", level: .debug)
             return 
         }
         
         let previousChartType = currentChartType
         currentChartType = chartType
-        print("🔄 ChartCell: Chart type switched from \(previousChartType) to \(currentChartType)")
+        AppLogger.chart("🔄 ChartCell: Chart type switched from \(previousChartType) to \(currentChartType)", level: .debug)
         
         // Debug chart visibility after switch
         DispatchQueue.main.async {
-            print("🔄 Line chart isHidden: \(self.lineChartView.isHidden)")
-            print("🔄 Candlestick chart isHidden: \(self.candlestickChartView.isHidden)")
+            AppLogger.chart("🔄 Line chart isHidden: \(self.lineChartView.isHidden)", level: .debug)
+            AppLogger.chart("🔄 Candlestick chart isHidden: \(self.candlestickChartView.isHidden)", level: .debug)
         }
         
         // Only update views if we're in data state
@@ -432,30 +462,47 @@ final class ChartCell: UITableViewCell {
         }
     }
     
-    // Update chart data without recreation
-    func updateChartData(points: [Double]? = nil, ohlcData: [OHLCData]? = nil, range: String) {
+    // Update chart data without recreation (full redraws render from `model` when given)
+    func updateChartData(points: [Double]? = nil, ohlcData: [OHLCData]? = nil, range: String, model: ChartModel? = nil) {
+        // Live refreshes of the same range usually only touch the tail - patch it in place
+        let isSameRange = range == currentRange && currentState == .data
         self.currentRange = range
         
         var hasData = false
+        var volumeUpdatedInPlace = false
         
         if let points = points {
+            let previousPoints = currentPoints
             self.currentPoints = points
             if !points.isEmpty {
-                lineChartView.update(points, range: range)
-                reapplyTechnicalIndicators()
+                if !(isSameRange && applyIncrementalUpdate(from: previousPoints, to: points)) {
+                    if let model = model {
+                        lineChartView.update(model)
+                    } else {
+                        lineChartView.update(points, range: range)
+                    }
+                    reapplyTechnicalIndicators()
+                }
                 hasData = true
             }
         }
         
         if let ohlcData = ohlcData {
+            let previousOHLCData = currentOHLCData
             self.currentOHLCData = ohlcData
+            self.currentModel = model
             if !ohlcData.isEmpty {
-                let _ = ohlcData.compactMap { $0.volume }.count  // volumeCount unused
-                // Process OHLC data
-                
-                candlestickChartView.update(ohlcData, range: range)
-                reapplyTechnicalIndicators()
-                applyPendingIndicatorSettings() // Apply any pending settings after data is loaded
+                if isSameRange && applyIncrementalUpdate(from: previousOHLCData, to: ohlcData) {
+                    volumeUpdatedInPlace = true
+                } else {
+                    if let model = model {
+                        candlestickChartView.update(model)
+                    } else {
+                        candlestickChartView.update(ohlcData, range: range)
+                    }
+                    reapplyTechnicalIndicators()
+                    applyPendingIndicatorSettings() // Apply any pending settings after data is loaded
+                }
                 hasData = true
             } else {
                 // Only clear and show loading if we're in candlestick mode
@@ -471,7 +518,7 @@ final class ChartCell: UITableViewCell {
         
         // Update volume chart ONLY when we have OHLC data (not for line chart points)
         // Volume data comes with OHLC data, so we only update when ohlcData parameter is provided
-        if hasData && showVolume && !currentOHLCData.isEmpty && ohlcData != nil {
+        if hasData && showVolume && !currentOHLCData.isEmpty && ohlcData != nil && !volumeUpdatedInPlace {
             updateVolumeData()
         }
         
@@ -487,10 +534,62 @@ final class ChartCell: UITableViewCell {
         // Chart updated
     }
     
+    // MARK: - Incremental Updates
+    
+    /// Patches the line chart when only the last point changed or one point was appended.
+    /// The chart extends its indicator buffers, overlays and labels with the same points, so no
+    /// indicator reapply is needed. Returns false when the series changed otherwise and a full update is needed.
+    private func applyIncrementalUpdate(from old: [Double], to new: [Double]) -> Bool {
+        guard !old.isEmpty else { return false }
+        switch new.count - old.count {
+        case 0 where old.dropLast().elementsEqual(new.dropLast()):
+            return lineChartView.replaceLastPoint(new[new.count - 1])
+        case 1 where old.dropLast().elementsEqual(new.prefix(old.count - 1)):
+            return lineChartView.replaceLastPoint(new[old.count - 1])
+                && lineChartView.appendPoint(new[new.count - 1])
+        default:
+            return false
+        }
+    }
+    
+    /// Patches the candlestick (and volume) chart when only the forming candle changed or one candle was added.
+    /// Returns false when the series changed otherwise and a full update is needed.
+    private func applyIncrementalUpdate(from old: [OHLCData], to new: [OHLCData]) -> Bool {
+        guard let oldLast = old.last, let newLast = new.last,
+              old.first?.timestamp == new.first?.timestamp else { return false }
+        
+        let changed: [(candle: OHLCData, appended: Bool)]
+        switch new.count - old.count {
+        case 0 where newLast.timestamp == oldLast.timestamp:
+            changed = [(newLast, false)]
+        case 1 where new[old.count - 1].timestamp == oldLast.timestamp:
+            changed = [(new[old.count - 1], false), (newLast, true)]
+        default:
+            return false
+        }
+        
+        for change in changed {
+            let applied = change.appended
+                ? candlestickChartView.appendCandle(change.candle)
+                : candlestickChartView.replaceLastCandle(change.candle)
+            guard applied else { return false }
+        }
+        
+        if showVolume {
+            let volumeApplied = changed.allSatisfy { change in
+                change.appended
+                    ? volumeChartView.appendVolume(from: change.candle)
+                    : volumeChartView.replaceLastVolume(from: change.candle)
+            }
+            if !volumeApplied { updateVolumeData() }
+        }
+        return true
+    }
+    
     // ATOMIC UPDATE: Combines chart data update + settings application to prevent flashing
-    func updateChartDataWithSettings(points: [Double]? = nil, ohlcData: [OHLCData]? = nil, range: String, settings: [String: Any]) {
+    func updateChartDataWithSettings(points: [Double]? = nil, ohlcData: [OHLCData]? = nil, range: String, model: ChartModel? = nil, settings: [String: Any]) {
         // Update data first
-        updateChartData(points: points, ohlcData: ohlcData, range: range)
+        updateChartData(points: points, ohlcData: ohlcData, range: range, model: model)
         
         // Only apply settings if we have actual chart data to avoid unnecessary redraws
         guard currentState == .data else { return }
@@ -499,6 +598,26 @@ final class ChartCell: UITableViewCell {
         applySettingsAtomically(settings)
     }
     
+    // Renders a prepared model, touching only the series whose revision changed
+    func updateChartModel(_ model: ChartModel, settings: [String: Any]) {
+        let previous = currentModel
+        let rangeChanged = previous?.key.range != model.key.range
+        let pointsChanged = rangeChanged || previous?.pointsRevision != model.pointsRevision
+        // Indicator-settings-only changes keep the series; indicators re-read the model's buffers
+        let ohlcChanged = rangeChanged
+            || previous?.key.coinID != model.key.coinID
+            || previous?.key.timeframe != model.key.timeframe
+            || previous?.ohlcRevision != model.ohlcRevision
+
+        updateChartDataWithSettings(points: pointsChanged ? model.points : nil,
+                                    ohlcData: ohlcChanged ? model.ohlc : nil,
+                                    range: model.key.range,
+                                    model: model,
+                                    settings: settings)
+        // Line-only updates keep the candle series, so the new model still describes it
+        currentModel = model
+    }
+
     // Applies settings without triggering multiple redraws
     func applySettingsAtomically(_ settings: [String: Any]) {
         let gridEnabled = settings["gridEnabled"] as? Bool ?? false
@@ -508,6 +627,7 @@ final class ChartCell: UITableViewCell {
         let lineThickness = settings["lineThickness"] as? Double ?? 0
         let animationSpeed = settings["animationSpeed"] as? Double ?? 0
         let showVolume = settings["showVolume"] as? Bool ?? false
+        let candleSeriesMode = (settings["candleSeriesMode"] as? String).flatMap(CandleSeriesMode.init(rawValue:)) ?? .standard
 
         
         // Apply all settings in one go using existing methods
@@ -524,6 +644,7 @@ final class ChartCell: UITableViewCell {
         }
         
         setAnimationSpeed(animationSpeed)
+        setCandleSeriesMode(candleSeriesMode)
         
         // Apply volume settings to ensure persistence across filter changes
         updateVolumeSettings(showVolume: showVolume)
@@ -635,6 +756,10 @@ extension ChartCell {
         candlestickChartView.toggleAutoScale(enabled)
     }
     
+    func setCandleSeriesMode(_ mode: CandleSeriesMode) {
+        candlestickChartView.setSeriesMode(mode)
+    }
+    
     func applyColorTheme(_ theme: ChartColorTheme) {
         lineChartView.applyColorTheme(theme)
         candlestickChartView.applyColorTheme(theme)
@@ -694,8 +819,12 @@ extension ChartCell {
         // Update volume chart
         // Volume chart layout updated
         
-        // Update volume chart immediately - no more debouncing
-        volumeChartView.updateVolume(ohlcData: currentOHLCData, range: currentRange, theme: theme)
+        // Update volume chart immediately - prepared volumes/analysis when the model matches the candles
+        if let model = currentModel {
+            volumeChartView.updateVolume(model: model, theme: theme)
+        } else {
+            volumeChartView.updateVolume(ohlcData: currentOHLCData, range: currentRange, theme: theme)
+        }
         
         // Synchronize X-axis with main chart immediately - no async delays
         let currentMainChart = currentChartType == .line ? lineChartView : candlestickChartView
@@ -12,12 +12,18 @@ final class SegmentCell: UITableViewCell {
     private let segmentView = SegmentView()
     private let chartTypeToggle = UIButton(type: .system)
     private let landscapeToggle = UIButton(type: .system)
+    private let timeframeButton = UIButton(type: .system)
+    private var timeframeWidthConstraint: NSLayoutConstraint!
     
     // Chart type callback
     var onChartTypeToggle: ((ChartType) -> Void)?
     // Landscape toggle callback
     var onLandscapeToggle: (() -> Void)?
+    // Candle timeframe callback (derived locally, never triggers a fetch)
+    var onTimeframeSelect: ((OHLCTimeframe) -> Void)?
     private var currentChartType: ChartType = .line
+    private var availableTimeframes: [OHLCTimeframe] = [.native]
+    private var selectedTimeframe: OHLCTimeframe = .native
 
     override init(style: UITableViewCell.CellStyle, reuseIdentifier: String?) {
         super.init(style: style, reuseIdentifier: reuseIdentifier)
@@ -38,20 +44,31 @@ final class SegmentCell: UITableViewCell {
         // Setup toggle buttons
         setupChartTypeToggle()
         setupLandscapeToggle()
+        setupTimeframeButton()
         
         // Add all views to container
-        container.addSubviews(segmentView, landscapeToggle, chartTypeToggle)
+        container.addSubviews(segmentView, timeframeButton, landscapeToggle, chartTypeToggle)
         
         segmentView.translatesAutoresizingMaskIntoConstraints = false
+        timeframeButton.translatesAutoresizingMaskIntoConstraints = false
         landscapeToggle.translatesAutoresizingMaskIntoConstraints = false
         chartTypeToggle.translatesAutoresizingMaskIntoConstraints = false
         
+        // Collapsed to zero width while the selector isn't relevant (line chart / single timeframe)
+        timeframeWidthConstraint = timeframeButton.widthAnchor.constraint(equalToConstant: 0)
+        
         NSLayoutConstraint.activate([
             // Segment view - independent height, centered vertically
             segmentView.leadingAnchor.constraint(equalTo: container.leadingAnchor),
             segmentView.centerYAnchor.constraint(equalTo: container.centerYAnchor),
             segmentView.heightAnchor.constraint(equalToConstant: 36), // Smaller height for segment control
-            segmentView.trailingAnchor.constraint(equalTo: landscapeToggle.leadingAnchor, constant: -12),
+            segmentView.trailingAnchor.constraint(equalTo: timeframeButton.leadingAnchor, constant: -12),
+            
+            // Timeframe selector - collapses when hidden
+            timeframeButton.trailingAnchor.constraint(equalTo: landscapeToggle.leadingAnchor, constant: -8),
+            timeframeButton.centerYAnchor.constraint(equalTo: container.centerYAnchor),
+            timeframeButton.heightAnchor.constraint(equalToConstant: 40),
+            timeframeWidthConstraint,
             
             // Landscape toggle button - maintains 40x40 size
             landscapeToggle.trailingAnchor.constraint(equalTo: chartTypeToggle.leadingAnchor, constant: -8),
@@ -151,6 +168,40 @@ final class SegmentCell: UITableViewCell {
     
 
     
+    private func setupTimeframeButton() {
+        timeframeButton.backgroundColor = .systemGray6
+        timeframeButton.layer.cornerRadius = 12
+        timeframeButton.layer.masksToBounds = true
+        timeframeButton.titleLabel?.font = UIFont.systemFont(ofSize: 13, weight: .semibold)
+        timeframeButton.tintColor = .systemBlue
+        timeframeButton.showsMenuAsPrimaryAction = true
+        updateTimeframeButton()
+    }
+    
+    private func updateTimeframeButton() {
+        let isVisible = currentChartType == .candlestick && availableTimeframes.count > 1
+        timeframeButton.isHidden = !isVisible
+        timeframeWidthConstraint?.constant = isVisible ? 44 : 0
+        timeframeButton.setTitle(selectedTimeframe.rawValue, for: .normal)
+        
+        timeframeButton.menu = UIMenu(title: "Candle Timeframe", children: availableTimeframes.map { timeframe in
+            UIAction(title: timeframe.rawValue, state: timeframe == selectedTimeframe ? .on : .off) { [weak self] _ in
+                guard let self = self, timeframe != self.selectedTimeframe else { return }
+                self.selectedTimeframe = timeframe
+                self.updateTimeframeButton()
+                self.onTimeframeSelect?(timeframe)
+            }
+        })
+    }
+    
+    /// Updates the timeframe menu without firing the selection callback
+    func setTimeframes(_ timeframes: [OHLCTimeframe], selected: OHLCTimeframe) {
+        guard timeframes != availableTimeframes || selected != selectedTimeframe else { return }
+        availableTimeframes = timeframes
+        selectedTimeframe = selected
+        updateTimeframeButton()
+    }
+    
     @objc private func landscapeToggleTapped() {
         // Provide haptic feedback
         let impactFeedback = UIImpactFeedbackGenerator(style: .medium)
@@ -170,11 +221,12 @@ final class SegmentCell: UITableViewCell {
     }
     
     @objc private func chartTypeToggleTapped() {
-        print("🎯 Chart type toggle tapped! Current: \(currentChartType)")
+        AppLogger.chart("🎯 Chart type toggle tapped! Current: \(currentChartType)", level: .debug)
         
         // Toggle chart type
         currentChartType = currentChartType == .line ? .candlestick : .line
         updateChartTypeToggleAppearance()
+        updateTimeframeButton()
         
         // Provide haptic feedback
         let impactFeedback = UIImpactFeedbackGenerator(style: .light)
@@ -183,7 +235,7 @@ final class SegmentCell: UITableViewCell {
         // Notify callback
         onChartTypeToggle?(currentChartType)
         
-        print("🎯 Chart type toggled to: \(currentChartType)")
+        AppLogger.chart("🎯 Chart type toggled to: \(currentChartType)", level: .debug)
     }
 
 
@@ -197,6 +249,7 @@ final class SegmentCell: UITableViewCell {
         if currentChartType != chartType {
             currentChartType = chartType
             updateChartTypeToggleAppearance()
+            updateTimeframeButton()
         }
     }
     
@@ -210,6 +263,7 @@ final class SegmentCell: UITableViewCell {
         if currentChartType != chartType {
             currentChartType = chartType
             updateChartTypeToggleAppearance()
+            updateTimeframeButton()
         }
         }
     
@@ -233,6 +287,7 @@ final class SegmentCell: UITableViewCell {
         // Clean up closure properties to prevent memory leaks
         onChartTypeToggle = nil
         onLandscapeToggle = nil
+        onTimeframeSelect = nil
         AppLogger.ui("SegmentCell deinit - cleaned up closures")
     }
 }
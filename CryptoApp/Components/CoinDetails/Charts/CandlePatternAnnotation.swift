@@ -0,0 +1,52 @@
+//
+//  CandlePatternAnnotation.swift
+//  CryptoApp
+//
+
+import UIKit
+
+/**
+ * CANDLE PATTERN ANNOTATION
+ *
+ * Small tag images ("D", "H", "E", "★") attached to candlestick entries as DGCharts icons.
+ * Images are rendered once per (tag, direction) and shared by every entry.
+ */
+enum CandlePatternAnnotation {
+
+    private static var cache: [String: UIImage] = [:]
+
+    /// Icon for a candle's pattern mask, nil when the candle has no pattern (main thread)
+    static func icon(for patterns: CandlePattern) -> UIImage? {
+        guard let tag = patterns.annotationTag else { return nil }
+        let direction: Int
+        let color: UIColor
+        if !patterns.isDisjoint(with: .bullish) {
+            direction = 1
+            color = .systemGreen
+        } else if !patterns.isDisjoint(with: .bearish) {
+            direction = -1
+            color = .systemRed
+        } else {
+            direction = 0
+            color = .systemGray
+        }
+
+        let key = "\(tag)|\(direction)"
+        if let image = cache[key] {
+            return image
+        }
+
+        let attributes: [NSAttributedString.Key: Any] = [
+            .font: UIFont.systemFont(ofSize: 9, weight: .bold),
+            .foregroundColor: color
+        ]
+        let text = tag as NSString
+        let textSize = text.size(withAttributes: attributes)
+        let size = CGSize(width: ceil(textSize.width) + 4, height: ceil(textSize.height))
+        let image = UIGraphicsImageRenderer(size: size).image { _ in
+            text.draw(at: CGPoint(x: 2, y: 0), withAttributes: attributes)
+        }
+        cache[key] = image
+        return image
+    }
+}
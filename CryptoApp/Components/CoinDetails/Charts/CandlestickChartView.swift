@@ -17,6 +17,21 @@ final class CandlestickChartView: CombinedChartView {
     private var currentRange: String = "24h"
     private var visibleDataPointsCount: Int = 50
     private var currentScrollPosition: CGFloat = 0
+    // Columnar copy of allOHLCData with lazily derived Heikin-Ashi / log / percent views
+    private let candleSeries = DerivedCandleSeries()
+    // How candles are presented; switching only re-reads a (cached) derived view
+    private(set) var seriesMode: CandleSeriesMode = .standard
+    // Min/max of the displayed series (from the chart model, widened by live updates)
+    private var priceBounds: ChartModel.PriceBounds? {
+        candleSeries.bounds(for: seriesMode)
+    }
+    // Prepared data the chart was last rendered from; dropped once the series is patched in place
+    private var chartModel: ChartModel?
+    // Latest `update(_:range:)` build; older builds finishing late are discarded
+    private var modelGeneration = 0
+    private var isBuildingModel = false
+    // Pattern mask per candle (index-aligned with allOHLCData), shown as icons above the candles
+    private var candlePatterns: [CandlePattern] = []
     
     // Common chart functionality helper
     private let configurationHelper = ChartConfigurationHelper()
@@ -32,20 +47,68 @@ final class CandlestickChartView: CombinedChartView {
     // MARK: - Dynamic Value Tracking (CoinMarketCap Style)
     private var currentSMADataSet: LineChartDataSet?
     private var currentEMADataSet: LineChartDataSet?
-    private var currentRSIResult: TechnicalIndicators.RSIResult?
+    private var currentRSIDataSet: LineChartDataSet?
+    // Index-aligned indicator values (NaN warm-up) for O(1) label lookups
+    private var currentSMABuffer: TechnicalIndicators.IndicatorBuffer?
+    private var currentEMABuffer: TechnicalIndicators.IndicatorBuffer?
+    private var currentRSIBuffer: TechnicalIndicators.IndicatorBuffer?
     private var currentTechnicalSettings: TechnicalIndicators.IndicatorSettings?
     private var currentTheme: ChartColorTheme?
     
-    // Throttling for smooth scrolling
-    private var updateTimer: Timer?
-    
-    // Viewport monitoring for scroll-based updates
-    private var lastVisibleX: Double = 0
-    private var viewportMonitorTimer: Timer?
+    // Viewport tracking: pan/zoom/deceleration callbacks coalesced onto display frames, idle otherwise
+    private lazy var viewportTracker = ChartViewportTracker { [weak self] in
+        self?.handleViewportChange()
+    }
     
     // Visual indicator for monitored candlestick
     private var monitoringIndicatorView: UIView?
     
+    // X-axis label formatter, reused by full rebuilds and live appends
+    private let axisLabelFormatter: DateFormatter = {
+        let formatter = DateFormatter()
+        // Ensure formatter uses local timezone (Singapore time for this user)
+        formatter.timeZone = TimeZone.current
+        return formatter
+    }()
+    
+    // Candle entries are materialised only for the visible window plus a margin
+    private lazy var candleVirtualizer = ChartEntryVirtualizer<CandleChartDataEntry>(
+        makeEntry: { CandleChartDataEntry() },
+        configure: { [unowned self] entry, index in
+            // Candles in the current mode's value space (raw prices in standard mode)
+            let ohlc = self.candleSeries.columns(for: self.seriesMode).candle(at: index)
+            // Skip NaN candles (same filtering as the full build used to do)
+            guard ohlc.isFinite else {
+                return false
+            }
+            entry.x = Double(index)  // X-axis position
+            entry.high = ohlc.high   // Top wick
+            entry.low = ohlc.low     // Bottom wick
+            entry.open = ohlc.open   // Open Price
+            entry.close = ohlc.close // Close Price
+            entry.icon = self.seriesMode.showsPatternAnnotations
+                ? self.candlePatterns[safe: index].flatMap(CandlePatternAnnotation.icon(for:))
+                : nil
+            return true
+        }
+    )
+    
+    // Indicator overlays follow the candle window, reading values from the index-aligned buffers
+    private lazy var smaVirtualizer = makeOverlayVirtualizer { [unowned self] index in
+        self.currentSMABuffer?.value(at: index).map { self.candleSeries.displayValue(forPrice: $0, mode: self.seriesMode) }
+    }
+    private lazy var emaVirtualizer = makeOverlayVirtualizer { [unowned self] index in
+        self.currentEMABuffer?.value(at: index).map { self.candleSeries.displayValue(forPrice: $0, mode: self.seriesMode) }
+    }
+    private lazy var rsiVirtualizer = makeOverlayVirtualizer { [unowned self] index in
+        // RSI (0-100) mapped into the pane below the candles
+        guard let pane = self.rsiPane, let value = self.currentRSIBuffer?.value(at: index),
+              value >= 0 && value <= 100 else { return nil }
+        return pane.bottom + (value / 100.0) * pane.height
+    }
+    // RSI pane placement in price-axis units, set when the RSI datasets are built
+    private var rsiPane: (bottom: Double, height: Double)?
+    
     // Current price indicator (TradingView style)
     private var currentPriceLineView: UIView?
     private var currentPriceLabelView: UIView?
@@ -61,11 +124,11 @@ final class CandlestickChartView: CombinedChartView {
     
     // Public method to dismiss tooltip - called from parent view
     func dismissTooltip() {
-        print("🕯️💥 CandlestickChartView: dismissTooltip() called")
-        print("🕯️💥 Highlighted count before dismiss: \(highlighted.count)")
+        AppLogger.chart("🕯️💥 CandlestickChartView: dismissTooltip() called", level: .debug)
+        AppLogger.chart("🕯️💥 Highlighted count before dismiss: \(highlighted.count)", level: .debug)
         highlightValue(nil)
         resetToLatestValues()
-        print("🕯️💥 Highlighted count after dismiss: \(highlighted.count)")
+        AppLogger.chart("🕯️💥 Highlighted count after dismiss: \(highlighted.count)", level: .debug)
     }
     
     // MARK: - Init
@@ -124,12 +187,12 @@ final class CandlestickChartView: CombinedChartView {
         // Determine color based on price movement (bullish/bearish)
         let indicatorColor = candlestick.isBullish ? UIColor.systemGreen : UIColor.systemRed
         
-        // Convert price to Y position on chart
-        let yPosition = getYPositionForPrice(currentPrice)
+        // Convert price to Y position on chart (in the displayed mode's value space)
+        let yPosition = getYPositionForPrice(candleSeries.displayValue(forPrice: currentPrice, mode: seriesMode))
         
         // CRITICAL: Validate Y position to prevent NaN errors
         guard yPosition.isFinite else {
-            print("⚠️ Invalid yPosition in price indicator: \(yPosition) for price: \(currentPrice)")
+            AppLogger.chart("Invalid yPosition in price indicator: \(yPosition) for price: \(currentPrice)", level: .warning)
             return
         }
         
@@ -142,8 +205,7 @@ final class CandlestickChartView: CombinedChartView {
         // CRITICAL: Validate all frame values to prevent CoreGraphics errors
         guard lineStartX.isFinite && lineWidth.isFinite && lineWidth > 0 && 
               (yPosition - 0.5).isFinite else {
-            print("⚠️ Invalid frame values in price indicator")
-            print("lineStartX: \(lineStartX), lineWidth: \(lineWidth), yPosition: \(yPosition)")
+            AppLogger.chart("Invalid frame values in price indicator | lineStartX: \(lineStartX), lineWidth: \(lineWidth), yPosition: \(yPosition)", level: .warning)
             return
         }
         
@@ -168,7 +230,7 @@ final class CandlestickChartView: CombinedChartView {
         // Create the path for the line using the actual line width
         // CRITICAL: Validate lineWidth to prevent CGPath errors
         guard lineWidth.isFinite && lineWidth > 0 else {
-            print("⚠️ Invalid lineWidth in dotted line: \(lineWidth)")
+            AppLogger.chart("Invalid lineWidth in dotted line: \(lineWidth)", level: .warning)
             return
         }
         
@@ -192,7 +254,7 @@ final class CandlestickChartView: CombinedChartView {
     private func getYPositionForPrice(_ price: Double) -> CGFloat {
         // CRITICAL: Validate input price to prevent NaN propagation
         guard price.isFinite else {
-            print("⚠️ Invalid price in getYPositionForPrice: \(price)")
+            AppLogger.chart("Invalid price in getYPositionForPrice: \(price)", level: .warning)
             return contentRect.midY
         }
         
@@ -209,7 +271,7 @@ final class CandlestickChartView: CombinedChartView {
         
         // CRITICAL: Validate pixelY before using it
         guard pixelY.y.isFinite else {
-            print("⚠️ Invalid pixelY from transformer: \(pixelY) for price: \(price)")
+            AppLogger.chart("Invalid pixelY from transformer: \(pixelY) for price: \(price)", level: .warning)
             return contentRect.midY
         }
         
@@ -273,6 +335,7 @@ final class CandlestickChartView: CombinedChartView {
         doubleTapToZoomEnabled = true
         highlightPerTapEnabled = true
         highlightPerDragEnabled = true  // Enable drag highlighting for dynamic value updates
+        maxVisibleCount = 1000          // Pattern icons render for the whole virtualized window
         // Enable dynamic Y-axis autoscaling so axis adapts when zooming/panning
         autoScaleMinMaxEnabled = true
         
@@ -383,8 +446,7 @@ final class CandlestickChartView: CombinedChartView {
         guard !allOHLCData.isEmpty else { return }
         
         // Recalculate original Y-axis range
-        guard let minY = allOHLCData.map({ min($0.low, min($0.open, $0.close)) }).min(),
-              let maxY = allOHLCData.map({ max($0.high, max($0.open, $0.close)) }).max() else { return }
+        guard let minY = priceBounds?.min, let maxY = priceBounds?.max else { return }
         
         let range = maxY - minY
         let buffer = range * 0.25  // Same buffer as in updateChart
@@ -473,11 +535,9 @@ final class CandlestickChartView: CombinedChartView {
         configurationHelper.layoutHintLabel(in: bounds)
         
         // Update price indicator position when layout changes (orientation, zoom, etc.)
-        // Use a delayed update to ensure chart layout is complete
-        DispatchQueue.main.asyncAfter(deadline: .now() + 0.05) { [weak self] in
-            if let self = self, !self.allOHLCData.isEmpty {
-                self.updateValuesForVisibleRange()
-            }
+        // The update runs on the next display frame, after layout is complete
+        if !allOHLCData.isEmpty {
+            updateValuesForVisibleRange()
         }
     }
     
@@ -514,16 +574,42 @@ final class CandlestickChartView: CombinedChartView {
     
     // MARK: - Public Update Method
     
+    /// Builds the model (indicators, patterns) on ChartModel.buildQueue and renders it on the main queue
     func update(_ ohlcData: [OHLCData], range: String) {
-        guard !ohlcData.isEmpty else { 
+        modelGeneration += 1
+        let generation = modelGeneration
+        isBuildingModel = true
+        let settings = currentTechnicalSettings ?? TechnicalIndicators.loadIndicatorSettings()
+        ChartModel.buildQueue.async { [weak self] in
+            let model = ChartModel(ohlc: ohlcData, range: range, settings: settings)
+            DispatchQueue.main.async {
+                guard let self = self, generation == self.modelGeneration else { return }
+                self.update(model)
+                // Indicators requested while the model was building
+                if let settings = self.currentTechnicalSettings, let theme = self.currentTheme {
+                    self.updateWithTechnicalIndicators(settings, theme: theme)
+                }
+            }
+        }
+    }
+    
+    /// Renders the candle series of a prepared model (dates, bounds and indicator buffers are reused)
+    func update(_ model: ChartModel) {
+        // A direct model supersedes any pending `update(_:range:)` build
+        modelGeneration += 1
+        isBuildingModel = false
+        guard !model.ohlc.isEmpty else { 
             hideCurrentPriceIndicator()
             return 
         }
         
-        self.allOHLCData = ohlcData
-        self.currentRange = range
-        self.visibleDataPointsCount = ChartConfigurationHelper.calculateVisiblePoints(for: range, dataCount: ohlcData.count)
-        self.allDates = ohlcData.map { $0.timestamp }
+        self.chartModel = model
+        self.allOHLCData = model.ohlc
+        self.currentRange = model.key.range
+        self.visibleDataPointsCount = ChartConfigurationHelper.calculateVisiblePoints(for: model.key.range, dataCount: model.ohlc.count)
+        self.allDates = model.candleDates
+        self.candleSeries.reset(model.ohlc, bounds: model.candleBounds)
+        self.candlePatterns = model.patterns
         self.currentScrollPosition = 0
         
         // SWIFT BEST PRACTICE: Invalidate cache when data changes to prevent stale transformer references
@@ -532,17 +618,11 @@ final class CandlestickChartView: CombinedChartView {
         updateChart()
         
         // ENHANCEMENT: Position chart to show latest data with room to scroll past the last candlestick
-        DispatchQueue.main.asyncAfter(deadline: .now() + 0.05) { [weak self] in
-            self?.positionChartForOptimalScrolling()
-        }
-        
-        // Start viewport monitoring for scroll-based updates
-        startViewportMonitoring()
+        // (moveViewToX queues a viewport job when the chart hasn't been laid out yet)
+        positionChartForOptimalScrolling()
         
-        // Show price indicator for the rightmost visible candlestick
-        DispatchQueue.main.asyncAfter(deadline: .now() + 0.1) { [weak self] in
-            self?.updateValuesForVisibleRange()
-        }
+        // Show price indicator for the rightmost visible candlestick on the next display frame
+        updateValuesForVisibleRange()
     }
     
     // MARK: - Chart Rendering
@@ -550,74 +630,26 @@ final class CandlestickChartView: CombinedChartView {
     private func updateChart() {
         guard !allOHLCData.isEmpty, !allDates.isEmpty else { return }
         
-        // Create candlestick entries using INTEGER indices instead of timestamps, filtering out NaN values
-        let entries = allOHLCData.enumerated().compactMap { index, ohlc -> CandleChartDataEntry? in
-            // Check for NaN values in OHLC data
-            guard ohlc.open.isFinite && ohlc.high.isFinite && ohlc.low.isFinite && ohlc.close.isFinite else {
-                return nil
-            }
-            
-            return CandleChartDataEntry(x: Double(index),  // X-axis position
-                                      shadowH: ohlc.high,  // Top wick
-                                      shadowL: ohlc.low,   // Bottom wick
-                                      open: ohlc.open,     // Open Price
-                                      close: ohlc.close,   // Close Price
-                                      icon: nil)
-        }
+        // Create candlestick entries using INTEGER indices instead of timestamps, filtering out NaN values.
+        // Only the latest candles plus a margin are materialised; the window follows the viewport afterwards.
+        let lastIndex = allOHLCData.count - 1
+        let bufferCandles = max(3, allOHLCData.count / 10)
+        candleVirtualizer.reset(sourceCount: allOHLCData.count)
+        candleVirtualizer.update(visibleLower: lastIndex - max(visibleDataPointsCount, bufferCandles),
+                                 visibleUpper: lastIndex,
+                                 force: true)
+        let entries = candleVirtualizer.entries
         
         guard !entries.isEmpty else { return }
         
-        guard let minY = allOHLCData.map({ min($0.low, min($0.open, $0.close)) }).min(),
-              let maxY = allOHLCData.map({ max($0.high, max($0.open, $0.close)) }).max() else { return }
-        
-        // Setup Y-axis handling: autoscale when enabled, otherwise fixed bounds
-        if autoScaleMinMaxEnabled {
-            rightAxis.resetCustomAxisMin()
-            rightAxis.resetCustomAxisMax()
-            
-            // IMPORTANT: Set label properties for autoscale mode
-            rightAxis.labelCount = 6
-            rightAxis.forceLabelsEnabled = false
-            rightAxis.granularityEnabled = false
-            rightAxis.valueFormatter = PriceFormatter()
-            rightAxis.minWidth = 60
-        } else {
-            // Setup y-axis - main price chart only (RSI will have separate scaling)
-            let range = maxY - minY
-            // FIXED: Prevent NaN in CoreGraphics when all OHLC values are identical
-            let fallbackRange = max(abs(maxY), 1.0) * 0.01 // Fallback for zero/near-zero prices
-            let minRange = max(range, fallbackRange) // Ensure at least 1% range
-            
-            // Main chart area - price data only
-            let baseBuffer = minRange * 0.15  // Standard buffer for price context
-            
-            // Calculate axis bounds
-            var axisMin = minY - baseBuffer
-            var axisMax = maxY + baseBuffer
-            // Never show negative price on Y-axis for price section
-            if axisMin < 0 {
-                axisMin = 0
-                if axisMax <= axisMin {
-                    axisMax = axisMin + max(minRange, 1e-12)
-                }
-            }
-            
-            // CRITICAL: Validate axis values before setting to prevent NaN errors
-            guard axisMin.isFinite && axisMax.isFinite && axisMax > axisMin else {
-                print("⚠️ Invalid axis values in CandlestickChartView - skipping axis configuration")
-                print("axisMin: \(axisMin), axisMax: \(axisMax), minY: \(minY), maxY: \(maxY)")
-                return
-            }
-            
-            // Price chart axis (RSI will use separate coordinate space)
-            rightAxis.axisMinimum = axisMin
-            rightAxis.axisMaximum = axisMax
-        }
+        guard applyPriceAxisRange() else { return }
         
         let dataSet = CandleChartDataSet(entries: entries, label: "")
         
         dataSet.drawValuesEnabled = false
-        dataSet.drawIconsEnabled = false
+        // Pattern annotations are entry icons drawn just above each candle's wick
+        dataSet.drawIconsEnabled = true
+        dataSet.iconsOffset = CGPoint(x: 0, y: -8)
         
         // Set Candlestick colors - darker green, vibrant red, gray for doji
         dataSet.increasingColor = UIColor(red: 0.0, green: 0.7, blue: 0.0, alpha: 1.0)  // Dark green
@@ -645,7 +677,7 @@ final class CandlestickChartView: CombinedChartView {
         // Special handling for 24h timeframe which needs more padding
         let paddingMultiplier = currentRange == "24h" ? 1.0 : 0.5 // 100% for 24h, 50% for others
         let paddingPoints = max(Double(visibleDataPointsCount) * paddingMultiplier, 15.0) // Reduced minimum
-        let lastDataIndex = Double(entries.count - 1)
+        let lastDataIndex = Double(lastIndex)
         
         // Set X-axis range to include the padding - only at the beginning (left side - historical data)
         xAxis.axisMinimum = -paddingPoints // Allow scrolling before the first candlestick
@@ -662,31 +694,19 @@ final class CandlestickChartView: CombinedChartView {
         // Chart updated with candles
         
         // Position chart to show latest candlesticks with some scroll space
-        let lastIndex = Double(entries.count - 1)
-        
         // For small datasets, show all data centered
-        if entries.count <= 20 {
+        if allOHLCData.count <= 20 {
             fitScreen()
         } else {
             // For larger datasets, position to show latest with 10% buffer for scrolling
-            let bufferCandles = max(3.0, Double(entries.count) * 0.1)
-            moveViewToX(lastIndex - bufferCandles)
-        }
-        
-        // Create X-axis formatter for indices based on current range
-        let dateStrings = allDates.map { date in
-            let formatter = DateFormatter()
-            // Ensure formatter uses local timezone (Singapore time for this user)
-            formatter.timeZone = TimeZone.current
-            // For 24h filter, show time of day instead of date
-            if currentRange == "24h" {
-                formatter.dateFormat = "h a"  // "9 AM", "12 PM", "6 PM"
-            } else {
-                formatter.dateFormat = "MM/dd"  // "07/22", "07/23"
-            }
-            return formatter.string(from: date)
+            moveViewToX(Double(lastIndex - bufferCandles))
         }
         
+        // Create X-axis formatter for indices based on current range (one formatter for all labels)
+        // For 24h filter, show time of day instead of date
+        axisLabelFormatter.dateFormat = currentRange == "24h" ? "h a" : "MM/dd"  // "9 AM" / "07/22"
+        let dateStrings = allDates.map { axisLabelFormatter.string(from: $0) }
+        
         xAxis.valueFormatter = IndexAxisValueFormatter(values: dateStrings)
         
         // Update marker with current dates and range for proper tooltip display
@@ -694,40 +714,104 @@ final class CandlestickChartView: CombinedChartView {
             candlestickMarker.updateDates(allDates)
             candlestickMarker.updateRange(currentRange)
         }
+        updateMarkerPriceMapping()
         
         // Force chart refresh
         notifyDataSetChanged()
         invalidateIntrinsicContentSize()
         setNeedsDisplay()
         
-        // Animate chart updates with delay to ensure rendering
-        DispatchQueue.main.asyncAfter(deadline: .now() + 0.1) { [weak self] in
-            self?.animate(xAxisDuration: 0.6, yAxisDuration: 0.6, easingOption: .easeInOutQuart)
+        // Animate chart updates (the animator drives its own display link)
+        animate(xAxisDuration: 0.6, yAxisDuration: 0.6, easingOption: .easeInOutQuart)
+    }
+    
+    /// Sets the price axis range and labels for the displayed series; false when the bounds are unusable
+    @discardableResult
+    private func applyPriceAxisRange() -> Bool {
+        guard let minY = priceBounds?.min, let maxY = priceBounds?.max else { return false }
+        
+        // Setup Y-axis handling: autoscale when enabled, otherwise fixed bounds
+        if autoScaleMinMaxEnabled {
+            rightAxis.resetCustomAxisMin()
+            rightAxis.resetCustomAxisMax()
+            
+            // IMPORTANT: Set label properties for autoscale mode
+            rightAxis.labelCount = 6
+            rightAxis.forceLabelsEnabled = false
+            rightAxis.granularityEnabled = false
+            rightAxis.valueFormatter = makePriceAxisFormatter()
+            rightAxis.minWidth = 60
+        } else {
+            // Setup y-axis - main price chart only (RSI will have separate scaling)
+            let range = maxY - minY
+            // FIXED: Prevent NaN in CoreGraphics when all OHLC values are identical
+            let fallbackRange = max(abs(maxY), 1.0) * 0.01 // Fallback for zero/near-zero prices
+            let minRange = max(range, fallbackRange) // Ensure at least 1% range
+            
+            // Main chart area - price data only
+            let baseBuffer = minRange * 0.15  // Standard buffer for price context
+            
+            // Calculate axis bounds
+            var axisMin = minY - baseBuffer
+            var axisMax = maxY + baseBuffer
+            // Never show negative price on Y-axis for price section (log/percent values can be negative)
+            if axisMin < 0 && !seriesMode.allowsNegativeValues {
+                axisMin = 0
+                if axisMax <= axisMin {
+                    axisMax = axisMin + max(minRange, 1e-12)
+                }
+            }
+            
+            // CRITICAL: Validate axis values before setting to prevent NaN errors
+            guard axisMin.isFinite && axisMax.isFinite && axisMax > axisMin else {
+                AppLogger.chart("Invalid axis values in CandlestickChartView - skipping axis configuration | axisMin: \(axisMin), axisMax: \(axisMax), minY: \(minY), maxY: \(maxY)", level: .warning)
+                return false
+            }
+            
+            // Price chart axis (RSI will use separate coordinate space)
+            rightAxis.axisMinimum = axisMin
+            rightAxis.axisMaximum = axisMax
+            rightAxis.valueFormatter = makePriceAxisFormatter()
+        }
+        return true
+    }
+    
+    /// Price labels for the current series mode (log and percent values are mapped back to prices / shown as %)
+    private func makePriceAxisFormatter() -> AxisValueFormatter {
+        switch seriesMode {
+        case .standard, .heikinAshi:
+            return PriceFormatter()
+        case .logarithmic:
+            return LogPriceFormatter()
+        case .percentFromStart:
+            return PercentChangeFormatter()
         }
     }
     
     // MARK: - External Scrolling Helpers
     
+    // NOTE: Bounds come from allOHLCData, not `data`, which only holds the virtualized window
+    
     func scrollToLatest() {
-        guard let data = data else { return }
-        moveViewToX(data.xMax)
+        guard data != nil, !allOHLCData.isEmpty else { return }
+        moveViewToX(Double(allOHLCData.count - 1))
+        refreshVirtualWindow()
     }
     
     func scrollToOldest() {
-        guard let data = data else { return }
-        moveViewToX(data.xMin)
+        guard data != nil, !allOHLCData.isEmpty else { return }
+        moveViewToX(0)
+        refreshVirtualWindow()
     }
     
     func scrollBy(points: Int) {
-        guard let data = data else { return }
+        guard data != nil, !allOHLCData.isEmpty else { return }
+        // X values are candle indices, so one point is one unit
         let currentCenterX = (lowestVisibleX + highestVisibleX) / 2
-        let dataRange = data.xMax - data.xMin
-        let pointWidth = dataRange / Double(allOHLCData.count)
-        let offsetX = Double(points) * pointWidth
-        
-        let newCenterX = currentCenterX + offsetX
-        let clampedX = max(data.xMin, min(data.xMax, newCenterX))
+        let newCenterX = currentCenterX + Double(points)
+        let clampedX = max(0, min(Double(allOHLCData.count - 1), newCenterX))
         moveViewToX(clampedX)
+        refreshVirtualWindow()
     }
     
     // MARK: - Dynamic Value Updates (CoinMarketCap Style)
@@ -740,9 +824,9 @@ final class CandlestickChartView: CombinedChartView {
         
         labelManager.updateLabelsAtPosition(
             xIndex: xIndex,
-            smaDataSet: currentSMADataSet,
-            emaDataSet: currentEMADataSet,
-            rsiResult: currentRSIResult,
+            sma: currentSMABuffer,
+            ema: currentEMABuffer,
+            rsi: currentRSIBuffer,
             settings: settings,
             theme: theme
         )
@@ -759,25 +843,17 @@ final class CandlestickChartView: CombinedChartView {
         
         labelManager.updateLabelsAtPosition(
             xIndex: lastIndex,
-            smaDataSet: currentSMADataSet,
-            emaDataSet: currentEMADataSet,
-            rsiResult: currentRSIResult,
+            sma: currentSMABuffer,
+            ema: currentEMABuffer,
+            rsi: currentRSIBuffer,
             settings: settings,
             theme: theme
         )
     }
     
-    /// Updates indicator values based on the current visible range (optimized)
+    /// Updates indicator values based on the current visible range (coalesced to the next display frame)
     private func updateValuesForVisibleRange() {
-        // SWIFT BEST PRACTICE: Use DispatchQueue for better performance than Timer
-        // Debounce rapid calls using work items
-        updateTimer?.invalidate()
-        
-        let workItem = DispatchWorkItem { [weak self] in
-            self?.performVisibleRangeUpdate()
-        }
-        
-        DispatchQueue.main.asyncAfter(deadline: .now() + 0.05, execute: workItem)
+        viewportTracker.viewportDidChange()
     }
     
     private func performVisibleRangeUpdate() {
@@ -800,13 +876,11 @@ final class CandlestickChartView: CombinedChartView {
               let settings = currentTechnicalSettings,
               let theme = currentTheme else { return }
         
-        // Extract closing prices for data count check
-        let closingPrices = allOHLCData.map { $0.close }
-        
         // Check if we have enough data for any enabled indicators
-        let hasEnoughDataForSMA = settings.showSMA && closingPrices.count >= settings.smaPeriod
-        let hasEnoughDataForEMA = settings.showEMA && closingPrices.count >= settings.emaPeriod
-        let hasEnoughDataForRSI = settings.showRSI && closingPrices.count >= (settings.rsiPeriod + 1)
+        let dataCount = allOHLCData.count
+        let hasEnoughDataForSMA = settings.showSMA && dataCount >= settings.smaPeriod
+        let hasEnoughDataForEMA = settings.showEMA && dataCount >= settings.emaPeriod
+        let hasEnoughDataForRSI = settings.showRSI && dataCount >= (settings.rsiPeriod + 1)
         
         // If no indicators have enough data, skip position updates to preserve the "Need more data" messages
         guard hasEnoughDataForSMA || hasEnoughDataForEMA || hasEnoughDataForRSI else { return }
@@ -814,9 +888,9 @@ final class CandlestickChartView: CombinedChartView {
         // Update labels with values at this position
         labelManager.updateLabelsAtPosition(
             xIndex: targetIndex,
-            smaDataSet: currentSMADataSet,
-            emaDataSet: currentEMADataSet,
-            rsiResult: currentRSIResult,
+            sma: currentSMABuffer,
+            ema: currentEMABuffer,
+            rsi: currentRSIBuffer,
             settings: settings,
             theme: theme,
             dataPointCount: allOHLCData.count
@@ -827,12 +901,14 @@ final class CandlestickChartView: CombinedChartView {
     
     /// Scrolls the chart to show the latest (most recent) data
     private func scrollToLatestData() {
-        guard let data = data else { return }
+        guard data != nil, !allOHLCData.isEmpty else { return }
         
         // Move to the rightmost position (latest data) like ChartView does
-        moveViewToX(data.xMax)
+        let lastIndex = Double(allOHLCData.count - 1)
+        moveViewToX(lastIndex)
+        refreshVirtualWindow()
         
-        print("📍 Auto-scrolled to latest data at position \(data.xMax)")
+        AppLogger.chart("📍 Auto-scrolled to latest data at position \(lastIndex)", level: .debug)
     }
     
     /// Positions the chart optimally to show the latest data while allowing scrolling past the last candlestick
@@ -849,8 +925,60 @@ final class CandlestickChartView: CombinedChartView {
         let targetPosition = lastCandlestickIndex - (visibleRange * 0.3)
         
         moveViewToX(max(0, targetPosition))
+        refreshVirtualWindow()
         
-        print("📍 Positioned chart at \(targetPosition) to show last candlestick with significant scroll room")
+        AppLogger.chart("📍 Positioned chart at \(targetPosition) to show last candlestick with significant scroll room", level: .debug)
+    }
+    
+    // MARK: - Entry Virtualization
+    
+    /// Main candlestick dataset (inside CombinedChartData once indicators are applied)
+    private var mainCandleDataSet: CandleChartDataSet? {
+        if let combined = data as? CombinedChartData {
+            return combined.candleData?.dataSets.first as? CandleChartDataSet
+        }
+        return data?.dataSets.first as? CandleChartDataSet
+    }
+    
+    private func makeOverlayVirtualizer(_ value: @escaping (Int) -> Double?) -> ChartEntryVirtualizer<ChartDataEntry> {
+        ChartEntryVirtualizer(
+            makeEntry: { ChartDataEntry() },
+            configure: { entry, index in
+                // Warm-up (NaN) points are not drawn
+                guard let y = value(index), y.isFinite else { return false }
+                entry.x = Double(index)
+                entry.y = y
+                return true
+            }
+        )
+    }
+    
+    /// Points an overlay virtualizer at a freshly computed buffer and materialises the candle window
+    private func overlayEntries(_ virtualizer: ChartEntryVirtualizer<ChartDataEntry>,
+                                count: Int) -> [ChartDataEntry] {
+        virtualizer.reset(sourceCount: count)
+        virtualizer.follow(candleVirtualizer.window)
+        return virtualizer.entries
+    }
+    
+    /// Slides the materialised candle window to follow the viewport; a no-op while it still covers it
+    private func refreshVirtualWindow() {
+        guard !allOHLCData.isEmpty,
+              let dataSet = mainCandleDataSet,
+              lowestVisibleX.isFinite, highestVisibleX.isFinite else { return }
+        
+        let changed = candleVirtualizer.update(visibleLower: Int(lowestVisibleX.rounded(.down)),
+                                               visibleUpper: Int(highestVisibleX.rounded(.up)))
+        guard changed else { return }
+        
+        // Same dataset object, new entries: X-axis bounds are fixed so the viewport doesn't move
+        dataSet.replaceEntries(candleVirtualizer.entries)
+        let overlays = [(currentSMADataSet, smaVirtualizer), (currentEMADataSet, emaVirtualizer), (currentRSIDataSet, rsiVirtualizer)]
+        for case let (overlay?, virtualizer) in overlays where virtualizer.follow(candleVirtualizer.window) {
+            overlay.replaceEntries(virtualizer.entries)
+        }
+        data?.notifyDataChanged()
+        notifyDataSetChanged()
     }
     
     // MARK: - View Lifecycle
@@ -858,10 +986,8 @@ final class CandlestickChartView: CombinedChartView {
     override func willMove(toWindow newWindow: UIWindow?) {
         super.willMove(toWindow: newWindow)
         if newWindow == nil {
-            // View is being removed from window, stop monitoring
-            stopViewportMonitoring()
-            updateTimer?.invalidate()
-            updateTimer = nil
+            // View is being removed from window, stop tracking
+            viewportTracker.stop()
         }
     }
     
@@ -869,50 +995,17 @@ final class CandlestickChartView: CombinedChartView {
         super.didMoveToWindow()
         if window == nil {
             // Ensure cleanup when view is removed from window
-            stopViewportMonitoring()
-            updateTimer?.invalidate()
-            updateTimer = nil
-        }
-    }
-    
-    // MARK: - Viewport Monitoring for Scroll-Based Updates
-    
-    /// Starts monitoring viewport changes for automatic value updates
-    private func startViewportMonitoring() {
-        stopViewportMonitoring()
-        lastVisibleX = highestVisibleX
-        
-        // Only start monitoring if view is in window hierarchy
-        guard window != nil else { return }
-        
-        // print("🚀 CandlestickChart: Starting viewport monitoring from position \(lastVisibleX)")
-        
-        viewportMonitorTimer = Timer.scheduledTimer(withTimeInterval: 0.05, repeats: true) { [weak self] timer in
-            guard let self = self, self.window != nil else {
-                timer.invalidate()
-                return
-            }
-            self.checkViewportChanges()
+            viewportTracker.stop()
         }
     }
     
-    /// Stops viewport monitoring
-    private func stopViewportMonitoring() {
-        viewportMonitorTimer?.invalidate()
-        viewportMonitorTimer = nil
-    }
+    // MARK: - Viewport Tracking for Scroll-Based Updates
     
-    /// Checks if viewport has changed and updates values accordingly
-    private func checkViewportChanges() {
-        let currentVisibleX = highestVisibleX
-        
-        // Check if viewport has changed significantly (more than 0.1 data points for more responsive updates)
-        if abs(currentVisibleX - lastVisibleX) > 0.1 {
-            lastVisibleX = currentVisibleX
-            
-            // Update all indicators (including price indicator) together
-            updateValuesForVisibleRange()
-        }
+    /// Runs at most once per display frame while the viewport is moving (see ChartViewportTracker)
+    private func handleViewportChange() {
+        // Keep materialised candles ahead of the viewport, then update all indicators together
+        refreshVirtualWindow()
+        performVisibleRangeUpdate()
     }
     
     // MARK: - Visual Monitoring Indicator
@@ -964,10 +1057,7 @@ final class CandlestickChartView: CombinedChartView {
     }
     
     deinit {
-        // Clean up all timers and resources
-        stopViewportMonitoring()
-        updateTimer?.invalidate()
-        updateTimer = nil
+        // Clean up resources (viewportTracker invalidates its display link on deinit)
         
         // Clean up visual indicator
         monitoringIndicatorView?.removeFromSuperview()
@@ -976,7 +1066,10 @@ final class CandlestickChartView: CombinedChartView {
         // Clear stored references
         currentSMADataSet = nil
         currentEMADataSet = nil
-        currentRSIResult = nil
+        currentRSIDataSet = nil
+        currentSMABuffer = nil
+        currentEMABuffer = nil
+        currentRSIBuffer = nil
         currentTechnicalSettings = nil
         currentTheme = nil
         labelManager = nil
@@ -1024,21 +1117,19 @@ extension CandlestickChartView: ChartViewDelegate {
         
         // Calculate visible candles for user feedback
         let visibleCandles = Int(highestVisibleX - lowestVisibleX) + 1
-        print("🔍 Zoom detected - ScaleX: \(scaleX), ScaleY: \(scaleY), Visible candles: \(visibleCandles)")
+        AppLogger.chart("🔍 Zoom detected - ScaleX: \(scaleX), ScaleY: \(scaleY), Visible candles: \(visibleCandles)", level: .debug)
         
-        // Update price indicator and labels immediately when zoom level changes
-        // The new screen-based calculation is zoom-independent and doesn't need delays
-        updateValuesForVisibleRange()
+        // Zooming can uncover candles outside the materialised window; virtual window, price
+        // indicator and labels update together on the next display frame
+        viewportTracker.viewportDidChange()
     }
     
     func chartTranslated(_ chartView: ChartViewBase, dX: CGFloat, dY: CGFloat) {
         // Handle chart panning while zoomed
         // This ensures smooth interaction between zoom and pan
         
-        // Price indicator updates are now integrated into updateValuesForVisibleRange()
-        
-        // Update indicator values based on current visible range
-        updateValuesForVisibleRange()
+        // Fires per pan and per deceleration step; coalesced to one update per display frame
+        viewportTracker.viewportDidChange()
     }
     
     func chartViewDidEndPanning(_ chartView: ChartViewBase) {
@@ -1071,10 +1162,210 @@ extension CandlestickChartView: ChartViewDelegate {
     }
 }
 
+// MARK: - Incremental Updates
+
+extension CandlestickChartView {
+    
+    /**
+     * Appends one candle without rebuilding the chart.
+     * - Only the new entry is materialised (if the virtual window reaches the end)
+     * - SMA/EMA overlays get one new point each (O(period) / O(1))
+     * - The fixed price axis is widened only if the candle escapes it
+     * Returns false when there is no chart to extend; callers then fall back to `update(_:range:)`.
+     */
+    @discardableResult
+    func appendCandle(_ candle: OHLCData) -> Bool {
+        guard !allOHLCData.isEmpty, let dataSet = mainCandleDataSet else { return false }
+        
+        // Follow the live edge only if the user is already looking at it
+        let wasAtLatest = highestVisibleX >= Double(allOHLCData.count - 1) - 0.5
+        
+        allOHLCData.append(candle)
+        allDates.append(candle.timestamp)
+        candleSeries.append(candle)  // Widens the bounds and patches cached derived views in O(1)
+        chartModel = nil
+        candlePatterns.append(CandlePatternScanner.scanLast(allOHLCData))
+        let index = allOHLCData.count - 1
+        
+        if let entry = candleVirtualizer.appendSource() {
+            dataSet.append(entry)  // Updates dataset min/max for this entry only
+        }
+        
+        xAxis.axisMaximum = Double(index)
+        (xAxis.valueFormatter as? IndexAxisValueFormatter)?.values.append(axisLabelFormatter.string(from: candle.timestamp))
+        (marker as? CandlestickBalloonMarker)?.updateDates(allDates)
+        
+        let needsIndicatorRebuild = updateIndicatorOverlays(at: index, appended: true)
+        expandPriceAxisIfNeeded(at: index)
+        
+        data?.notifyDataChanged()
+        notifyDataSetChanged()  // X-axis extent changed
+        if wasAtLatest {
+            moveViewToX(lowestVisibleX + 1)
+        }
+        finishIncrementalUpdate(rebuildIndicators: needsIndicatorRebuild)
+        return true
+    }
+    
+    /**
+     * Replaces the last (still forming) candle in place.
+     * Redraws without re-laying out the chart unless the price axis had to grow.
+     */
+    @discardableResult
+    func replaceLastCandle(_ candle: OHLCData) -> Bool {
+        guard let index = allOHLCData.indices.last, let dataSet = mainCandleDataSet else { return false }
+        
+        allOHLCData[index] = candle
+        allDates[index] = candle.timestamp
+        candleSeries.replaceLast(candle)
+        chartModel = nil
+        if candlePatterns.indices.contains(index) {
+            candlePatterns[index] = CandlePatternScanner.scanLast(allOHLCData)
+        }
+        
+        if candleVirtualizer.refreshSource(at: index) != nil {
+            dataSet.notifyDataSetChanged()  // Min/max over the materialised window only
+        }
+        
+        let needsIndicatorRebuild = updateIndicatorOverlays(at: index, appended: false)
+        if expandPriceAxisIfNeeded(at: index) {
+            data?.notifyDataChanged()
+            notifyDataSetChanged()
+        } else {
+            data?.notifyDataChanged()
+            setNeedsDisplay()
+        }
+        finishIncrementalUpdate(rebuildIndicators: needsIndicatorRebuild)
+        return true
+    }
+    
+    /**
+     * Extends or rewrites the SMA/EMA value at `index` (label buffer and overlay) from the closes.
+     * Returns true when an overlay can't be updated in place (RSI, which is mapped into the
+     * price pane and needs the full Wilder state) and indicators must be rebuilt.
+     */
+    private func updateIndicatorOverlays(at index: Int, appended: Bool) -> Bool {
+        guard let settings = currentTechnicalSettings else { return false }
+        
+        if settings.showSMA, currentSMABuffer != nil {
+            let period = settings.smaPeriod
+            var value: Double?
+            if index >= period - 1 {
+                let sum = allOHLCData[(index - period + 1)...index].reduce(0) { $0 + $1.close }
+                value = sum / Double(period)
+            }
+            if appended {
+                currentSMABuffer?.append(value)
+            } else {
+                currentSMABuffer?.replaceLast(value)
+            }
+            if let sma = currentSMADataSet {
+                updateOverlay(sma, through: smaVirtualizer, at: index, appended: appended)
+            }
+        }
+        
+        if settings.showEMA, currentEMABuffer != nil {
+            // EMA(t) = close × k + EMA(t-1) × (1 - k), with EMA(t-1) read from the index-aligned buffer
+            let period = settings.emaPeriod
+            let multiplier = 2.0 / Double(period + 1)
+            var value: Double?
+            if let previous = currentEMABuffer?.value(at: index - 1) {
+                value = allOHLCData[index].close * multiplier + previous * (1 - multiplier)
+            } else if index == period - 1 {
+                // First defined EMA is seeded with the SMA, as in calculateEMA
+                value = allOHLCData[0...index].reduce(0) { $0 + $1.close } / Double(period)
+            }
+            if appended {
+                currentEMABuffer?.append(value)
+            } else {
+                currentEMABuffer?.replaceLast(value)
+            }
+            if let ema = currentEMADataSet {
+                updateOverlay(ema, through: emaVirtualizer, at: index, appended: appended)
+            }
+        }
+        
+        return settings.showRSI
+    }
+    
+    /// Mirrors a buffer change at `index` into the overlay's materialised window
+    private func updateOverlay(_ dataSet: LineChartDataSet, through virtualizer: ChartEntryVirtualizer<ChartDataEntry>,
+                               at index: Int, appended: Bool) {
+        if appended {
+            if let entry = virtualizer.appendSource() {
+                dataSet.append(entry)
+            }
+        } else if virtualizer.refreshSource(at: index) != nil {
+            dataSet.notifyDataSetChanged()
+        }
+    }
+    
+    /// Widens a fixed price axis to the displayed candle at `index`; true when the axis changed
+    @discardableResult
+    private func expandPriceAxisIfNeeded(at index: Int) -> Bool {
+        let displayed = candleSeries.columns(for: seriesMode).candle(at: index)
+        return ChartConfigurationHelper.expandAxisIfNeeded(rightAxis, low: displayed.low, high: displayed.high,
+                                                          allowsNegative: seriesMode.allowsNegativeValues)
+    }
+    
+    private func finishIncrementalUpdate(rebuildIndicators: Bool) {
+        if rebuildIndicators, let settings = currentTechnicalSettings, let theme = currentTheme {
+            updateWithTechnicalIndicators(settings, theme: theme)
+        } else {
+            updateValuesForVisibleRange()
+        }
+    }
+}
+
 // MARK: - Chart Settings Support
 
 extension CandlestickChartView {
     
+    /**
+     * Switches how candles are presented (standard, Heikin-Ashi, log, percent-from-start).
+     * Only the materialised window is re-read from the derived view (built once, then cached)
+     * and the price axis re-ranged; candles, dates, patterns and the viewport are kept.
+     */
+    func setSeriesMode(_ mode: CandleSeriesMode) {
+        guard mode != seriesMode else { return }
+        seriesMode = mode
+        guard !allOHLCData.isEmpty, let dataSet = mainCandleDataSet else { return }
+        
+        let lastIndex = allOHLCData.count - 1
+        let lower = lowestVisibleX.isFinite ? Int(lowestVisibleX.rounded(.down)) : lastIndex - visibleDataPointsCount
+        let upper = highestVisibleX.isFinite ? Int(highestVisibleX.rounded(.up)) : lastIndex
+        candleVirtualizer.reset(sourceCount: allOHLCData.count)
+        candleVirtualizer.update(visibleLower: lower, visibleUpper: upper, force: true)
+        dataSet.replaceEntries(candleVirtualizer.entries)
+        
+        applyPriceAxisRange()
+        updateMarkerPriceMapping()
+        cachedRightAxisTransformer = nil
+        
+        if let settings = currentTechnicalSettings, let theme = currentTheme {
+            // Overlays and the RSI pane live in the price axis' value space, so they follow the mode
+            updateWithTechnicalIndicators(settings, theme: theme)
+        } else {
+            data?.notifyDataChanged()
+            notifyDataSetChanged()
+            updateValuesForVisibleRange()
+        }
+    }
+    
+    /// Tooltips show prices for log / percent candles; Heikin-Ashi values are shown as drawn
+    private func updateMarkerPriceMapping() {
+        guard let candlestickMarker = marker as? CandlestickBalloonMarker else { return }
+        let mode = seriesMode
+        switch mode {
+        case .standard, .heikinAshi:
+            candlestickMarker.updatePriceMapping(nil)
+        case .logarithmic, .percentFromStart:
+            candlestickMarker.updatePriceMapping { [candleSeries] value in
+                candleSeries.price(forDisplayValue: value, mode: mode)
+            }
+        }
+    }
+    
     func updateLineThickness(_ thickness: CGFloat) {
         // Combined charts can wrap candle data inside CombinedChartData
         var candleDataSet: CandleChartDataSet?
@@ -1100,14 +1391,15 @@ extension CandlestickChartView {
         // Restore previous matrix precisely (no extra zoom)
         _ = viewPortHandler.refresh(newMatrix: savedMatrix, chart: self, invalidate: true)
         // Clamp viewport if restored window is invalid
-        if let d = data {
-            let minX = d.xMin
-            let maxX = d.xMax
+        if data != nil, !allOHLCData.isEmpty {
+            let minX = 0.0
+            let maxX = Double(allOHLCData.count - 1)
             let low = lowestVisibleX
             let high = highestVisibleX
             if !low.isFinite || !high.isFinite || high <= minX || low >= maxX {
                 let center = (minX + maxX) / 2
                 moveViewToX(center)
+                refreshVirtualWindow()
             }
         }
         setNeedsDisplay()
@@ -1161,14 +1453,15 @@ extension CandlestickChartView {
         notifyDataSetChanged()
         // Restore previous matrix precisely (no extra zoom) and clamp if needed
         _ = viewPortHandler.refresh(newMatrix: savedMatrix, chart: self, invalidate: true)
-        if let d = data {
-            let minX = d.xMin
-            let maxX = d.xMax
+        if data != nil, !allOHLCData.isEmpty {
+            let minX = 0.0
+            let maxX = Double(allOHLCData.count - 1)
             let low = lowestVisibleX
             let high = highestVisibleX
             if !low.isFinite || !high.isFinite || high <= minX || low >= maxX {
                 let center = (minX + maxX) / 2
                 moveViewToX(center)
+                refreshVirtualWindow()
             }
         }
         setNeedsDisplay()
@@ -1191,21 +1484,16 @@ extension CandlestickChartView {
     
     /// Updates chart with technical indicators overlays
     func updateWithTechnicalIndicators(_ settings: TechnicalIndicators.IndicatorSettings, theme: ChartColorTheme = .classic) {
-        guard !allOHLCData.isEmpty else { 
-            // Cannot apply technical indicators - no OHLC data
+        guard !allOHLCData.isEmpty, !isBuildingModel else { 
+            // Remembered and applied once the candles (or the pending model) are in place
+            currentTechnicalSettings = settings
+            currentTheme = theme
             return 
         }
         
-        // Apply technical indicators
-        
-        // DEBUG: Log price range for normalization
-        let allPrices = allOHLCData.flatMap { [$0.open, $0.high, $0.low, $0.close] }
-        if let _ = allPrices.min(), let _ = allPrices.max() {
-            // Price range calculated but unused
-        }
-        
-        // Extract closing prices for indicator calculations
-        let closingPrices = allOHLCData.map { $0.close }
+        // Prepared closes/buffers from the chart model when it still describes the displayed series
+        let model = chartModel
+        let closingPrices = model?.closes ?? allOHLCData.map { $0.close }
         
         // Get existing candlestick data - handle both CombinedChartData and direct access
         guard let existingData = data else { 
@@ -1243,18 +1531,29 @@ extension CandlestickChartView {
         // Store data sets for label updates
         var smaDataSet: LineChartDataSet?
         var emaDataSet: LineChartDataSet?
-        var rsiResult: TechnicalIndicators.RSIResult?
+        var rsiDataSet: LineChartDataSet?
+        var smaBuffer: TechnicalIndicators.IndicatorBuffer?
+        var emaBuffer: TechnicalIndicators.IndicatorBuffer?
+        var rsiBuffer: TechnicalIndicators.IndicatorBuffer?
         
         // Add moving averages if enabled
         if settings.showSMA {
-            smaDataSet = createSMADataSet(prices: closingPrices, period: settings.smaPeriod, theme: theme)
+            let buffer = model?.smaBuffer(for: settings)
+                ?? TechnicalIndicators.IndicatorBuffer(TechnicalIndicators.calculateSMA(prices: closingPrices, period: settings.smaPeriod))
+            smaBuffer = buffer
+            currentSMABuffer = buffer  // Read by smaVirtualizer
+            smaDataSet = createSMADataSet(from: buffer, theme: theme)
             if let sma = smaDataSet {
                 lineDataSets.append(sma)
             }
         }
         
         if settings.showEMA {
-            emaDataSet = createEMADataSet(prices: closingPrices, period: settings.emaPeriod, theme: theme)
+            let buffer = model?.emaBuffer(for: settings)
+                ?? TechnicalIndicators.IndicatorBuffer(TechnicalIndicators.calculateEMA(prices: closingPrices, period: settings.emaPeriod))
+            emaBuffer = buffer
+            currentEMABuffer = buffer  // Read by emaVirtualizer
+            emaDataSet = createEMADataSet(from: buffer, theme: theme)
             if let ema = emaDataSet {
                 lineDataSets.append(ema)
             }
@@ -1262,8 +1561,12 @@ extension CandlestickChartView {
         
         // Add RSI if enabled (with reference lines)
         if settings.showRSI {
-            rsiResult = TechnicalIndicators.calculateRSI(prices: closingPrices, period: settings.rsiPeriod)
-            let rsiDataSets = createRSIDataSets(prices: closingPrices, settings: settings, theme: theme)
+            let buffer = model?.rsiBuffer(for: settings)
+                ?? TechnicalIndicators.IndicatorBuffer(TechnicalIndicators.calculateRSI(prices: closingPrices, period: settings.rsiPeriod))
+            rsiBuffer = buffer
+            currentRSIBuffer = buffer  // Read by rsiVirtualizer
+            let rsiDataSets = createRSIDataSets(from: buffer, settings: settings, theme: theme)
+            rsiDataSet = rsiDataSets.first
             // SAFETY: Only append if we have valid data sets
             if !rsiDataSets.isEmpty {
                 lineDataSets.append(contentsOf: rsiDataSets)
@@ -1273,14 +1576,20 @@ extension CandlestickChartView {
         // Store current data for dynamic updates
         currentSMADataSet = smaDataSet
         currentEMADataSet = emaDataSet
-        currentRSIResult = rsiResult
+        currentRSIDataSet = rsiDataSet
+        currentSMABuffer = smaBuffer
+        currentEMABuffer = emaBuffer
+        currentRSIBuffer = rsiBuffer
         currentTechnicalSettings = settings
         currentTheme = theme
         
         // FIXED: Now using CombinedChartView - we can properly display technical indicators!
         if !lineDataSets.isEmpty {
             // SAFETY: Validate all data sets have entries before creating LineChartData
-            let validDataSets = lineDataSets.filter { !$0.entries.isEmpty }
+            // (overlays may be empty while the window sits in their warm-up; they fill in as it slides)
+            let validDataSets = lineDataSets.filter {
+                !$0.entries.isEmpty || $0 === smaDataSet || $0 === emaDataSet || $0 === rsiDataSet
+            }
             if !validDataSets.isEmpty {
                 combinedData.lineData = LineChartData(dataSets: validDataSets)
                 // Technical indicators applied
@@ -1297,7 +1606,7 @@ extension CandlestickChartView {
         let wasZoomed = abs(savedScaleX - 1.0) > 0.01 || abs(savedScaleY - 1.0) > 0.01
 
         // FORCE CHART REFRESH: Ensure everything happens on main thread
-        DispatchQueue.main.async { [weak self, smaDataSet, emaDataSet, rsiResult, settings, theme, savedScaleX, savedScaleY, savedCenterX, savedCenterY, wasZoomed] in
+        DispatchQueue.main.async { [weak self, smaBuffer, emaBuffer, rsiBuffer, settings, theme, savedScaleX, savedScaleY, savedCenterX, savedCenterY, wasZoomed] in
             guard let self = self else { return }
             
             // Apply the combined data (candlesticks + technical indicators)
@@ -1323,9 +1632,9 @@ extension CandlestickChartView {
             
             // Update labels with current values
             self.labelManager?.updateAllLabels(
-                smaDataSet: smaDataSet,
-                emaDataSet: emaDataSet,
-                rsiResult: rsiResult,
+                sma: smaBuffer,
+                ema: emaBuffer,
+                rsi: rsiBuffer,
                 settings: settings,
                 theme: theme,
                 rsiAreaTop: rsiAreaTop,
@@ -1334,35 +1643,22 @@ extension CandlestickChartView {
             )
             
             // Maintain current viewport if the user was zoomed; otherwise keep existing UX
-            DispatchQueue.main.asyncAfter(deadline: .now() + 0.1) {
-                if wasZoomed {
-                    // When zoomed, do not auto-scroll; just update labels for current view
-                    self.updateValuesForVisibleRange()
-                } else {
-                    // Not zoomed: keep previous behavior of showing latest and monitoring
-                    self.scrollToLatestData()
-                    self.updateValuesForVisibleRange()
-                    self.startViewportMonitoring()
-                }
+            // When zoomed, do not auto-scroll; labels follow the current view on the next frame
+            if !wasZoomed {
+                self.scrollToLatestData()
             }
+            self.updateValuesForVisibleRange()
             
             // Chart refreshed with technical indicators
         }
     }
     
-    private func createSMADataSet(prices: [Double], period: Int, theme: ChartColorTheme) -> LineChartDataSet? {
-        let smaResult = TechnicalIndicators.calculateSMA(prices: prices, period: period)
-        
-        let entries = smaResult.values.enumerated().compactMap { index, value -> ChartDataEntry? in
-            guard let value = value else { return nil }
-            // Additional NaN check for safety
-            guard value.isFinite else { return nil }
-            return ChartDataEntry(x: Double(index), y: value)
-        }
-        
-        guard !entries.isEmpty else { return nil }
+    private func createSMADataSet(from buffer: TechnicalIndicators.IndicatorBuffer, theme: ChartColorTheme) -> LineChartDataSet? {
+        // Only the candle window is materialised; the overlay follows it as the viewport moves
+        let entries = overlayEntries(smaVirtualizer, count: buffer.count)
+        guard buffer.firstValidIndex != nil else { return nil }
         
-        let dataSet = LineChartDataSet(entries: entries, label: "SMA(\(period))")
+        let dataSet = LineChartDataSet(entries: entries, label: "SMA(\(buffer.period))")
         dataSet.setColor(TechnicalIndicators.getIndicatorColor(for: "sma", theme: theme))
         dataSet.lineWidth = 1.5
         dataSet.drawCirclesEnabled = false
@@ -1373,19 +1669,12 @@ extension CandlestickChartView {
         return dataSet
     }
     
-    private func createEMADataSet(prices: [Double], period: Int, theme: ChartColorTheme) -> LineChartDataSet? {
-        let emaResult = TechnicalIndicators.calculateEMA(prices: prices, period: period)
-        
-        let entries = emaResult.values.enumerated().compactMap { index, value -> ChartDataEntry? in
-            guard let value = value else { return nil }
-            // Additional NaN check for safety
-            guard value.isFinite else { return nil }
-            return ChartDataEntry(x: Double(index), y: value)
-        }
-        
-        guard !entries.isEmpty else { return nil }
+    private func createEMADataSet(from buffer: TechnicalIndicators.IndicatorBuffer, theme: ChartColorTheme) -> LineChartDataSet? {
+        // Only the candle window is materialised; the overlay follows it as the viewport moves
+        let entries = overlayEntries(emaVirtualizer, count: buffer.count)
+        guard buffer.firstValidIndex != nil else { return nil }
         
-        let dataSet = LineChartDataSet(entries: entries, label: "EMA(\(period))")
+        let dataSet = LineChartDataSet(entries: entries, label: "EMA(\(buffer.period))")
         dataSet.setColor(TechnicalIndicators.getIndicatorColor(for: "ema", theme: theme))
         dataSet.lineWidth = 1.5
         dataSet.drawCirclesEnabled = false
@@ -1398,23 +1687,20 @@ extension CandlestickChartView {
     
 
     
-    private func createRSIDataSets(prices: [Double], settings: TechnicalIndicators.IndicatorSettings, theme: ChartColorTheme) -> [LineChartDataSet] {
+    private func createRSIDataSets(from rsi: TechnicalIndicators.IndicatorBuffer, settings: TechnicalIndicators.IndicatorSettings, theme: ChartColorTheme) -> [LineChartDataSet] {
         // SAFETY: Early validation to prevent crashes
-        guard !prices.isEmpty, prices.count > settings.rsiPeriod else { return [] }
+        guard rsi.count > settings.rsiPeriod else { return [] }
         guard !allOHLCData.isEmpty else { return [] }
         
-        let rsiResult = TechnicalIndicators.calculateRSI(prices: prices, period: settings.rsiPeriod, overbought: settings.rsiOverbought, oversold: settings.rsiOversold)
-        
         // Get price range to position RSI below main chart
-        let allPrices = allOHLCData.flatMap { [$0.open, $0.high, $0.low, $0.close] }
-        guard let minPrice = allPrices.min(), let maxPrice = allPrices.max(), maxPrice > minPrice else { return [] }
+        guard let minPrice = priceBounds?.min, let maxPrice = priceBounds?.max, maxPrice > minPrice else { return [] }
         
         // Create RSI section with robust validation to prevent NaN errors
         let priceRange = maxPrice - minPrice
         
         // Validate price range is finite and reasonable
         guard priceRange.isFinite && priceRange >= 0 else {
-            print("⚠️ Invalid price range: \(priceRange), minPrice: \(minPrice), maxPrice: \(maxPrice)")
+            AppLogger.chart("Invalid price range: \(priceRange), minPrice: \(minPrice), maxPrice: \(maxPrice)", level: .warning)
             return []
         }
         
@@ -1424,30 +1710,18 @@ extension CandlestickChartView {
         
         // Final validation of all computed values
         guard separationMultiplier.isFinite && rsiSectionHeight.isFinite && rsiBottom.isFinite else {
-            print("⚠️ Invalid RSI positioning values:")
-            print("separationMultiplier: \(separationMultiplier), rsiSectionHeight: \(rsiSectionHeight), rsiBottom: \(rsiBottom)")
+            AppLogger.chart("Invalid RSI positioning values: separationMultiplier: \(separationMultiplier), rsiSectionHeight: \(rsiSectionHeight), rsiBottom: \(rsiBottom)", level: .warning)
             return []
         }
         
-        // Map RSI values (0-100) to RSI section coordinates
-        let rsiEntries = rsiResult.values.enumerated().compactMap { index, value -> ChartDataEntry? in
-            guard let value = value else { return nil }
-            guard value.isFinite && value >= 0 && value <= 100 else { return nil }
-            guard index < allOHLCData.count else { return nil }
-            
-            // Map RSI (0-100) to the RSI section height
-            let rsiPosition = rsiBottom + (value / 100.0) * rsiSectionHeight
-            
-            // Validate final position is finite before creating entry
-            guard rsiPosition.isFinite else {
-                print("⚠️ Invalid RSI position: \(rsiPosition) for value: \(value)")
-                return nil
-            }
-            
-            return ChartDataEntry(x: Double(index), y: rsiPosition)
-        }
+        // Reference lines span the defined RSI range, whatever part of it is materialised
+        guard let firstIndex = rsi.firstValidIndex,
+              let lastIndex = rsi.values.lastIndex(where: { $0.isFinite }),
+              lastIndex > firstIndex else { return [] }
         
-        guard !rsiEntries.isEmpty, rsiEntries.count >= 2 else { return [] }
+        // Map RSI values (0-100) to RSI section coordinates, for the candle window only
+        rsiPane = (bottom: rsiBottom, height: rsiSectionHeight)
+        let rsiEntries = overlayEntries(rsiVirtualizer, count: rsi.count)
         
         var dataSets: [LineChartDataSet] = []
         
@@ -1463,9 +1737,6 @@ extension CandlestickChartView {
         rsiDataSet.cubicIntensity = 0.1 // Subtle smoothing
         dataSets.append(rsiDataSet)
         
-        // Create reference line entries spanning the chart width
-        guard let firstEntry = rsiEntries.first, let lastEntry = rsiEntries.last else { return [rsiDataSet] }
-        
         // Reference lines using user-configurable RSI levels
         let referenceLines = [
             (level: settings.rsiOverbought, color: UIColor.systemRed, name: "Overbought", dashPattern: [CGFloat(2.0), CGFloat(4.0)]),
@@ -1478,13 +1749,13 @@ extension CandlestickChartView {
             
             // Validate reference line position is finite
             guard levelPosition.isFinite else {
-                print("⚠️ Invalid reference line position: \(levelPosition) for level: \(referenceLine.level)")
+                AppLogger.chart("Invalid reference line position: \(levelPosition) for level: \(referenceLine.level)", level: .warning)
                 continue
             }
             
             let entries = [
-                ChartDataEntry(x: firstEntry.x, y: levelPosition),
-                ChartDataEntry(x: lastEntry.x, y: levelPosition)
+                ChartDataEntry(x: Double(firstIndex), y: levelPosition),
+                ChartDataEntry(x: Double(lastIndex), y: levelPosition)
             ]
             
             let dataSet = LineChartDataSet(entries: entries, label: "")
@@ -1512,10 +1783,7 @@ extension CandlestickChartView {
                   granularityValue.isFinite && granularityValue > 0,
                   rsiBottom.isFinite && rsiSectionHeight.isFinite && rsiSectionHeight > 0,
                   minPrice.isFinite else {
-                print("⚠️ Invalid axis values detected - skipping axis configuration")
-                print("axisMinimum: \(axisMinimum), axisMaximum: \(axisMaximum)")
-                print("rsiBottom: \(rsiBottom), rsiSectionHeight: \(rsiSectionHeight)")
-                print("minPrice: \(minPrice), maxPrice: \(maxPrice)")
+                AppLogger.chart("Invalid axis values detected - skipping axis configuration | axisMinimum: \(axisMinimum), axisMaximum: \(axisMaximum) | rsiBottom: \(rsiBottom), rsiSectionHeight: \(rsiSectionHeight) | minPrice: \(minPrice), maxPrice: \(maxPrice)", level: .warning)
                 return
             }
             
@@ -1532,7 +1800,8 @@ extension CandlestickChartView {
                 self.rightAxis.valueFormatter = RSISeparateAxisFormatter(
                     rsiStart: rsiBottom,
                     rsiEnd: rsiBottom + rsiSectionHeight,
-                    priceStart: minPrice
+                    priceStart: minPrice,
+                    priceFormatter: self.makePriceAxisFormatter()
                 )
             } else {
                 // Set axis to include both price data and RSI section
@@ -1564,7 +1833,8 @@ extension CandlestickChartView {
                 self.rightAxis.valueFormatter = RSISeparateAxisFormatter(
                     rsiStart: rsiBottom,
                     rsiEnd: rsiBottom + rsiSectionHeight,
-                    priceStart: minPrice
+                    priceStart: minPrice,
+                    priceFormatter: self.makePriceAxisFormatter()
                 )
             }
         }
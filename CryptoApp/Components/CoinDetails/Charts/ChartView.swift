@@ -18,6 +18,13 @@ final class ChartView: LineChartView {
     private var currentRange: String = "24h"
     private var visibleDataPointsCount: Int = 50
     private var currentScrollPosition: CGFloat = 0
+    // Min/max of allDataPoints (from the chart model, widened by live updates)
+    private var priceBounds: ChartModel.PriceBounds?
+    // Prepared data the chart was last rendered from; dropped once the series is patched in place
+    private var chartModel: ChartModel?
+    // Latest `update(_:range:)` build; older builds finishing late are discarded
+    private var modelGeneration = 0
+    private var isBuildingModel = false
 
     // Common chart functionality helper
     private let configurationHelper = ChartConfigurationHelper()
@@ -28,16 +35,37 @@ final class ChartView: LineChartView {
     // MARK: - Dynamic Value Tracking (CoinMarketCap Style)
     private var currentSMADataSet: LineChartDataSet?
     private var currentEMADataSet: LineChartDataSet?
-    private var currentRSIResult: TechnicalIndicators.RSIResult?
+    // Index-aligned indicator values (NaN warm-up) for O(1) label lookups
+    private var currentSMABuffer: TechnicalIndicators.IndicatorBuffer?
+    private var currentEMABuffer: TechnicalIndicators.IndicatorBuffer?
+    private var currentRSIBuffer: TechnicalIndicators.IndicatorBuffer?
     private var currentTechnicalSettings: TechnicalIndicators.IndicatorSettings?
     private var currentTheme: ChartColorTheme?
     
-    // Throttling for smooth scrolling
-    private var updateTimer: Timer?
+    // Viewport tracking: pan/zoom/deceleration callbacks coalesced onto display frames, idle otherwise
+    private lazy var viewportTracker = ChartViewportTracker { [weak self] in
+        self?.handleViewportChange()
+    }
+    
+    // Price entries are materialised only for the visible window plus a margin
+    private lazy var lineVirtualizer = ChartEntryVirtualizer<ChartDataEntry>(
+        makeEntry: { ChartDataEntry() },
+        configure: { [unowned self] entry, index in
+            let value = self.allDataPoints[index]
+            guard value.isFinite, index < self.allDates.count else { return false }
+            entry.x = self.allDates[index].timeIntervalSince1970
+            entry.y = value
+            return true
+        }
+    )
     
-    // Viewport monitoring for scroll-based updates
-    private var lastVisibleX: Double = 0
-    private var viewportMonitorTimer: Timer?
+    // SMA/EMA overlays follow the price window, reading values from the index-aligned buffers
+    private lazy var smaVirtualizer = makeOverlayVirtualizer { [unowned self] index in
+        self.currentSMABuffer?.value(at: index)
+    }
+    private lazy var emaVirtualizer = makeOverlayVirtualizer { [unowned self] index in
+        self.currentEMABuffer?.value(at: index)
+    }
 
     // Callback to notify when user scrolls to chart edge
     var onScrollToEdge: ((ScrollDirection) -> Void)?
@@ -190,14 +218,7 @@ final class ChartView: LineChartView {
         let lastX = allDates.last!.timeIntervalSince1970
         let totalTimeRange = max(1.0, lastX - firstX)
 
-        let ratio: Double
-        switch currentRange {
-        case "24h": ratio = 0.35
-        case "7d": ratio = 0.30
-        case "30d": ratio = 0.25
-        case "All": ratio = 0.15
-        default: ratio = 0.30
-        }
+        let ratio = initialZoomRatio
 
         let secondsPerPoint = max(totalTimeRange / max(1.0, Double(allDataPoints.count - 1)), 1.0)
         let minVisible = secondsPerPoint * 3
@@ -207,6 +228,17 @@ final class ChartView: LineChartView {
         setVisibleXRangeMinimum(max(minVisible, visibleTimeRange * 0.2))
     }
     
+    /// Fraction of the full time range shown at the initial zoom level
+    private var initialZoomRatio: Double {
+        switch currentRange {
+        case "24h": return 0.35
+        case "7d": return 0.30
+        case "30d": return 0.25
+        case "All": return 0.15
+        default: return 0.30
+        }
+    }
+    
     // MARK: - Layout
     
     override func layoutSubviews() {
@@ -248,38 +280,40 @@ final class ChartView: LineChartView {
 
     // MARK: - Public Update Method
 
+    /// Builds the model on ChartModel.buildQueue and renders it on the main queue
     func update(_ dataPoints: [Double], range: String) {
-        guard !dataPoints.isEmpty else { return }
-
-        self.allDataPoints = dataPoints
-        self.currentRange = range
-        self.visibleDataPointsCount = ChartConfigurationHelper.calculateVisiblePoints(for: range, dataCount: dataPoints.count)
-        generateDates(for: dataPoints, range: range)
-        self.currentScrollPosition = 0
-        updateChart()
+        modelGeneration += 1
+        let generation = modelGeneration
+        isBuildingModel = true
+        let settings = currentTechnicalSettings ?? TechnicalIndicators.IndicatorSettings()
+        ChartModel.buildQueue.async { [weak self] in
+            let model = ChartModel(points: dataPoints, range: range, settings: settings)
+            DispatchQueue.main.async {
+                guard let self = self, generation == self.modelGeneration else { return }
+                self.update(model)
+                // Indicators requested while the model was building
+                if let settings = self.currentTechnicalSettings, let theme = self.currentTheme {
+                    self.updateWithTechnicalIndicators(settings, theme: theme)
+                }
+            }
+        }
     }
 
+    /// Renders the line series of a prepared model (dates, price bounds and indicator buffers are reused)
+    func update(_ model: ChartModel) {
+        // A direct model supersedes any pending `update(_:range:)` build
+        modelGeneration += 1
+        isBuildingModel = false
+        guard !model.points.isEmpty else { return }
 
-
-    private func generateDates(for dataPoints: [Double], range: String) {
-        let now = Date()
-        
-        let timeInterval: TimeInterval = range == "24h" ? 86400 :
-                                         range == "7d" ? 604800 :
-                                         range == "30d" ? 2592000 : 31536000
-        let start = now.addingTimeInterval(-timeInterval)
-        
-        // Guard against single-point datasets to avoid division by zero which
-        // results in NaN timestamps and an invisible chart.
-        guard dataPoints.count >= 2 else {
-            allDates = [start, now]
-            return
-        }
-        
-        let step = timeInterval / Double(dataPoints.count - 1)
-        allDates = (0..<dataPoints.count).map { i in
-            start.addingTimeInterval(Double(i) * step)
-        }
+        self.chartModel = model
+        self.allDataPoints = model.points
+        self.currentRange = model.key.range
+        self.visibleDataPointsCount = ChartConfigurationHelper.calculateVisiblePoints(for: model.key.range, dataCount: model.points.count)
+        self.allDates = model.lineDates
+        self.priceBounds = model.lineBounds
+        self.currentScrollPosition = 0
+        updateChart()
     }
 
     // MARK: - Chart Rendering
@@ -292,13 +326,16 @@ final class ChartView: LineChartView {
         // after switching smoothing algorithms while zoomed.
         fitScreen()
 
-        // Combine data and dates into chart entries, filtering out any NaN values
-        let entries = zip(allDates, allDataPoints).compactMap { date, value -> ChartDataEntry? in
-            guard value.isFinite else { return nil }
-            return ChartDataEntry(x: date.timeIntervalSince1970, y: value)
-        }
+        // Combine data and dates into chart entries, filtering out any NaN values.
+        // Only the latest points (initial zoom) plus a margin are materialised; the window follows the viewport.
+        let lastIndex = allDataPoints.count - 1
+        let initialVisibleCount = max(visibleDataPointsCount, Int(Double(allDataPoints.count) * initialZoomRatio))
+        lineVirtualizer.reset(sourceCount: allDataPoints.count)
+        lineVirtualizer.update(visibleLower: lastIndex - initialVisibleCount, visibleUpper: lastIndex, force: true)
+        let entries = lineVirtualizer.entries
         
-        guard !entries.isEmpty else { return }
+        guard !entries.isEmpty, let firstX = allDates.first?.timeIntervalSince1970,
+              let lastX = allDates.last?.timeIntervalSince1970 else { return }
 
         // Calculate Y-axis range from price data plus SMA/EMA if visible
         if autoScaleMinMaxEnabled {
@@ -317,7 +354,7 @@ final class ChartView: LineChartView {
             rightAxis.minWidth = 60
         } else {
             // When autoscale is off, only consider price data for Y-axis range
-            guard let minY = allDataPoints.min(), let maxY = allDataPoints.max() else { return }
+            guard let minY = priceBounds?.min, let maxY = priceBounds?.max else { return }
             // Setup y-axis buffer (using right axis) with NaN validation
             let range = maxY - minY
             // FIXED: Prevent NaN in CoreGraphics when all values are identical
@@ -337,8 +374,7 @@ final class ChartView: LineChartView {
             
             // CRITICAL: Validate axis values before setting to prevent NaN errors
             guard axisMin.isFinite && axisMax.isFinite && axisMax > axisMin else {
-                print("⚠️ Invalid axis values in ChartView - skipping axis configuration")
-                print("axisMin: \(axisMin), axisMax: \(axisMax), minY: \(minY), maxY: \(maxY)")
+                AppLogger.chart("Invalid axis values in ChartView - skipping axis configuration | axisMin: \(axisMin), axisMax: \(axisMax), minY: \(minY), maxY: \(maxY)", level: .warning)
                 return
             }
             
@@ -394,10 +430,14 @@ final class ChartView: LineChartView {
 
         self.data = LineChartData(dataSet: dataSet)
 
+        // Pin the X-axis to the full series so scrolling isn't limited to the materialised window
+        xAxis.axisMinimum = firstX
+        xAxis.axisMaximum = lastX
+
         // Adjust visible time range using time-based units (seconds).
         // Ensure minimum and maximum are sensible and not identical.
         let visiblePoints = Double(visibleDataPointsCount)
-        let totalTimeRange = entries.last!.x - entries.first!.x
+        let totalTimeRange = lastX - firstX
         let secondsPerPoint = max(totalTimeRange / max(1.0, Double(allDataPoints.count - 1)), 1.0)
         let visibleTimeRange = max(secondsPerPoint * visiblePoints, secondsPerPoint * 3)
 
@@ -406,7 +446,7 @@ final class ChartView: LineChartView {
         setVisibleXRangeMinimum(max(secondsPerPoint * 2, visibleTimeRange * 0.2))
         
         // Scroll to the latest entry
-        moveViewToX(entries.last?.x ?? 0)
+        moveViewToX(lastX)
 
         // Update x-axis formatter with new dates and range
         if let xAxisFormatter = xAxis.valueFormatter as? DateValueFormatter {
@@ -428,26 +468,85 @@ final class ChartView: LineChartView {
     
     // MARK: - External Scrolling Helpers
     
+    // NOTE: Bounds come from allDates, not `data`, which only holds the virtualized window
+    
     func scrollToLatest() {
-        guard let data = data else { return }
-        moveViewToX(data.xMax)
+        guard data != nil, let lastX = allDates.last?.timeIntervalSince1970 else { return }
+        moveViewToX(lastX)
+        refreshVirtualWindow()
     }
 
     func scrollToOldest() {
-        guard let data = data else { return }
-        moveViewToX(data.xMin)
+        guard data != nil, let firstX = allDates.first?.timeIntervalSince1970 else { return }
+        moveViewToX(firstX)
+        refreshVirtualWindow()
     }
 
-        func scrollBy(points: Int) {
-        guard let data = data else { return }
+    func scrollBy(points: Int) {
+        guard data != nil,
+              let firstX = allDates.first?.timeIntervalSince1970,
+              let lastX = allDates.last?.timeIntervalSince1970 else { return }
         let currentCenterX = (lowestVisibleX + highestVisibleX) / 2
-        let dataRange = data.xMax - data.xMin
-        let pointWidth = dataRange / Double(allDataPoints.count)
+        let pointWidth = (lastX - firstX) / Double(allDataPoints.count)
         let offsetX = Double(points) * pointWidth
         
         let newCenterX = currentCenterX + offsetX
-        let clampedX = max(data.xMin, min(data.xMax, newCenterX))
+        let clampedX = max(firstX, min(lastX, newCenterX))
         moveViewToX(clampedX)
+        refreshVirtualWindow()
+    }
+    
+    // MARK: - Entry Virtualization
+    
+    /// Maps an X value (seconds) to the nearest series index; dates are evenly spaced by ChartModel.lineDates
+    private func dataIndex(forX x: Double) -> Int {
+        guard allDataPoints.count > 1,
+              let firstX = allDates.first?.timeIntervalSince1970,
+              let lastX = allDates.last?.timeIntervalSince1970,
+              lastX > firstX, x.isFinite else { return 0 }
+        let step = (lastX - firstX) / Double(allDataPoints.count - 1)
+        return Int(((x - firstX) / step).rounded())
+    }
+    
+    private func makeOverlayVirtualizer(_ value: @escaping (Int) -> Double?) -> ChartEntryVirtualizer<ChartDataEntry> {
+        ChartEntryVirtualizer(
+            makeEntry: { ChartDataEntry() },
+            configure: { [unowned self] entry, index in
+                // Warm-up (NaN) points are not drawn
+                guard let y = value(index), index < self.allDates.count else { return false }
+                entry.x = self.allDates[index].timeIntervalSince1970
+                entry.y = y
+                return true
+            }
+        )
+    }
+    
+    /// Points an overlay virtualizer at a freshly computed buffer and materialises the price window
+    private func overlayEntries(_ virtualizer: ChartEntryVirtualizer<ChartDataEntry>,
+                                count: Int) -> [ChartDataEntry] {
+        virtualizer.reset(sourceCount: count)
+        virtualizer.follow(lineVirtualizer.window)
+        return virtualizer.entries
+    }
+    
+    /// Slides the materialised price window to follow the viewport; a no-op while it still covers it
+    private func refreshVirtualWindow() {
+        guard !allDataPoints.isEmpty, let dataSet = getMainPriceDataSet() else { return }
+        
+        let changed = lineVirtualizer.update(visibleLower: dataIndex(forX: lowestVisibleX) - 1,
+                                             visibleUpper: dataIndex(forX: highestVisibleX) + 1)
+        guard changed else { return }
+        
+        // Same dataset object, new entries: X-axis bounds are fixed so the viewport doesn't move
+        dataSet.replaceEntries(lineVirtualizer.entries)
+        if let sma = currentSMADataSet, smaVirtualizer.follow(lineVirtualizer.window) {
+            sma.replaceEntries(smaVirtualizer.entries)
+        }
+        if let ema = currentEMADataSet, emaVirtualizer.follow(lineVirtualizer.window) {
+            ema.replaceEntries(emaVirtualizer.entries)
+        }
+        data?.notifyDataChanged()
+        notifyDataSetChanged()
     }
     
     // MARK: - Dynamic Value Updates (CoinMarketCap Style)
@@ -463,31 +562,18 @@ final class ChartView: LineChartView {
         
         labelManager.updateLabelsAtPosition(
             xIndex: xIndex,
-            smaDataSet: currentSMADataSet,
-            emaDataSet: currentEMADataSet,
-            rsiResult: currentRSIResult,
+            sma: currentSMABuffer,
+            ema: currentEMABuffer,
+            rsi: currentRSIBuffer,
             settings: settings,
             theme: theme
         )
     }
     
-    /// Finds the closest index for a given timestamp
+    /// Finds the closest index for a given timestamp (dates are evenly spaced, so O(1))
     private func findIndexForTimestamp(_ timestamp: Double) -> Int {
-        guard !allDates.isEmpty else { return 0 }
-        
-        let _ = Date(timeIntervalSince1970: timestamp)  // targetDate unused
-        var closestIndex = 0
-        var minDifference = abs(allDates[0].timeIntervalSince1970 - timestamp)
-        
-        for (index, date) in allDates.enumerated() {
-            let difference = abs(date.timeIntervalSince1970 - timestamp)
-            if difference < minDifference {
-                minDifference = difference
-                closestIndex = index
-            }
-        }
-        
-        return closestIndex
+        guard !allDataPoints.isEmpty else { return 0 }
+        return max(0, min(allDataPoints.count - 1, dataIndex(forX: timestamp)))
     }
     
     /// Resets labels to show the latest (most recent) values
@@ -509,23 +595,18 @@ final class ChartView: LineChartView {
         
         labelManager.updateLabelsAtPosition(
             xIndex: lastIndex,
-            smaDataSet: currentSMADataSet,
-            emaDataSet: currentEMADataSet,
-            rsiResult: currentRSIResult,
+            sma: currentSMABuffer,
+            ema: currentEMABuffer,
+            rsi: currentRSIBuffer,
             settings: settings,
             theme: theme,
             dataPointCount: allDataPoints.count
         )
     }
     
-    /// Updates indicator values based on the current visible range (CoinMarketCap style)
+    /// Updates indicator values based on the current visible range (coalesced to the next display frame)
     private func updateValuesForVisibleRange() {
-        // Throttle updates to avoid excessive calls during scrolling
-        updateTimer?.invalidate()
-        updateTimer = Timer.scheduledTimer(withTimeInterval: 0.1, repeats: false) { [weak self] timer in
-            timer.invalidate() // Ensure timer is invalidated
-            self?.performVisibleRangeUpdate()
-        }
+        viewportTracker.viewportDidChange()
     }
     
     private func performVisibleRangeUpdate() {
@@ -560,49 +641,21 @@ final class ChartView: LineChartView {
         // Update labels with values at this position
         labelManager.updateLabelsAtPosition(
             xIndex: targetIndex,
-            smaDataSet: currentSMADataSet,
-            emaDataSet: currentEMADataSet,
-            rsiResult: currentRSIResult,
+            sma: currentSMABuffer,
+            ema: currentEMABuffer,
+            rsi: currentRSIBuffer,
             settings: settings,
             theme: theme,
             dataPointCount: allDataPoints.count
         )
     }
     
-    // MARK: - Viewport Monitoring for Scroll-Based Updates
+    // MARK: - Viewport Tracking for Scroll-Based Updates
     
-    /// Starts monitoring viewport changes for automatic value updates
-    private func startViewportMonitoring() {
-        stopViewportMonitoring()
-        lastVisibleX = highestVisibleX
-        
-        // Only start monitoring if view is in window hierarchy
-        guard window != nil else { return }
-        
-        viewportMonitorTimer = Timer.scheduledTimer(withTimeInterval: 0.2, repeats: true) { [weak self] timer in
-            guard let self = self, self.window != nil else {
-                timer.invalidate()
-                return
-            }
-            self.checkViewportChanges()
-        }
-    }
-    
-    /// Stops viewport monitoring
-    private func stopViewportMonitoring() {
-        viewportMonitorTimer?.invalidate()
-        viewportMonitorTimer = nil
-    }
-    
-    /// Checks if viewport has changed and updates values accordingly
-    private func checkViewportChanges() {
-        let currentVisibleX = highestVisibleX
-        
-        // Check if viewport has changed significantly
-        if abs(currentVisibleX - lastVisibleX) > 0.1 {
-            lastVisibleX = currentVisibleX
-            updateValuesForVisibleRange()
-        }
+    /// Runs at most once per display frame while the viewport is moving (see ChartViewportTracker)
+    private func handleViewportChange() {
+        refreshVirtualWindow()
+        performVisibleRangeUpdate()
     }
     
     // MARK: - View Lifecycle
@@ -610,10 +663,8 @@ final class ChartView: LineChartView {
     override func willMove(toWindow newWindow: UIWindow?) {
         super.willMove(toWindow: newWindow)
         if newWindow == nil {
-            // View is being removed from window, stop monitoring
-            stopViewportMonitoring()
-            updateTimer?.invalidate()
-            updateTimer = nil
+            // View is being removed from window, stop tracking
+            viewportTracker.stop()
         }
     }
     
@@ -621,22 +672,19 @@ final class ChartView: LineChartView {
         super.didMoveToWindow()
         if window == nil {
             // Ensure cleanup when view is removed from window
-            stopViewportMonitoring()
-            updateTimer?.invalidate()
-            updateTimer = nil
+            viewportTracker.stop()
         }
     }
     
     deinit {
-        // Clean up all timers and resources
-        stopViewportMonitoring()
-        updateTimer?.invalidate()
-        updateTimer = nil
+        // Clean up resources (viewportTracker invalidates its display link on deinit)
         
         // Clear stored references
         currentSMADataSet = nil
         currentEMADataSet = nil
-        currentRSIResult = nil
+        currentSMABuffer = nil
+        currentEMABuffer = nil
+        currentRSIBuffer = nil
         currentTechnicalSettings = nil
         currentTheme = nil
         labelManager = nil
@@ -675,16 +723,16 @@ extension ChartView: ChartViewDelegate {
             selectionFeedback.selectionChanged()
         }
         
-        // Log zoom level for debugging
-        // Chart zoom level changed
+        // Zooming can uncover points outside the materialised window; handled on the next display frame
+        viewportTracker.viewportDidChange()
     }
     
     func chartTranslated(_ chartView: ChartViewBase, dX: CGFloat, dY: CGFloat) {
         // Handle chart panning while zoomed
         // This ensures smooth interaction between zoom and pan
         
-        // Update indicator values based on current visible range
-        updateValuesForVisibleRange()
+        // Fires per pan and per deceleration step; coalesced to one update per display frame
+        viewportTracker.viewportDidChange()
     }
 
     // Detect if user has panned all the way to left/right
@@ -692,24 +740,164 @@ extension ChartView: ChartViewDelegate {
         // Update values when panning ends
         updateValuesForVisibleRange()
         
+        // Use the full series bounds (the dataset only holds the virtualized window)
         guard let lineChart = chartView as? LineChartView,
-              let data = lineChart.data else { return }
+              lineChart.data != nil,
+              let xMin = allDates.first?.timeIntervalSince1970,
+              let xMax = allDates.last?.timeIntervalSince1970 else { return }
 
         let lowestVisibleX = lineChart.lowestVisibleX
         let highestVisibleX = lineChart.highestVisibleX
 
         // Notify when close to LEFT edge
-        if lowestVisibleX <= data.xMin + (data.xMax - data.xMin) * 0.1 {
+        if lowestVisibleX <= xMin + (xMax - xMin) * 0.1 {
             onScrollToEdge?(.left)
         }
 
         // Notify when close to RIGHT edge
-        if highestVisibleX >= data.xMax - (data.xMax - data.xMin) * 0.1 {
+        if highestVisibleX >= xMax - (xMax - xMin) * 0.1 {
             onScrollToEdge?(.right)
         }
     }
 }
 
+// MARK: - Incremental Updates
+
+extension ChartView {
+    
+    /**
+     * Appends one price point without rebuilding the chart.
+     * The point is spaced one step after the last synthesized date; only the new entry is
+     * materialised, SMA/EMA overlays get one new point each and the fixed price axis is
+     * widened only if the value escapes it.
+     * Returns false when there is no chart to extend; callers then fall back to `update(_:range:)`.
+     */
+    @discardableResult
+    func appendPoint(_ value: Double) -> Bool {
+        guard allDataPoints.count >= 2, value.isFinite,
+              let dataSet = getMainPriceDataSet(),
+              let firstX = allDates.first?.timeIntervalSince1970,
+              let lastDate = allDates.last else { return false }
+        
+        // Follow the live edge only if the user is already looking at it
+        let step = (lastDate.timeIntervalSince1970 - firstX) / Double(allDataPoints.count - 1)
+        let wasAtLatest = highestVisibleX >= lastDate.timeIntervalSince1970 - step / 2
+        
+        allDataPoints.append(value)
+        priceBounds = priceBounds?.including(low: value, high: value)
+        chartModel = nil
+        let newDate = lastDate.addingTimeInterval(step)
+        allDates.append(newDate)
+        
+        if let entry = lineVirtualizer.appendSource() {
+            dataSet.append(entry)  // Updates dataset min/max for this entry only
+        }
+        
+        xAxis.axisMaximum = newDate.timeIntervalSince1970
+        (xAxis.valueFormatter as? DateValueFormatter)?.updateDates(allDates)
+        ChartConfigurationHelper.expandAxisIfNeeded(rightAxis, low: value, high: value)
+        updateIndicatorOverlays(at: allDataPoints.count - 1, appended: true)
+        
+        data?.notifyDataChanged()
+        notifyDataSetChanged()  // X-axis extent changed
+        if wasAtLatest {
+            moveViewToX(lowestVisibleX + step)
+        }
+        updateValuesForVisibleRange()
+        return true
+    }
+    
+    /**
+     * Replaces the most recent price point in place.
+     * Redraws without re-laying out the chart unless the price axis had to grow.
+     */
+    @discardableResult
+    func replaceLastPoint(_ value: Double) -> Bool {
+        guard let index = allDataPoints.indices.last, value.isFinite,
+              let dataSet = getMainPriceDataSet() else { return false }
+        
+        allDataPoints[index] = value
+        priceBounds = priceBounds?.including(low: value, high: value)
+        chartModel = nil
+        if lineVirtualizer.refreshSource(at: index) != nil {
+            dataSet.notifyDataSetChanged()  // Min/max over the materialised window only
+        }
+        updateIndicatorOverlays(at: index, appended: false)
+        
+        data?.notifyDataChanged()
+        if ChartConfigurationHelper.expandAxisIfNeeded(rightAxis, low: value, high: value) {
+            notifyDataSetChanged()
+        } else {
+            setNeedsDisplay()
+        }
+        updateValuesForVisibleRange()
+        return true
+    }
+    
+    /**
+     * Extends or rewrites the SMA/EMA value at `index` (label buffer and overlay) from the points.
+     * RSI has no overlay on the line chart; its label buffer is recomputed, since Wilder's
+     * smoothing state isn't kept between updates.
+     */
+    private func updateIndicatorOverlays(at index: Int, appended: Bool) {
+        guard let settings = currentTechnicalSettings, index < allDates.count else { return }
+        
+        if settings.showSMA, currentSMABuffer != nil {
+            let period = settings.smaPeriod
+            var value: Double?
+            if index >= period - 1 {
+                value = allDataPoints[(index - period + 1)...index].reduce(0, +) / Double(period)
+            }
+            if appended {
+                currentSMABuffer?.append(value)
+            } else {
+                currentSMABuffer?.replaceLast(value)
+            }
+            if let sma = currentSMADataSet {
+                updateOverlay(sma, through: smaVirtualizer, at: index, appended: appended)
+            }
+        }
+        
+        if settings.showEMA, currentEMABuffer != nil {
+            // EMA(t) = price × k + EMA(t-1) × (1 - k), with EMA(t-1) read from the index-aligned buffer
+            let period = settings.emaPeriod
+            let multiplier = 2.0 / Double(period + 1)
+            var value: Double?
+            if let previous = currentEMABuffer?.value(at: index - 1) {
+                value = allDataPoints[index] * multiplier + previous * (1 - multiplier)
+            } else if index == period - 1 {
+                // First defined EMA is seeded with the SMA, as in calculateEMA
+                value = allDataPoints[0...index].reduce(0, +) / Double(period)
+            }
+            if appended {
+                currentEMABuffer?.append(value)
+            } else {
+                currentEMABuffer?.replaceLast(value)
+            }
+            if let ema = currentEMADataSet {
+                updateOverlay(ema, through: emaVirtualizer, at: index, appended: appended)
+            }
+        }
+        
+        if settings.showRSI, currentRSIBuffer != nil {
+            currentRSIBuffer = TechnicalIndicators.IndicatorBuffer(
+                TechnicalIndicators.calculateRSI(prices: allDataPoints, period: settings.rsiPeriod))
+        }
+    }
+    
+    /// Mirrors a buffer change at `index` into the overlay's materialised window
+    private func updateOverlay(_ dataSet: LineChartDataSet, through virtualizer: ChartEntryVirtualizer<ChartDataEntry>,
+                               at index: Int, appended: Bool) {
+        if appended {
+            if let entry = virtualizer.appendSource() {
+                dataSet.append(entry)
+            }
+        } else if virtualizer.refreshSource(at: index) != nil {
+            dataSet.notifyDataSetChanged()
+        }
+    }
+}
+
 // MARK: - Chart Settings Support
 
 extension ChartView {
@@ -794,7 +982,15 @@ extension ChartView {
     
     /// Updates chart with technical indicators overlays
     func updateWithTechnicalIndicators(_ settings: TechnicalIndicators.IndicatorSettings, theme: ChartColorTheme = .classic) {
-        guard !allDataPoints.isEmpty else { return }
+        // Remembered and applied once the series (or the pending model) is in place
+        guard !allDataPoints.isEmpty, !isBuildingModel else {
+            currentTechnicalSettings = settings
+            currentTheme = theme
+            return
+        }
+        
+        // Prepared buffers from the chart model when it still describes the displayed series
+        let model = chartModel
         
         // Clear existing additional datasets (keep main price line)
         let existingData = data
@@ -806,20 +1002,30 @@ extension ChartView {
         }
         
         // Store data sets for label updates
+        var smaBuffer: TechnicalIndicators.IndicatorBuffer?
+        var emaBuffer: TechnicalIndicators.IndicatorBuffer?
+        var rsiBuffer: TechnicalIndicators.IndicatorBuffer?
         var smaDataSet: LineChartDataSet?
         var emaDataSet: LineChartDataSet?
-        var rsiResult: TechnicalIndicators.RSIResult?
         
         // Add moving averages if enabled
         if settings.showSMA {
-            smaDataSet = createSMADataSet(period: settings.smaPeriod, theme: theme)
+            let buffer = model?.smaBuffer(for: settings, series: .line)
+                ?? TechnicalIndicators.IndicatorBuffer(TechnicalIndicators.calculateSMA(prices: allDataPoints, period: settings.smaPeriod))
+            smaBuffer = buffer
+            currentSMABuffer = buffer  // Read by smaVirtualizer
+            smaDataSet = createSMADataSet(from: buffer, theme: theme)
             if let sma = smaDataSet {
                 dataSets.append(sma)
             }
         }
         
         if settings.showEMA {
-            emaDataSet = createEMADataSet(period: settings.emaPeriod, theme: theme)
+            let buffer = model?.emaBuffer(for: settings, series: .line)
+                ?? TechnicalIndicators.IndicatorBuffer(TechnicalIndicators.calculateEMA(prices: allDataPoints, period: settings.emaPeriod))
+            emaBuffer = buffer
+            currentEMABuffer = buffer  // Read by emaVirtualizer
+            emaDataSet = createEMADataSet(from: buffer, theme: theme)
             if let ema = emaDataSet {
                 dataSets.append(ema)
             }
@@ -827,7 +1033,8 @@ extension ChartView {
         
         // Add RSI if enabled (with reference lines)
         if settings.showRSI {
-            rsiResult = TechnicalIndicators.calculateRSI(prices: allDataPoints, period: settings.rsiPeriod)
+            rsiBuffer = model?.rsiBuffer(for: settings, series: .line)
+                ?? TechnicalIndicators.IndicatorBuffer(TechnicalIndicators.calculateRSI(prices: allDataPoints, period: settings.rsiPeriod))
             let rsiDataSets = createRSIDataSets(settings: settings, theme: theme)
             // SAFETY: Only append if we have valid data sets
             if !rsiDataSets.isEmpty {
@@ -838,13 +1045,16 @@ extension ChartView {
         // Store current data for dynamic updates
         currentSMADataSet = smaDataSet
         currentEMADataSet = emaDataSet
-        currentRSIResult = rsiResult
+        currentSMABuffer = smaBuffer
+        currentEMABuffer = emaBuffer
+        currentRSIBuffer = rsiBuffer
         currentTechnicalSettings = settings
         currentTheme = theme
         
         // Update chart with all datasets
         // SAFETY: Validate all data sets have entries before creating LineChartData
-        let validDataSets = dataSets.filter { !$0.entries.isEmpty }
+        // (overlays may be empty while the window sits in their warm-up; they fill in as it slides)
+        let validDataSets = dataSets.filter { !$0.entries.isEmpty || $0 === smaDataSet || $0 === emaDataSet }
         if !validDataSets.isEmpty {
             self.data = LineChartData(dataSets: validDataSets)
             notifyDataSetChanged()
@@ -856,9 +1066,9 @@ extension ChartView {
             
             // Update labels with current values
             labelManager?.updateAllLabels(
-                smaDataSet: smaDataSet,
-                emaDataSet: emaDataSet,
-                rsiResult: rsiResult,
+                sma: smaBuffer,
+                ema: emaBuffer,
+                rsi: rsiBuffer,
                 settings: settings,
                 theme: theme,
                 rsiAreaTop: rsiAreaTop,
@@ -866,27 +1076,17 @@ extension ChartView {
                 dataPointCount: allDataPoints.count
             )
             
-            // Update values for currently visible range (CoinMarketCap style)
-            DispatchQueue.main.asyncAfter(deadline: .now() + 0.1) {
-                self.updateValuesForVisibleRange()
-                self.startViewportMonitoring() // Start monitoring for scroll-based updates
-            }
+            // Update values for currently visible range on the next display frame (CoinMarketCap style)
+            self.updateValuesForVisibleRange()
         }
     }
     
-    private func createSMADataSet(period: Int, theme: ChartColorTheme) -> LineChartDataSet? {
-        let smaResult = TechnicalIndicators.calculateSMA(prices: allDataPoints, period: period)
-        
-        let entries = smaResult.values.enumerated().compactMap { index, value -> ChartDataEntry? in
-            guard let value = value, index < allDates.count else { return nil }
-            // Additional NaN check for safety
-            guard value.isFinite else { return nil }
-            return ChartDataEntry(x: allDates[index].timeIntervalSince1970, y: value)
-        }
-        
-        guard !entries.isEmpty else { return nil }
+    private func createSMADataSet(from buffer: TechnicalIndicators.IndicatorBuffer, theme: ChartColorTheme) -> LineChartDataSet? {
+        // Only the price window is materialised; the overlay follows it as the viewport moves
+        let entries = overlayEntries(smaVirtualizer, count: buffer.count)
+        guard buffer.firstValidIndex != nil else { return nil }
         
-        let dataSet = LineChartDataSet(entries: entries, label: "SMA(\(period))")
+        let dataSet = LineChartDataSet(entries: entries, label: "SMA(\(buffer.period))")
         dataSet.setColor(TechnicalIndicators.getIndicatorColor(for: "sma", theme: theme))
         dataSet.lineWidth = 1.5
         dataSet.drawCirclesEnabled = false
@@ -897,19 +1097,12 @@ extension ChartView {
         return dataSet
     }
     
-    private func createEMADataSet(period: Int, theme: ChartColorTheme) -> LineChartDataSet? {
-        let emaResult = TechnicalIndicators.calculateEMA(prices: allDataPoints, period: period)
-        
-        let entries = emaResult.values.enumerated().compactMap { index, value -> ChartDataEntry? in
-            guard let value = value, index < allDates.count else { return nil }
-            // Additional NaN check for safety
-            guard value.isFinite else { return nil }
-            return ChartDataEntry(x: allDates[index].timeIntervalSince1970, y: value)
-        }
+    private func createEMADataSet(from buffer: TechnicalIndicators.IndicatorBuffer, theme: ChartColorTheme) -> LineChartDataSet? {
+        // Only the price window is materialised; the overlay follows it as the viewport moves
+        let entries = overlayEntries(emaVirtualizer, count: buffer.count)
+        guard buffer.firstValidIndex != nil else { return nil }
         
-        guard !entries.isEmpty else { return nil }
-        
-        let dataSet = LineChartDataSet(entries: entries, label: "EMA(\(period))")
+        let dataSet = LineChartDataSet(entries: entries, label: "EMA(\(buffer.period))")
         dataSet.setColor(TechnicalIndicators.getIndicatorColor(for: "ema", theme: theme))
         dataSet.lineWidth = 1.5
         dataSet.drawCirclesEnabled = false
@@ -940,6 +1133,8 @@ extension ChartView {
         
         // Keep only the first dataset (main price line)
         self.data = LineChartData(dataSet: priceDataSet)
+        currentSMADataSet = nil
+        currentEMADataSet = nil
         notifyDataSetChanged()
     }
     
@@ -62,6 +62,12 @@ final class VolumeChartView: BarChartView {
     /// Determines colors for bullish/bearish bars and overall styling
     private var currentTheme: ChartColorTheme = .classic
     
+    /// Latest `updateVolume(ohlcData:)` build; older builds finishing late are discarded
+    private var modelGeneration = 0
+    
+    /// Main chart the X-axis was last synchronized with, re-applied when a built model lands
+    private weak var synchronizedChart: ChartViewBase?
+    
 
     
     // MARK: - Initialization
@@ -181,8 +187,33 @@ final class VolumeChartView: BarChartView {
      * 4. Trigger chart rendering with color-coded bars
      */
     func updateVolume(ohlcData: [OHLCData], range: String, theme: ChartColorTheme = .classic) {
+        // The model (volumes and their analysis) is built on ChartModel.buildQueue; the latest call wins
+        modelGeneration += 1
+        let generation = modelGeneration
+        ChartModel.buildQueue.async { [weak self] in
+            let model = ChartModel(ohlc: ohlcData, range: range)
+            DispatchQueue.main.async {
+                guard let self = self, generation == self.modelGeneration else { return }
+                self.updateVolume(model: model, theme: theme)
+                if let chartView = self.synchronizedChart {
+                    self.synchronizeXAxisWith(chartView: chartView)
+                }
+            }
+        }
+    }
+    
+    /**
+     * Updates the volume chart from a prepared chart model
+     * 
+     * Volumes, bar directions and the volume analysis are taken from the model as-is,
+     * so showing the pane again or rendering the same model in landscape costs no analysis.
+     */
+    func updateVolume(model: ChartModel, theme: ChartColorTheme = .classic) {
+        // A direct model supersedes any pending `updateVolume(ohlcData:)` build
+        modelGeneration += 1
+        
         // MARK: Input Validation
-        guard !ohlcData.isEmpty else { 
+        guard !model.ohlc.isEmpty else { 
             // Clear chart data if no volume data available
             let emptyData = BarChartData()
             self.data = emptyData
@@ -190,39 +221,35 @@ final class VolumeChartView: BarChartView {
         }
         
         // MARK: Store Configuration
-        self.currentRange = range                   // Store time range for analysis
+        self.currentRange = model.key.range         // Store time range for analysis
         self.currentTheme = theme                   // Store theme for color consistency
-        self.dates = ohlcData.map { $0.timestamp }  // Extract timestamps for synchronization
+        self.dates = model.candleDates              // Timestamps for synchronization
         
-        // MARK: Extract Volume Data
-        // Convert OHLC data to volume values, defaulting to 0 for missing volume
-        self.volumes = ohlcData.map { $0.volume ?? 0.0 }
+        // MARK: Volume Data
+        // Volume values (0 for missing) and bullish/bearish flags for bar coloring
+        self.volumes = model.volumes
+        self.priceChanges = model.volumeIsBullish
         
-        // MARK: Determine Price Movement Direction
-        // Extract bullish/bearish indicators for bar coloring
-        // true = green bar (price went up), false = red bar (price went down)
-        self.priceChanges = ohlcData.map { $0.isBullish }
-        
-        // MARK: Perform Volume Analysis
-        // Calculate volume ratios, identify high volume periods, detect patterns
-        self.volumeAnalysis = TechnicalIndicators.analyzeVolume(volumes: volumes)
+        // MARK: Volume Analysis
+        // Volume ratios and high volume periods, prepared with the model
+        self.volumeAnalysis = model.volumeAnalysis
         
         // MARK: Trigger Chart Update
         updateChart()                               // Render the updated volume bars
     }
     
     /**
-     * Recalculates volume analysis and refreshes chart display
+     * Refreshes the chart display after volume settings change
      * 
-     * Used when volume analysis settings change but the underlying data remains the same.
-     * Useful for real-time updates or when technical indicator settings are modified.
+     * The analysis only depends on the volumes, so it is reused when present and
+     * only computed for data that arrived without one.
      */
     func updateSettings() {
-        // Recalculate volume analysis if we have data
-        if !volumes.isEmpty {
+        guard !volumes.isEmpty else { return }
+        if volumeAnalysis?.volumes.count != volumes.count {
             self.volumeAnalysis = TechnicalIndicators.analyzeVolume(volumes: volumes)
-            updateChart()                           // Re-render with updated analysis
         }
+        updateChart()                               // Re-render with current analysis
     }
     
     /**
@@ -238,6 +265,88 @@ final class VolumeChartView: BarChartView {
         updateChart()                               // Re-render with new colors
     }
     
+    // MARK: - Incremental Updates
+    
+    /**
+     * Appends the volume bar for a new candle without rebuilding the chart
+     * 
+     * Only the new bar's volume ratio is computed (O(period)) and the Y-axis is
+     * recalculated only when the new volume exceeds the current maximum.
+     * 
+     * - Parameter candle: Newly opened candle carrying the volume to display
+     * - Returns: false when there is no chart to extend (use `updateVolume` instead)
+     */
+    @discardableResult
+    func appendVolume(from candle: OHLCData) -> Bool {
+        guard !volumes.isEmpty, let dataSet = data?.dataSets.first as? BarChartDataSet else { return false }
+        
+        let volume = candle.volume ?? 0.0
+        volumes.append(volume)
+        priceChanges.append(candle.isBullish)
+        dates.append(candle.timestamp)
+        let index = volumes.count - 1
+        
+        let ratio = TechnicalIndicators.volumeRatio(at: index, volumes: volumes)
+        volumeAnalysis?.volumes.append(volume)
+        volumeAnalysis?.volumeRatio.append(ratio)
+        volumeAnalysis?.isHighVolume.append(ratio > 1.5)
+        
+        if volume.isFinite && volume >= 0 {
+            // Entry and color stay index-aligned with the bars already drawn
+            dataSet.append(BarChartDataEntry(x: Double(index), y: volume))
+            dataSet.colors.append(barColor(at: index))
+        }
+        
+        data?.notifyDataChanged()
+        notifyDataSetChanged()  // X extent grew by one bar
+        return true
+    }
+    
+    /**
+     * Replaces the last (still forming) volume bar in place
+     * 
+     * - Parameter candle: Updated version of the most recent candle
+     * - Returns: false when there is no bar to replace
+     */
+    @discardableResult
+    func replaceLastVolume(from candle: OHLCData) -> Bool {
+        guard let index = volumes.indices.last,
+              let dataSet = data?.dataSets.first as? BarChartDataSet,
+              let entry = dataSet.entries.last, entry.x == Double(index) else { return false }
+        
+        let volume = candle.volume ?? 0.0
+        guard volume.isFinite && volume >= 0 else { return false }
+        volumes[index] = volume
+        priceChanges[index] = candle.isBullish
+        
+        let ratio = TechnicalIndicators.volumeRatio(at: index, volumes: volumes)
+        volumeAnalysis?.volumes[index] = volume
+        volumeAnalysis?.volumeRatio[index] = ratio
+        volumeAnalysis?.isHighVolume[index] = ratio > 1.5
+        
+        entry.y = volume
+        if dataSet.colors.count == dataSet.entries.count {
+            dataSet.colors[dataSet.colors.count - 1] = barColor(at: index)
+        }
+        
+        // Only a new maximum moves the (auto-scaled) volume axis
+        if volume > dataSet.yMax {
+            dataSet.notifyDataSetChanged()
+            data?.notifyDataChanged()
+            notifyDataSetChanged()
+        } else {
+            setNeedsDisplay()
+        }
+        return true
+    }
+    
+    /// Bar color for one period: theme color by direction, more opaque for high volume
+    private func barColor(at index: Int) -> UIColor {
+        let baseColor = priceChanges[index] ? currentTheme.positiveColor : currentTheme.negativeColor
+        let isHighVolume = volumeAnalysis?.isHighVolume[safe: index] ?? false
+        return baseColor.withAlphaComponent(isHighVolume ? 0.9 : 0.6)
+    }
+    
     // MARK: - Chart Rendering
     
     /**
@@ -382,6 +491,7 @@ final class VolumeChartView: BarChartView {
      * - Parameter chartView: The main chart to synchronize with (for future enhancements)
      */
     func synchronizeXAxisWith(chartView: ChartViewBase) {
+        synchronizedChart = chartView               // Re-applied when a pending model lands
         guard !volumes.isEmpty else { return }
         
         // MARK: Calculate Full Range
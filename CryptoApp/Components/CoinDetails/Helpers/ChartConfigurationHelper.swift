@@ -231,4 +231,24 @@ class ChartConfigurationHelper {
         default: return min(50, dataCount)
         }
     }
-} 
+    
+    /// Widens a fixed (custom min/max) value axis when a live value escapes it.
+    /// Autoscaled axes are left alone. Returns true when the axis bounds changed.
+    @discardableResult
+    static func expandAxisIfNeeded(_ axis: YAxis, low: Double, high: Double, paddingRatio: Double = 0.05,
+                                   allowsNegative: Bool = false) -> Bool {
+        guard axis.isAxisMinCustom, axis.isAxisMaxCustom, low.isFinite, high.isFinite else { return false }
+        let padding = max(axis.axisMaximum - axis.axisMinimum, 0) * paddingRatio
+        var changed = false
+        if high > axis.axisMaximum {
+            axis.axisMaximum = high + padding
+            changed = true
+        }
+        if low < axis.axisMinimum {
+            // Never show negative price on Y-axis (unless the axis shows log/percent values)
+            axis.axisMinimum = allowsNegative ? low - padding : max(0, low - padding)
+            changed = true
+        }
+        return changed
+    }
+}
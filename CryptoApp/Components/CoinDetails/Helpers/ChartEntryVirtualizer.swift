@@ -0,0 +1,194 @@
+//
+//  ChartEntryVirtualizer.swift
+//  CryptoApp
+//
+
+import Foundation
+import DGCharts
+
+/**
+ * CHART ENTRY VIRTUALIZER
+ *
+ * Keeps DGCharts entries materialised only for the visible index range plus a margin:
+ * - The window is a contiguous index range [visible - margin, visible + margin) over the source series
+ * - Panning slides the window; entries that leave it go back to a pool and are re-configured
+ *   for the indices that enter it, so sliding allocates nothing once the pool is warm
+ * - Entries in the overlap of the old and new window are kept as-is
+ * - The window only moves when the visible range gets close to its edge or the zoom level
+ *   makes it clearly too small/large, so most pan frames are a bounds check
+ *
+ * Entries are heap objects (ChartDataEntry subclasses), so for multi-year series this keeps
+ * memory and dataset build time proportional to what is on screen rather than the series length.
+ *
+ * NOTE: Main-thread only, like the chart views that own it.
+ */
+final class ChartEntryVirtualizer<Entry: ChartDataEntry> {
+
+    /// Writes the source value at an index into a (new or recycled) entry; return false to skip the index (e.g. NaN)
+    typealias Configure = (_ entry: Entry, _ index: Int) -> Bool
+
+    // MARK: - Properties
+
+    /// Number of points in the source series
+    private(set) var sourceCount: Int = 0
+    /// Index range currently materialised
+    private(set) var window: Range<Int> = 0..<0
+    /// Materialised entries in index order (skipped indices have no entry)
+    private(set) var entries: [Entry] = []
+
+    private var entryIndices: [Int] = []
+    private var pool: [Entry] = []
+
+    private let minimumMargin: Int
+    private let makeEntry: () -> Entry
+    private let configure: Configure
+
+    /// Entries waiting to be reused (exposed for tests and diagnostics)
+    var pooledCount: Int { pool.count }
+
+    // MARK: - Initialization
+
+    init(minimumMargin: Int = 32, makeEntry: @escaping () -> Entry, configure: @escaping Configure) {
+        self.minimumMargin = max(1, minimumMargin)
+        self.makeEntry = makeEntry
+        self.configure = configure
+    }
+
+    // MARK: - Public API
+
+    /// Points the virtualizer at a new source series; current entries are pooled for reuse
+    func reset(sourceCount: Int) {
+        self.sourceCount = max(0, sourceCount)
+        pool.append(contentsOf: entries)
+        entries.removeAll(keepingCapacity: true)
+        entryIndices.removeAll(keepingCapacity: true)
+        window = 0..<0
+    }
+
+    /**
+     * Ensures the window covers the visible index range (inclusive, may lie outside the data).
+     * Returns true when `entries` changed and the dataset needs `replaceEntries`.
+     */
+    @discardableResult
+    func update(visibleLower: Int, visibleUpper: Int, force: Bool = false) -> Bool {
+        guard sourceCount > 0 else { return false }
+
+        let lower = max(0, min(visibleLower, sourceCount - 1))
+        let upper = max(lower, min(visibleUpper, sourceCount - 1))
+        let margin = max(minimumMargin, upper - lower + 1)
+        let target = max(0, lower - margin)..<min(sourceCount, upper + 1 + margin)
+
+        guard force || needsSlide(visible: lower...upper, margin: margin, target: target) else { return false }
+        slide(to: target)
+        return true
+    }
+
+    /**
+     * Materialises exactly `target` (clamped to the series), so an overlay series such as an
+     * indicator line stays index-aligned with the window of the series it is drawn over.
+     * Returns true when `entries` changed.
+     */
+    @discardableResult
+    func follow(_ target: Range<Int>) -> Bool {
+        let lower = min(max(0, target.lowerBound), sourceCount)
+        let upper = max(lower, min(sourceCount, target.upperBound))
+        guard lower..<upper != window else { return false }
+        slide(to: lower..<upper)
+        return true
+    }
+
+    // MARK: - Incremental Source Changes
+
+    /**
+     * Grows the source series by one point. When the window already reaches the end of the
+     * series the new index is materialised and returned so the caller can append it to the
+     * dataset in place; otherwise it is picked up the next time the window slides there.
+     */
+    func appendSource() -> Entry? {
+        let index = sourceCount
+        sourceCount += 1
+        guard !window.isEmpty, window.upperBound == index else { return nil }
+
+        window = window.lowerBound..<(index + 1)
+        let entry = pool.popLast() ?? makeEntry()
+        guard configure(entry, index) else {
+            pool.append(entry)
+            return nil
+        }
+        entries.append(entry)
+        entryIndices.append(index)
+        return entry
+    }
+
+    /// Re-reads the source value at `index` into its existing entry; returns the entry when materialised
+    func refreshSource(at index: Int) -> Entry? {
+        guard window.contains(index),
+              // Live updates touch the tail, so search from the end
+              let position = entryIndices.lastIndex(of: index) else { return nil }
+        let entry = entries[position]
+        return configure(entry, index) ? entry : nil
+    }
+
+    // MARK: - Private Helpers
+
+    private func needsSlide(visible: ClosedRange<Int>, margin: Int, target: Range<Int>) -> Bool {
+        guard !window.isEmpty else { return true }
+        let threshold = margin / 2
+        // Close to an edge that isn't the edge of the data
+        let nearLeft = window.lowerBound > 0 && visible.lowerBound - window.lowerBound < threshold
+        let nearRight = window.upperBound < sourceCount && window.upperBound - 1 - visible.upperBound < threshold
+        // Zoomed in far enough that the window is mostly off-screen
+        let oversized = window.count > target.count * 2
+        return nearLeft || nearRight || oversized
+    }
+
+    private func slide(to target: Range<Int>) {
+        let keepLower = max(window.lowerBound, target.lowerBound)
+        let keepUpper = min(window.upperBound, target.upperBound)
+        let overlap = keepLower < keepUpper ? keepLower..<keepUpper : target.lowerBound..<target.lowerBound
+
+        var nextEntries: [Entry] = []
+        var nextIndices: [Int] = []
+        nextEntries.reserveCapacity(target.count)
+        nextIndices.reserveCapacity(target.count)
+
+        // Recycle everything leaving the window before materialising what enters it
+        var kept: [(entry: Entry, index: Int)] = []
+        kept.reserveCapacity(overlap.count)
+        for (entry, index) in zip(entries, entryIndices) {
+            if overlap.contains(index) {
+                kept.append((entry, index))
+            } else {
+                pool.append(entry)
+            }
+        }
+
+        func materialise(_ range: Range<Int>) {
+            for index in range {
+                let entry = pool.popLast() ?? makeEntry()
+                if configure(entry, index) {
+                    nextEntries.append(entry)
+                    nextIndices.append(index)
+                } else {
+                    pool.append(entry)
+                }
+            }
+        }
+
+        materialise(target.lowerBound..<overlap.lowerBound)
+        for item in kept {
+            nextEntries.append(item.entry)
+            nextIndices.append(item.index)
+        }
+        materialise(overlap.upperBound..<target.upperBound)
+
+        entries = nextEntries
+        entryIndices = nextIndices
+        window = target
+
+        // Keep the pool no larger than one window so memory tracks the viewport
+        if pool.count > entries.count {
+            pool.removeLast(pool.count - entries.count)
+        }
+    }
+}
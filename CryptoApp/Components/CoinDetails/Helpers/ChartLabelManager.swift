@@ -24,6 +24,28 @@ class ChartLabelManager {
     private var rsiLabel: UILabel?
     private var currentPriceLabel: UILabel?
     
+    // MARK: - Formatters
+    
+    // Label updates run per crosshair move / viewport frame, so formatters are built once
+    private static let priceFormatter: NumberFormatter = {
+        let formatter = NumberFormatter()
+        formatter.numberStyle = .currency
+        formatter.currencySymbol = "$"
+        formatter.minimumFractionDigits = 2
+        formatter.maximumFractionDigits = 2
+        return formatter
+    }()
+    
+    private static let indicatorFormatter: NumberFormatter = {
+        let formatter = NumberFormatter()
+        formatter.numberStyle = .currency
+        formatter.currencySymbol = "$"
+        formatter.minimumFractionDigits = 2
+        formatter.maximumFractionDigits = 2
+        formatter.locale = Locale(identifier: "en_US")
+        return formatter
+    }()
+    
     // MARK: - Initialization
     
     init(parentChart: UIView) {
@@ -271,12 +293,7 @@ class ChartLabelManager {
         // Adaptive price formatting for micro-priced coins (non-abbreviated)
         let formattedPrice: String
         if price >= 1 {
-            let formatter = NumberFormatter()
-            formatter.numberStyle = .currency
-            formatter.currencySymbol = "$"
-            formatter.minimumFractionDigits = 2
-            formatter.maximumFractionDigits = 2
-            formattedPrice = formatter.string(from: NSNumber(value: price)) ?? String(format: "$%.2f", price)
+            formattedPrice = Self.priceFormatter.string(from: NSNumber(value: price)) ?? String(format: "$%.2f", price)
         } else if price > 0 {
             var decimals = 6
             var v = price
@@ -297,236 +314,42 @@ class ChartLabelManager {
         label.isHidden = false
     }
     
-    /// Updates labels with values at specific chart position (for crosshair interaction)
+    /**
+     * Updates labels with values at a specific source index (crosshair / viewport interaction).
+     * Indicator buffers are index-aligned with the chart series, so each lookup is one array read;
+     * this runs on every crosshair move and must stay free of scans, parsing and logging.
+     */
     func updateLabelsAtPosition(
         xIndex: Int,
-        smaDataSet: LineChartDataSet?,
-        emaDataSet: LineChartDataSet?,
-        rsiResult: TechnicalIndicators.RSIResult?,
+        sma: TechnicalIndicators.IndicatorBuffer?,
+        ema: TechnicalIndicators.IndicatorBuffer?,
+        rsi: TechnicalIndicators.IndicatorBuffer?,
         settings: TechnicalIndicators.IndicatorSettings,
         theme: ChartColorTheme,
         dataPointCount: Int = 0
     ) {
-        // Cache values to avoid duplicate calls
-        var smaValue: Double?
-        var emaValue: Double?
-        var rsiValue: Double?
-        
         // Update SMA at position
         if settings.showSMA {
-            if let smaDataSet = smaDataSet {
-                smaValue = getValueAtIndex(xIndex, from: smaDataSet)
-                // If no value found but SMA is enabled, provide helpful context
-                if smaValue == nil {
-                    // Check if we're before the SMA warm-up period
-                    if let firstValidIndex = getFirstValidIndicatorIndex(from: smaDataSet), xIndex < firstValidIndex {
-                        // User is viewing a time period before SMA calculation begins
-                        print("📍 User scrolled to index \(xIndex), but SMA line starts at index \(firstValidIndex)")
-                    }
-                }
-            }
             let smaColor = TechnicalIndicators.getIndicatorColor(for: "sma", theme: theme)
-            updateSMALabel(value: smaValue, period: settings.smaPeriod, color: smaColor, isVisible: true, dataCount: dataPointCount)
+            updateSMALabel(value: sma?.value(at: xIndex), period: settings.smaPeriod, color: smaColor, isVisible: true, dataCount: dataPointCount)
         } else {
             smaLabel?.isHidden = true
         }
         
         // Update EMA at position
         if settings.showEMA {
-            if let emaDataSet = emaDataSet {
-                emaValue = getValueAtIndex(xIndex, from: emaDataSet)
-                // If no value found but EMA is enabled, provide helpful context
-                if emaValue == nil {
-                    // Check if we're before the EMA warm-up period
-                    if let firstValidIndex = getFirstValidIndicatorIndex(from: emaDataSet), xIndex < firstValidIndex {
-                        // User is viewing a time period before EMA calculation begins
-                        print("📍 User scrolled to index \(xIndex), but EMA line starts at index \(firstValidIndex)")
-                    }
-                }
-            }
             let emaColor = TechnicalIndicators.getIndicatorColor(for: "ema", theme: theme)
-            updateEMALabel(value: emaValue, period: settings.emaPeriod, color: emaColor, isVisible: true, dataCount: dataPointCount)
+            updateEMALabel(value: ema?.value(at: xIndex), period: settings.emaPeriod, color: emaColor, isVisible: true, dataCount: dataPointCount)
         } else {
             emaLabel?.isHidden = true
         }
         
         // Update RSI at position
         if settings.showRSI {
-            if let rsiResult = rsiResult {
-                rsiValue = getRSIValueAtIndex(xIndex, from: rsiResult)
-            }
-            updateRSILabel(value: rsiValue, period: settings.rsiPeriod, isVisible: true, dataCount: dataPointCount)
+            updateRSILabel(value: rsi?.value(at: xIndex), period: settings.rsiPeriod, isVisible: true, dataCount: dataPointCount)
         } else {
             rsiLabel?.isHidden = true
         }
-        
-        // Summary of what's being monitored (using cached values)
-        print("📊 SUMMARY for Index \(xIndex):")
-        if settings.showSMA {
-            let smaText = smaValue.map { String(format: "%.2f", $0) } ?? "N/A"
-            print("   • SMA(\(settings.smaPeriod)): $\(smaText)")
-        }
-        if settings.showEMA {
-            let emaText = emaValue.map { String(format: "%.2f", $0) } ?? "N/A"
-            print("   • EMA(\(settings.emaPeriod)): $\(emaText)")
-        }
-        if settings.showRSI {
-            let rsiText = rsiValue.map { String(format: "%.2f", $0) } ?? "N/A"
-            print("   • RSI(\(settings.rsiPeriod)): \(rsiText)")
-        }
-        print("────────────────────────────────────────")
-    }
-    
-    /// Gets value from dataset at specific index, accounting for dataset offset
-    private func getValueAtIndex(_ index: Int, from dataSet: LineChartDataSet) -> Double? {
-        // For SMA/EMA datasets that start later due to warm-up period,
-        // we need to find the corresponding entry by matching x values (timestamps or indices)
-        
-        guard !dataSet.entries.isEmpty else { 
-            print("⚠️ Dataset is empty")
-            return nil 
-        }
-        
-        // ENHANCEMENT: Check if the indicator line is actually visible at this index
-        // SMA/EMA lines have a warm-up period and don't start from index 0
-        let isIndexInVisibleRange = isIndicatorVisibleAtIndex(index, in: dataSet)
-        guard isIndexInVisibleRange else {
-            print("📍 SMA/EMA line not visible at index \(index) - line starts at index \(getFirstValidIndicatorIndex(from: dataSet) ?? -1)")
-            return nil
-        }
-        
-        // Detect coordinate system: check if X values are timestamps (large numbers) or indices (small numbers)
-        let firstEntry = dataSet.entries.first!
-        let usesTimestamps = firstEntry.x > 10000 // Timestamps are much larger than indices
-        
-        if usesTimestamps {
-            // For timestamp-based datasets (line charts), find entry by index position in the original array
-            // Account for nil values filtered out during dataset creation
-            let warmupPeriod = getWarmupPeriodFromLabel(dataSet.label)
-            let adjustedIndex = index - warmupPeriod
-            
-            // Ensure adjusted index is valid for the filtered entries array
-            if adjustedIndex >= 0 && adjustedIndex < dataSet.entries.count {
-                let entry = dataSet.entries[adjustedIndex]
-                let value = entry.y
-                print("🎯 Timestamp-based: Retrieved \(String(format: "%.2f", value)) at adjusted index \(adjustedIndex) (original index: \(index), warmup: \(warmupPeriod), x: \(String(format: "%.0f", entry.x))) from dataset with \(dataSet.entries.count) entries")
-                return value
-            }
-        } else {
-            // For index-based datasets (candlestick charts), use direct X value matching
-            let targetX = Double(index)
-            
-            // Try exact match first
-            if let exactEntry = dataSet.entries.first(where: { abs($0.x - targetX) < 0.1 }) {
-                let value = exactEntry.y
-                print("🎯 Index-based exact: Retrieved \(String(format: "%.2f", value)) at index \(index) (x: \(exactEntry.x)) from dataset with \(dataSet.entries.count) entries")
-                return value
-            }
-        }
-        
-        // Fallback: Find the entry with the closest x value
-        let targetX = usesTimestamps ? firstEntry.x + (Double(index) * 3600) : Double(index) // Rough timestamp estimation for fallback
-        var closestEntry: ChartDataEntry?
-        var closestDistance = Double.infinity
-        
-        for entry in dataSet.entries {
-            let distance = abs(entry.x - targetX)
-            if distance < closestDistance {
-                closestDistance = distance
-                closestEntry = entry
-            }
-        }
-        
-        let tolerance = usesTimestamps ? 7200.0 : 1.0 // 2 hours for timestamps, 1 unit for indices
-        if let entry = closestEntry, closestDistance <= tolerance {
-            print("🎯 Fallback: Retrieved \(String(format: "%.2f", entry.y)) for target index \(index) (actual x: \(entry.x), distance: \(String(format: "%.1f", closestDistance)), uses timestamps: \(usesTimestamps)) from dataset with \(dataSet.entries.count) entries")
-            return entry.y
-        }
-        
-        print("⚠️ No matching entry found for index \(index) in dataset with \(dataSet.entries.count) entries (uses timestamps: \(usesTimestamps))")
-        return nil
-    }
-    
-    /// Checks if the indicator line is actually visible/drawn at the given index
-    private func isIndicatorVisibleAtIndex(_ index: Int, in dataSet: LineChartDataSet) -> Bool {
-        guard !dataSet.entries.isEmpty else { return false }
-        
-        // Find the first index where the indicator actually has data
-        guard let firstValidIndex = getFirstValidIndicatorIndex(from: dataSet) else { return false }
-        
-        // The indicator is only visible from its first valid data point onwards
-        return index >= firstValidIndex
-    }
-    
-    /// Gets the first index where the indicator has valid data (accounts for warm-up period)
-    private func getFirstValidIndicatorIndex(from dataSet: LineChartDataSet) -> Int? {
-        guard !dataSet.entries.isEmpty else { return nil }
-        
-        // For SMA/EMA datasets created with X values as timestamps,
-        // find the first entry's X value and convert it to an index
-        let firstEntry = dataSet.entries.first!
-        
-        // If X values are timestamps, we need to find the corresponding index
-        // If X values are direct indices, we can use them directly
-        let firstX = firstEntry.x
-        
-        // Check if X values appear to be timestamps (large numbers) or indices (small numbers)
-        if firstX > 10000 { // Likely timestamp
-            // For timestamp-based X values, we need a different approach
-            // The warm-up period means SMA(20) starts at index 19, etc.
-            // We can infer this from the dataset label
-            if let label = dataSet.label {
-                if label.contains("SMA") {
-                    // Extract period from label like "SMA(20)"
-                    let period = extractPeriodFromLabel(label) ?? 20
-                    return period - 1  // SMA(20) starts at index 19
-                } else if label.contains("EMA") {
-                    // Extract period from label like "EMA(12)"
-                    let period = extractPeriodFromLabel(label) ?? 12
-                    return period - 1  // EMA(12) starts at index 11
-                }
-            }
-            return 19 // Default warm-up for typical 20-period indicators
-        } else {
-            // X values are likely indices, use directly
-            return Int(firstX)
-        }
-    }
-    
-    /// Extracts the period number from indicator labels like "SMA(20)" or "EMA(12)"
-    private func extractPeriodFromLabel(_ label: String) -> Int? {
-        // Simple string parsing approach - more reliable than regex for this case
-        guard let startIndex = label.firstIndex(of: "("),
-              let endIndex = label.firstIndex(of: ")"),
-              startIndex < endIndex else {
-            return nil
-        }
-        
-        let numberString = String(label[label.index(after: startIndex)..<endIndex])
-        return Int(numberString)
-    }
-    
-    /// Gets the warmup period from dataset label (period - 1)
-    private func getWarmupPeriodFromLabel(_ label: String?) -> Int {
-        guard let label = label else { return 19 } // Default for typical 20-period indicators
-        
-        if let period = extractPeriodFromLabel(label) {
-            return period - 1 // SMA(20) needs 19 warmup periods, starts at index 19
-        }
-        
-        return 19 // Default warmup period
-    }
-    
-    /// Gets RSI value at specific index
-    private func getRSIValueAtIndex(_ index: Int, from rsiResult: TechnicalIndicators.RSIResult) -> Double? {
-        guard index >= 0 && index < rsiResult.values.count else { 
-            print("⚠️ RSI index \(index) out of bounds for RSI with \(rsiResult.values.count) values")
-            return nil 
-        }
-        let value = rsiResult.values[index]
-        let formattedValue = value.map { String(format: "%.2f", $0) } ?? "nil"
-        print("🎯 RSI: Retrieved \(formattedValue) at index \(index) from RSI with \(rsiResult.values.count) values")
-        return value
     }
     
     // MARK: - Private Helpers
@@ -534,13 +357,7 @@ class ChartLabelManager {
     /// Formats currency values with adaptive precision so micro-prices don't collapse to $0.00
     private func formatCurrency(_ value: Double) -> String {
         if value >= 1 {
-            let formatter = NumberFormatter()
-            formatter.numberStyle = .currency
-            formatter.currencySymbol = "$"
-            formatter.minimumFractionDigits = 2
-            formatter.maximumFractionDigits = 2
-            formatter.locale = Locale(identifier: "en_US")
-            return formatter.string(from: NSNumber(value: value)) ?? String(format: "$%.2f", value)
+            return Self.indicatorFormatter.string(from: NSNumber(value: value)) ?? String(format: "$%.2f", value)
         } else if value > 0 {
             var decimals = 6
             var v = value
@@ -576,9 +393,9 @@ extension ChartLabelManager {
     
     /// Updates all labels based on current chart data and settings
     func updateAllLabels(
-        smaDataSet: LineChartDataSet?,
-        emaDataSet: LineChartDataSet?, 
-        rsiResult: TechnicalIndicators.RSIResult?,
+        sma: TechnicalIndicators.IndicatorBuffer?,
+        ema: TechnicalIndicators.IndicatorBuffer?,
+        rsi: TechnicalIndicators.IndicatorBuffer?,
         settings: TechnicalIndicators.IndicatorSettings,
         theme: ChartColorTheme,
         rsiAreaTop: CGFloat? = nil,
@@ -586,18 +403,15 @@ extension ChartLabelManager {
         dataPointCount: Int = 0
     ) {
         // Update SMA label
-        let smaValue = getLatestSMAValue(from: smaDataSet)
         let smaColor = TechnicalIndicators.getIndicatorColor(for: "sma", theme: theme)
-        updateSMALabel(value: smaValue, period: settings.smaPeriod, color: smaColor, isVisible: settings.showSMA, dataCount: dataPointCount)
+        updateSMALabel(value: sma?.latest, period: settings.smaPeriod, color: smaColor, isVisible: settings.showSMA, dataCount: dataPointCount)
         
         // Update EMA label
-        let emaValue = getLatestEMAValue(from: emaDataSet)
         let emaColor = TechnicalIndicators.getIndicatorColor(for: "ema", theme: theme)
-        updateEMALabel(value: emaValue, period: settings.emaPeriod, color: emaColor, isVisible: settings.showEMA, dataCount: dataPointCount)
+        updateEMALabel(value: ema?.latest, period: settings.emaPeriod, color: emaColor, isVisible: settings.showEMA, dataCount: dataPointCount)
         
         // Update RSI label
-        let rsiValue = rsiResult != nil ? getLatestRSIValue(from: rsiResult!) : nil
-        updateRSILabel(value: rsiValue, period: settings.rsiPeriod, isVisible: settings.showRSI, dataCount: dataPointCount)
+        updateRSILabel(value: rsi?.latest, period: settings.rsiPeriod, isVisible: settings.showRSI, dataCount: dataPointCount)
         
         // Position RSI label in RSI section if coordinates provided
         if let rsiTop = rsiAreaTop, let rsiHeight = rsiAreaHeight, settings.showRSI {
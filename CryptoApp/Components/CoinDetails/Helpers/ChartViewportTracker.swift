@@ -0,0 +1,105 @@
+//
+//  ChartViewportTracker.swift
+//  CryptoApp
+//
+
+import UIKit
+
+/**
+ * CHART VIEWPORT TRACKER
+ *
+ * Event-driven replacement for polling the chart's visible range on a repeating Timer:
+ * - Charts call `viewportDidChange()` from their pan/zoom/deceleration delegate callbacks
+ *   (and after programmatic moves); the call only marks the viewport dirty
+ * - A CADisplayLink delivers at most one `onChange` per frame while changes keep coming
+ * - After a couple of frames without changes the link pauses, so an idle chart causes
+ *   no main-thread wakeups at all
+ *
+ * NOTE: Main-thread only. Call `stop()` when the chart leaves its window.
+ */
+final class ChartViewportTracker {
+
+    // MARK: - Properties
+
+    /// Frames without changes before the display link pauses (covers the last deceleration frame)
+    private let idleFramesBeforePause = 2
+
+    private let onChange: () -> Void
+    private var displayLink: CADisplayLink?
+    private var isDirty = false
+    private var idleFrames = 0
+
+    /// True while the display link is delivering frames (exposed for tests and diagnostics)
+    var isRunning: Bool { displayLink.map { !$0.isPaused } ?? false }
+
+    // MARK: - Initialization
+
+    init(onChange: @escaping () -> Void) {
+        self.onChange = onChange
+    }
+
+    deinit {
+        displayLink?.invalidate()
+    }
+
+    // MARK: - Public API
+
+    /// Marks the viewport as changed; `onChange` runs on the next display frame
+    func viewportDidChange() {
+        isDirty = true
+        idleFrames = 0
+        if let link = displayLink {
+            link.isPaused = false
+        } else {
+            // Proxy target: CADisplayLink retains its target strongly
+            let link = CADisplayLink(target: DisplayLinkProxy(self), selector: #selector(DisplayLinkProxy.tick))
+            link.add(to: .main, forMode: .common)
+            displayLink = link
+        }
+    }
+
+    /// Delivers any pending change immediately instead of waiting for the next frame
+    func flush() {
+        guard isDirty else { return }
+        isDirty = false
+        onChange()
+    }
+
+    /// Tears down the display link and drops any pending change
+    func stop() {
+        displayLink?.invalidate()
+        displayLink = nil
+        isDirty = false
+        idleFrames = 0
+    }
+
+    // MARK: - Frame Handling
+
+    fileprivate func displayLinkFired() {
+        if isDirty {
+            isDirty = false
+            idleFrames = 0
+            onChange()
+        } else {
+            idleFrames += 1
+            if idleFrames >= idleFramesBeforePause {
+                displayLink?.isPaused = true
+            }
+        }
+    }
+}
+
+// MARK: - Display Link Proxy
+
+/// Weak trampoline so the display link doesn't keep the tracker (and its chart) alive
+private final class DisplayLinkProxy {
+    private weak var tracker: ChartViewportTracker?
+
+    init(_ tracker: ChartViewportTracker) {
+        self.tracker = tracker
+    }
+
+    @objc func tick() {
+        tracker?.displayLinkFired()
+    }
+}
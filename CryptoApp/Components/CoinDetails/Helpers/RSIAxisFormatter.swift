@@ -12,11 +12,13 @@ class RSISeparateAxisFormatter: NSObject, AxisValueFormatter {
     private let rsiStart: Double
     private let rsiEnd: Double
     private let priceStart: Double
+    private let priceFormatter: AxisValueFormatter
     
-    init(rsiStart: Double, rsiEnd: Double, priceStart: Double) {
+    init(rsiStart: Double, rsiEnd: Double, priceStart: Double, priceFormatter: AxisValueFormatter = PriceFormatter()) {
         self.rsiStart = rsiStart
         self.rsiEnd = rsiEnd
         self.priceStart = priceStart
+        self.priceFormatter = priceFormatter
         super.init()
     }
     
@@ -27,7 +29,7 @@ class RSISeparateAxisFormatter: NSObject, AxisValueFormatter {
             return ""
         } else if value >= priceStart {
             // For price section, use price formatting
-            return PriceFormatter().stringForValue(value, axis: axis)
+            return priceFormatter.stringForValue(value, axis: axis)
         } else {
             // Hide labels in gap between sections
             return ""
@@ -46,6 +46,9 @@ class CandlestickBalloonMarker: MarkerImage {
     /// Current time range filter that affects date/time formatting
     private var currentRange: String = "24h"
     
+    /// Maps displayed candle values back to prices (log / percent chart modes); nil shows them as-is
+    private var priceForValue: ((Double) -> Double)?
+    
     // MARK: - Internal Drawing State
     
     /// Multi-line formatted text containing OHLC data and trend information
@@ -108,6 +111,15 @@ class CandlestickBalloonMarker: MarkerImage {
         self.currentRange = range
     }
     
+    /**
+     * Sets how displayed candle values map back to prices, so tooltips keep showing prices
+     * when the chart plots log or percent-from-start values
+     * - Parameter mapping: Display value → price, or nil when values already are prices
+     */
+    func updatePriceMapping(_ mapping: ((Double) -> Double)?) {
+        self.priceForValue = mapping
+    }
+    
     // MARK: - Price Formatting
     
     /**
@@ -240,30 +252,36 @@ class CandlestickBalloonMarker: MarkerImage {
         
         // Extract OHLC data and create OKX-style tooltip content
         if let candleEntry = entry as? CandleChartDataEntry {
+            // Tooltips always show prices, whatever value space the chart plots in
+            let open = priceForValue?(candleEntry.open) ?? candleEntry.open
+            let high = priceForValue?(candleEntry.high) ?? candleEntry.high
+            let low = priceForValue?(candleEntry.low) ?? candleEntry.low
+            let close = priceForValue?(candleEntry.close) ?? candleEntry.close
+            
             // Analyze candlestick sentiment for color coding
-            let _ = candleEntry.close >= candleEntry.open  // isBullish unused
+            let _ = close >= open  // isBullish unused
             
             // Calculate price change metrics
-            let changeValue = candleEntry.close - candleEntry.open
-            let changePercent = (changeValue / candleEntry.open) * 100
+            let changeValue = close - open
+            let changePercent = (changeValue / open) * 100
             let changeSign = changeValue >= 0 ? "+" : "-"
             
             // Calculate additional metrics like OKX
-            let range = candleEntry.high - candleEntry.low
-            let denominator = candleEntry.low != 0 ? candleEntry.low : max(candleEntry.high, 1e-12)
+            let range = high - low
+            let denominator = low != 0 ? low : max(high, 1e-12)
             let rangePercent = (range / denominator) * 100
             
             // Format the current price (close) prominently like OKX
-            let _ = formatPrice(candleEntry.close)  // formattedPrice unused
+            let _ = formatPrice(close)  // formattedPrice unused
             let formattedChangePercent = String(format: "%.2f", abs(changePercent))
             
             // Build compact tooltip - more vertical and concise
             label = """
             \(formatter.string(from: date))
-            Open \(formatPrice(candleEntry.open))
-            High \(formatPrice(candleEntry.high))
-            Low \(formatPrice(candleEntry.low))
-            Close \(formatPrice(candleEntry.close))
+            Open \(formatPrice(open))
+            High \(formatPrice(high))
+            Low \(formatPrice(low))
+            Close \(formatPrice(close))
             Chg \(changeSign)\(formatPrice(abs(changeValue)))
             %Chg \(changeSign)\(formattedChangePercent)%
             Range \(String(format: "%.2f", rangePercent))%
@@ -276,7 +294,7 @@ class CandlestickBalloonMarker: MarkerImage {
         // Extract change value for color coding
         let changeValue: Double
         if let candleEntry = entry as? CandleChartDataEntry {
-            changeValue = candleEntry.close - candleEntry.open
+            changeValue = (priceForValue?(candleEntry.close) ?? candleEntry.close) - (priceForValue?(candleEntry.open) ?? candleEntry.open)
         } else {
             changeValue = 0
         }
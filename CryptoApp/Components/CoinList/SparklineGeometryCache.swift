@@ -0,0 +1,216 @@
+//
+//  SparklineGeometryCache.swift
+//  CryptoApp
+//
+
+import UIKit
+
+/**
+ * SPARKLINE GEOMETRY CACHE
+ *
+ * Render-ready sparkline geometry so list cells don't re-normalise and rebuild paths per draw:
+ * - Values are normalised once into a compact Float32 buffer of (x, y) pairs in view points
+ * - Stroke and gradient-fill CGPaths are built from that buffer once and shared by every draw
+ * - Entries are keyed by (data version, pixel size) and held in a small LRU, so scrolling a
+ *   long list back and forth reuses the geometry of recently shown rows
+ * - Longer series are built on a background queue; short ones inline, where a queue hop
+ *   costs more than the work
+ * - Gradients are shared per resolved line colour
+ *
+ * NOTE: Lookups, inserts and gradient access are main-thread only; builds run off-main.
+ */
+final class SparklineGeometryCache {
+
+    static let shared = SparklineGeometryCache()
+
+    // MARK: - Types
+
+    struct Key: Hashable {
+        /// Content hash of the values (changes whenever the series changes)
+        let version: Int
+        let pixelWidth: Int
+        let pixelHeight: Int
+
+        init(values: [Double], size: CGSize, scale: CGFloat) {
+            var hasher = Hasher()
+            hasher.combine(values.count)
+            for value in values {
+                hasher.combine(value)
+            }
+            self.version = hasher.finalize()
+            self.pixelWidth = Int((size.width * scale).rounded())
+            self.pixelHeight = Int((size.height * scale).rounded())
+        }
+    }
+
+    final class Geometry {
+        /// Interleaved x, y coordinates in view points
+        let points: ContiguousArray<Float>
+        let strokePath: CGPath
+        /// Stroke path closed along the bottom edge, clip region for the gradient
+        let fillPath: CGPath
+
+        var pointCount: Int { points.count / 2 }
+
+        /// Approximate bytes held (buffer plus two paths of the same length)
+        var byteCost: Int { points.count * MemoryLayout<Float>.stride * 5 }
+
+        /// Nil for fewer than two points or a flat series (nothing to draw)
+        init?(values: [Double], size: CGSize) {
+            guard values.count > 1, size.width > 0, size.height > 0 else { return nil }
+
+            var minValue = Double.infinity
+            var maxValue = -Double.infinity
+            for value in values {
+                minValue = min(minValue, value)
+                maxValue = max(maxValue, value)
+            }
+            let valueRange = maxValue - minValue
+            guard valueRange > 0, valueRange.isFinite else { return nil }
+
+            let width = Float(size.width)
+            let height = Float(size.height)
+            let stepX = width / Float(values.count - 1)
+            let scaleY = height / Float(valueRange)
+
+            var points = ContiguousArray<Float>()
+            points.reserveCapacity(values.count * 2)
+            for (index, value) in values.enumerated() {
+                points.append(Float(index) * stepX)
+                points.append(height - Float(value - minValue) * scaleY)
+            }
+
+            let stroke = CGMutablePath()
+            stroke.move(to: CGPoint(x: CGFloat(points[0]), y: CGFloat(points[1])))
+            for i in stride(from: 2, to: points.count, by: 2) {
+                stroke.addLine(to: CGPoint(x: CGFloat(points[i]), y: CGFloat(points[i + 1])))
+            }
+
+            let fill = stroke.mutableCopy() ?? CGMutablePath()
+            fill.addLine(to: CGPoint(x: size.width, y: size.height))
+            fill.addLine(to: CGPoint(x: 0, y: size.height))
+            fill.closeSubpath()
+
+            self.points = points
+            self.strokePath = stroke.copy() ?? stroke
+            self.fillPath = fill.copy() ?? fill
+        }
+    }
+
+    // MARK: - Properties
+
+    /// Series longer than this are built off the main thread
+    private let inlineBuildThreshold = 64
+
+    private let geometries: LRUCache<Key, Geometry>
+    /// Keys whose geometry failed to build (flat/too short), so draws don't retry them
+    private let emptyKeys = LRUCache<Key, Bool>(countLimit: 256)
+    private var pendingCompletions: [Key: [(Geometry?) -> Void]] = [:]
+    private var gradients: [CGColor: CGGradient] = [:]
+
+    private let buildQueue = DispatchQueue(label: "com.cryptoapp.sparkline.geometry", qos: .userInitiated)
+
+    // MARK: - Initialization
+
+    /// Default limit comfortably covers the rows of a few screens in both scroll directions
+    init(countLimit: Int = 300) {
+        geometries = LRUCache(countLimit: countLimit)
+        MemoryAccountant.shared.register(self)
+    }
+
+    // MARK: - Geometry
+
+    /// Cached geometry for `key`, or nil when it hasn't been built yet
+    func cachedGeometry(for key: Key) -> Geometry? {
+        geometries.value(forKey: key)
+    }
+
+    /**
+     * Returns cached geometry immediately when available. Otherwise builds it (inline for short
+     * series, off-main for long ones) and calls `completion` on the main thread. Concurrent
+     * requests for the same key share one build.
+     */
+    @discardableResult
+    func geometry(for key: Key, values: [Double], size: CGSize, completion: @escaping (Geometry?) -> Void) -> Geometry? {
+        if let cached = geometries.value(forKey: key) {
+            return cached
+        }
+        if emptyKeys.contains(key) {
+            return nil
+        }
+
+        if values.count <= inlineBuildThreshold {
+            let geometry = Geometry(values: values, size: size)
+            store(geometry, for: key)
+            return geometry
+        }
+
+        if pendingCompletions[key] != nil {
+            pendingCompletions[key]?.append(completion)
+            return nil
+        }
+        pendingCompletions[key] = [completion]
+
+        buildQueue.async { [weak self] in
+            let geometry = Geometry(values: values, size: size)
+            DispatchQueue.main.async {
+                guard let self = self else { return }
+                self.store(geometry, for: key)
+                let completions = self.pendingCompletions.removeValue(forKey: key) ?? []
+                completions.forEach { $0(geometry) }
+            }
+        }
+        return nil
+    }
+
+    private func store(_ geometry: Geometry?, for key: Key) {
+        if let geometry = geometry {
+            geometries.setValue(geometry, forKey: key, cost: geometry.byteCost)
+        } else {
+            emptyKeys.setValue(true, forKey: key)
+        }
+    }
+
+    func removeAll() {
+        geometries.removeAll()
+        emptyKeys.removeAll()
+        gradients.removeAll()
+    }
+
+    var count: Int { geometries.count }
+
+    // MARK: - Gradients
+
+    /// Shared top-to-bottom fade for a (resolved) line colour
+    func fillGradient(for color: CGColor) -> CGGradient? {
+        if let gradient = gradients[color] {
+            return gradient
+        }
+        let colors = [
+            color.copy(alpha: 0.3) ?? color,
+            color.copy(alpha: 0.0) ?? color
+        ]
+        guard let gradient = CGGradient(colorsSpace: color.colorSpace ?? CGColorSpaceCreateDeviceRGB(),
+                                        colors: colors as CFArray,
+                                        locations: [0.0, 1.0]) else { return nil }
+        gradients[color] = gradient
+        return gradient
+    }
+}
+
+// MARK: - Memory Accounting
+
+extension SparklineGeometryCache: MemoryAccountable {
+
+    func memoryFootprint() -> MemoryFootprint {
+        MemoryFootprint(name: "SparklineGeometryCache", bytes: geometries.totalCost, tier: .derived)
+    }
+
+    /// Geometry is rebuilt from the sparkline values on the next draw
+    func releaseMemory(for tier: MemoryPressureTier) -> Int {
+        guard tier == .derived else { return 0 }
+        let freed = geometries.totalCost
+        removeAll()
+        return freed
+    }
+}
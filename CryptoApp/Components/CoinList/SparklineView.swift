@@ -11,6 +11,11 @@ class SparklineView: UIView {
     private var dataPoints: [Double] = []
     private var isPositiveChange: Bool = true
     
+    // Geometry comes from the shared cache; draw() only strokes/fills prebuilt paths
+    private let geometryCache = SparklineGeometryCache.shared
+    private var geometryKey: SparklineGeometryCache.Key?
+    private var geometry: SparklineGeometryCache.Geometry?
+    
     override init(frame: CGRect) {
         super.init(frame: frame)
         setupView()
@@ -29,6 +34,7 @@ class SparklineView: UIView {
     func configure(_ dataPoints: [Double], isPositive: Bool) {
         self.dataPoints = dataPoints
         self.isPositiveChange = isPositive
+        resolveGeometry()
         setNeedsDisplay()
     }
     
@@ -37,81 +43,77 @@ class SparklineView: UIView {
         configure(doubleArray, isPositive: isPositive)
     }
     
-    // This is where the UIBezierPath plots the sparkline based on the values
+    override func layoutSubviews() {
+        super.layoutSubviews()
+        // Size changes need geometry for the new pixel size (contentMode .redraw schedules the draw)
+        resolveGeometry()
+    }
+    
+    override func traitCollectionDidChange(_ previousTraitCollection: UITraitCollection?) {
+        super.traitCollectionDidChange(previousTraitCollection)
+        // Line colours resolve per interface style; the geometry itself is unchanged
+        if traitCollection.hasDifferentColorAppearance(comparedTo: previousTraitCollection) {
+            setNeedsDisplay()
+        }
+    }
+    
+    /// Picks up cached geometry for the current data and size, or requests it from the cache
+    private func resolveGeometry() {
+        guard dataPoints.count > 1, bounds.width > 0, bounds.height > 0 else {
+            geometryKey = nil
+            geometry = nil
+            return
+        }
+        
+        let scale = window?.screen.scale ?? UIScreen.main.scale
+        let key = SparklineGeometryCache.Key(values: dataPoints, size: bounds.size, scale: scale)
+        guard key != geometryKey else { return }
+        geometryKey = key
+        
+        geometry = geometryCache.geometry(for: key, values: dataPoints, size: bounds.size) { [weak self] geometry in
+            // Ignore builds for data this (reused) view no longer shows
+            guard let self = self, self.geometryKey == key else { return }
+            self.geometry = geometry
+            self.setNeedsDisplay()
+        }
+    }
+    
+    // Strokes the cached sparkline path and fills it with the shared gradient
     override func draw(_ rect: CGRect) {
         super.draw(rect)
         
-        guard dataPoints.count > 1 else { return }
-        
-        let context = UIGraphicsGetCurrentContext()
-        context?.clear(rect)
+        guard let geometry = geometry, let context = UIGraphicsGetCurrentContext() else { return }
+        context.clear(rect)
         
         // Set line color based on positive/negative change
-        let lineColor = isPositiveChange ? UIColor.systemGreen : UIColor.systemRed
-        context?.setStrokeColor(lineColor.cgColor)
-        context?.setLineWidth(2.0)
-        context?.setLineCap(.round)
-        context?.setLineJoin(.round)
-        
-        // Calculate min and max values for scaling
-        let minValue = dataPoints.min() ?? 0
-        let maxValue = dataPoints.max() ?? 0
-        let valueRange = maxValue - minValue
-        
-        // Avoid division by zero
-        guard valueRange > 0 else { return }
-        
-        // Calculate points
-        let stepX = rect.width / CGFloat(dataPoints.count - 1)
-        let path = UIBezierPath()
-        
-        for (index, value) in dataPoints.enumerated() {
-            let x = CGFloat(index) * stepX
-            let normalizedValue = (value - minValue) / valueRange
-            let y = rect.height - (CGFloat(normalizedValue) * rect.height)
-            
-            if index == 0 {
-                path.move(to: CGPoint(x: x, y: y))
-            } else {
-                path.addLine(to: CGPoint(x: x, y: y))
-            }
-        }
+        let lineColor = (isPositiveChange ? UIColor.systemGreen : UIColor.systemRed)
+            .resolvedColor(with: traitCollection)
+            .cgColor
+        context.setStrokeColor(lineColor)
+        context.setLineWidth(2.0)
+        context.setLineCap(.round)
+        context.setLineJoin(.round)
         
         // Draw the path
-        context?.addPath(path.cgPath)
-        context?.strokePath()
+        context.addPath(geometry.strokePath)
+        context.strokePath()
         
         // Add a subtle gradient fill
-        drawGradientFill(context: context, path: path, rect: rect, color: lineColor)
+        drawGradientFill(context: context, geometry: geometry, color: lineColor)
     }
     
-    private func drawGradientFill(context: CGContext?, path: UIBezierPath, rect: CGRect, color: UIColor) {
-        guard let context = context else { return }
-        
-        // Create a copy of the path and close it to the bottom
-        let fillPath = path.copy() as! UIBezierPath
-        fillPath.addLine(to: CGPoint(x: rect.width, y: rect.height))
-        fillPath.addLine(to: CGPoint(x: 0, y: rect.height))
-        fillPath.close()
-        
-        // Create gradient
-        let colorSpace = CGColorSpaceCreateDeviceRGB()
-        let colors = [
-            color.withAlphaComponent(0.3).cgColor,
-            color.withAlphaComponent(0.0).cgColor
-        ]
-        
-        guard let gradient = CGGradient(colorsSpace: colorSpace, colors: colors as CFArray, locations: [0.0, 1.0]) else { return }
+    private func drawGradientFill(context: CGContext, geometry: SparklineGeometryCache.Geometry, color: CGColor) {
+        guard let gradient = geometryCache.fillGradient(for: color) else { return }
         
         // Save context state
         context.saveGState()
         
-        // Add the fill path to the context and clip
-        context.addPath(fillPath.cgPath)
+        // Clip to the area under the line
+        context.addPath(geometry.fillPath)
         context.clip()
         
         // Draw the gradient
-        context.drawLinearGradient(gradient, start: CGPoint(x: 0, y: 0), end: CGPoint(x: 0, y: rect.height), options: [])
+        context.drawLinearGradient(gradient, start: .zero, end: CGPoint(x: 0, y: bounds.height), options: [])
         
         // Restore context state
         context.restoreGState()
@@ -122,7 +124,9 @@ extension SparklineView {
     
     // Generates sample sparkline data based on percentage change
     // This simulates historical price movement leading to the current change
-    static func generateSampleData(for percentChange: Double, points: Int = 20) -> [Double] {
+    // A seed makes the series repeatable, so reconfiguring a cell yields the same data version
+    static func generateSampleData(for percentChange: Double, points: Int = 20, seed: UInt64? = nil) -> [Double] {
+        var generator = SeededGenerator(seed: seed ?? UInt64.random(in: 0...UInt64.max))
         var dataPoints: [Double] = []
         let baseValue = 100.0 // Every graph starts from a base price of 100.0.
         
@@ -142,12 +146,12 @@ extension SparklineView {
             let progress = Double(i) / Double(points - 1)
             
             // randomFactor adds slight zig-zag noise to look like a real chart.
-            let randomFactor = Double.random(in: -0.02...0.02)
+            let randomFactor = Double.random(in: -0.02...0.02, using: &generator)
             let trendValue = baseValue + (totalChange * progress) + (baseValue * randomFactor)
             
             // Add some volatility
             let volatility = abs(percentChange) * 0.1
-            let noise = Double.random(in: -volatility...volatility)
+            let noise = Double.random(in: -volatility...volatility, using: &generator)
             currentValue = trendValue + noise
             
             // Ensures the last point accurately reflects the 24h % change.
@@ -160,3 +164,20 @@ extension SparklineView {
         return dataPoints
     }
 }
+
+/// SplitMix64 - small deterministic generator for repeatable sample series
+private struct SeededGenerator: RandomNumberGenerator {
+    private var state: UInt64
+    
+    init(seed: UInt64) {
+        state = seed
+    }
+    
+    mutating func next() -> UInt64 {
+        state &+= 0x9E3779B97F4A7C15
+        var z = state
+        z = (z ^ (z >> 30)) &* 0xBF58476D1CE4E5B9
+        z = (z ^ (z >> 27)) &* 0x94D049BB133111EB
+        return z ^ (z >> 31)
+    }
+}
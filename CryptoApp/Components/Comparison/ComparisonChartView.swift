@@ -0,0 +1,148 @@
+//
+//  ComparisonChartView.swift
+//  CryptoApp
+//
+
+import UIKit
+import DGCharts
+
+/**
+ * COMPARISON CHART VIEW
+ *
+ * Overlays several coins' percent-change lines on one aligned time grid.
+ * Entries use the grid index as x, so every line shares the same x for a given point in time
+ * and a single tap or drag highlights all lines at once (shared crosshair).
+ */
+final class ComparisonChartView: LineChartView {
+
+    // MARK: - Properties
+
+    static let palette: [UIColor] = [.systemOrange, .systemBlue, .systemPurple, .systemTeal, .systemPink]
+
+    /// Called with the highlighted grid index, or nil when the crosshair is cleared
+    var onCrosshairMoved: ((Int?) -> Void)?
+
+    private let dateFormatter = IndexDateFormatter()
+    private var comparison: CoinComparison?
+
+    // MARK: - Init
+
+    override init(frame: CGRect) {
+        super.init(frame: frame)
+        configure()
+    }
+
+    required init?(coder: NSCoder) {
+        super.init(coder: coder)
+        configure()
+    }
+
+    // MARK: - Chart Setup
+
+    private func configure() {
+        delegate = self
+        ChartConfigurationHelper.configureBasicSettings(for: self)
+        ChartConfigurationHelper.configureAxes(for: self)
+
+        rightAxis.valueFormatter = PercentChangeFormatter()
+        xAxis.valueFormatter = dateFormatter
+        xAxis.granularity = 1
+        xAxis.labelCount = 4
+
+        highlightPerTapEnabled = true
+        highlightPerDragEnabled = true
+        scaleYEnabled = false
+        autoScaleMinMaxEnabled = true
+        setViewPortOffsets(left: 16, top: 16, right: 60, bottom: 32)
+        noDataText = ""
+    }
+
+    static func color(at index: Int) -> UIColor {
+        palette[index % palette.count]
+    }
+
+    // MARK: - Data
+
+    func configure(with comparison: CoinComparison?) {
+        self.comparison = comparison
+        highlightValue(nil)
+        guard let comparison = comparison, !comparison.isEmpty else {
+            data = nil
+            return
+        }
+
+        dateFormatter.update(dates: comparison.timestamps, range: comparison.range)
+
+        let dataSets = comparison.lines.enumerated().map { index, line -> LineChartDataSet in
+            var entries: [ChartDataEntry] = []
+            entries.reserveCapacity(line.percentChanges.count)
+            for (x, value) in line.percentChanges.enumerated() where value.isFinite {
+                entries.append(ChartDataEntry(x: Double(x), y: value))
+            }
+
+            let dataSet = LineChartDataSet(entries: entries, label: line.symbol)
+            let color = Self.color(at: index)
+            dataSet.setColor(color)
+            dataSet.lineWidth = 1.6
+            dataSet.drawCirclesEnabled = false
+            dataSet.drawValuesEnabled = false
+            dataSet.mode = .linear
+            dataSet.highlightColor = .secondaryLabel
+            dataSet.highlightLineWidth = 0.8
+            dataSet.drawHorizontalHighlightIndicatorEnabled = false
+            return dataSet
+        }
+
+        data = LineChartData(dataSets: dataSets)
+        fitScreen()
+    }
+
+    /// Highlights every line at the same grid index
+    private func highlightAll(at index: Int) {
+        guard let dataSets = data?.dataSets, let lines = comparison?.lines else { return }
+        let highlights = dataSets.indices.compactMap { setIndex -> Highlight? in
+            guard let value = lines[safe: setIndex]?.percentChanges[safe: index], value.isFinite else { return nil }
+            return Highlight(x: Double(index), y: value, dataSetIndex: setIndex)
+        }
+        highlightValues(highlights)
+    }
+}
+
+// MARK: - Delegate Handling
+
+extension ComparisonChartView: ChartViewDelegate {
+
+    func chartValueSelected(_ chartView: ChartViewBase, entry: ChartDataEntry, highlight: Highlight) {
+        let index = Int(entry.x)
+        highlightAll(at: index)
+        onCrosshairMoved?(index)
+    }
+
+    func chartValueNothingSelected(_ chartView: ChartViewBase) {
+        chartView.highlightValue(nil)
+        onCrosshairMoved?(nil)
+    }
+}
+
+// MARK: - Index Date Formatter
+
+/// Maps grid indices back to their timestamps for the x axis
+private final class IndexDateFormatter: AxisValueFormatter {
+
+    private var dates: [Date] = []
+    private let formatter = DateFormatter()
+
+    init() {
+        formatter.timeZone = TimeZone.current
+    }
+
+    func update(dates: [Date], range: String) {
+        self.dates = dates
+        formatter.dateFormat = range == "1" ? "h a" : "MM/dd"
+    }
+
+    func stringForValue(_ value: Double, axis: AxisBase?) -> String {
+        guard let date = dates[safe: Int(value.rounded())] else { return "" }
+        return formatter.string(from: date)
+    }
+}
@@ -6,6 +6,12 @@ protocol FilterHeaderViewDelegate: AnyObject {
     func filterHeaderView(_ headerView: FilterHeaderView, didTapPriceChangeButton button: FilterButton)
     func filterHeaderView(_ headerView: FilterHeaderView, didTapTopCoinsButton button: FilterButton)
     func filterHeaderView(_ headerView: FilterHeaderView, didTapAddCoinsButton button: UIButton) // New delegate method
+    func filterHeaderView(_ headerView: FilterHeaderView, didTapPatternsButton button: FilterButton)
+}
+
+extension FilterHeaderViewDelegate {
+    // Pattern button only exists in coin list mode
+    func filterHeaderView(_ headerView: FilterHeaderView, didTapPatternsButton button: FilterButton) {}
 }
 
 // MARK: - FilterHeaderView
@@ -27,6 +33,7 @@ class FilterHeaderView: UIView {
     
     private var priceChangeButton: FilterButton!
     private var topCoinsButton: FilterButton!
+    private var patternsButton: FilterButton! // Candle pattern screen (coin list mode)
     private var addCoinsButton: UIButton! // New + button for watchlist mode
     
     // MARK: - Initialization
@@ -83,6 +90,11 @@ class FilterHeaderView: UIView {
             topCoinsButton = FilterButton(title: topCoinsDisplayText.title)
             topCoinsButton.addTarget(self, action: #selector(topCoinsButtonTapped), for: .touchUpInside)
             topCoinsButton.translatesAutoresizingMaskIntoConstraints = false
+            
+            // Candle pattern filter button (only shown in coin list mode)
+            patternsButton = FilterButton(title: filterState.patternDisplayText.title)
+            patternsButton.addTarget(self, action: #selector(patternsButtonTapped), for: .touchUpInside)
+            patternsButton.translatesAutoresizingMaskIntoConstraints = false
         }
     }
     
@@ -114,6 +126,7 @@ class FilterHeaderView: UIView {
             buttonContainer.spacing = 12
             buttonContainer.addArrangedSubview(priceChangeButton)
             buttonContainer.addArrangedSubview(topCoinsButton)
+            buttonContainer.addArrangedSubview(patternsButton)
             
             stackView.addArrangedSubview(buttonContainer)
             
@@ -147,7 +160,8 @@ class FilterHeaderView: UIView {
             ])
         } else {
             NSLayoutConstraint.activate([
-                topCoinsButton.widthAnchor.constraint(equalToConstant: 110)
+                topCoinsButton.widthAnchor.constraint(equalToConstant: 110),
+                patternsButton.widthAnchor.constraint(equalToConstant: 96) // Narrower so three buttons fit on compact phones
             ])
         }
     }
@@ -166,11 +180,14 @@ class FilterHeaderView: UIView {
     func setLoading(_ isLoading: Bool, for buttonType: FilterType) {
         let button: FilterButton?
         
-        if buttonType == .priceChange {
+        switch buttonType {
+        case .priceChange:
             button = priceChangeButton
-        } else {
+        case .topCoins:
             // Only try to access topCoinsButton if not in watchlist mode
             button = isWatchlistMode ? nil : topCoinsButton
+        case .patterns:
+            button = isWatchlistMode ? nil : patternsButton
         }
         
         // Simple visual feedback - slight dimming during filter application
@@ -190,6 +207,7 @@ class FilterHeaderView: UIView {
         if !isWatchlistMode {
             let topCoinsDisplay = filterState.topCoinsDisplayText
             topCoinsButton?.updateTitle(topCoinsDisplay.title)
+            patternsButton?.updateTitle(filterState.patternDisplayText.title)
         }
     }
     
@@ -198,9 +216,11 @@ class FilterHeaderView: UIView {
         // But keeping it for potential future use or if called from elsewhere
         if isWatchlistMode {
             topCoinsButton?.isHidden = true
+            patternsButton?.isHidden = true
             addCoinsButton?.isHidden = false
         } else {
             topCoinsButton?.isHidden = false
+            patternsButton?.isHidden = false
             addCoinsButton?.isHidden = true
         }
     }
@@ -215,6 +235,10 @@ class FilterHeaderView: UIView {
         delegate?.filterHeaderView(self, didTapTopCoinsButton: topCoinsButton)
     }
     
+    @objc private func patternsButtonTapped() {
+        delegate?.filterHeaderView(self, didTapPatternsButton: patternsButton)
+    }
+    
     @objc private func addCoinsButtonTapped() {
         delegate?.filterHeaderView(self, didTapAddCoinsButton: addCoinsButton)
     }
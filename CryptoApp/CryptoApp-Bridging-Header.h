@@ -20,3 +20,4 @@
 #import "CoinCellSkeleton.h"
 #import "AddCoinCellSkeleton.h"
 #import "ChartSkeleton.h"
+#import "MetricsAtomics.h"
@@ -0,0 +1,430 @@
+//
+//  PriceAlertEngine.swift
+//  CryptoApp
+//
+
+import Foundation
+
+/**
+ * PRICE ALERT ENGINE
+ *
+ * Evaluates user alert rules against streaming price ticks without scanning every rule:
+ * - Threshold rules (price, 24h change, RSI) live in per-coin sorted indexes, so a tick only
+ *   visits the rules whose level lies between the previous and the new value
+ * - RSI and SMA crossover rules run on incremental indicator state (O(1) per tick)
+ * - Hysteresis: a fired rule stays disarmed until the value retreats past its re-arm level
+ * - Deduplication: a rule fires at most once per crossing and never within its cooldown
+ *
+ * Coins without rules cost a single dictionary lookup per tick.
+ *
+ * NOTE: Not thread-safe. Callers must serialize access (see PriceAlertManager).
+ */
+final class PriceAlertEngine {
+
+    // MARK: - Threshold Index
+
+    /// Sorted threshold levels for one metric of one coin
+    struct ThresholdIndex {
+
+        struct Entry {
+            let level: Double
+            let slot: Int
+        }
+
+        enum Crossing {
+            case triggerUp
+            case triggerDown
+            case rearm
+        }
+
+        private var rising: [Entry] = []        // Fire when the value moves up through `level`
+        private var risingRearm: [Entry] = []   // Re-arm rising rules when the value moves down through `level`
+        private var falling: [Entry] = []       // Fire when the value moves down through `level`
+        private var fallingRearm: [Entry] = []  // Re-arm falling rules when the value moves up through `level`
+
+        var count: Int { rising.count + falling.count }
+
+        mutating func insertRising(level: Double, rearmLevel: Double, slot: Int) {
+            Self.insert(Entry(level: level, slot: slot), into: &rising)
+            Self.insert(Entry(level: rearmLevel, slot: slot), into: &risingRearm)
+        }
+
+        mutating func insertFalling(level: Double, rearmLevel: Double, slot: Int) {
+            Self.insert(Entry(level: level, slot: slot), into: &falling)
+            Self.insert(Entry(level: rearmLevel, slot: slot), into: &fallingRearm)
+        }
+
+        mutating func remove(slot: Int) {
+            rising.removeAll { $0.slot == slot }
+            risingRearm.removeAll { $0.slot == slot }
+            falling.removeAll { $0.slot == slot }
+            fallingRearm.removeAll { $0.slot == slot }
+        }
+
+        /// Visits only the entries whose level lies in the interval crossed between `old` and `new`
+        func visitCrossings(from old: Double, to new: Double, _ visit: (Int, Crossing) -> Void) {
+            if new > old {
+                // Upward move: old < level <= new
+                var i = Self.firstIndex(in: rising) { $0 > old }
+                while i < rising.count && rising[i].level <= new {
+                    visit(rising[i].slot, .triggerUp)
+                    i += 1
+                }
+                var j = Self.firstIndex(in: fallingRearm) { $0 > old }
+                while j < fallingRearm.count && fallingRearm[j].level <= new {
+                    visit(fallingRearm[j].slot, .rearm)
+                    j += 1
+                }
+            } else if new < old {
+                // Downward move: new <= level < old
+                var i = Self.firstIndex(in: falling) { $0 >= new }
+                while i < falling.count && falling[i].level < old {
+                    visit(falling[i].slot, .triggerDown)
+                    i += 1
+                }
+                var j = Self.firstIndex(in: risingRearm) { $0 >= new }
+                while j < risingRearm.count && risingRearm[j].level < old {
+                    visit(risingRearm[j].slot, .rearm)
+                    j += 1
+                }
+            }
+        }
+
+        /// Arming state for the first observed value: rules already past their level start disarmed
+        func visitInitialState(at value: Double, _ visit: (Int, Bool) -> Void) {
+            for entry in rising { visit(entry.slot, value < entry.level) }
+            for entry in falling { visit(entry.slot, value > entry.level) }
+        }
+
+        // Binary search for the first entry whose level satisfies `predicate` (entries are sorted by level)
+        private static func firstIndex(in entries: [Entry], where predicate: (Double) -> Bool) -> Int {
+            var low = 0
+            var high = entries.count
+            while low < high {
+                let mid = (low + high) / 2
+                if predicate(entries[mid].level) {
+                    high = mid
+                } else {
+                    low = mid + 1
+                }
+            }
+            return low
+        }
+
+        private static func insert(_ entry: Entry, into entries: inout [Entry]) {
+            let index = firstIndex(in: entries) { $0 > entry.level }
+            entries.insert(entry, at: index)
+        }
+    }
+
+    // MARK: - Per-Coin State
+
+    private struct RuleState {
+        let rule: PriceAlertRule
+        var isArmed: Bool = true
+        var lastFired: Date?
+        var crossoverSide: Int = 0 // -1 fast below slow, +1 fast above slow, 0 unknown
+    }
+
+    private final class RSITrack {
+        var rsi: TechnicalIndicators.RollingRSI
+        var lastValue: Double?
+        var index = ThresholdIndex()
+        /// False until the track has seen a price; only such tracks accept seeded history
+        var hasPrices = false
+
+        init(period: Int) {
+            rsi = TechnicalIndicators.RollingRSI(period: period)
+        }
+    }
+
+    private struct CrossoverKey: Hashable {
+        let fast: Int
+        let slow: Int
+    }
+
+    private final class CrossoverTrack {
+        var fast: TechnicalIndicators.RollingSMA
+        var slow: TechnicalIndicators.RollingSMA
+        var slots: [Int] = []
+        var hasPrices = false
+
+        init(key: CrossoverKey) {
+            fast = TechnicalIndicators.RollingSMA(period: key.fast)
+            slow = TechnicalIndicators.RollingSMA(period: key.slow)
+        }
+    }
+
+    private final class CoinBook {
+        var lastPrice: Double?
+        var lastAbsChange: Double?
+        var priceIndex = ThresholdIndex()
+        var changeIndex = ThresholdIndex()
+        var rsiTracks: [Int: RSITrack] = [:]
+        var crossoverTracks: [CrossoverKey: CrossoverTrack] = [:]
+        var ruleCount = 0
+    }
+
+    // MARK: - Properties
+
+    private var slots: [RuleState?] = []
+    private var freeSlots: [Int] = []
+    private var slotById: [UUID: Int] = [:]
+    private var books: [Int: CoinBook] = [:]
+
+    /// Number of active (enabled) rules currently indexed
+    var ruleCount: Int { slotById.count }
+
+    /// Number of coins that have at least one active rule
+    var watchedCoinCount: Int { books.count }
+
+    // MARK: - Rule Management
+
+    /// Adds or replaces a rule. Disabled rules are removed from the index.
+    func addRule(_ rule: PriceAlertRule) {
+        removeRule(id: rule.id)
+        guard rule.isEnabled else { return }
+
+        let slot: Int
+        if let reused = freeSlots.popLast() {
+            slot = reused
+            slots[slot] = RuleState(rule: rule)
+        } else {
+            slot = slots.count
+            slots.append(RuleState(rule: rule))
+        }
+        slotById[rule.id] = slot
+
+        let book = books[rule.coinId] ?? CoinBook()
+        books[rule.coinId] = book
+        book.ruleCount += 1
+
+        let h = rule.hysteresis
+        switch rule.condition {
+        case .priceAbove(let level):
+            book.priceIndex.insertRising(level: level, rearmLevel: level - abs(level) * h, slot: slot)
+            slots[slot]?.isArmed = book.lastPrice.map { $0 < level } ?? true
+        case .priceBelow(let level):
+            book.priceIndex.insertFalling(level: level, rearmLevel: level + abs(level) * h, slot: slot)
+            slots[slot]?.isArmed = book.lastPrice.map { $0 > level } ?? true
+        case .percentChange24hBeyond(let percent):
+            let level = abs(percent)
+            book.changeIndex.insertRising(level: level, rearmLevel: level - level * h, slot: slot)
+            slots[slot]?.isArmed = book.lastAbsChange.map { $0 < level } ?? true
+        case .rsiAbove(let level, let period):
+            let track = rsiTrack(for: period, in: book)
+            track.index.insertRising(level: level, rearmLevel: level - abs(level) * h, slot: slot)
+            slots[slot]?.isArmed = track.lastValue.map { $0 < level } ?? true
+        case .rsiBelow(let level, let period):
+            let track = rsiTrack(for: period, in: book)
+            track.index.insertFalling(level: level, rearmLevel: level + abs(level) * h, slot: slot)
+            slots[slot]?.isArmed = track.lastValue.map { $0 > level } ?? true
+        case .smaCrossover(let fast, let slow):
+            let key = CrossoverKey(fast: fast, slow: slow)
+            let track = book.crossoverTracks[key] ?? CrossoverTrack(key: key)
+            book.crossoverTracks[key] = track
+            track.slots.append(slot)
+        }
+    }
+
+    /// Removes a rule from the index (no-op if unknown)
+    func removeRule(id: UUID) {
+        guard let slot = slotById.removeValue(forKey: id), let state = slots[slot] else { return }
+        slots[slot] = nil
+        freeSlots.append(slot)
+
+        guard let book = books[state.rule.coinId] else { return }
+        switch state.rule.condition {
+        case .priceAbove, .priceBelow:
+            book.priceIndex.remove(slot: slot)
+        case .percentChange24hBeyond:
+            book.changeIndex.remove(slot: slot)
+        case .rsiAbove(_, let period), .rsiBelow(_, let period):
+            book.rsiTracks[period]?.index.remove(slot: slot)
+            if book.rsiTracks[period]?.index.count == 0 {
+                book.rsiTracks[period] = nil
+            }
+        case .smaCrossover(let fast, let slow):
+            let key = CrossoverKey(fast: fast, slow: slow)
+            book.crossoverTracks[key]?.slots.removeAll { $0 == slot }
+            if book.crossoverTracks[key]?.slots.isEmpty == true {
+                book.crossoverTracks[key] = nil
+            }
+        }
+
+        book.ruleCount -= 1
+        if book.ruleCount == 0 {
+            books[state.rule.coinId] = nil
+        }
+    }
+
+    /// Removes every rule and all indicator state
+    func removeAllRules() {
+        slots.removeAll()
+        freeSlots.removeAll()
+        slotById.removeAll()
+        books.removeAll()
+    }
+
+    /**
+     * Warms up RSI/SMA state for a coin from historical prices (oldest first)
+     * so indicator rules are live immediately instead of after `period` ticks.
+     * Only tracks that haven't seen a price yet are seeded, so history never lands after live
+     * ticks. Does not fire alerts.
+     */
+    func seedIndicators(coinId: Int, prices: [Double]) {
+        guard let book = books[coinId], !prices.isEmpty else { return }
+        for track in book.rsiTracks.values where !track.hasPrices {
+            for price in prices { track.lastValue = track.rsi.append(price) }
+            track.hasPrices = true
+            // Rules already past their level start disarmed, as for a first live value
+            if let rsi = track.lastValue {
+                track.index.visitInitialState(at: rsi) { slot, armed in
+                    slots[slot]?.isArmed = armed
+                }
+            }
+        }
+        for track in book.crossoverTracks.values where !track.hasPrices {
+            for price in prices {
+                track.fast.append(price)
+                track.slow.append(price)
+            }
+            track.hasPrices = true
+        }
+    }
+
+    // MARK: - Evaluation
+
+    /**
+     * Evaluates one batch of ticks (typically one SharedCoinDataManager update)
+     *
+     * - Returns: Alerts that became active in this batch, at most one per rule
+     */
+    @discardableResult
+    func evaluate(_ ticks: [PriceTick], at timestamp: Date = Date()) -> [PriceAlertEvent] {
+        guard !books.isEmpty else { return [] }
+        var events: [PriceAlertEvent] = []
+        for tick in ticks {
+            guard let book = books[tick.coinId] else { continue }
+            evaluate(tick, book: book, at: timestamp, into: &events)
+        }
+        return events
+    }
+
+    private func evaluate(_ tick: PriceTick, book: CoinBook, at timestamp: Date, into events: inout [PriceAlertEvent]) {
+        let price = tick.price
+
+        // Price thresholds
+        if book.priceIndex.count > 0 {
+            process(book.priceIndex, from: book.lastPrice, to: price, price: price, at: timestamp, into: &events)
+        }
+        book.lastPrice = price
+
+        // 24h change thresholds (indexed on the absolute change)
+        if let change = tick.percentChange24h, change.isFinite {
+            let absChange = abs(change)
+            if book.changeIndex.count > 0 {
+                let direction: PriceAlertEvent.Direction = change >= 0 ? .up : .down
+                process(book.changeIndex, from: book.lastAbsChange, to: absChange, price: price,
+                        at: timestamp, reportedValue: change, direction: direction, into: &events)
+            }
+            book.lastAbsChange = absChange
+        }
+
+        // RSI thresholds on incremental state
+        for track in book.rsiTracks.values {
+            track.hasPrices = true
+            guard let rsi = track.rsi.append(price) else { continue }
+            process(track.index, from: track.lastValue, to: rsi, price: price, at: timestamp, into: &events)
+            track.lastValue = rsi
+        }
+
+        // SMA crossovers on incremental state
+        for track in book.crossoverTracks.values {
+            // Both averages take every price, even while the other is still warming up
+            track.hasPrices = true
+            let fastValue = track.fast.append(price)
+            let slowValue = track.slow.append(price)
+            guard let fast = fastValue, let slow = slowValue, slow != 0 else { continue }
+            let spread = (fast - slow) / abs(slow)
+
+            for slot in track.slots {
+                guard var state = slots[slot] else { continue }
+                let h = state.rule.hysteresis
+                // Inside the dead band the previous side is kept, which suppresses flapping
+                let side = spread > h ? 1 : (spread < -h ? -1 : state.crossoverSide)
+                if state.crossoverSide != 0 && side != state.crossoverSide {
+                    fire(&state, direction: side > 0 ? .up : .down, value: fast - slow,
+                         price: price, at: timestamp, into: &events)
+                }
+                state.crossoverSide = side
+                slots[slot] = state
+            }
+        }
+    }
+
+    /// Applies a value change to a threshold index, visiting only the crossed interval
+    private func process(
+        _ index: ThresholdIndex,
+        from old: Double?,
+        to new: Double,
+        price: Double,
+        at timestamp: Date,
+        reportedValue: Double? = nil,
+        direction fixedDirection: PriceAlertEvent.Direction? = nil,
+        into events: inout [PriceAlertEvent]
+    ) {
+        guard let old = old else {
+            // First observation: establish arming state without firing
+            index.visitInitialState(at: new) { slot, armed in
+                slots[slot]?.isArmed = armed
+            }
+            return
+        }
+
+        index.visitCrossings(from: old, to: new) { slot, crossing in
+            guard var state = slots[slot] else { return }
+            switch crossing {
+            case .rearm:
+                state.isArmed = true
+            case .triggerUp, .triggerDown:
+                guard state.isArmed else { return }
+                state.isArmed = false
+                let direction = fixedDirection ?? (crossing == .triggerUp ? .up : .down)
+                fire(&state, direction: direction, value: reportedValue ?? new,
+                     price: price, at: timestamp, into: &events)
+            }
+            slots[slot] = state
+        }
+    }
+
+    private func fire(
+        _ state: inout RuleState,
+        direction: PriceAlertEvent.Direction,
+        value: Double,
+        price: Double,
+        at timestamp: Date,
+        into events: inout [PriceAlertEvent]
+    ) {
+        if let lastFired = state.lastFired, timestamp.timeIntervalSince(lastFired) < state.rule.cooldown {
+            return // Deduplicated: still cooling down from the previous notification
+        }
+        state.lastFired = timestamp
+        events.append(PriceAlertEvent(
+            ruleId: state.rule.id,
+            coinId: state.rule.coinId,
+            condition: state.rule.condition,
+            direction: direction,
+            value: value,
+            price: price,
+            timestamp: timestamp
+        ))
+    }
+
+    private func rsiTrack(for period: Int, in book: CoinBook) -> RSITrack {
+        if let track = book.rsiTracks[period] { return track }
+        let track = RSITrack(period: period)
+        book.rsiTracks[period] = track
+        return track
+    }
+}
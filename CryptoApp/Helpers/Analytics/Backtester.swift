@@ -0,0 +1,306 @@
+//
+//  Backtester.swift
+//  CryptoApp
+//
+
+import Foundation
+import Accelerate
+
+/**
+ * STRATEGY BACKTESTER
+ *
+ * Runs long-only rules over OHLC history already fetched through CoinManager.fetchOHLCData.
+ *
+ * Performance:
+ * - Candles are converted once into columns (close/high/low) and bar returns (vDSP)
+ * - Indicator columns come from the TechnicalIndicators kernels and are computed once per
+ *   distinct period, then shared read-only by every strategy in a sweep
+ * - Each strategy is a position-column pass followed by one fused loop that produces equity,
+ *   drawdown, Sharpe and trade stats together
+ * - Sweeps split strategies across cores with DispatchQueue.concurrentPerform
+ *
+ * NOTE: Signals are evaluated at a bar's close and positions apply from the next bar,
+ * so there is no look-ahead.
+ */
+final class Backtester {
+
+    // MARK: - Properties
+
+    let configuration: BacktestConfiguration
+    let closes: [Double]
+    let highs: [Double]
+    let lows: [Double]
+    /// returns[t] = close[t] / close[t - 1] - 1 (returns[0] = 0)
+    private let returns: [Double]
+
+    private var indicatorCache: [String: [Double]] = [:]
+    private let cacheLock = NSLock()
+
+    var barCount: Int { closes.count }
+
+    // MARK: - Initialization
+
+    init(candles: [OHLCData], configuration: BacktestConfiguration = BacktestConfiguration()) {
+        self.configuration = configuration
+        self.closes = candles.map { $0.close }
+        self.highs = candles.map { $0.high }
+        self.lows = candles.map { $0.low }
+
+        var barReturns = [Double](repeating: 0, count: candles.count)
+        if candles.count > 1 {
+            let count = vDSP_Length(candles.count - 1)
+            closes.withUnsafeBufferPointer { c in
+                barReturns.withUnsafeMutableBufferPointer { r in
+                    // vDSP_vdivD computes C = A / B with B passed first
+                    vDSP_vdivD(c.baseAddress!, 1, c.baseAddress! + 1, 1, r.baseAddress! + 1, 1, count)
+                    var minusOne = -1.0
+                    vDSP_vsaddD(r.baseAddress! + 1, 1, &minusOne, r.baseAddress! + 1, 1, count)
+                }
+            }
+        }
+        self.returns = barReturns.map { $0.isFinite ? $0 : 0 }
+    }
+
+    // MARK: - Public API
+
+    /// Full run with equity curve, drawdown series and trade list
+    func run(_ strategy: BacktestStrategy) -> BacktestResult {
+        prepareIndicators(for: [strategy])
+        let positions = positionColumn(for: strategy, columns: indicatorColumns())
+        var equity = [Double](repeating: 1, count: barCount)
+        var drawdown = [Double](repeating: 0, count: barCount)
+        var trades: [BacktestTrade] = []
+        let summary = evaluate(strategy, positions: positions, equity: &equity, drawdown: &drawdown, trades: &trades)
+        return BacktestResult(summary: summary, equityCurve: equity, drawdown: drawdown, trades: trades)
+    }
+
+    /**
+     * Evaluates every strategy in parallel and returns summaries in input order.
+     * Indicators are precomputed once per distinct period before the parallel section.
+     */
+    func sweep(_ strategies: [BacktestStrategy]) -> [BacktestSummary] {
+        guard !strategies.isEmpty else { return [] }
+        prepareIndicators(for: strategies)
+        let columns = indicatorColumns()  // Read-only snapshot shared by all workers
+
+        let chunkSize = max(1, strategies.count / (ProcessInfo.processInfo.activeProcessorCount * 4))
+        let chunkCount = (strategies.count + chunkSize - 1) / chunkSize
+        var results = [BacktestSummary?](repeating: nil, count: strategies.count)
+
+        results.withUnsafeMutableBufferPointer { output in
+            let output = output // Each index is written by exactly one chunk
+            DispatchQueue.concurrentPerform(iterations: chunkCount) { chunk in
+                let lower = chunk * chunkSize
+                let upper = min(lower + chunkSize, strategies.count)
+                for index in lower..<upper {
+                    let positions = positionColumn(for: strategies[index], columns: columns)
+                    output[index] = summarize(strategies[index], positions: positions)
+                }
+            }
+        }
+        return results.compactMap { $0 }
+    }
+
+    // MARK: - Indicator Columns
+
+    /// Computes (once) every indicator column the strategies need, NaN where undefined
+    private func prepareIndicators(for strategies: [BacktestStrategy]) {
+        var smaPeriods = Set<Int>()
+        var rsiPeriods = Set<Int>()
+        for strategy in strategies {
+            switch strategy {
+            case .smaCrossover(let fast, let slow):
+                smaPeriods.formUnion([fast, slow])
+            case .rsiMeanReversion(let period, _, _):
+                rsiPeriods.insert(period)
+            case .breakout:
+                break
+            }
+        }
+
+        typealias IndicatorJob = (key: String, compute: () -> [Double])
+        let closes = self.closes
+        let jobs: [IndicatorJob] =
+            smaPeriods.map { period in
+                (key: Self.smaKey(period), compute: {
+                    TechnicalIndicators.calculateSMA(prices: closes, period: period).values.map { $0 ?? .nan }
+                })
+            } + rsiPeriods.map { period in
+                (key: Self.rsiKey(period), compute: {
+                    TechnicalIndicators.calculateRSI(prices: closes, period: period).values.map { $0 ?? .nan }
+                })
+            }
+
+        let cachedKeys = Set(indicatorColumns().keys)
+        let todo = jobs.filter { !cachedKeys.contains($0.key) }
+        guard !todo.isEmpty else { return }
+        var computed = [[Double]](repeating: [], count: todo.count)
+        computed.withUnsafeMutableBufferPointer { output in
+            let output = output
+            DispatchQueue.concurrentPerform(iterations: todo.count) { index in
+                output[index] = todo[index].compute()
+            }
+        }
+
+        cacheLock.lock()
+        for (index, item) in todo.enumerated() {
+            indicatorCache[item.key] = computed[index]
+        }
+        cacheLock.unlock()
+    }
+
+    private func indicatorColumns() -> [String: [Double]] {
+        cacheLock.lock()
+        defer { cacheLock.unlock() }
+        return indicatorCache
+    }
+
+    private static func smaKey(_ period: Int) -> String { "sma:\(period)" }
+    private static func rsiKey(_ period: Int) -> String { "rsi:\(period)" }
+
+    // MARK: - Signal Passes
+
+    /// Position held during bar t+1 as decided at close t (1 = long, 0 = flat)
+    private func positionColumn(for strategy: BacktestStrategy, columns: [String: [Double]]) -> [Double] {
+        let n = barCount
+        var positions = [Double](repeating: 0, count: n)
+        guard n > 1 else { return positions }
+
+        switch strategy {
+        case .smaCrossover(let fast, let slow):
+            guard let fastColumn = columns[Self.smaKey(fast)],
+                  let slowColumn = columns[Self.smaKey(slow)] else { return positions }
+            var spread = [Double](repeating: 0, count: n)
+            // vDSP_vsubD computes C = A - B with B passed first
+            vDSP_vsubD(slowColumn, 1, fastColumn, 1, &spread, 1, vDSP_Length(n))
+            for t in 0..<n where spread[t] > 0 {   // NaN (warm-up) compares false → flat
+                positions[t] = 1
+            }
+
+        case .rsiMeanReversion(let period, let oversold, let overbought):
+            guard let rsi = columns[Self.rsiKey(period)] else { return positions }
+            var holding = false
+            for t in 0..<n {
+                if !holding && rsi[t] < oversold {
+                    holding = true
+                } else if holding && rsi[t] > overbought {
+                    holding = false
+                }
+                positions[t] = holding ? 1 : 0
+            }
+
+        case .breakout(let lookback):
+            guard lookback > 0, n > lookback else { return positions }
+            let windows = vDSP_Length(n - lookback)
+            var upper = [Double](repeating: 0, count: n - lookback)
+            var lower = [Double](repeating: 0, count: n - lookback)
+            let negatedLows = lows.map { -$0 }
+            // Sliding-window max over the `lookback` bars before each bar t >= lookback
+            vDSP_vswmaxD(highs, 1, &upper, 1, windows, vDSP_Length(lookback))
+            vDSP_vswmaxD(negatedLows, 1, &lower, 1, windows, vDSP_Length(lookback))
+
+            var holding = false
+            for t in lookback..<n {
+                let channel = t - lookback
+                if !holding && closes[t] > upper[channel] {
+                    holding = true
+                } else if holding && closes[t] < -lower[channel] {
+                    holding = false
+                }
+                positions[t] = holding ? 1 : 0
+            }
+        }
+        return positions
+    }
+
+    // MARK: - Evaluation
+
+    /// Fused metrics pass without per-bar outputs (used by sweeps)
+    private func summarize(_ strategy: BacktestStrategy, positions: [Double]) -> BacktestSummary {
+        var equity: [Double] = []
+        var drawdown: [Double] = []
+        var trades: [BacktestTrade] = []
+        return evaluate(strategy, positions: positions, equity: &equity, drawdown: &drawdown, trades: &trades, recordSeries: false)
+    }
+
+    /**
+     * Single pass over bars: strategy return = previous position × bar return − fees on changes.
+     * Accumulates equity, running peak, max drawdown, Σr / Σr² for Sharpe and trade outcomes.
+     */
+    private func evaluate(
+        _ strategy: BacktestStrategy,
+        positions: [Double],
+        equity: inout [Double],
+        drawdown: inout [Double],
+        trades: inout [BacktestTrade],
+        recordSeries: Bool = true
+    ) -> BacktestSummary {
+        let n = barCount
+        let fee = configuration.feeRate
+        var value = 1.0
+        var peak = 1.0
+        var maxDrawdown = 0.0
+        var sum = 0.0
+        var sumSquares = 0.0
+        var tradeCount = 0
+        var wins = 0
+        var entryIndex = -1
+
+        for t in 1..<max(n, 1) {
+            let held = positions[t - 1]
+            let previous = t >= 2 ? positions[t - 2] : 0
+            var barReturn = held * returns[t]
+
+            if held != previous {
+                barReturn -= fee
+                if held > 0 {
+                    entryIndex = t - 1
+                } else if entryIndex >= 0 {
+                    tradeCount += 1
+                    if closes[t - 1] > closes[entryIndex] { wins += 1 }
+                    if recordSeries {
+                        trades.append(BacktestTrade(entryIndex: entryIndex, exitIndex: t - 1,
+                                                    entryPrice: closes[entryIndex], exitPrice: closes[t - 1]))
+                    }
+                    entryIndex = -1
+                }
+            }
+
+            value *= 1 + barReturn
+            peak = max(peak, value)
+            let currentDrawdown = value / peak - 1
+            maxDrawdown = min(maxDrawdown, currentDrawdown)
+            sum += barReturn
+            sumSquares += barReturn * barReturn
+
+            if recordSeries {
+                equity[t] = value
+                drawdown[t] = currentDrawdown
+            }
+        }
+
+        // Mark an open position to the last close
+        if entryIndex >= 0, n > 0 {
+            tradeCount += 1
+            if closes[n - 1] > closes[entryIndex] { wins += 1 }
+            if recordSeries {
+                trades.append(BacktestTrade(entryIndex: entryIndex, exitIndex: n - 1,
+                                            entryPrice: closes[entryIndex], exitPrice: closes[n - 1]))
+            }
+        }
+
+        let samples = Double(max(n - 1, 1))
+        let mean = sum / samples
+        let variance = max(0, sumSquares / samples - mean * mean)
+        let sharpe = variance > 0 ? mean / variance.squareRoot() * configuration.periodsPerYear.squareRoot() : 0
+
+        return BacktestSummary(
+            strategy: strategy,
+            totalReturn: value - 1,
+            maxDrawdown: -maxDrawdown,
+            sharpe: sharpe,
+            tradeCount: tradeCount,
+            winRate: tradeCount > 0 ? Double(wins) / Double(tradeCount) : 0
+        )
+    }
+}
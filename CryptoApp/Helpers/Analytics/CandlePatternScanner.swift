@@ -0,0 +1,215 @@
+//
+//  CandlePatternScanner.swift
+//  CryptoApp
+//
+
+import Foundation
+import Accelerate
+
+// MARK: - Candle Pattern
+
+/// Per-candle pattern bitmask; a pattern is flagged on the candle that completes it
+struct CandlePattern: OptionSet, Hashable {
+    let rawValue: UInt8
+
+    static let doji             = CandlePattern(rawValue: 1 << 0)
+    static let hammer           = CandlePattern(rawValue: 1 << 1)
+    static let bullishEngulfing = CandlePattern(rawValue: 1 << 2)
+    static let bearishEngulfing = CandlePattern(rawValue: 1 << 3)
+    static let morningStar      = CandlePattern(rawValue: 1 << 4)
+    static let eveningStar      = CandlePattern(rawValue: 1 << 5)
+
+    static let bullish: CandlePattern = [.hammer, .bullishEngulfing, .morningStar]
+    static let bearish: CandlePattern = [.bearishEngulfing, .eveningStar]
+    static let all: CandlePattern = [.doji, .bullish, .bearish]
+
+    /// Individual patterns in display order
+    static let allPatterns: [CandlePattern] = [.doji, .hammer, .bullishEngulfing, .bearishEngulfing, .morningStar, .eveningStar]
+
+    var displayName: String {
+        switch self {
+        case .doji: return "Doji"
+        case .hammer: return "Hammer"
+        case .bullishEngulfing: return "Bullish Engulfing"
+        case .bearishEngulfing: return "Bearish Engulfing"
+        case .morningStar: return "Morning Star"
+        case .eveningStar: return "Evening Star"
+        default: return CandlePattern.allPatterns.filter { contains($0) }.map { $0.displayName }.joined(separator: ", ")
+        }
+    }
+
+    /// One- or two-letter tag for chart annotations (strongest pattern wins)
+    var annotationTag: String? {
+        if contains(.morningStar) || contains(.eveningStar) { return "★" }
+        if contains(.bullishEngulfing) || contains(.bearishEngulfing) { return "E" }
+        if contains(.hammer) { return "H" }
+        if contains(.doji) { return "D" }
+        return nil
+    }
+}
+
+// MARK: - Candle Pattern Scanner
+
+/**
+ * CANDLE PATTERN SCANNER
+ *
+ * Detects doji, hammer, engulfing and morning/evening star patterns for every candle at once.
+ *
+ * Performance:
+ * - Candles are converted once into columns (open/high/low/close)
+ * - Body, range, wick and direction columns are derived with vDSP
+ * - A single fused pass over the columns evaluates every pattern and writes a one-byte
+ *   mask per candle (no per-pattern passes, no intermediate pattern arrays)
+ * - Screening many coins only scans each series' tail and runs coins in parallel
+ *   (DispatchQueue.concurrentPerform), like Backtester sweeps
+ *
+ * NOTE: Patterns are shape-only (no trend confirmation), so they're hints, not signals.
+ */
+enum CandlePatternScanner {
+
+    // MARK: - Configuration
+
+    struct Thresholds {
+        /// Doji: body at most this fraction of the high-low range
+        var dojiBodyRatio: Double = 0.1
+        /// Hammer: lower wick at least this multiple of the body...
+        var hammerLowerWickRatio: Double = 2.0
+        /// ...and upper wick at most this multiple of the body
+        var hammerUpperWickRatio: Double = 0.5
+        /// Stars: first candle's body at least this fraction of its range
+        var starLongBodyRatio: Double = 0.5
+        /// Stars: middle candle's body at most this fraction of the first body
+        var starSmallBodyRatio: Double = 0.3
+    }
+
+    /// Candles a pattern looks back over (stars span three)
+    static let maxPatternLength = 3
+
+    // MARK: - Columns
+
+    struct Columns {
+        let opens: [Double]
+        let highs: [Double]
+        let lows: [Double]
+        let closes: [Double]
+
+        var count: Int { closes.count }
+
+        init<C: Collection>(_ candles: C) where C.Element == OHLCData {
+            opens = candles.map { $0.open }
+            highs = candles.map { $0.high }
+            lows = candles.map { $0.low }
+            closes = candles.map { $0.close }
+        }
+    }
+
+    // MARK: - Scanning
+
+    static func scan(_ candles: [OHLCData], thresholds: Thresholds = Thresholds()) -> [CandlePattern] {
+        scan(Columns(candles), thresholds: thresholds)
+    }
+
+    /// One mask per candle, index-aligned with the columns
+    static func scan(_ columns: Columns, thresholds: Thresholds = Thresholds()) -> [CandlePattern] {
+        let n = columns.count
+        guard n > 0 else { return [] }
+
+        // Derived columns (vectorized)
+        let signedBody = vDSP.subtract(columns.closes, columns.opens)   // > 0 bullish, < 0 bearish
+        let body = vDSP.absolute(signedBody)
+        let range = vDSP.subtract(columns.highs, columns.lows)
+        let bodyTop = vDSP.maximum(columns.opens, columns.closes)
+        let bodyBottom = vDSP.minimum(columns.opens, columns.closes)
+        let upperWick = vDSP.subtract(columns.highs, bodyTop)
+        let lowerWick = vDSP.subtract(bodyBottom, columns.lows)
+        let opens = columns.opens
+        let closes = columns.closes
+        let t = thresholds
+
+        var masks = [CandlePattern](repeating: [], count: n)
+
+        // Fused pass: every pattern evaluated from the same column reads
+        for i in 0..<n {
+            var mask: UInt8 = 0
+
+            if range[i] > 0 {
+                let isDoji = body[i] <= t.dojiBodyRatio * range[i]
+                if isDoji {
+                    mask |= CandlePattern.doji.rawValue
+                } else if lowerWick[i] >= t.hammerLowerWickRatio * body[i]
+                            && upperWick[i] <= t.hammerUpperWickRatio * body[i] {
+                    mask |= CandlePattern.hammer.rawValue
+                }
+            }
+
+            if i >= 1 && body[i] > body[i - 1] {
+                let p = i - 1
+                if signedBody[p] < 0 && signedBody[i] > 0 && opens[i] <= closes[p] && closes[i] >= opens[p] {
+                    mask |= CandlePattern.bullishEngulfing.rawValue
+                } else if signedBody[p] > 0 && signedBody[i] < 0 && opens[i] >= closes[p] && closes[i] <= opens[p] {
+                    mask |= CandlePattern.bearishEngulfing.rawValue
+                }
+            }
+
+            if i >= 2 {
+                let first = i - 2
+                let star = i - 1
+                let isLongFirst = range[first] > 0 && body[first] >= t.starLongBodyRatio * range[first]
+                let isSmallStar = body[star] <= t.starSmallBodyRatio * body[first]
+                if isLongFirst && isSmallStar {
+                    let firstMidpoint = (opens[first] + closes[first]) / 2
+                    if signedBody[first] < 0 && signedBody[i] > 0 && closes[i] > firstMidpoint {
+                        mask |= CandlePattern.morningStar.rawValue
+                    } else if signedBody[first] > 0 && signedBody[i] < 0 && closes[i] < firstMidpoint {
+                        mask |= CandlePattern.eveningStar.rawValue
+                    }
+                }
+            }
+
+            masks[i] = CandlePattern(rawValue: mask)
+        }
+        return masks
+    }
+
+    /// Mask for the last candle only (live updates); looks at the last `maxPatternLength` candles
+    static func scanLast<C: BidirectionalCollection>(_ candles: C, thresholds: Thresholds = Thresholds()) -> CandlePattern where C.Element == OHLCData {
+        scan(Columns(candles.suffix(maxPatternLength)), thresholds: thresholds).last ?? []
+    }
+
+    // MARK: - Screening
+
+    /**
+     * Patterns completed within the last `lookback` candles of each series, computed in parallel.
+     * Only each series' tail is scanned. Coins without candles are omitted from the result.
+     */
+    static func screen(_ series: [Int: [OHLCData]],
+                       lookback: Int = 3,
+                       thresholds: Thresholds = Thresholds()) -> [Int: CandlePattern] {
+        let jobs = series.filter { !$0.value.isEmpty }.map { (coinId: $0.key, candles: $0.value) }
+        guard !jobs.isEmpty else { return [:] }
+
+        let tailLength = max(1, lookback) + maxPatternLength - 1
+        let chunkSize = max(1, jobs.count / (ProcessInfo.processInfo.activeProcessorCount * 4))
+        let chunkCount = (jobs.count + chunkSize - 1) / chunkSize
+        var found = [CandlePattern](repeating: [], count: jobs.count)
+
+        found.withUnsafeMutableBufferPointer { output in
+            let output = output // Each index is written by exactly one chunk
+            DispatchQueue.concurrentPerform(iterations: chunkCount) { chunk in
+                let lower = chunk * chunkSize
+                let upper = min(lower + chunkSize, jobs.count)
+                for index in lower..<upper {
+                    let masks = scan(Columns(jobs[index].candles.suffix(tailLength)), thresholds: thresholds)
+                    output[index] = masks.suffix(lookback).reduce(into: CandlePattern()) { $0.formUnion($1) }
+                }
+            }
+        }
+
+        var result: [Int: CandlePattern] = [:]
+        result.reserveCapacity(jobs.count)
+        for (index, job) in jobs.enumerated() {
+            result[job.coinId] = found[index]
+        }
+        return result
+    }
+}
@@ -0,0 +1,304 @@
+//
+//  CorrelationEngine.swift
+//  CryptoApp
+//
+
+import Foundation
+import Accelerate
+
+/**
+ * CROSS-COIN CORRELATION ENGINE
+ *
+ * Computes pairwise return correlations, beta against a benchmark (BTC) and realised
+ * volatility for a set of coins whose price series share the same time grid.
+ *
+ * Performance:
+ * - Returns are stored per coin as contiguous Double rows (log returns)
+ * - The k×k cross-product matrix is built by a blocked kernel: rows are split into blocks
+ *   processed in parallel (DispatchQueue.concurrentPerform), time is tiled so a block's
+ *   rows stay cache-resident, and each dot product is vectorized with vDSP
+ * - All statistics derive from running sums (Σx, Σx², Σxy), so appending a new aligned
+ *   point costs O(k²) instead of recomputing O(k²·n)
+ *
+ * NOTE: Not thread-safe. Callers must serialize access (see WatchlistAnalyticsVM).
+ */
+final class CorrelationEngine {
+
+    // MARK: - Snapshot
+
+    struct Snapshot {
+        let coinIds: [Int]
+        /// Row-major k×k correlation matrix (NaN when a series has no variance)
+        let correlation: [Double]
+        /// Beta of each coin against the benchmark (nil without a benchmark)
+        let beta: [Double?]
+        /// Annualised realised volatility of each coin's returns
+        let volatility: [Double]
+        /// Number of returns the statistics are computed over
+        let sampleCount: Int
+
+        func correlation(_ i: Int, _ j: Int) -> Double {
+            correlation[i * coinIds.count + j]
+        }
+    }
+
+    // MARK: - Properties
+
+    let coinIds: [Int]
+    let benchmarkIndex: Int?
+    /// Maximum number of returns kept (oldest returns slide out as new points arrive)
+    let window: Int
+    private let periodsPerYear: Double
+
+    private var returns: [[Double]]      // One row per coin, oldest first (from `start`)
+    private var start = 0                // Index of the oldest return still inside the window
+    private var lastPrices: [Double]
+    private var sums: [Double]           // Σx per coin
+    private var crossProducts: [Double]  // Σx·y per pair (k×k, row-major, symmetric)
+
+    var sampleCount: Int { returns.first.map { $0.count - start } ?? 0 }
+
+    // MARK: - Tuning
+
+    static let rowBlockSize = 16
+    static let timeTileSize = 2048
+
+    // MARK: - Initialization
+
+    /**
+     * - Parameters:
+     *   - coinIds: Identifier of each series (same order as `series`)
+     *   - series: Price series per coin, oldest first, on a shared time grid.
+     *             Series of different lengths are aligned on their most recent points.
+     *   - benchmarkIndex: Index of the benchmark series (BTC) used for beta
+     *   - window: Maximum number of returns to keep; defaults to the aligned length
+     *   - periodsPerYear: Sampling frequency used to annualise volatility (8760 for hourly)
+     */
+    init(coinIds: [Int], series: [[Double]], benchmarkIndex: Int?, window: Int? = nil, periodsPerYear: Double) {
+        precondition(coinIds.count == series.count, "coinIds and series must have the same count")
+        self.coinIds = coinIds
+        self.benchmarkIndex = benchmarkIndex.flatMap { $0 < series.count ? $0 : nil }
+        self.periodsPerYear = periodsPerYear
+
+        var aligned = CorrelationEngine.alignedLogReturns(series)
+        let length = aligned.first?.count ?? 0
+        let keep = min(window ?? length, length)
+        if keep < length {
+            aligned = aligned.map { Array($0.suffix(keep)) }
+        }
+        self.window = max(1, window ?? length)
+        self.returns = aligned
+        self.lastPrices = series.map { $0.last ?? 0 }
+        self.sums = aligned.map { row in
+            var total = 0.0
+            vDSP_sveD(row, 1, &total, vDSP_Length(row.count))
+            return total
+        }
+        self.crossProducts = CorrelationEngine.blockedCrossProducts(aligned, from: 0, count: keep)
+    }
+
+    // MARK: - Incremental Updates
+
+    /**
+     * Appends one aligned price per coin (same order as `coinIds`).
+     * Updates all running sums in O(k²); the oldest return slides out once the window is full.
+     * Missing (non-positive) prices carry the previous price forward as a zero return.
+     */
+    func append(prices: [Double]) {
+        let k = coinIds.count
+        guard prices.count == k, k > 0 else { return }
+
+        var newReturns = [Double](repeating: 0, count: k)
+        for i in 0..<k where prices[i] > 0 && prices[i].isFinite {
+            newReturns[i] = CorrelationEngine.logReturn(from: lastPrices[i], to: prices[i])
+            lastPrices[i] = prices[i]
+        }
+
+        let evicting = sampleCount >= window
+        var oldReturns = [Double](repeating: 0, count: k)
+        if evicting {
+            for i in 0..<k { oldReturns[i] = returns[i][start] }
+            start += 1
+        }
+
+        for i in 0..<k {
+            returns[i].append(newReturns[i])
+            sums[i] += newReturns[i] - oldReturns[i]
+            for j in 0...i {
+                let delta = newReturns[i] * newReturns[j] - oldReturns[i] * oldReturns[j]
+                crossProducts[i * k + j] += delta
+                if i != j { crossProducts[j * k + i] += delta }
+            }
+        }
+
+        // Compact occasionally so rows don't grow without bound
+        if start >= window {
+            returns = returns.map { Array($0[start...]) }
+            start = 0
+        }
+    }
+
+    // MARK: - Statistics
+
+    func snapshot() -> Snapshot {
+        let k = coinIds.count
+        let n = Double(sampleCount)
+        var correlation = [Double](repeating: .nan, count: k * k)
+        var variances = [Double](repeating: 0, count: k)
+
+        guard n > 1 else {
+            return Snapshot(coinIds: coinIds, correlation: correlation, beta: Array(repeating: nil, count: k),
+                            volatility: Array(repeating: 0, count: k), sampleCount: Int(n))
+        }
+
+        for i in 0..<k {
+            variances[i] = max(0, (crossProducts[i * k + i] - sums[i] * sums[i] / n) / (n - 1))
+        }
+        for i in 0..<k {
+            for j in 0...i {
+                let covariance = (crossProducts[i * k + j] - sums[i] * sums[j] / n) / (n - 1)
+                let denominator = (variances[i] * variances[j]).squareRoot()
+                let value = denominator > 0 ? min(1, max(-1, covariance / denominator)) : .nan
+                correlation[i * k + j] = value
+                correlation[j * k + i] = value
+            }
+        }
+
+        let beta: [Double?] = (0..<k).map { i in
+            guard let b = benchmarkIndex, variances[b] > 0 else { return nil }
+            let covariance = (crossProducts[i * k + b] - sums[i] * sums[b] / n) / (n - 1)
+            return covariance / variances[b]
+        }
+        let volatility = variances.map { ($0 * periodsPerYear).squareRoot() }
+
+        return Snapshot(coinIds: coinIds, correlation: correlation, beta: beta, volatility: volatility, sampleCount: Int(n))
+    }
+
+    /**
+     * Rolling beta of every coin against the benchmark over `window` returns.
+     * O(n) per coin using vectorized prefix sums; positions before the first full window are NaN.
+     */
+    func rollingBeta(window rollingWindow: Int) -> [[Double]] {
+        guard let b = benchmarkIndex, rollingWindow > 1 else { return [] }
+        let n = sampleCount
+        guard n >= rollingWindow else { return Array(repeating: [], count: coinIds.count) }
+
+        let benchmark = Array(returns[b][start...])
+        let benchmarkSums = CorrelationEngine.prefixSums(benchmark)
+        let benchmarkSquares = CorrelationEngine.prefixSums(CorrelationEngine.multiply(benchmark, benchmark))
+        let w = Double(rollingWindow)
+
+        return (0..<coinIds.count).map { i in
+            let row = Array(returns[i][start...])
+            let rowSums = CorrelationEngine.prefixSums(row)
+            let productSums = CorrelationEngine.prefixSums(CorrelationEngine.multiply(row, benchmark))
+
+            var betas = [Double](repeating: .nan, count: n)
+            for t in (rollingWindow - 1)..<n {
+                let lower = t + 1 - rollingWindow
+                let sx = rowSums[t + 1] - rowSums[lower]
+                let sb = benchmarkSums[t + 1] - benchmarkSums[lower]
+                let sxb = productSums[t + 1] - productSums[lower]
+                let sbb = benchmarkSquares[t + 1] - benchmarkSquares[lower]
+                let varianceB = sbb - sb * sb / w
+                betas[t] = varianceB > 0 ? (sxb - sx * sb / w) / varianceB : .nan
+            }
+            return betas
+        }
+    }
+
+    // MARK: - Kernels
+
+    /**
+     * Blocked, parallel cross-product (Gram) matrix Σ x_i·x_j over `count` samples from `from`.
+     * Row blocks run concurrently; each block walks time in tiles and uses vDSP dot products.
+     * Every (i, j ≤ i) cell is written by exactly one block, then mirrored.
+     */
+    static func blockedCrossProducts(_ rows: [[Double]], from offset: Int, count n: Int) -> [Double] {
+        let k = rows.count
+        guard k > 0, n > 0 else { return [Double](repeating: 0, count: k * k) }
+
+        var result = [Double](repeating: 0, count: k * k)
+        let blockCount = (k + rowBlockSize - 1) / rowBlockSize
+
+        result.withUnsafeMutableBufferPointer { output in
+            let output = output // Immutable capture of the buffer for concurrent writes to disjoint cells
+            DispatchQueue.concurrentPerform(iterations: blockCount) { block in
+                let rowStart = block * rowBlockSize
+                let rowEnd = min(rowStart + rowBlockSize, k)
+
+                var tileStart = 0
+                while tileStart < n {
+                    let tileLength = vDSP_Length(min(timeTileSize, n - tileStart))
+                    let base = offset + tileStart
+                    for i in rowStart..<rowEnd {
+                        rows[i].withUnsafeBufferPointer { rowI in
+                            for j in 0...i {
+                                rows[j].withUnsafeBufferPointer { rowJ in
+                                    var dot = 0.0
+                                    vDSP_dotprD(rowI.baseAddress! + base, 1, rowJ.baseAddress! + base, 1, &dot, tileLength)
+                                    output[i * k + j] += dot
+                                }
+                            }
+                        }
+                    }
+                    tileStart += timeTileSize
+                }
+            }
+        }
+
+        for i in 0..<k {
+            for j in 0..<i {
+                result[j * k + i] = result[i * k + j]
+            }
+        }
+        return result
+    }
+
+    /// Aligns series on their most recent points and converts them to log returns (vForce)
+    static func alignedLogReturns(_ series: [[Double]]) -> [[Double]] {
+        let length = series.map { $0.count }.min() ?? 0
+        guard length > 1 else { return series.map { _ in [] } }
+
+        return series.map { prices in
+            let aligned = Array(prices.suffix(length))
+            let count = length - 1
+            var ratios = [Double](repeating: 0, count: count)
+            aligned.withUnsafeBufferPointer { p in
+                // vDSP_vdivD computes C = A / B with B passed first
+                vDSP_vdivD(p.baseAddress!, 1, p.baseAddress! + 1, 1, &ratios, 1, vDSP_Length(count))
+            }
+            var logs = [Double](repeating: 0, count: count)
+            var n32 = Int32(count)
+            vvlog(&logs, ratios, &n32)
+            // Zero out gaps / invalid prices rather than poisoning every sum with NaN
+            for t in 0..<count where !logs[t].isFinite {
+                logs[t] = 0
+            }
+            return logs
+        }
+    }
+
+    private static func logReturn(from previous: Double, to current: Double) -> Double {
+        guard previous > 0, current > 0 else { return 0 }
+        let value = log(current / previous)
+        return value.isFinite ? value : 0
+    }
+
+    private static func multiply(_ a: [Double], _ b: [Double]) -> [Double] {
+        var output = [Double](repeating: 0, count: a.count)
+        vDSP_vmulD(a, 1, b, 1, &output, 1, vDSP_Length(a.count))
+        return output
+    }
+
+    /// Prefix sums with a leading zero: sums[t] = Σ values[0..<t]
+    private static func prefixSums(_ values: [Double]) -> [Double] {
+        var sums = [Double](repeating: 0, count: values.count + 1)
+        var running = 0.0
+        for (t, value) in values.enumerated() {
+            running += value
+            sums[t + 1] = running
+        }
+        return sums
+    }
+}
@@ -0,0 +1,139 @@
+//
+//  SeriesAligner.swift
+//  CryptoApp
+//
+
+import Foundation
+import Accelerate
+
+/**
+ * SERIES ALIGNER
+ *
+ * Puts several timestamped price series on one common time grid and normalises them to
+ * percent change, so coins can be overlaid on a single chart.
+ *
+ * Algorithm:
+ * - A k-way merge join walks every series with one cursor: the next grid time is the smallest
+ *   pending timestamp; each series contributes its points within `tolerance` of it and
+ *   otherwise carries its last value forward (as-of join)
+ * - Every step consumes at least one point, so alignment is O(N·k) for N points over k series
+ *   (k is a handful of coins), with no sorting or hashing of timestamps
+ * - The grid starts once every series has a value and stops after the earliest series ends,
+ *   so all lines share the same 0% origin and nothing is extrapolated at the tail
+ *
+ * Inputs are expected in time order (API order); out-of-order series are sorted once.
+ */
+enum SeriesAligner {
+
+    // MARK: - Types
+
+    struct Sample {
+        let time: TimeInterval
+        let value: Double
+    }
+
+    struct Alignment {
+        let timestamps: [Date]
+        /// One column per input series, index-aligned with `timestamps`
+        let values: [[Double]]
+
+        var count: Int { timestamps.count }
+        var isEmpty: Bool { timestamps.isEmpty }
+
+        /// Each column as percent change from its first aligned value
+        func percentChanges() -> [[Double]] {
+            values.map { SeriesAligner.percentChange($0) }
+        }
+    }
+
+    // MARK: - Alignment
+
+    /// Aligns candle closes (one series per coin)
+    static func align(candles: [[OHLCData]], tolerance: TimeInterval? = nil) -> Alignment {
+        align(candles.map { series in
+            series.map { Sample(time: $0.timestamp.timeIntervalSince1970, value: $0.close) }
+        }, tolerance: tolerance)
+    }
+
+    /**
+     * Merge-joins the series onto a common grid.
+     * `tolerance` defaults to half the smallest average spacing, which absorbs small clock
+     * offsets between coins without merging neighbouring points of the same series.
+     */
+    static func align(_ series: [[Sample]], tolerance: TimeInterval? = nil) -> Alignment {
+        let k = series.count
+        guard k > 0, series.allSatisfy({ !$0.isEmpty }) else {
+            return Alignment(timestamps: [], values: Array(repeating: [], count: k))
+        }
+
+        let sorted = series.map { isSorted($0) ? $0 : $0.sorted { $0.time < $1.time } }
+        let tolerance = tolerance ?? defaultTolerance(for: sorted)
+        let end = sorted.map { $0[$0.count - 1].time }.min() ?? 0
+
+        var cursors = [Int](repeating: 0, count: k)
+        var last = [Double](repeating: .nan, count: k)
+        var started = 0
+        var timestamps: [Date] = []
+        var columns = [[Double]](repeating: [], count: k)
+        let capacity = sorted.map { $0.count }.max() ?? 0
+        timestamps.reserveCapacity(capacity)
+        for s in 0..<k {
+            columns[s].reserveCapacity(capacity)
+        }
+
+        while true {
+            // Next grid time: the earliest point not yet consumed
+            var next = Double.infinity
+            for s in 0..<k where cursors[s] < sorted[s].count {
+                next = min(next, sorted[s][cursors[s]].time)
+            }
+            guard next.isFinite, next <= end + tolerance else { break }
+
+            // Each series takes its latest point inside the join window
+            for s in 0..<k {
+                let points = sorted[s]
+                while cursors[s] < points.count && points[cursors[s]].time <= next + tolerance {
+                    let value = points[cursors[s]].value
+                    if value.isFinite {
+                        if !last[s].isFinite { started += 1 }
+                        last[s] = value
+                    }
+                    cursors[s] += 1
+                }
+            }
+
+            guard started == k else { continue }
+            timestamps.append(Date(timeIntervalSince1970: next))
+            for s in 0..<k {
+                columns[s].append(last[s])
+            }
+        }
+
+        return Alignment(timestamps: timestamps, values: columns)
+    }
+
+    // MARK: - Normalisation
+
+    /// (value / first − 1) × 100; all NaN when the series has no usable first value
+    static func percentChange(_ values: [Double]) -> [Double] {
+        guard let first = values.first, first.isFinite, first != 0 else {
+            return [Double](repeating: .nan, count: values.count)
+        }
+        return vDSP.add(-100, vDSP.multiply(100 / first, values))
+    }
+
+    // MARK: - Helpers
+
+    private static func isSorted(_ samples: [Sample]) -> Bool {
+        zip(samples, samples.dropFirst()).allSatisfy { $0.time <= $1.time }
+    }
+
+    /// Half the smallest average spacing across the series (0 for single points), O(k)
+    private static func defaultTolerance(for series: [[Sample]]) -> TimeInterval {
+        let spacings: [TimeInterval] = series.compactMap { samples in
+            guard samples.count > 1 else { return nil }
+            return (samples[samples.count - 1].time - samples[0].time) / Double(samples.count - 1)
+        }
+        return (spacings.min() ?? 0) / 2
+    }
+}
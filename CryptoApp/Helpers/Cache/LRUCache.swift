@@ -0,0 +1,155 @@
+//
+//  LRUCache.swift
+//  CryptoApp
+//
+
+import Foundation
+
+/**
+ * LRU CACHE
+ *
+ * Small in-memory least-recently-used cache with an entry limit and an optional cost limit:
+ * - Lookups and inserts are O(1) (dictionary + doubly linked recency list)
+ * - Reads promote an entry; inserts beyond either limit evict from the cold end
+ * - `trim(toCost:)` lets owners shed memory on demand (memory warnings)
+ *
+ * NOTE: Not thread-safe. Owners confine it to one queue or guard it with a lock.
+ */
+final class LRUCache<Key: Hashable, Value> {
+
+    // MARK: - Node
+
+    private final class Node {
+        let key: Key
+        var value: Value
+        var cost: Int
+        var newer: Node?
+        weak var older: Node?
+
+        init(key: Key, value: Value, cost: Int) {
+            self.key = key
+            self.value = value
+            self.cost = cost
+        }
+    }
+
+    // MARK: - Properties
+
+    let countLimit: Int
+    let costLimit: Int
+
+    /// Called for every entry dropped to satisfy a limit (not for explicit removals)
+    var onEvict: ((Key, Value) -> Void)?
+
+    private var nodes: [Key: Node] = [:]
+    /// Least recently used entry (evicted first); strongly owns the chain towards `mostRecent`
+    private var leastRecent: Node?
+    private weak var mostRecent: Node?
+
+    private(set) var totalCost = 0
+    var count: Int { nodes.count }
+
+    // MARK: - Initialization
+
+    init(countLimit: Int, costLimit: Int = .max) {
+        self.countLimit = max(1, countLimit)
+        self.costLimit = max(1, costLimit)
+    }
+
+    // MARK: - Access
+
+    /// Returns the cached value and marks it most recently used
+    func value(forKey key: Key) -> Value? {
+        guard let node = nodes[key] else { return nil }
+        moveToMostRecent(node)
+        return node.value
+    }
+
+    /// Checks membership without touching recency
+    func contains(_ key: Key) -> Bool {
+        nodes[key] != nil
+    }
+
+    func setValue(_ value: Value, forKey key: Key, cost: Int = 0) {
+        if let node = nodes[key] {
+            totalCost += cost - node.cost
+            node.value = value
+            node.cost = cost
+            moveToMostRecent(node)
+        } else {
+            let node = Node(key: key, value: value, cost: cost)
+            nodes[key] = node
+            totalCost += cost
+            appendMostRecent(node)
+        }
+        evict(toCount: countLimit, cost: costLimit)
+    }
+
+    @discardableResult
+    func removeValue(forKey key: Key) -> Value? {
+        guard let node = nodes.removeValue(forKey: key) else { return nil }
+        unlink(node)
+        totalCost -= node.cost
+        return node.value
+    }
+
+    func removeAll() {
+        nodes.removeAll()
+        leastRecent = nil
+        mostRecent = nil
+        totalCost = 0
+    }
+
+    /// Evicts least recently used entries until the total cost fits; returns the number evicted
+    @discardableResult
+    func trim(toCost cost: Int) -> Int {
+        evict(toCount: countLimit, cost: max(0, cost))
+    }
+
+    // MARK: - Recency List
+
+    private func appendMostRecent(_ node: Node) {
+        node.older = mostRecent
+        node.newer = nil
+        mostRecent?.newer = node
+        mostRecent = node
+        if leastRecent == nil {
+            leastRecent = node
+        }
+    }
+
+    private func unlink(_ node: Node) {
+        if node === leastRecent {
+            leastRecent = node.newer
+        }
+        if node === mostRecent {
+            mostRecent = node.older
+        }
+        node.older?.newer = node.newer
+        node.newer?.older = node.older
+        node.newer = nil
+        node.older = nil
+    }
+
+    private func moveToMostRecent(_ node: Node) {
+        guard node !== mostRecent else { return }
+        // Keep the node alive while it is briefly outside the chain
+        withExtendedLifetime(node) {
+            unlink(node)
+            appendMostRecent(node)
+        }
+    }
+
+    @discardableResult
+    private func evict(toCount countLimit: Int, cost costLimit: Int) -> Int {
+        var evicted = 0
+        while (nodes.count > countLimit || totalCost > costLimit), let node = leastRecent {
+            nodes.removeValue(forKey: node.key)
+            unlink(node)
+            totalCost -= node.cost
+            evicted += 1
+            onEvict?(node.key, node.value)
+        }
+        return evicted
+    }
+}
@@ -0,0 +1,316 @@
+//
+//  LogoAtlas.swift
+//  CryptoApp
+//
+
+import UIKit
+
+/// Where a logo lives inside an atlas sheet; CoinImageView shows it via `CALayer.contentsRect`
+@objc final class LogoAtlasSlot: NSObject {
+    @objc let sheet: CGImage
+    /// Unit-coordinate rect of the logo's cell within `sheet` (origin top-left)
+    @objc let contentsRect: CGRect
+
+    init(sheet: CGImage, contentsRect: CGRect) {
+        self.sheet = sheet
+        self.contentsRect = contentsRect
+    }
+}
+
+/**
+ * LOGO ATLAS
+ *
+ * Packs the downsampled logos of the top-N coins into a few shared, pre-decoded bitmaps
+ * (8×8 cells per sheet). List cells reference a sub-rect of a sheet instead of holding their
+ * own UIImage, so the first screen needs no per-logo decode and no per-logo allocation.
+ *
+ * - Built on a background queue from LogoImageCache (memory, then disk) whenever the set of
+ *   top coins changes; coins whose logo isn't cached yet are left out and picked up by a later
+ *   rebuild once they have downloaded
+ * - Persisted as PNG sheets plus a manifest in Caches/LogoAtlas (next to the logo disk cache)
+ *   and restored at launch with one read and decode per sheet. Each build writes sheets under
+ *   new generation file names and commits by replacing the manifest, so a failed or interrupted
+ *   write never pairs a manifest with another build's sheets
+ * - Logos outside the atlas keep going through ImageLoader as before
+ */
+@objc final class LogoAtlas: NSObject {
+
+    @objc static let shared = LogoAtlas()
+
+    // MARK: - Configuration
+
+    static let defaultCapacity = 100
+    static let columns = 8
+    static let cellsPerSheet = columns * columns
+    /// Matches ImageLoader's downsample size
+    static let cellPoints: CGFloat = 64
+    /// Minimum spacing between rebuilds that only retry missing logos
+    private static let incompleteRebuildInterval: TimeInterval = 30
+
+    // MARK: - Types
+
+    private struct Manifest: Codable {
+        static let currentVersion = 2
+        let version: Int
+        let scale: CGFloat
+        let cellPixels: Int
+        /// Requested URLs (rebuild signature, compared as a set)
+        let requested: [String]
+        /// Packed URLs in slot order
+        let packed: [String]
+        /// Sheet file names in sheet order, unique to the build that wrote them
+        let sheetFiles: [String]
+    }
+
+    // MARK: - Properties
+
+    private let directory: URL
+    private let scale: CGFloat
+    private let imageProvider: (String) -> UIImage?
+    private let buildQueue = DispatchQueue(label: "logo.atlas.build", qos: .utility)
+
+    /// Published slots by URL, swapped atomically after each build
+    private var slots: [String: LogoAtlasSlot] = [:]
+    private let slotsLock = NSLock()
+
+    // buildQueue only
+    private var manifest: Manifest?
+    private var lastBuildDate = Date.distantPast
+
+    // MARK: - Initialization
+
+    private convenience override init() {
+        self.init(
+            directory: FileManager.default.urls(for: .cachesDirectory, in: .userDomainMask)[0]
+                .appendingPathComponent("LogoAtlas", isDirectory: true),
+            scale: UIScreen.main.scale,
+            imageProvider: { url in
+                LogoImageCache.shared.memoryImage(for: url) ?? LogoImageCache.shared.diskImage(for: url, promote: false)
+            }
+        )
+        buildQueue.async { [weak self] in
+            self?.restoreLocked()
+        }
+    }
+
+    init(directory: URL, scale: CGFloat, imageProvider: @escaping (String) -> UIImage?) {
+        self.directory = directory
+        self.scale = scale
+        self.imageProvider = imageProvider
+        super.init()
+        try? FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+        MemoryAccountant.shared.register(self)
+    }
+
+    // MARK: - Lookup
+
+    /// Atlas slot for a logo URL, nil when the logo isn't packed
+    @objc(slotForURL:)
+    func slot(for url: String) -> LogoAtlasSlot? {
+        slotsLock.lock()
+        defer { slotsLock.unlock() }
+        return slots[url]
+    }
+
+    var packedCount: Int {
+        slotsLock.lock()
+        defer { slotsLock.unlock() }
+        return slots.count
+    }
+
+    /// Decoded bytes of the published sheets
+    var residentBytes: Int {
+        slotsLock.lock()
+        defer { slotsLock.unlock() }
+        var seen = Set<ObjectIdentifier>()
+        return slots.values.reduce(0) { total, slot in
+            seen.insert(ObjectIdentifier(slot.sheet)).inserted ? total + slot.sheet.bytesPerRow * slot.sheet.height : total
+        }
+    }
+
+    // MARK: - Building
+
+    /// Schedules a background rebuild for the given logo URLs (most important first) if they changed
+    func update(urls: [String], capacity: Int = LogoAtlas.defaultCapacity) {
+        let requested = Array(urls.prefix(capacity))
+        buildQueue.async { [weak self] in
+            self?.rebuildIfNeededLocked(requested: requested)
+        }
+    }
+
+    /// Synchronous variant for tests and callers already off the main thread
+    func rebuildNow(urls: [String], capacity: Int = LogoAtlas.defaultCapacity) {
+        let requested = Array(urls.prefix(capacity))
+        buildQueue.sync {
+            rebuildIfNeededLocked(requested: requested)
+        }
+    }
+
+    /// Loads the persisted atlas synchronously (the shared instance restores in the background at launch)
+    func restoreNow() {
+        buildQueue.sync {
+            restoreLocked()
+        }
+    }
+
+    private func rebuildIfNeededLocked(requested: [String]) {
+        // Rank reshuffles reorder the same logos; only a different set needs new sheets
+        if let manifest = manifest, Set(manifest.requested) == Set(requested) {
+            let isComplete = manifest.packed.count == requested.count
+            guard !isComplete,
+                  Date().timeIntervalSince(lastBuildDate) >= Self.incompleteRebuildInterval else { return }
+        }
+        lastBuildDate = Date()
+
+        let cellPixels = Int((Self.cellPoints * scale).rounded())
+        var packed: [String] = []
+        var images: [UIImage] = []
+        for url in requested {
+            guard let image = imageProvider(url) else { continue }
+            packed.append(url)
+            images.append(image)
+        }
+
+        let sheets = stride(from: 0, to: images.count, by: Self.cellsPerSheet).compactMap { start -> CGImage? in
+            Self.renderSheet(Array(images[start..<min(start + Self.cellsPerSheet, images.count)]), cellPixels: cellPixels)
+        }
+        guard sheets.count == (images.count + Self.cellsPerSheet - 1) / Self.cellsPerSheet else {
+            AppLogger.cache("Logo atlas render failed", level: .warning)
+            return
+        }
+
+        let generation = UUID().uuidString.prefix(8)
+        let manifest = Manifest(version: Manifest.currentVersion, scale: scale, cellPixels: cellPixels,
+                                requested: requested, packed: packed,
+                                sheetFiles: sheets.indices.map { "sheet-\(generation)-\($0).png" })
+        publish(manifest, sheets: sheets)
+        persist(manifest, sheets: sheets)
+        AppLogger.cache("Logo atlas rebuilt: \(packed.count)/\(requested.count) logos in \(sheets.count) sheet(s)")
+    }
+
+    private func publish(_ manifest: Manifest, sheets: [CGImage]) {
+        var newSlots: [String: LogoAtlasSlot] = [:]
+        for (index, url) in manifest.packed.enumerated() {
+            let sheetIndex = index / Self.cellsPerSheet
+            let cellCount = min(Self.cellsPerSheet, manifest.packed.count - sheetIndex * Self.cellsPerSheet)
+            newSlots[url] = LogoAtlasSlot(sheet: sheets[sheetIndex],
+                                          contentsRect: Self.contentsRect(forCell: index % Self.cellsPerSheet, cellCount: cellCount))
+        }
+        self.manifest = manifest
+        slotsLock.lock()
+        slots = newSlots
+        slotsLock.unlock()
+    }
+
+    // MARK: - Layout
+
+    static func rows(forCellCount cellCount: Int) -> Int {
+        max(1, (cellCount + columns - 1) / columns)
+    }
+
+    /// Unit rect of `cell` in a sheet holding `cellCount` cells (sheets are only as tall as needed)
+    static func contentsRect(forCell cell: Int, cellCount: Int) -> CGRect {
+        let rows = CGFloat(rows(forCellCount: cellCount))
+        let columns = CGFloat(Self.columns)
+        return CGRect(x: CGFloat(cell % Self.columns) / columns,
+                      y: CGFloat(cell / Self.columns) / rows,
+                      width: 1 / columns,
+                      height: 1 / rows)
+    }
+
+    /// Draws up to `cellsPerSheet` logos aspect-fitted into square cells, row by row from the top
+    private static func renderSheet(_ images: [UIImage], cellPixels: Int) -> CGImage? {
+        let cell = CGFloat(cellPixels)
+        let size = CGSize(width: cell * CGFloat(columns), height: cell * CGFloat(rows(forCellCount: images.count)))
+        let format = UIGraphicsImageRendererFormat()
+        format.scale = 1
+        format.opaque = false
+        let sheet = UIGraphicsImageRenderer(size: size, format: format).image { _ in
+            for (index, image) in images.enumerated() {
+                let origin = CGPoint(x: CGFloat(index % columns) * cell, y: CGFloat(index / columns) * cell)
+                let fit = min(cell / max(image.size.width, 1), cell / max(image.size.height, 1))
+                let drawSize = CGSize(width: image.size.width * fit, height: image.size.height * fit)
+                image.draw(in: CGRect(x: origin.x + (cell - drawSize.width) / 2,
+                                      y: origin.y + (cell - drawSize.height) / 2,
+                                      width: drawSize.width,
+                                      height: drawSize.height))
+            }
+        }
+        return sheet.cgImage
+    }
+
+    // MARK: - Persistence (buildQueue only)
+
+    private var manifestURL: URL {
+        directory.appendingPathComponent("manifest.json")
+    }
+
+    private func sheetURL(_ name: String) -> URL {
+        directory.appendingPathComponent(name)
+    }
+
+    /// Writes this build's sheets, then commits by atomically replacing the manifest; the
+    /// previous build's sheets are only deleted after the commit
+    private func persist(_ manifest: Manifest, sheets: [CGImage]) {
+        var written: [URL] = []
+        do {
+            for (name, sheet) in zip(manifest.sheetFiles, sheets) {
+                guard let data = UIImage(cgImage: sheet).pngData() else {
+                    throw CocoaError(.fileWriteUnknown)
+                }
+                let url = sheetURL(name)
+                try data.write(to: url, options: .atomic)
+                written.append(url)
+            }
+            try JSONEncoder().encode(manifest).write(to: manifestURL, options: .atomic)
+        } catch {
+            written.forEach { try? FileManager.default.removeItem(at: $0) }
+            AppLogger.cache("Logo atlas persist failed: \(error.localizedDescription)", level: .warning)
+            return
+        }
+        removeSheets(except: Set(manifest.sheetFiles))
+    }
+
+    /// Deletes sheets of earlier builds, including leftovers of writes interrupted by a crash
+    private func removeSheets(except keep: Set<String>) {
+        let files = (try? FileManager.default.contentsOfDirectory(atPath: directory.path)) ?? []
+        for name in files where name.hasSuffix(".png") && !keep.contains(name) {
+            try? FileManager.default.removeItem(at: sheetURL(name))
+        }
+    }
+
+    /// Loads the persisted sheets, decoding each once, and publishes their slots
+    private func restoreLocked() {
+        guard let data = try? Data(contentsOf: manifestURL),
+              let manifest = try? JSONDecoder().decode(Manifest.self, from: data),
+              manifest.version == Manifest.currentVersion,
+              manifest.scale == scale else { return }
+
+        let sheetCount = (manifest.packed.count + Self.cellsPerSheet - 1) / Self.cellsPerSheet
+        guard manifest.sheetFiles.count == sheetCount else { return }
+        var sheets: [CGImage] = []
+        for name in manifest.sheetFiles {
+            guard let source = CGImageSourceCreateWithURL(sheetURL(name) as CFURL, nil),
+                  let sheet = CGImageSourceCreateImageAtIndex(source, 0, [kCGImageSourceShouldCacheImmediately: true] as CFDictionary) else {
+                return
+            }
+            sheets.append(sheet)
+        }
+        publish(manifest, sheets: sheets)
+        AppLogger.cache("Logo atlas restored: \(manifest.packed.count) logos from \(sheetCount) sheet(s)")
+    }
+}
+
+// MARK: - Memory Accounting
+
+extension LogoAtlas: MemoryAccountable {
+
+    /// Reported but never released: visible cells draw straight from the sheets
+    func memoryFootprint() -> MemoryFootprint {
+        MemoryFootprint(name: "LogoAtlas", bytes: residentBytes)
+    }
+
+    func releaseMemory(for tier: MemoryPressureTier) -> Int {
+        return 0
+    }
+}
@@ -0,0 +1,227 @@
+//
+//  LogoImageCache.swift
+//  CryptoApp
+//
+
+import UIKit
+import CryptoKit
+
+/**
+ * LOGO IMAGE CACHE
+ *
+ * Two-tier cache for downsampled coin logos, kept apart from CacheService's data budget:
+ * - Memory: decoded images in an LRU whose cost is pixels (width × height), so the budget
+ *   tracks actual bitmap memory regardless of point size or screen scale
+ * - Disk: the already-downsampled image, PNG-encoded, in Caches/LogoCache under the SHA-256
+ *   of the URL (stable across launches, unlike `String.hash`), evicted least recently used
+ *   once the directory exceeds its byte limit
+ *
+ * A relaunch therefore shows logos from disk without network traffic or re-downsampling.
+ *
+ * Threading: the memory tier is lock-protected and safe from any thread; disk reads happen on
+ * the caller's (background) thread; writes, index updates and eviction run on a serial IO queue.
+ */
+final class LogoImageCache {
+
+    static let shared = LogoImageCache()
+
+    // MARK: - Configuration
+
+    static let defaultMemoryPixelLimit = 4_000_000     // ≈16 MB of RGBA bitmaps
+    static let defaultDiskByteLimit = 30 * 1024 * 1024  // 30 MB
+    /// Eviction trims to this fraction of the disk limit so it doesn't run on every write
+    private static let diskTrimRatio = 0.8
+
+    // MARK: - Properties
+
+    private let memory: LRUCache<String, UIImage>
+    private let memoryLock = NSLock()
+
+    let directory: URL
+    let diskByteLimit: Int
+    private let ioQueue = DispatchQueue(label: "logo.cache.disk", qos: .utility)
+    /// File name → (bytes, last use); loaded lazily from the directory (ioQueue only)
+    private var diskIndex: [String: (bytes: Int, lastUsed: Date)]?
+    private var diskBytes = 0
+
+    // MARK: - Initialization
+
+    init(directory: URL? = nil,
+         memoryPixelLimit: Int = LogoImageCache.defaultMemoryPixelLimit,
+         diskByteLimit: Int = LogoImageCache.defaultDiskByteLimit) {
+        self.memory = LRUCache(countLimit: 2000, costLimit: memoryPixelLimit)
+        self.directory = directory ?? FileManager.default.urls(for: .cachesDirectory, in: .userDomainMask)[0]
+            .appendingPathComponent("LogoCache", isDirectory: true)
+        self.diskByteLimit = diskByteLimit
+        try? FileManager.default.createDirectory(at: self.directory, withIntermediateDirectories: true)
+        MemoryAccountant.shared.register(self)
+    }
+
+    // MARK: - Memory Tier
+
+    /// Decoded image if it's in memory; never touches disk
+    func memoryImage(for url: String) -> UIImage? {
+        memoryLock.lock()
+        defer { memoryLock.unlock() }
+        return memory.value(forKey: url)
+    }
+
+    var memoryPixelCost: Int {
+        memoryLock.lock()
+        defer { memoryLock.unlock() }
+        return memory.totalCost
+    }
+
+    func trimMemory(toFraction fraction: Double) {
+        memoryLock.lock()
+        memory.trim(toCost: Int(Double(memory.costLimit) * fraction))
+        memoryLock.unlock()
+    }
+
+    private func storeInMemory(_ image: UIImage, for url: String) {
+        memoryLock.lock()
+        memory.setValue(image, forKey: url, cost: Self.pixelCost(of: image))
+        memoryLock.unlock()
+    }
+
+    static func pixelCost(of image: UIImage) -> Int {
+        if let cgImage = image.cgImage {
+            return cgImage.width * cgImage.height
+        }
+        return Int(image.size.width * image.scale * image.size.height * image.scale)
+    }
+
+    // MARK: - Both Tiers
+
+    /**
+     * Stores a downsampled image in memory and persists it to disk.
+     * PNG encoding happens on the calling thread; call from a background queue.
+     */
+    func store(_ image: UIImage, for url: String) {
+        storeInMemory(image, for: url)
+        guard let data = image.pngData() else { return }
+        let name = Self.fileName(for: url)
+        ioQueue.async { [weak self] in
+            self?.writeLocked(data, name: name)
+        }
+    }
+
+    /**
+     * Disk lookup for a memory miss: decodes the stored bitmap (already at display size) and,
+     * unless `promote` is false (bulk readers like LogoAtlas), keeps it in memory.
+     * Blocking file read; call from a background queue.
+     */
+    func diskImage(for url: String, promote: Bool = true) -> UIImage? {
+        let name = Self.fileName(for: url)
+        guard let data = try? Data(contentsOf: fileURL(for: name)),
+              let image = UIImage(data: data, scale: UIScreen.main.scale)?.preparingForDisplay() else {
+            return nil
+        }
+        if promote {
+            storeInMemory(image, for: url)
+        }
+        ioQueue.async { [weak self] in
+            self?.touchLocked(name)
+        }
+        return image
+    }
+
+    /// Empties both tiers
+    func removeAll() {
+        memoryLock.lock()
+        memory.removeAll()
+        memoryLock.unlock()
+        ioQueue.sync {
+            let files = (try? FileManager.default.contentsOfDirectory(at: directory, includingPropertiesForKeys: nil)) ?? []
+            files.forEach { try? FileManager.default.removeItem(at: $0) }
+            diskIndex = [:]
+            diskBytes = 0
+        }
+    }
+
+    /// Bytes currently stored on disk (waits for pending writes)
+    var diskUsage: Int {
+        ioQueue.sync {
+            loadIndexIfNeededLocked()
+            return diskBytes
+        }
+    }
+
+    // MARK: - Disk Tier (ioQueue only)
+
+    static func fileName(for url: String) -> String {
+        SHA256.hash(data: Data(url.utf8)).map { String(format: "%02x", $0) }.joined() + ".png"
+    }
+
+    private func fileURL(for name: String) -> URL {
+        directory.appendingPathComponent(name, isDirectory: false)
+    }
+
+    private func writeLocked(_ data: Data, name: String) {
+        loadIndexIfNeededLocked()
+        do {
+            try data.write(to: fileURL(for: name), options: .atomic)
+        } catch {
+            AppLogger.cache("Logo disk write failed: \(error.localizedDescription)", level: .warning)
+            return
+        }
+        diskBytes += data.count - (diskIndex?[name]?.bytes ?? 0)
+        diskIndex?[name] = (data.count, Date())
+        evictIfNeededLocked()
+    }
+
+    private func touchLocked(_ name: String) {
+        loadIndexIfNeededLocked()
+        guard let entry = diskIndex?[name] else { return }
+        let now = Date()
+        diskIndex?[name] = (entry.bytes, now)
+        // Persist recency so LRU order survives relaunches
+        try? FileManager.default.setAttributes([.modificationDate: now], ofItemAtPath: fileURL(for: name).path)
+    }
+
+    private func loadIndexIfNeededLocked() {
+        guard diskIndex == nil else { return }
+        let keys: [URLResourceKey] = [.fileSizeKey, .contentModificationDateKey]
+        let files = (try? FileManager.default.contentsOfDirectory(at: directory, includingPropertiesForKeys: keys)) ?? []
+        var index: [String: (bytes: Int, lastUsed: Date)] = [:]
+        var total = 0
+        for file in files {
+            let values = try? file.resourceValues(forKeys: Set(keys))
+            let bytes = values?.fileSize ?? 0
+            index[file.lastPathComponent] = (bytes, values?.contentModificationDate ?? .distantPast)
+            total += bytes
+        }
+        diskIndex = index
+        diskBytes = total
+    }
+
+    /// Removes least recently used files until the directory is back under the trim target
+    private func evictIfNeededLocked() {
+        guard diskBytes > diskByteLimit, let index = diskIndex else { return }
+        let target = Int(Double(diskByteLimit) * Self.diskTrimRatio)
+        for (name, entry) in index.sorted(by: { $0.value.lastUsed < $1.value.lastUsed }) {
+            guard diskBytes > target else { break }
+            try? FileManager.default.removeItem(at: fileURL(for: name))
+            diskIndex?.removeValue(forKey: name)
+            diskBytes -= entry.bytes
+        }
+        AppLogger.cache("Logo disk cache trimmed to \(diskBytes) bytes")
+    }
+}
+
+// MARK: - Memory Accounting
+
+extension LogoImageCache: MemoryAccountable {
+
+    func memoryFootprint() -> MemoryFootprint {
+        MemoryFootprint(name: "LogoImageCache", bytes: MemoryEstimate.bitmap(pixels: memoryPixelCost), tier: .images)
+    }
+
+    /// Keeps the most recently used quarter (likely on screen); the rest reloads from disk
+    func releaseMemory(for tier: MemoryPressureTier) -> Int {
+        guard tier == .images else { return 0 }
+        let before = memoryPixelCost
+        trimMemory(toFraction: 0.25)
+        return MemoryEstimate.bitmap(pixels: before - memoryPixelCost)
+    }
+}
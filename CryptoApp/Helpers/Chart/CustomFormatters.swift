@@ -71,6 +71,33 @@ class PriceFormatter: AxisValueFormatter {
     }
 }
 
+// MARK: - Log / Percent Formatters for Derived Candle Series
+
+/**
+ * LogPriceFormatter labels a log10 price axis with the prices it represents,
+ * so a logarithmic candle chart still reads in dollars.
+ */
+class LogPriceFormatter: AxisValueFormatter {
+    
+    private let priceFormatter = PriceFormatter()
+    
+    func stringForValue(_ value: Double, axis: AxisBase?) -> String {
+        priceFormatter.stringForValue(pow(10, value), axis: axis)
+    }
+}
+
+/**
+ * PercentChangeFormatter labels a percent-from-start axis ("+12.5%", "-3%").
+ */
+class PercentChangeFormatter: AxisValueFormatter {
+    
+    func stringForValue(_ value: Double, axis: AxisBase?) -> String {
+        let decimals = abs(value) >= 100 ? 0 : 1
+        let sign = value > 0 ? "+" : ""
+        return String(format: "%@%.*f%%", sign, decimals, value)
+    }
+}
+
 // MARK: - Date Formatter for Chart X-Axis
 
 /**
@@ -0,0 +1,151 @@
+//
+//  OHLCResampler.swift
+//  CryptoApp
+//
+
+import Foundation
+
+// MARK: - OHLC Timeframe
+
+/// Candle timeframes derivable locally from the finer series CoinGecko returns
+enum OHLCTimeframe: String, CaseIterable {
+    case native = "Auto"   // Whatever granularity the API returned for the range
+    case oneHour = "1H"
+    case fourHours = "4H"
+    case oneDay = "1D"
+    case oneWeek = "1W"
+
+    var seconds: TimeInterval {
+        switch self {
+        case .native: return 0
+        case .oneHour: return 3600
+        case .fourHours: return 4 * 3600
+        case .oneDay: return 86400
+        case .oneWeek: return 7 * 86400
+        }
+    }
+}
+
+/**
+ * OHLC RESAMPLER
+ *
+ * Aggregates a fine OHLC series into a coarser timeframe in a single streaming pass:
+ * - Source timestamps are candle close times (as CoinGecko reports them); each candle is
+ *   bucketed by its open time, one source interval earlier
+ * - Buckets are aligned to UTC calendar boundaries (hours from midnight, days, ISO weeks from Monday)
+ * - open = first open, close = last close, high/low = extremes, volume = sum
+ * - Output candles are stamped with their bucket start
+ * - Incomplete first/last buckets are reported so callers can drop or mark them
+ *
+ * CoinGecko's `ohlc` endpoint only offers fixed granularities per `days` value
+ * (30m for 1 day, 4h up to 30 days, 4d beyond), so 1H/4H/1D/1W views come from here
+ * instead of extra API calls.
+ */
+enum OHLCResampler {
+
+    struct Result {
+        let candles: [OHLCData]
+        /// First bucket started before the source data did (its open isn't the bucket's open)
+        let isFirstPartial: Bool
+        /// Last bucket hasn't closed yet relative to the source data (still forming)
+        let isLastPartial: Bool
+    }
+
+    /// Monday 1970-01-05 00:00 UTC — ISO weeks are aligned to this offset from the epoch
+    private static let weekAnchor: TimeInterval = 4 * 86400
+
+    // MARK: - Resampling
+
+    static func resample(_ candles: [OHLCData], to timeframe: OHLCTimeframe) -> Result {
+        guard timeframe != .native, !candles.isEmpty else {
+            return Result(candles: candles, isFirstPartial: false, isLastPartial: false)
+        }
+
+        let width = timeframe.seconds
+        let anchor = timeframe == .oneWeek ? weekAnchor : 0
+        let interval = sourceInterval(of: candles)
+
+        // A candle closing exactly on a boundary belongs to the bucket before it
+        func bucketStart(of candle: OHLCData) -> TimeInterval {
+            bucketStartTime(for: candle.timestamp.timeIntervalSince1970 - interval, width: width, anchor: anchor)
+        }
+
+        var output: [OHLCData] = []
+        output.reserveCapacity(Int(Double(candles.count) * max(interval, 1) / width) + 2)
+
+        var currentBucket = bucketStart(of: candles[0])
+        var open = candles[0].open
+        var high = candles[0].high
+        var low = candles[0].low
+        var close = candles[0].close
+        var volume = candles[0].volume
+
+        func flush() {
+            output.append(OHLCData(timestamp: Date(timeIntervalSince1970: currentBucket),
+                                   open: open, high: high, low: low, close: close, volume: volume))
+        }
+
+        for candle in candles.dropFirst() {
+            let start = bucketStart(of: candle)
+            if start != currentBucket {
+                flush()
+                currentBucket = start
+                open = candle.open
+                high = candle.high
+                low = candle.low
+                close = candle.close
+                volume = candle.volume
+            } else {
+                high = max(high, candle.high)
+                low = min(low, candle.low)
+                close = candle.close
+                if let candleVolume = candle.volume {
+                    volume = (volume ?? 0) + candleVolume
+                }
+            }
+        }
+        flush()
+
+        let firstOpen = candles[0].timestamp.timeIntervalSince1970 - interval
+        let lastClose = candles[candles.count - 1].timestamp.timeIntervalSince1970
+        let firstBucket = output[0].timestamp.timeIntervalSince1970
+        let lastBucket = output[output.count - 1].timestamp.timeIntervalSince1970
+
+        return Result(
+            candles: output,
+            isFirstPartial: firstOpen > firstBucket,
+            isLastPartial: lastClose < lastBucket + width
+        )
+    }
+
+    // MARK: - Timeframe Availability
+
+    /// Typical spacing of the source candles (median gap; robust to missing candles)
+    static func sourceInterval(of candles: [OHLCData]) -> TimeInterval {
+        guard candles.count > 1 else { return 0 }
+        let sampleCount = min(candles.count - 1, 64)
+        let gaps = (0..<sampleCount).map { index -> TimeInterval in
+            let offset = candles.count - 1 - sampleCount + index
+            return candles[offset + 1].timestamp.timeIntervalSince(candles[offset].timestamp)
+        }.sorted()
+        return gaps[gaps.count / 2]
+    }
+
+    /// Native plus every timeframe strictly coarser than the source that still yields at least two candles
+    static func availableTimeframes(for candles: [OHLCData]) -> [OHLCTimeframe] {
+        guard let first = candles.first, let last = candles.last else { return [.native] }
+        let interval = sourceInterval(of: candles)
+        let span = last.timestamp.timeIntervalSince(first.timestamp)
+        guard interval > 0 else { return [.native] }
+
+        return [.native] + OHLCTimeframe.allCases.filter { timeframe in
+            timeframe != .native && timeframe.seconds > interval * 1.5 && span >= timeframe.seconds * 2
+        }
+    }
+
+    // MARK: - Private Helpers
+
+    private static func bucketStartTime(for time: TimeInterval, width: TimeInterval, anchor: TimeInterval) -> TimeInterval {
+        ((time - anchor) / width).rounded(.down) * width + anchor
+    }
+}
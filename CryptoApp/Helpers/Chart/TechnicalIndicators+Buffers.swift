@@ -0,0 +1,85 @@
+//
+//  TechnicalIndicators+Buffers.swift
+//  CryptoApp
+//
+
+import Foundation
+
+// MARK: - Index-Aligned Indicator Buffers
+
+/**
+ * Dense indicator values aligned 1:1 with the source series.
+ *
+ * Chart datasets drop warm-up points and may use timestamps or indices as X, so reading an
+ * indicator "at candle i" from a dataset means scanning or guessing. A buffer keeps one
+ * value per source index instead (NaN during warm-up), so crosshair and viewport label
+ * lookups are a single array read regardless of the chart's coordinate system.
+ */
+extension TechnicalIndicators {
+
+    struct IndicatorBuffer {
+        /// One value per source index; NaN where the indicator is undefined (warm-up)
+        private(set) var values: [Double]
+        /// Lookback period the values were computed with
+        let period: Int
+        /// First index holding a finite value, nil while the whole buffer is warm-up
+        private(set) var firstValidIndex: Int?
+
+        init(values: [Double?], period: Int) {
+            self.values = values.map { $0 ?? .nan }
+            self.period = period
+            self.firstValidIndex = self.values.firstIndex { $0.isFinite }
+        }
+
+        init(_ result: MovingAverageResult) {
+            self.init(values: result.values, period: result.period)
+        }
+
+        init(_ result: RSIResult) {
+            self.init(values: result.values, period: result.period)
+        }
+
+        var count: Int { values.count }
+
+        /// Value at a source index in O(1); nil outside the series or during warm-up
+        func value(at index: Int) -> Double? {
+            guard values.indices.contains(index) else { return nil }
+            let value = values[index]
+            return value.isFinite ? value : nil
+        }
+
+        /// Most recent value, nil if it isn't defined yet
+        var latest: Double? {
+            value(at: values.count - 1)
+        }
+
+        /// True when `index` lies before the first defined value
+        func isWarmingUp(at index: Int) -> Bool {
+            guard let first = firstValidIndex else { return true }
+            return index < first
+        }
+
+        // MARK: Incremental Updates
+
+        /// Appends the value for a new source index (nil/NaN while still warming up)
+        mutating func append(_ value: Double?) {
+            let stored = value ?? .nan
+            values.append(stored)
+            if firstValidIndex == nil && stored.isFinite {
+                firstValidIndex = values.count - 1
+            }
+        }
+
+        /// Rewrites the value for the last source index (live candle updates)
+        mutating func replaceLast(_ value: Double?) {
+            guard let last = values.indices.last else { return }
+            let stored = value ?? .nan
+            values[last] = stored
+            if firstValidIndex == last && !stored.isFinite {
+                firstValidIndex = nil
+            } else if firstValidIndex == nil && stored.isFinite {
+                firstValidIndex = last
+            }
+        }
+    }
+}
@@ -0,0 +1,140 @@
+//
+//  TechnicalIndicators+Incremental.swift
+//  CryptoApp
+//
+
+import Foundation
+
+// MARK: - Incremental Indicator State
+
+/**
+ * Streaming counterparts of the batch indicator calculations.
+ *
+ * Each type consumes one price at a time in O(1) and produces the same values the
+ * batch functions in `TechnicalIndicators` would produce for the full series so far.
+ * Used wherever prices arrive as a stream (live ticks, alert evaluation) and
+ * recomputing the whole series per update would be wasteful.
+ */
+extension TechnicalIndicators {
+
+    /// Rolling Simple Moving Average backed by a fixed-size ring buffer
+    struct RollingSMA {
+        let period: Int
+        private var window: [Double]
+        private var head = 0
+        private var count = 0
+        private var sum = 0.0
+
+        init(period: Int) {
+            self.period = max(1, period)
+            self.window = Array(repeating: 0, count: self.period)
+        }
+
+        /// Current SMA, nil until `period` prices have been observed
+        var value: Double? {
+            guard count >= period else { return nil }
+            let average = sum / Double(period)
+            return average.isFinite ? average : nil
+        }
+
+        /// Appends a price and returns the updated SMA
+        @discardableResult
+        mutating func append(_ price: Double) -> Double? {
+            if count >= period {
+                sum -= window[head]
+            } else {
+                count += 1
+            }
+            window[head] = price
+            sum += price
+            head = (head + 1) % period
+            return value
+        }
+    }
+
+    /// Rolling Exponential Moving Average seeded with the SMA of the first `period` prices
+    struct RollingEMA {
+        let period: Int
+        private let multiplier: Double
+        private var seedSum = 0.0
+        private var count = 0
+        private(set) var value: Double?
+
+        init(period: Int) {
+            self.period = max(1, period)
+            self.multiplier = 2.0 / Double(self.period + 1)
+        }
+
+        /// Appends a price and returns the updated EMA
+        @discardableResult
+        mutating func append(_ price: Double) -> Double? {
+            count += 1
+            if count < period {
+                seedSum += price
+                return nil
+            }
+            if count == period {
+                let seed = (seedSum + price) / Double(period)
+                value = seed.isFinite ? seed : nil
+                return value
+            }
+            guard let previous = value else { return nil }
+            let next = (price * multiplier) + (previous * (1 - multiplier))
+            value = next.isFinite ? next : nil
+            return value
+        }
+    }
+
+    /// Rolling RSI using the same seeding and Wilder's smoothing as `calculateRSI`
+    struct RollingRSI {
+        let period: Int
+        private var previousPrice: Double?
+        private var changeCount = 0
+        private var avgGain = 0.0
+        private var avgLoss = 0.0
+        private(set) var value: Double?
+
+        init(period: Int = 14) {
+            self.period = max(1, period)
+        }
+
+        /// Appends a price and returns the updated RSI (0-100)
+        @discardableResult
+        mutating func append(_ price: Double) -> Double? {
+            defer { previousPrice = price }
+            guard let previous = previousPrice else { return nil }
+
+            let change = price - previous
+            let gain = change > 0 ? change : 0
+            let loss = change < 0 ? -change : 0
+            changeCount += 1
+
+            if changeCount <= period {
+                // Accumulate sums for the seed window, then convert to simple averages
+                avgGain += gain
+                avgLoss += loss
+                guard changeCount == period else { return nil }
+                avgGain /= Double(period)
+                avgLoss /= Double(period)
+            } else {
+                avgGain = ((avgGain * Double(period - 1)) + gain) / Double(period)
+                avgLoss = ((avgLoss * Double(period - 1)) + loss) / Double(period)
+            }
+
+            guard avgGain.isFinite && avgLoss.isFinite else {
+                value = nil
+                return nil
+            }
+
+            let rs: Double
+            if avgLoss == 0 {
+                rs = avgGain > 0 ? 100 : 0
+            } else {
+                rs = avgGain / avgLoss
+            }
+            let rsi = 100 - (100 / (1 + rs))
+            value = (rsi.isFinite && rsi >= 0 && rsi <= 100) ? rsi : nil
+            return value
+        }
+    }
+}
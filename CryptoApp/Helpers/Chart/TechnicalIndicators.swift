@@ -113,11 +113,11 @@ final class TechnicalIndicators {
      */
     struct VolumeAnalysis {
         /// Raw volume data
-        let volumes: [Double]
+        var volumes: [Double]
         /// Ratio of current volume to average volume (1.0 = average, >1.0 = above average)
-        let volumeRatio: [Double]
+        var volumeRatio: [Double]
         /// Boolean flags indicating periods of high volume (>1.5x average)
-        let isHighVolume: [Bool]
+        var isHighVolume: [Bool]
     }
     
     // MARK: - Simple Moving Average (SMA)
@@ -384,6 +384,15 @@ final class TechnicalIndicators {
             isHighVolume: isHighVolume
         )
     }
+    
+    /// Volume ratio at a single index in O(period) — same value `analyzeVolume` produces there.
+    /// Used by live chart updates that append or replace the last bar.
+    static func volumeRatio(at index: Int, volumes: [Double], period: Int = 20) -> Double {
+        guard period > 0, index >= period - 1, index < volumes.count else { return 1.0 }
+        let average = volumes[(index - period + 1)...index].reduce(0, +) / Double(period)
+        guard average > 0, average.isFinite else { return 1.0 }
+        return volumes[index] / average
+    }
     // MARK: - UserDefaults Integration
     
     /**
@@ -492,3 +501,6 @@ final class TechnicalIndicators {
  * are automatically codable since they use standard Swift types.
  */
 extension TechnicalIndicators.IndicatorSettings: Codable {}
+
+/// Equatable so prepared chart data can tell whether it was built for the current settings
+extension TechnicalIndicators.IndicatorSettings: Equatable {}
@@ -0,0 +1,162 @@
+//
+//  ChartDataExporter.swift
+//  CryptoApp
+//
+
+import Foundation
+import Combine
+
+/**
+ * CHART DATA EXPORTER
+ *
+ * Writes OHLC, volume and SMA/EMA/RSI series to CSV or the columnar binary format
+ * (see ColumnarExportWriter) for spreadsheets and notebooks.
+ *
+ * Memory stays bounded:
+ * - Rows are produced one at a time from the candles with rolling indicators and flushed to
+ *   disk in fixed-size chunks; no full-file string or per-column arrays are ever built
+ * - Watchlist exports fetch one coin at a time (cache-first via CoinManager) and drop their own
+ *   reference to its candles once written, so the exporter never holds more than one series
+ *
+ * NOTE: CoinManager fetches go through CoinService, which stores every OHLC series in
+ * CacheService for an hour like any chart fetch. Exported series therefore stay resident
+ * within the cache's 100 MB budget (and its pressure eviction) after the export finishes.
+ *
+ * All file work happens on a private serial queue; results are delivered on main. A file
+ * whose export fails or is cancelled is closed and deleted, never left half written.
+ */
+final class ChartDataExporter {
+
+    enum Format: String, CaseIterable {
+        case csv
+        case columnar
+
+        var displayName: String {
+            switch self {
+            case .csv: return "CSV"
+            case .columnar: return "Columnar (binary)"
+            }
+        }
+
+        var fileExtension: String {
+            switch self {
+            case .csv: return "csv"
+            case .columnar: return "capx"
+            }
+        }
+    }
+
+    // MARK: - Dependencies
+
+    private let coinManager: CoinManagerProtocol
+    private let directory: URL
+    private let exportQueue = DispatchQueue(label: "chart.export", qos: .utility)
+
+    init(coinManager: CoinManagerProtocol, directory: URL = FileManager.default.temporaryDirectory) {
+        self.coinManager = coinManager
+        self.directory = directory
+    }
+
+    // MARK: - Single Coin
+
+    /// Exports the candles of a prepared chart model using its indicator periods
+    func export(model: ChartModel, symbol: String, format: Format) -> AnyPublisher<URL, Error> {
+        let candles = model.ohlc
+        let settings = model.key.settings
+        let fileURL = makeFileURL(name: "\(symbol)-\(model.key.range)", format: format)
+        let exportQueue = self.exportQueue
+
+        return Future<URL, Error> { promise in
+            exportQueue.async {
+                promise(Result {
+                    guard !candles.isEmpty else { throw ChartExportError.noData }
+                    let writer = try Self.makeWriter(format: format, fileURL: fileURL)
+                    do {
+                        try Self.write(candles, symbol: symbol, settings: settings, to: writer)
+                        try writer.finish()
+                    } catch {
+                        writer.discard()
+                        throw error
+                    }
+                    return fileURL
+                })
+            }
+        }
+        .receive(on: DispatchQueue.main)
+        .eraseToAnyPublisher()
+    }
+
+    // MARK: - Watchlist
+
+    /**
+     * Exports every coin's candles for `range` into one file, one series per coin.
+     * Coins are fetched sequentially so the exporter holds one series at a time (fetched series
+     * are still cached by CoinService); coins whose data fails to load are skipped. The next fetch starts only once the previous series is written.
+     */
+    func exportWatchlist(coins: [Coin], range: String, format: Format,
+                         settings: TechnicalIndicators.IndicatorSettings = TechnicalIndicators.IndicatorSettings()) -> AnyPublisher<URL, Error> {
+        let fileURL = makeFileURL(name: "watchlist-\(range)d", format: format)
+        let exportQueue = self.exportQueue
+        let coinManager = self.coinManager
+
+        return Future<ChartExportWriter, Error> { promise in
+            exportQueue.async {
+                promise(Result { try Self.makeWriter(format: format, fileURL: fileURL) })
+            }
+        }
+        .flatMap { writer in
+            Publishers.Sequence<[Coin], Error>(sequence: coins)
+                // The write is part of each coin's publisher, so `.max(1)` holds the next fetch
+                // until the previous series is on disk rather than only until it has downloaded
+                .flatMap(maxPublishers: .max(1)) { coin in
+                    coinManager.fetchOHLCData(for: coin.slug?.lowercased() ?? coin.name.lowercased(), range: range, currency: "usd", priority: .low)
+                        .replaceError(with: [])
+                        .setFailureType(to: Error.self)
+                        .receive(on: exportQueue)
+                        .tryMap { candles -> Int in
+                            try Self.write(candles, symbol: coin.symbol, settings: settings, to: writer)
+                            return candles.count
+                        }
+                }
+                .reduce(0, +)
+                .tryMap { rowCount -> URL in
+                    try writer.finish()
+                    guard rowCount > 0 else { throw ChartExportError.noData }
+                    return fileURL
+                }
+                // Failures are thrown by the writes above, so they already arrive on exportQueue
+                .handleEvents(receiveCompletion: { completion in
+                    if case .failure = completion {
+                        writer.discard()
+                    }
+                }, receiveCancel: {
+                    exportQueue.async { writer.discard() }
+                })
+        }
+        .receive(on: DispatchQueue.main)
+        .eraseToAnyPublisher()
+    }
+
+    // MARK: - Helpers
+
+    static func makeWriter(format: Format, fileURL: URL) throws -> ChartExportWriter {
+        switch format {
+        case .csv: return try CSVExportWriter(fileURL: fileURL)
+        case .columnar: return try ColumnarExportWriter(fileURL: fileURL)
+        }
+    }
+
+    static func write(_ candles: [OHLCData], symbol: String,
+                      settings: TechnicalIndicators.IndicatorSettings, to writer: ChartExportWriter) throws {
+        guard !candles.isEmpty else { return }
+        try writer.beginSeries(symbol: symbol)
+        for row in ChartExportRows(candles: candles, settings: settings) {
+            try writer.write(row)
+        }
+    }
+
+    private func makeFileURL(name: String, format: Format) -> URL {
+        let stamp = Int(Date().timeIntervalSince1970)
+        return directory.appendingPathComponent("\(name)-\(stamp).\(format.fileExtension)")
+    }
+}
@@ -0,0 +1,298 @@
+//
+//  ChartExportWriter.swift
+//  CryptoApp
+//
+
+import Foundation
+
+// MARK: - Export Row
+
+/// One exported candle with its indicator values; NaN marks a missing value (no volume, warm-up)
+struct ChartExportRow {
+    let timestamp: TimeInterval
+    let open: Double
+    let high: Double
+    let low: Double
+    let close: Double
+    let volume: Double
+    let sma: Double
+    let ema: Double
+    let rsi: Double
+
+    static let columnNames = ["timestamp", "open", "high", "low", "close", "volume", "sma", "ema", "rsi"]
+
+    /// Values in `columnNames` order
+    var columns: [Double] {
+        [timestamp, open, high, low, close, volume, sma, ema, rsi]
+    }
+}
+
+/**
+ * Streams candles as export rows, computing SMA/EMA/RSI with the rolling indicator state.
+ * Holds O(period) indicator state instead of full indicator arrays, and yields the same
+ * values the batch calculations would.
+ */
+struct ChartExportRows: Sequence, IteratorProtocol {
+
+    private var candles: IndexingIterator<[OHLCData]>
+    private var sma: TechnicalIndicators.RollingSMA
+    private var ema: TechnicalIndicators.RollingEMA
+    private var rsi: TechnicalIndicators.RollingRSI
+
+    init(candles: [OHLCData], settings: TechnicalIndicators.IndicatorSettings) {
+        self.candles = candles.makeIterator()
+        self.sma = TechnicalIndicators.RollingSMA(period: settings.smaPeriod)
+        self.ema = TechnicalIndicators.RollingEMA(period: settings.emaPeriod)
+        self.rsi = TechnicalIndicators.RollingRSI(period: settings.rsiPeriod)
+    }
+
+    mutating func next() -> ChartExportRow? {
+        guard let candle = candles.next() else { return nil }
+        return ChartExportRow(
+            timestamp: candle.timestamp.timeIntervalSince1970,
+            open: candle.open,
+            high: candle.high,
+            low: candle.low,
+            close: candle.close,
+            volume: candle.volume ?? .nan,
+            sma: sma.append(candle.close) ?? .nan,
+            ema: ema.append(candle.close) ?? .nan,
+            rsi: rsi.append(candle.close) ?? .nan
+        )
+    }
+}
+
+// MARK: - Export Errors
+
+enum ChartExportError: Error, Equatable {
+    case noData
+    case fileUnavailable
+
+    var localizedDescription: String {
+        switch self {
+        case .noData:
+            return "There is no chart data to export"
+        case .fileUnavailable:
+            return "The export file could not be written"
+        }
+    }
+}
+
+// MARK: - Writer Protocol
+
+/**
+ * Sink for one export file. Rows are written one series at a time and flushed to disk in
+ * fixed-size chunks, so memory stays bounded no matter how many coins or candles are exported.
+ * Writers are not thread-safe; drive each one from a single queue.
+ */
+protocol ChartExportWriter: AnyObject {
+    var fileURL: URL { get }
+    /// Starts a new coin's series; rows that follow belong to it
+    func beginSeries(symbol: String) throws
+    func write(_ row: ChartExportRow) throws
+    /// Flushes remaining rows and closes the file
+    func finish() throws
+    /// Closes the file if still open and deletes it; for exports that failed or were cancelled
+    func discard()
+}
+
+// MARK: - Buffered Output
+
+/// Appends bytes to a fixed-capacity buffer and writes it to the file handle whenever it fills
+final class ExportOutputStream {
+
+    private let handle: FileHandle
+    private var buffer: [UInt8] = []
+    private let capacity: Int
+    private var isClosed = false
+
+    init(url: URL, capacity: Int = 64 * 1024) throws {
+        guard FileManager.default.createFile(atPath: url.path, contents: nil),
+              let handle = try? FileHandle(forWritingTo: url) else {
+            throw ChartExportError.fileUnavailable
+        }
+        self.handle = handle
+        self.capacity = capacity
+        buffer.reserveCapacity(capacity)
+    }
+
+    func write(_ string: String) throws {
+        buffer.append(contentsOf: string.utf8)
+        try flushIfFull()
+    }
+
+    func write(_ byte: UInt8) throws {
+        buffer.append(byte)
+        try flushIfFull()
+    }
+
+    func write<T: FixedWidthInteger>(_ value: T) throws {
+        withUnsafeBytes(of: value.littleEndian) { buffer.append(contentsOf: $0) }
+        try flushIfFull()
+    }
+
+    func write(_ value: Double) throws {
+        try write(value.bitPattern)
+    }
+
+    func flush() throws {
+        guard !isClosed else { throw ChartExportError.fileUnavailable }
+        guard !buffer.isEmpty else { return }
+        try handle.write(contentsOf: buffer)
+        buffer.removeAll(keepingCapacity: true)
+    }
+
+    func close() throws {
+        guard !isClosed else { return }
+        try flush()
+        isClosed = true
+        try handle.close()
+    }
+
+    /// Closes the handle without writing what is still buffered
+    func abandon() {
+        guard !isClosed else { return }
+        isClosed = true
+        buffer.removeAll()
+        try? handle.close()
+    }
+
+    private func flushIfFull() throws {
+        if buffer.count >= capacity {
+            try flush()
+        }
+    }
+}
+
+// MARK: - CSV Writer
+
+/**
+ * Long-format CSV: one header line, then `symbol,time,open,…,rsi` per candle.
+ * Times are ISO 8601 (UTC); missing values are left empty.
+ */
+final class CSVExportWriter: ChartExportWriter {
+
+    let fileURL: URL
+    private let output: ExportOutputStream
+    private let dateFormatter = ISO8601DateFormatter()
+    private var symbol = ""
+
+    init(fileURL: URL) throws {
+        self.fileURL = fileURL
+        self.output = try ExportOutputStream(url: fileURL)
+        try output.write((["symbol", "time"] + ChartExportRow.columnNames.dropFirst()).joined(separator: ",") + "\n")
+    }
+
+    func beginSeries(symbol: String) throws {
+        self.symbol = symbol.replacingOccurrences(of: ",", with: " ")
+    }
+
+    func write(_ row: ChartExportRow) throws {
+        var line = symbol
+        line += ","
+        line += dateFormatter.string(from: Date(timeIntervalSince1970: row.timestamp))
+        for value in row.columns.dropFirst() {
+            line += ","
+            if value.isFinite {
+                line += String(value)
+            }
+        }
+        line += "\n"
+        try output.write(line)
+    }
+
+    func finish() throws {
+        try output.close()
+    }
+
+    func discard() {
+        output.abandon()
+        try? FileManager.default.removeItem(at: fileURL)
+    }
+}
+
+// MARK: - Columnar Binary Writer
+
+/**
+ * Compact columnar format: rows are buffered per column and written in blocks, so each
+ * block stores every column contiguously (cheap to load column-wise into numpy/pandas).
+ *
+ * Layout (little-endian):
+ * - Header: magic "CAPXCOL1", UInt16 column count, then per column UInt8 length + UTF-8 name
+ * - Series: "S", UInt16 length + UTF-8 symbol
+ * - Block:  "B", UInt32 row count n, then for each column n × Float64 (timestamps are Unix seconds)
+ * - End:    "E"
+ *
+ * Memory is bounded by one block (`blockSize` rows × 9 columns).
+ */
+final class ColumnarExportWriter: ChartExportWriter {
+
+    static let magic = "CAPXCOL1"
+    static let defaultBlockSize = 4096
+
+    let fileURL: URL
+    private let output: ExportOutputStream
+    private let blockSize: Int
+    private var columns: [[Double]]
+
+    init(fileURL: URL, blockSize: Int = ColumnarExportWriter.defaultBlockSize) throws {
+        self.fileURL = fileURL
+        self.output = try ExportOutputStream(url: fileURL)
+        self.blockSize = max(1, blockSize)
+        self.columns = ChartExportRow.columnNames.map { _ in
+            var column: [Double] = []
+            column.reserveCapacity(max(1, blockSize))
+            return column
+        }
+
+        try output.write(Self.magic)
+        try output.write(UInt16(ChartExportRow.columnNames.count))
+        for name in ChartExportRow.columnNames {
+            try output.write(UInt8(name.utf8.count))
+            try output.write(name)
+        }
+    }
+
+    func beginSeries(symbol: String) throws {
+        try flushBlock()
+        let bytes = Array(symbol.utf8.prefix(Int(UInt16.max)))
+        try output.write(UInt8(ascii: "S"))
+        try output.write(UInt16(bytes.count))
+        for byte in bytes {
+            try output.write(byte)
+        }
+    }
+
+    func write(_ row: ChartExportRow) throws {
+        for (index, value) in row.columns.enumerated() {
+            columns[index].append(value)
+        }
+        if columns[0].count >= blockSize {
+            try flushBlock()
+        }
+    }
+
+    func finish() throws {
+        try flushBlock()
+        try output.write(UInt8(ascii: "E"))
+        try output.close()
+    }
+
+    func discard() {
+        output.abandon()
+        try? FileManager.default.removeItem(at: fileURL)
+    }
+
+    private func flushBlock() throws {
+        let count = columns[0].count
+        guard count > 0 else { return }
+        try output.write(UInt8(ascii: "B"))
+        try output.write(UInt32(count))
+        for index in columns.indices {
+            for value in columns[index] {
+                try output.write(value)
+            }
+            columns[index].removeAll(keepingCapacity: true)
+        }
+    }
+}
@@ -2,6 +2,14 @@ import Foundation
 
 /// Centralized logging system for CryptoApp
 /// Provides organized, visually clear debug output with different categories
+///
+/// Messages are `@autoclosure`s, so a call that is filtered out never builds its string:
+/// - Compile-time floor `compiledMinimumLevel` (.debug in DEBUG, .warning in release); calls
+///   below it are folded away by the optimizer
+/// - Runtime floor `minimumLevel`, adjustable while the app runs
+///
+/// Accepted entries are recorded in a binary ring buffer with monotonic timestamps (rendered
+/// only by `dump()`) and, in DEBUG builds, printed to the console.
 final class AppLogger {
     
     static let shared = AppLogger()
@@ -10,65 +18,78 @@ final class AppLogger {
     // MARK: - Log Categories
     
     /// Database operations (Core Data, WatchlistManager)
-    static func database(_ message: String, level: LogLevel = .info) {
-        shared.log("🗄️ DB", message, level: level)
+    @inline(__always)
+    static func database(_ message: @autoclosure () -> String, level: LogLevel = .info) {
+        log(.database, level, message)
     }
     
     /// Network requests and API calls
-    static func network(_ message: String, level: LogLevel = .info) {
-        shared.log("🌐 NET", message, level: level)
+    @inline(__always)
+    static func network(_ message: @autoclosure () -> String, level: LogLevel = .info) {
+        log(.network, level, message)
     }
     
     /// UI updates and view lifecycle
-    static func ui(_ message: String, level: LogLevel = .info) {
-        shared.log("📱 UI", message, level: level)
+    @inline(__always)
+    static func ui(_ message: @autoclosure () -> String, level: LogLevel = .info) {
+        log(.ui, level, message)
     }
     
     /// Data processing and transformations
-    static func data(_ message: String, level: LogLevel = .info) {
-        shared.log("📊 DATA", message, level: level)
+    @inline(__always)
+    static func data(_ message: @autoclosure () -> String, level: LogLevel = .info) {
+        log(.data, level, message)
     }
     
     /// Price updates and financial data
-    static func price(_ message: String, level: LogLevel = .info) {
-        shared.log("💰 PRICE", message, level: level)
+    @inline(__always)
+    static func price(_ message: @autoclosure () -> String, level: LogLevel = .info) {
+        log(.price, level, message)
     }
     
     /// Search functionality
-    static func search(_ message: String, level: LogLevel = .info) {
-        shared.log("🔍 SEARCH", message, level: level)
+    @inline(__always)
+    static func search(_ message: @autoclosure () -> String, level: LogLevel = .info) {
+        log(.search, level, message)
     }
     
     /// Chart and visualization updates
-    static func chart(_ message: String, level: LogLevel = .info) {
-        shared.log("📈 CHART", message, level: level)
+    @inline(__always)
+    static func chart(_ message: @autoclosure () -> String, level: LogLevel = .info) {
+        log(.chart, level, message)
     }
     
     /// Performance metrics and optimizations
-    static func performance(_ message: String, level: LogLevel = .info) {
-        shared.log("⚡ PERF", message, level: level)
+    @inline(__always)
+    static func performance(_ message: @autoclosure () -> String, level: LogLevel = .info) {
+        log(.performance, level, message)
     }
     
     /// Error conditions
-    static func error(_ message: String, error: Error? = nil) {
-        let errorDetail = error.map { " | \($0.localizedDescription)" } ?? ""
-        shared.log("❌ ERROR", message + errorDetail, level: .error)
+    @inline(__always)
+    static func error(_ message: @autoclosure () -> String, error: Error? = nil) {
+        log(.error, .error) {
+            message() + (error.map { " | \($0.localizedDescription)" } ?? "")
+        }
     }
     
     /// Success operations
-    static func success(_ message: String) {
-        shared.log("✅ SUCCESS", message, level: .success)
+    @inline(__always)
+    static func success(_ message: @autoclosure () -> String) {
+        log(.success, .success, message)
     }
     
     /// Cache operations
-    static func cache(_ message: String, level: LogLevel = .info) {
-        shared.log("💾 CACHE", message, level: level)
+    @inline(__always)
+    static func cache(_ message: @autoclosure () -> String, level: LogLevel = .info) {
+        log(.cache, level, message)
     }
     
     // MARK: - Log Levels
     
-    enum LogLevel {
-        case info, warning, error, success, debug
+    /// Ordered by severity; filtering keeps levels at or above the floor
+    enum LogLevel: UInt8, Comparable {
+        case debug, info, success, warning, error
         
         var emoji: String {
             switch self {
@@ -79,28 +100,115 @@ final class AppLogger {
             case .debug: return "🔧"
             }
         }
+        
+        static func < (lhs: LogLevel, rhs: LogLevel) -> Bool {
+            lhs.rawValue < rhs.rawValue
+        }
+    }
+    
+    enum Category: UInt8, CaseIterable {
+        case database, network, ui, data, price, search, chart, performance, error, success, cache
+        
+        var label: String {
+            switch self {
+            case .database: return "🗄️ DB"
+            case .network: return "🌐 NET"
+            case .ui: return "📱 UI"
+            case .data: return "📊 DATA"
+            case .price: return "💰 PRICE"
+            case .search: return "🔍 SEARCH"
+            case .chart: return "📈 CHART"
+            case .performance: return "⚡ PERF"
+            case .error: return "❌ ERROR"
+            case .success: return "✅ SUCCESS"
+            case .cache: return "💾 CACHE"
+            }
+        }
+    }
+    
+    // MARK: - Filtering
+    
+    #if DEBUG
+    static let compiledMinimumLevel: LogLevel = .debug
+    #else
+    static let compiledMinimumLevel: LogLevel = .warning
+    #endif
+    
+    /// Runtime floor, never below the compiled one. Meant to be changed rarely (launch, debug
+    /// settings); reads on the logging path are unsynchronized single-byte loads.
+    static var minimumLevel: LogLevel {
+        get { shared.minimumLevel }
+        set { shared.minimumLevel = max(newValue, compiledMinimumLevel) }
+    }
+    private var minimumLevel: LogLevel = AppLogger.compiledMinimumLevel
+    
+    /// Whether a message at `level` would be recorded; use to guard expensive log-only work
+    @inline(__always)
+    static func isEnabled(_ level: LogLevel) -> Bool {
+        level >= compiledMinimumLevel && level >= shared.minimumLevel
     }
     
     // MARK: - Core Logging
     
-    private func log(_ category: String, _ message: String, level: LogLevel) {
-        #if DEBUG
-        let timestamp = DateFormatter.timeFormatter.string(from: Date())
-        let levelEmoji = level.emoji
+    /// Recent entries, recorded in every build configuration
+    private let ring = LogRingBuffer()
+    /// Monotonic origin for timestamps, paired with the wall-clock launch time for dumps
+    private let launchUptime = DispatchTime.now().uptimeNanoseconds
+    private let launchDate = Date()
+    
+    @inline(__always)
+    private static func log(_ category: Category, _ level: LogLevel, _ message: () -> String) {
+        guard isEnabled(level) else { return }
+        shared.record(category, level: level, message: message())
+    }
+    
+    private func record(_ category: Category, level: LogLevel, message: String) {
+        let now = DispatchTime.now().uptimeNanoseconds
+        ring.append(uptimeNanoseconds: now, category: category.rawValue, level: level.rawValue, message: message)
         
+        #if DEBUG
+        let stamp = formatOffset(now)
         switch level {
-        case .error:
-            print("[\(timestamp)] \(levelEmoji) \(category) | \(message)")
-        case .success:
-            print("[\(timestamp)] \(levelEmoji) \(category) | \(message)")
-        case .warning:
-            print("[\(timestamp)] \(levelEmoji) \(category) | \(message)")
+        case .error, .success, .warning:
+            print("[\(stamp)] \(level.emoji) \(category.label) | \(message)")
         default:
-            print("[\(timestamp)] \(category) | \(message)")
+            print("[\(stamp)] \(category.label) | \(message)")
         }
         #endif
     }
     
+    /// Seconds since launch as "+12.345s"; no DateFormatter on the logging path
+    private func formatOffset(_ uptimeNanoseconds: UInt64) -> String {
+        let millis = (uptimeNanoseconds &- launchUptime) / 1_000_000
+        let fraction = millis % 1000
+        let padding = fraction < 10 ? "00" : (fraction < 100 ? "0" : "")
+        return "+\(millis / 1000).\(padding)\(fraction)s"
+    }
+    
+    // MARK: - Dump
+    
+    /// Renders the ring buffer, oldest first; timestamps are offsets from launch
+    static func dump() -> String {
+        shared.dump()
+    }
+    
+    /// Empties the ring buffer
+    static func clearRecentEntries() {
+        shared.ring.removeAll()
+    }
+    
+    private func dump() -> String {
+        let entries = ring.entries()
+        var lines = ["CryptoApp log — launched \(ISO8601DateFormatter().string(from: launchDate)), \(entries.count) entries"]
+        lines.reserveCapacity(entries.count + 1)
+        for entry in entries {
+            let level = LogLevel(rawValue: entry.level) ?? .info
+            let category = Category(rawValue: entry.category)?.label ?? "?"
+            lines.append("[\(formatOffset(entry.uptimeNanoseconds))] \(level.emoji) \(category) | \(entry.message)")
+        }
+        return lines.joined(separator: "\n")
+    }
+    
     // MARK: - System Message Filtering
     
     /// Suppresses common iOS system warnings that clutter the console
@@ -150,6 +258,7 @@ final class AppLogger {
     
     /// Log API request summary
     static func apiSummary(endpoint: String, status: Int, itemCount: Int? = nil, duration: TimeInterval? = nil) {
+        guard isEnabled(.info) else { return }
         let countText = itemCount.map { " | \($0) items" } ?? ""
         let durationText = duration.map { " | \(String(format: "%.2f", $0 * 1000))ms" } ?? ""
         AppLogger.network("\(endpoint) | HTTP \(status)\(countText)\(durationText)")
@@ -160,14 +269,6 @@ final class AppLogger {
 
 // MARK: - Extensions
 
-private extension DateFormatter {
-    static let timeFormatter: DateFormatter = {
-        let formatter = DateFormatter()
-        formatter.dateFormat = "HH:mm:ss.SSS"
-        return formatter
-    }()
-}
-
 private extension String {
     func repeating(_ count: Int) -> String {
         return String(repeating: self, count: count)
@@ -0,0 +1,124 @@
+//
+//  LogRingBuffer.swift
+//  CryptoApp
+//
+
+import Foundation
+
+/**
+ * LOG RING BUFFER
+ *
+ * Fixed-size binary store for the most recent log entries, kept in memory so they can be
+ * dumped on demand (bug reports, debug screens) in any build configuration.
+ *
+ * Storage is allocated once as `capacity` fixed-size slots:
+ *   [0..<8]   monotonic timestamp, nanoseconds of uptime (UInt64)
+ *   [8]       category (UInt8)
+ *   [9]       level (UInt8)
+ *   [10..<12] message length in bytes (UInt16)
+ *   [12...]   message UTF-8, truncated to `messageCapacity` at a character boundary
+ *
+ * Appending copies bytes into the next slot and never allocates; the oldest entry is
+ * overwritten once the buffer is full. Thread-safe.
+ */
+final class LogRingBuffer {
+
+    // MARK: - Types
+
+    struct Entry: Equatable {
+        let uptimeNanoseconds: UInt64
+        let category: UInt8
+        let level: UInt8
+        let message: String
+    }
+
+    // MARK: - Properties
+
+    let capacity: Int
+    let messageCapacity: Int
+
+    private static let headerSize = 12
+    private let slotSize: Int
+    private let storage: UnsafeMutableRawPointer
+    /// Entries written since creation; slot = written % capacity
+    private var written = 0
+    private let lock = NSLock()
+
+    // MARK: - Initialization
+
+    init(capacity: Int = 1024, messageCapacity: Int = 244) {
+        precondition(capacity > 0 && messageCapacity > 0 && messageCapacity <= Int(UInt16.max))
+        self.capacity = capacity
+        self.messageCapacity = messageCapacity
+        // Round slots up to 8 bytes so every timestamp stays aligned
+        self.slotSize = (Self.headerSize + messageCapacity + 7) & ~7
+        self.storage = UnsafeMutableRawPointer.allocate(byteCount: slotSize * capacity, alignment: 8)
+    }
+
+    deinit {
+        storage.deallocate()
+    }
+
+    // MARK: - Recording
+
+    func append(uptimeNanoseconds: UInt64, category: UInt8, level: UInt8, message: String) {
+        var message = message
+        message.withUTF8 { bytes in
+            let length = Self.truncatedLength(of: bytes, limit: messageCapacity)
+            lock.lock()
+            let slot = storage + (written % capacity) * slotSize
+            slot.storeBytes(of: uptimeNanoseconds, as: UInt64.self)
+            slot.storeBytes(of: category, toByteOffset: 8, as: UInt8.self)
+            slot.storeBytes(of: level, toByteOffset: 9, as: UInt8.self)
+            slot.storeBytes(of: UInt16(length), toByteOffset: 10, as: UInt16.self)
+            if let base = bytes.baseAddress, length > 0 {
+                (slot + Self.headerSize).copyMemory(from: base, byteCount: length)
+            }
+            written += 1
+            lock.unlock()
+        }
+    }
+
+    /// Byte count that fits in `limit` without splitting a UTF-8 sequence
+    static func truncatedLength(of bytes: UnsafeBufferPointer<UInt8>, limit: Int) -> Int {
+        guard bytes.count > limit else { return bytes.count }
+        var length = limit
+        // Back off continuation bytes (10xxxxxx) so the cut lands on a character start
+        while length > 0 && bytes[length] & 0xC0 == 0x80 {
+            length -= 1
+        }
+        return length
+    }
+
+    // MARK: - Reading
+
+    var count: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return min(written, capacity)
+    }
+
+    /// Stored entries, oldest first (decoding happens here, not when recording)
+    func entries() -> [Entry] {
+        lock.lock()
+        defer { lock.unlock() }
+        let stored = min(written, capacity)
+        return (0..<stored).map { offset in
+            let slot = storage + ((written - stored + offset) % capacity) * slotSize
+            let length = Int(slot.load(fromByteOffset: 10, as: UInt16.self))
+            let bytes = UnsafeRawBufferPointer(start: slot + Self.headerSize, count: length)
+            return Entry(
+                uptimeNanoseconds: slot.load(as: UInt64.self),
+                category: slot.load(fromByteOffset: 8, as: UInt8.self),
+                level: slot.load(fromByteOffset: 9, as: UInt8.self),
+                message: String(decoding: bytes, as: UTF8.self)
+            )
+        }
+    }
+
+    func removeAll() {
+        lock.lock()
+        written = 0
+        lock.unlock()
+    }
+}
@@ -0,0 +1,218 @@
+//
+//  MemoryAccounting.swift
+//  CryptoApp
+//
+
+import UIKit
+
+/**
+ * MEMORY ACCOUNTING
+ *
+ * Lets every long-lived holder of data (CacheService, image caches, view models) report what
+ * it keeps resident, and drives memory-warning responses from that report instead of each
+ * holder wiping itself independently.
+ *
+ * - Holders conform to `MemoryAccountable` and register with `MemoryAccountant.shared`
+ *   (held weakly, so view models drop out when they deallocate)
+ * - `report()` aggregates their footprints into one tree (App → holder → bucket)
+ * - On a memory warning the accountant releases tier by tier — derived data, then images,
+ *   then series — and stops as soon as the resident total is under `pressureTarget`
+ *
+ * Sizes are estimates (see `MemoryEstimate`), good for relative comparisons and trends,
+ * not for matching Instruments byte for byte.
+ */
+
+// MARK: - Pressure Tiers
+
+/// What a holder gives back at each escalation step, cheapest to recreate first
+enum MemoryPressureTier: Int, Codable, Comparable, CaseIterable, CustomStringConvertible {
+    /// Copies and computations rebuildable from data still in memory or on disk
+    case derived = 1
+    /// Decoded bitmaps that can be re-read from disk, and logo metadata
+    case images = 2
+    /// Fetched price/chart series that need network (and rate-limit budget) to restore
+    case series = 3
+
+    static func < (lhs: MemoryPressureTier, rhs: MemoryPressureTier) -> Bool {
+        lhs.rawValue < rhs.rawValue
+    }
+
+    var description: String {
+        switch self {
+        case .derived: return "derived"
+        case .images: return "images"
+        case .series: return "series"
+        }
+    }
+}
+
+// MARK: - Footprint
+
+/// One node of the memory report; leaves carry bytes, inner nodes sum their children
+struct MemoryFootprint: Codable, Equatable {
+    let name: String
+    /// Bytes held directly by this node
+    let bytes: Int
+    /// Tier that releases this node; nil when it stays resident (e.g. what's on screen)
+    let tier: MemoryPressureTier?
+    let children: [MemoryFootprint]
+
+    init(name: String, bytes: Int = 0, tier: MemoryPressureTier? = nil, children: [MemoryFootprint] = []) {
+        self.name = name
+        self.bytes = bytes
+        self.tier = tier
+        self.children = children
+    }
+
+    var totalBytes: Int {
+        children.reduce(bytes) { $0 + $1.totalBytes }
+    }
+
+    /// Bytes that responses up to and including `tier` can release
+    func releasableBytes(upTo tier: MemoryPressureTier) -> Int {
+        let own = (self.tier.map { $0 <= tier } ?? false) ? bytes : 0
+        return children.reduce(own) { $0 + $1.releasableBytes(upTo: tier) }
+    }
+
+    /// Indented tree, largest children first:
+    ///   App  1.2 MB
+    ///   ├─ CacheService  800 KB
+    ///   │  └─ chart  600 KB  [series]
+    func rendered() -> String {
+        var lines: [String] = []
+        render(into: &lines, prefix: "", childPrefix: "")
+        return lines.joined(separator: "\n")
+    }
+
+    private func render(into lines: inout [String], prefix: String, childPrefix: String) {
+        let size = ByteCountFormatter.string(fromByteCount: Int64(totalBytes), countStyle: .memory)
+        lines.append("\(prefix)\(name)  \(size)" + (tier.map { "  [\($0)]" } ?? ""))
+        let sorted = children.sorted { $0.totalBytes > $1.totalBytes }
+        for (index, child) in sorted.enumerated() {
+            let isLast = index == sorted.count - 1
+            child.render(into: &lines,
+                         prefix: childPrefix + (isLast ? "└─ " : "├─ "),
+                         childPrefix: childPrefix + (isLast ? "   " : "│  "))
+        }
+    }
+}
+
+// MARK: - Holder Protocol
+
+/// Anything that keeps data resident long enough to matter under memory pressure
+protocol MemoryAccountable: AnyObject {
+    /// Current resident footprint; called on the main thread
+    func memoryFootprint() -> MemoryFootprint
+    /// Releases everything this holder files under `tier` and returns the estimated bytes freed;
+    /// called on the main thread, once per tier in escalation order
+    @discardableResult
+    func releaseMemory(for tier: MemoryPressureTier) -> Int
+}
+
+// MARK: - Size Estimates
+
+/// Shared per-item estimates so holders report comparable numbers
+enum MemoryEstimate {
+    static let arrayOverhead = 32
+
+    /// Coin with nested quote dictionary and strings
+    static func coins(_ count: Int) -> Int { count * 500 + 64 }
+    static func quotes(_ count: Int) -> Int { count * 200 + arrayOverhead }
+    static func doubles(_ count: Int) -> Int { count * MemoryLayout<Double>.stride + arrayOverhead }
+    static func candles(_ count: Int) -> Int { count * MemoryLayout<OHLCData>.stride + arrayOverhead }
+    /// URL strings keyed by coin ID
+    static func urls(_ count: Int) -> Int { count * 100 + arrayOverhead }
+    static func bitmap(pixels: Int) -> Int { pixels * 4 }
+}
+
+// MARK: - Accountant
+
+final class MemoryAccountant {
+
+    static let shared = MemoryAccountant()
+
+    // MARK: - Properties
+
+    /// Escalation stops once the reported total is at or below this many bytes
+    var pressureTarget: Int
+
+    private struct WeakHolder {
+        weak var holder: MemoryAccountable?
+    }
+
+    private var holders: [WeakHolder] = []
+    private let lock = NSLock()
+    private var memoryWarningObserver: NSObjectProtocol?
+
+    // MARK: - Initialization
+
+    init(pressureTarget: Int = 32 * 1024 * 1024, observesMemoryWarnings: Bool = true) {
+        self.pressureTarget = pressureTarget
+        guard observesMemoryWarnings else { return }
+        memoryWarningObserver = NotificationCenter.default.addObserver(
+            forName: UIApplication.didReceiveMemoryWarningNotification,
+            object: nil,
+            queue: .main
+        ) { [weak self] _ in
+            self?.relievePressure()
+        }
+    }
+
+    deinit {
+        if let observer = memoryWarningObserver {
+            NotificationCenter.default.removeObserver(observer)
+        }
+    }
+
+    // MARK: - Registration
+
+    func register(_ holder: MemoryAccountable) {
+        lock.lock()
+        defer { lock.unlock() }
+        holders.removeAll { $0.holder == nil || $0.holder === holder }
+        holders.append(WeakHolder(holder: holder))
+    }
+
+    private func liveHolders() -> [MemoryAccountable] {
+        lock.lock()
+        defer { lock.unlock() }
+        holders.removeAll { $0.holder == nil }
+        return holders.compactMap { $0.holder }
+    }
+
+    // MARK: - Reporting
+
+    /// Tree of every registered holder's footprint (main thread)
+    func report() -> MemoryFootprint {
+        let root = MemoryFootprint(name: "App", children: liveHolders().map { $0.memoryFootprint() })
+        Metrics.memoryResidentBytes.set(root.totalBytes)
+        return root
+    }
+
+    // MARK: - Pressure
+
+    /**
+     * Releases tier by tier until the report is under `pressureTarget` (main thread)
+     * The derived tier always runs: a warning means the system wants memory back now.
+     * Returns the tiers that were applied.
+     */
+    @discardableResult
+    func relievePressure() -> [MemoryPressureTier] {
+        Metrics.memoryPressureEvents.increment()
+        let before = report().totalBytes
+        var applied: [MemoryPressureTier] = []
+
+        for tier in MemoryPressureTier.allCases {
+            if !applied.isEmpty && report().totalBytes <= pressureTarget {
+                break
+            }
+            let freed = liveHolders().reduce(0) { $0 + $1.releaseMemory(for: tier) }
+            applied.append(tier)
+            AppLogger.performance("Memory pressure | \(tier) tier freed ~\(freed / 1024) KB", level: .warning)
+        }
+
+        let after = report().totalBytes
+        AppLogger.performance("Memory pressure | \(before / 1024) KB → \(after / 1024) KB via \(applied.map(\.description).joined(separator: ", "))", level: .warning)
+        return applied
+    }
+}
@@ -0,0 +1,34 @@
+//
+//  MetricsAtomics.h
+//  CryptoApp
+//
+
+#import <stdatomic.h>
+#import <stdint.h>
+
+// Relaxed C11 atomics on plain int64_t cells, for MetricsRegistry.
+// Swift has no standard-library atomics on our deployment target; these inline
+// wrappers give the registry lock-free recording without a package dependency.
+// Relaxed ordering is enough: each cell is an independent statistic.
+
+static inline int64_t metrics_atomic_load(int64_t *cell) {
+    return atomic_load_explicit((_Atomic(int64_t) *)cell, memory_order_relaxed);
+}
+
+static inline void metrics_atomic_store(int64_t *cell, int64_t value) {
+    atomic_store_explicit((_Atomic(int64_t) *)cell, value, memory_order_relaxed);
+}
+
+/// Adds `delta` and returns the previous value
+static inline int64_t metrics_atomic_add(int64_t *cell, int64_t delta) {
+    return atomic_fetch_add_explicit((_Atomic(int64_t) *)cell, delta, memory_order_relaxed);
+}
+
+/// Raises the cell to `value` if it is larger
+static inline void metrics_atomic_max(int64_t *cell, int64_t value) {
+    int64_t current = atomic_load_explicit((_Atomic(int64_t) *)cell, memory_order_relaxed);
+    while (value > current &&
+           !atomic_compare_exchange_weak_explicit((_Atomic(int64_t) *)cell, &current, value,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
@@ -0,0 +1,338 @@
+//
+//  MetricsRegistry.swift
+//  CryptoApp
+//
+
+import Foundation
+
+/**
+ * METRICS REGISTRY
+ *
+ * One process-wide store for the counters, gauges and latency histograms that managers and
+ * view models report into, replacing per-class ad hoc stats dictionaries.
+ *
+ * - Recording is lock-free: every value is a 64-bit cell updated with relaxed C11 atomics
+ *   (MetricsAtomics.h), so hot paths (ticks, sorts, cache lookups) never block
+ * - The registry lock is only taken to create or look up a metric by name; callers keep the
+ *   handle (see `Metrics`) instead of looking it up per event
+ * - Histograms use fixed millisecond buckets chosen at registration, so recording is a
+ *   bucket scan plus three atomic adds
+ * - `snapshot()` returns a Codable value with stable JSON export, meant to be scraped in
+ *   test runs and diffed across builds
+ */
+final class MetricsRegistry {
+
+    static let shared = MetricsRegistry()
+
+    // MARK: - Properties
+
+    private let lock = NSLock()
+    private var counters: [String: Counter] = [:]
+    private var gauges: [String: Gauge] = [:]
+    private var histograms: [String: Histogram] = [:]
+
+    // MARK: - Registration
+
+    /// Returns the counter registered under `name`, creating it on first use
+    func counter(_ name: String) -> Counter {
+        lock.lock()
+        defer { lock.unlock() }
+        if let existing = counters[name] { return existing }
+        let counter = Counter()
+        counters[name] = counter
+        return counter
+    }
+
+    /// Returns the gauge registered under `name`, creating it on first use
+    func gauge(_ name: String) -> Gauge {
+        lock.lock()
+        defer { lock.unlock() }
+        if let existing = gauges[name] { return existing }
+        let gauge = Gauge()
+        gauges[name] = gauge
+        return gauge
+    }
+
+    /// Returns the histogram registered under `name`; `bounds` only apply when it is created
+    func histogram(_ name: String, bounds: [Double] = Histogram.defaultLatencyBounds) -> Histogram {
+        lock.lock()
+        defer { lock.unlock() }
+        if let existing = histograms[name] { return existing }
+        let histogram = Histogram(bounds: bounds)
+        histograms[name] = histogram
+        return histogram
+    }
+
+    // MARK: - Export
+
+    func snapshot() -> MetricsSnapshot {
+        lock.lock()
+        let counters = self.counters
+        let gauges = self.gauges
+        let histograms = self.histograms
+        lock.unlock()
+
+        return MetricsSnapshot(
+            counters: counters.mapValues { $0.value },
+            gauges: gauges.mapValues { $0.value },
+            histograms: histograms.mapValues { $0.summary() }
+        )
+    }
+
+    /// Zeroes every registered metric (handles stay valid); for tests and debug screens
+    func reset() {
+        lock.lock()
+        let all: [MetricCells] = Array(counters.values) + Array(gauges.values) + Array(histograms.values)
+        lock.unlock()
+        all.forEach { $0.zero() }
+    }
+}
+
+// MARK: - Cells
+
+/// Fixed block of atomic Int64 cells shared by all metric kinds
+class MetricCells {
+    fileprivate let cells: UnsafeMutablePointer<Int64>
+    fileprivate let cellCount: Int
+
+    fileprivate init(cellCount: Int) {
+        self.cellCount = cellCount
+        self.cells = UnsafeMutablePointer<Int64>.allocate(capacity: cellCount)
+        self.cells.initialize(repeating: 0, count: cellCount)
+    }
+
+    deinit {
+        cells.deallocate()
+    }
+
+    fileprivate func zero() {
+        for index in 0..<cellCount {
+            metrics_atomic_store(cells + index, 0)
+        }
+    }
+}
+
+// MARK: - Counter
+
+/// Monotonic event count (requests started, cache hits, …)
+final class Counter: MetricCells {
+
+    fileprivate init() {
+        super.init(cellCount: 1)
+    }
+
+    @inline(__always)
+    func increment(by amount: Int64 = 1) {
+        _ = metrics_atomic_add(cells, amount)
+    }
+
+    var value: Int64 {
+        metrics_atomic_load(cells)
+    }
+}
+
+// MARK: - Gauge
+
+/// Last-written level (queue depth, bytes held, …), stored as the bit pattern of a Double
+final class Gauge: MetricCells {
+
+    fileprivate init() {
+        super.init(cellCount: 1)
+    }
+
+    @inline(__always)
+    func set(_ value: Double) {
+        metrics_atomic_store(cells, Int64(bitPattern: value.bitPattern))
+    }
+
+    @inline(__always)
+    func set(_ value: Int) {
+        set(Double(value))
+    }
+
+    var value: Double {
+        Double(bitPattern: UInt64(bitPattern: metrics_atomic_load(cells)))
+    }
+}
+
+// MARK: - Histogram
+
+/**
+ * Fixed-bucket latency histogram in milliseconds
+ *
+ * Cells: one per bucket (`bounds.count` upper bounds plus an overflow bucket), then count,
+ * sum and max. Sum and max are kept in microseconds so they stay integral.
+ */
+final class Histogram: MetricCells {
+
+    /// Upper bounds (ms) for UI-path work: sub-millisecond sorts up to multi-second requests
+    static let defaultLatencyBounds: [Double] = [0.5, 1, 2, 5, 10, 16, 33, 50, 100, 250, 500, 1000, 2500]
+
+    let bounds: [Double]
+
+    private var countCell: UnsafeMutablePointer<Int64> { cells + bounds.count + 1 }
+    private var sumCell: UnsafeMutablePointer<Int64> { cells + bounds.count + 2 }
+    private var maxCell: UnsafeMutablePointer<Int64> { cells + bounds.count + 3 }
+
+    fileprivate init(bounds: [Double]) {
+        precondition(!bounds.isEmpty && bounds == bounds.sorted(), "Histogram bounds must be ascending")
+        self.bounds = bounds
+        super.init(cellCount: bounds.count + 4)
+    }
+
+    // MARK: Recording
+
+    func record(milliseconds: Double) {
+        let value = max(0, milliseconds)
+        var bucket = bounds.count
+        for (index, bound) in bounds.enumerated() where value <= bound {
+            bucket = index
+            break
+        }
+        let micros = Int64(value * 1000)
+        _ = metrics_atomic_add(cells + bucket, 1)
+        _ = metrics_atomic_add(countCell, 1)
+        _ = metrics_atomic_add(sumCell, micros)
+        metrics_atomic_max(maxCell, micros)
+    }
+
+    /// Records the time elapsed since `start` (`DispatchTime.now().uptimeNanoseconds`)
+    func recordElapsed(since start: UInt64) {
+        let now = DispatchTime.now().uptimeNanoseconds
+        record(milliseconds: Double(now &- start) / 1_000_000)
+    }
+
+    /// Runs `body` and records its duration
+    @discardableResult
+    func time<T>(_ body: () throws -> T) rethrows -> T {
+        let start = DispatchTime.now().uptimeNanoseconds
+        defer { recordElapsed(since: start) }
+        return try body()
+    }
+
+    // MARK: Reading
+
+    func summary() -> MetricsSnapshot.HistogramSummary {
+        MetricsSnapshot.HistogramSummary(
+            bounds: bounds,
+            buckets: (0...bounds.count).map { metrics_atomic_load(cells + $0) },
+            count: metrics_atomic_load(countCell),
+            sumMilliseconds: Double(metrics_atomic_load(sumCell)) / 1000,
+            maxMilliseconds: Double(metrics_atomic_load(maxCell)) / 1000
+        )
+    }
+}
+
+// MARK: - Snapshot
+
+/// Point-in-time copy of every registered metric
+struct MetricsSnapshot: Codable, Equatable {
+
+    struct HistogramSummary: Codable, Equatable {
+        /// Bucket upper bounds in ms; `buckets` has one extra trailing overflow bucket
+        let bounds: [Double]
+        let buckets: [Int64]
+        let count: Int64
+        let sumMilliseconds: Double
+        let maxMilliseconds: Double
+
+        var meanMilliseconds: Double {
+            count > 0 ? sumMilliseconds / Double(count) : 0
+        }
+
+        /// Upper bound of the bucket holding the `quantile` (0...1) sample; overflow reports the max
+        func percentile(_ quantile: Double) -> Double {
+            guard count > 0 else { return 0 }
+            let rank = Int64((Double(count) * min(max(quantile, 0), 1)).rounded(.up))
+            var seen: Int64 = 0
+            for (index, bucketCount) in buckets.enumerated() {
+                seen += bucketCount
+                if seen >= max(rank, 1) {
+                    return index < bounds.count ? min(bounds[index], maxMilliseconds) : maxMilliseconds
+                }
+            }
+            return maxMilliseconds
+        }
+    }
+
+    let counters: [String: Int64]
+    let gauges: [String: Double]
+    let histograms: [String: HistogramSummary]
+
+    /// hits / (hits + misses) for two counters, nil before any lookup
+    func ratio(_ hits: String, _ misses: String) -> Double? {
+        let hitCount = counters[hits] ?? 0
+        let total = hitCount + (counters[misses] ?? 0)
+        return total > 0 ? Double(hitCount) / Double(total) : nil
+    }
+
+    /// Activity between `earlier` and this snapshot: counters and histogram buckets are
+    /// subtracted, gauges and histogram max keep their current values
+    func delta(since earlier: MetricsSnapshot) -> MetricsSnapshot {
+        MetricsSnapshot(
+            counters: counters.reduce(into: [:]) { result, entry in
+                result[entry.key] = entry.value - (earlier.counters[entry.key] ?? 0)
+            },
+            gauges: gauges,
+            histograms: histograms.reduce(into: [:]) { result, entry in
+                guard let before = earlier.histograms[entry.key], before.bounds == entry.value.bounds else {
+                    result[entry.key] = entry.value
+                    return
+                }
+                result[entry.key] = HistogramSummary(
+                    bounds: entry.value.bounds,
+                    buckets: zip(entry.value.buckets, before.buckets).map { $0 - $1 },
+                    count: entry.value.count - before.count,
+                    sumMilliseconds: entry.value.sumMilliseconds - before.sumMilliseconds,
+                    maxMilliseconds: entry.value.maxMilliseconds
+                )
+            }
+        )
+    }
+
+    /// Stable JSON (sorted keys) so exports from different builds diff cleanly
+    func jsonData() throws -> Data {
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+        return try encoder.encode(self)
+    }
+}
+
+// MARK: - Well-Known Metrics
+
+/// Shared handles for the metrics the app reports; names are the export keys
+enum Metrics {
+    private static var registry: MetricsRegistry { .shared }
+
+    // Coin list pipeline
+    static let tickToPublish = registry.histogram("coinlist.tick_to_publish_ms")
+    static let coinSort = registry.histogram("coinlist.sort_ms")
+    static let responseDecode = registry.histogram("network.decode_ms")
+
+    // CacheService
+    static let cacheHits = registry.counter("cache.hits")
+    static let cacheMisses = registry.counter("cache.misses")
+    static let cacheExpirations = registry.counter("cache.expirations")
+    static let cacheEvictions = registry.counter("cache.evictions")
+    static let cacheSpills = registry.counter("cache.spills")
+    static let cacheSpillRestores = registry.counter("cache.spill_restores")
+    static let cacheEntries = registry.gauge("cache.entries")
+    static let cacheBytes = registry.gauge("cache.bytes")
+
+    // RequestManager
+    static let requestsStarted = registry.counter("requests.started")
+    static let requestsDeduplicated = registry.counter("requests.deduplicated")
+    static let requestsThrottled = registry.counter("requests.throttled")
+    static let requestsFailed = registry.counter("requests.failed")
+    static let requestQueueHigh = registry.gauge("requests.queue.high")
+    static let requestQueueNormal = registry.gauge("requests.queue.normal")
+    static let requestQueueLow = registry.gauge("requests.queue.low")
+
+    // Watchlist
+    static let watchlistOperations = registry.counter("watchlist.operations")
+    static let watchlistSize = registry.gauge("watchlist.size")
+
+    // MemoryAccountant
+    static let memoryResidentBytes = registry.gauge("memory.resident_bytes")
+    static let memoryPressureEvents = registry.counter("memory.pressure_events")
+}
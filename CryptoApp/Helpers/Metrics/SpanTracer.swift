@@ -0,0 +1,240 @@
+//
+//  SpanTracer.swift
+//  CryptoApp
+//
+
+import Foundation
+
+/**
+ * SPAN TRACER
+ *
+ * Begin/end spans around hot-path stages (price tick → filter → sort → diff → publish,
+ * chart processing per range), timed on the monotonic uptime clock.
+ *
+ * - Every span feeds its stage's MetricsRegistry histogram, so stage latencies show up in
+ *   metric snapshots and test runs as numbers
+ * - Spans of sampled traces (1 in `sampleEvery` roots) are also written to a preallocated
+ *   ring of fixed-size records and can be exported as a Chrome trace (Perfetto / chrome://tracing)
+ * - A `Span` is a value; beginning one allocates nothing and ending one is a histogram record
+ *   plus, for sampled traces only, a locked copy into the ring
+ * - A trace crosses a Combine hop by travelling with the value it describes (see `CoinDataUpdate`)
+ */
+final class SpanTracer {
+
+    static let shared = SpanTracer()
+
+    // MARK: - Types
+
+    /// An open span; pass it to `end(_:)` and as `parent` for child stages
+    struct Span {
+        let stage: SpanStage
+        /// 0 when the trace isn't sampled (histograms only)
+        let traceID: UInt32
+        let spanID: UInt32
+        let parentID: UInt32
+        let startNanoseconds: UInt64
+
+        var isSampled: Bool { traceID != 0 }
+    }
+
+    /// Closed span as stored in the ring
+    struct Record: Equatable {
+        let traceID: UInt32
+        let spanID: UInt32
+        let parentID: UInt32
+        let stageID: UInt16
+        let startNanoseconds: UInt64
+        let endNanoseconds: UInt64
+
+        var durationMilliseconds: Double {
+            Double(endNanoseconds &- startNanoseconds) / 1_000_000
+        }
+    }
+
+    // MARK: - Properties
+
+    let capacity: Int
+
+    /// Record every Nth trace into the ring (1 = all); histograms always see every span
+    var sampleEvery: Int {
+        get { Int(metrics_atomic_load(sampleEveryCell)) }
+        set { metrics_atomic_store(sampleEveryCell, Int64(max(1, newValue))) }
+    }
+
+    /// [0] traces begun, [1] last span ID
+    private let sequenceCells: UnsafeMutablePointer<Int64>
+    private let sampleEveryCell: UnsafeMutablePointer<Int64>
+
+    private let storage: UnsafeMutablePointer<Record>
+    /// Records written since creation; slot = written % capacity
+    private var written = 0
+    private let lock = NSLock()
+
+    #if DEBUG
+    static let defaultSampleEvery = 1
+    #else
+    static let defaultSampleEvery = 16
+    #endif
+
+    // MARK: - Initialization
+
+    init(capacity: Int = 4096, sampleEvery: Int = SpanTracer.defaultSampleEvery) {
+        precondition(capacity > 0)
+        self.capacity = capacity
+        self.storage = UnsafeMutablePointer<Record>.allocate(capacity: capacity)
+        self.sequenceCells = UnsafeMutablePointer<Int64>.allocate(capacity: 2)
+        self.sequenceCells.initialize(repeating: 0, count: 2)
+        self.sampleEveryCell = UnsafeMutablePointer<Int64>.allocate(capacity: 1)
+        self.sampleEveryCell.initialize(to: Int64(max(1, sampleEvery)))
+    }
+
+    deinit {
+        storage.deallocate()
+        sequenceCells.deallocate()
+        sampleEveryCell.deallocate()
+    }
+
+    // MARK: - Spans
+
+    /// Starts a root span, deciding whether this trace is sampled
+    func beginTrace(_ stage: SpanStage) -> Span {
+        let sequence = metrics_atomic_add(sequenceCells, 1)
+        let traceID = sequence % Int64(sampleEvery) == 0 ? UInt32(truncatingIfNeeded: sequence / Int64(sampleEvery) + 1) : 0
+        return Span(stage: stage, traceID: traceID, spanID: nextSpanID(), parentID: 0,
+                    startNanoseconds: DispatchTime.now().uptimeNanoseconds)
+    }
+
+    /// Starts a child span; without a parent the span only feeds its histogram
+    func begin(_ stage: SpanStage, parent: Span?) -> Span {
+        guard let parent = parent else {
+            return Span(stage: stage, traceID: 0, spanID: 0, parentID: 0,
+                        startNanoseconds: DispatchTime.now().uptimeNanoseconds)
+        }
+        return Span(stage: stage, traceID: parent.traceID, spanID: parent.isSampled ? nextSpanID() : 0,
+                    parentID: parent.spanID, startNanoseconds: DispatchTime.now().uptimeNanoseconds)
+    }
+
+    func end(_ span: Span) {
+        let end = DispatchTime.now().uptimeNanoseconds
+        span.stage.histogram.record(milliseconds: Double(end &- span.startNanoseconds) / 1_000_000)
+        guard span.isSampled else { return }
+
+        let record = Record(traceID: span.traceID, spanID: span.spanID, parentID: span.parentID,
+                            stageID: span.stage.id, startNanoseconds: span.startNanoseconds, endNanoseconds: end)
+        lock.lock()
+        // Record is trivial, so (re)initializing a slot is a plain copy
+        (storage + written % capacity).initialize(to: record)
+        written += 1
+        lock.unlock()
+    }
+
+    /// Time since `span` began, for metrics measured from a span's start to a point inside it
+    func elapsedMilliseconds(since span: Span) -> Double {
+        Double(DispatchTime.now().uptimeNanoseconds &- span.startNanoseconds) / 1_000_000
+    }
+
+    /// Runs `body` inside a child span of `parent`
+    @discardableResult
+    func measure<T>(_ stage: SpanStage, parent: Span?, _ body: () throws -> T) rethrows -> T {
+        let span = begin(stage, parent: parent)
+        defer { end(span) }
+        return try body()
+    }
+
+    private func nextSpanID() -> UInt32 {
+        UInt32(truncatingIfNeeded: metrics_atomic_add(sequenceCells + 1, 1) + 1)
+    }
+
+    // MARK: - Reading
+
+    /// Stored records, oldest first
+    func records() -> [Record] {
+        lock.lock()
+        defer { lock.unlock() }
+        let stored = min(written, capacity)
+        return (0..<stored).map { storage[(written - stored + $0) % capacity] }
+    }
+
+    func removeAll() {
+        lock.lock()
+        written = 0
+        lock.unlock()
+    }
+
+    /// Chrome trace-event JSON: one complete ("X") event per span, one row (tid) per trace
+    func exportChromeTrace() throws -> Data {
+        let events: [[String: Any]] = records().map { record in
+            [
+                "name": SpanStage.name(for: record.stageID),
+                "ph": "X",
+                "pid": 1,
+                "tid": Int(record.traceID),
+                "ts": Double(record.startNanoseconds) / 1000,
+                "dur": Double(record.endNanoseconds &- record.startNanoseconds) / 1000,
+                "args": ["span": Int(record.spanID), "parent": Int(record.parentID)]
+            ]
+        }
+        return try JSONSerialization.data(withJSONObject: ["traceEvents": events, "displayTimeUnit": "ms"],
+                                          options: [.sortedKeys])
+    }
+}
+
+// MARK: - Stages
+
+/// A named pipeline stage with its latency histogram (span.<name>_ms unless given one)
+final class SpanStage {
+
+    let id: UInt16
+    let name: String
+    let histogram: Histogram
+
+    private init(id: UInt16, name: String, histogram: Histogram) {
+        self.id = id
+        self.name = name
+        self.histogram = histogram
+    }
+
+    private static let lock = NSLock()
+    private static var stages: [SpanStage] = []
+
+    /// Returns the stage registered under `name`, creating it on first use
+    static func named(_ name: String, histogram: Histogram? = nil) -> SpanStage {
+        lock.lock()
+        defer { lock.unlock() }
+        if let existing = stages.first(where: { $0.name == name }) {
+            return existing
+        }
+        let stage = SpanStage(
+            id: UInt16(stages.count + 1),
+            name: name,
+            histogram: histogram ?? MetricsRegistry.shared.histogram("span.\(name)_ms")
+        )
+        stages.append(stage)
+        return stage
+    }
+
+    static func name(for id: UInt16) -> String {
+        lock.lock()
+        defer { lock.unlock() }
+        return stages.first(where: { $0.id == id })?.name ?? "stage-\(id)"
+    }
+
+    // Price tick pipeline (SharedCoinDataManager → CoinListVM); the root spans every stage including
+    // logos, so tick-to-publish is recorded by CoinListVM when tick.publish ends
+    static let priceTick = named("tick")
+    static let tickMerge = named("tick.merge")
+    static let tickFilter = named("tick.filter")
+    static let tickSort = named("tick.sort")
+    static let tickDiff = named("tick.diff")
+    static let tickPublish = named("tick.publish")
+    static let tickLogos = named("tick.logos")
+
+    // Chart processing (CoinDetailsVM), root per range
+    static func chartProcessing(range: String) -> SpanStage {
+        named("chart.process.\(range)d")
+    }
+    static let chartValidate = named("chart.validate")
+    static let chartOutliers = named("chart.outliers")
+    static let chartSmoothing = named("chart.smoothing")
+    static let chartDownsample = named("chart.downsample")
+}
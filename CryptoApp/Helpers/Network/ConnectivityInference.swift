@@ -0,0 +1,163 @@
+//
+//  ConnectivityInference.swift
+//  CryptoApp
+//
+
+import Foundation
+
+// MARK: - Traffic Outcomes
+
+/// What a real API request revealed about connectivity
+enum NetworkTrafficOutcome: Equatable {
+    /// The server answered (any status code): the network path works
+    case responded
+    /// Transport failed in a way that means there is no usable network
+    case unreachable
+    /// Timed out: a slow or dead network, ambiguous on its own
+    case timedOut
+
+    /// nil for failures that say nothing about connectivity (cancellation, TLS, bad URL, ...)
+    init?(error: URLError) {
+        switch error.code {
+        case .timedOut:
+            self = .timedOut
+        case .notConnectedToInternet, .networkConnectionLost, .cannotFindHost, .cannotConnectToHost,
+             .dnsLookupFailed, .internationalRoamingOff, .dataNotAllowed, .callIsActive:
+            self = .unreachable
+        default:
+            return nil
+        }
+    }
+}
+
+/// Receives traffic outcomes from the HTTP layer; must be callable from any thread
+protocol NetworkTrafficReporting: AnyObject {
+    func reportTraffic(_ outcome: NetworkTrafficOutcome)
+}
+
+// MARK: - Inference
+
+/**
+ * CONNECTIVITY INFERENCE
+ *
+ * Decides connectivity from signals the app gets anyway: outcomes of real API requests and
+ * NWPath updates. Active probes are only requested when those signals are ambiguous:
+ * - At launch, until the first real request answers
+ * - After a timeout (one timeout alone doesn't mean offline)
+ * - When the path comes back while we believe we're offline
+ * - While offline, to notice recovery, with exponential backoff
+ *
+ * While online, nothing is ever probed: the next real request is the check.
+ * Pure state machine; the monitor owns timers, probes and publishing.
+ */
+struct ConnectivityInference {
+
+    // MARK: - Types
+
+    struct Configuration {
+        var initialBackoff: TimeInterval = 1
+        var maxBackoff: TimeInterval = 60
+        /// Consecutive timeouts, with no response in between, that count as offline
+        var timeoutsToDisconnect = 2
+        /// How long to wait for real traffic at launch before probing
+        var launchProbeDelay: TimeInterval = 3
+    }
+
+    enum Signal: Equatable {
+        case traffic(NetworkTrafficOutcome)
+        case path(isSatisfied: Bool)
+        case probe(succeeded: Bool)
+    }
+
+    /// What the monitor should do with its probe timer
+    enum ProbeAction: Equatable {
+        /// Nothing ambiguous left: cancel any scheduled probe
+        case cancel
+        /// Keep whatever is already scheduled
+        case unchanged
+        /// (Re)schedule a probe after the delay
+        case after(TimeInterval)
+    }
+
+    // MARK: - Properties
+
+    let configuration: Configuration
+
+    /// Optimistic until proven otherwise, matching the app's previous launch behaviour
+    private(set) var isConnected = true
+    /// Whether any real traffic or probe result has been seen yet
+    private(set) var hasEvidence = false
+
+    private var consecutiveTimeouts = 0
+    private var nextBackoff: TimeInterval
+
+    // MARK: - Initialization
+
+    init(configuration: Configuration = Configuration()) {
+        self.configuration = configuration
+        self.nextBackoff = configuration.initialBackoff
+    }
+
+    /// Probe to schedule at launch; cancelled by the first real response
+    var launchProbe: ProbeAction {
+        .after(configuration.launchProbeDelay)
+    }
+
+    // MARK: - Signals
+
+    mutating func handle(_ signal: Signal) -> ProbeAction {
+        switch signal {
+        case .traffic(.responded), .probe(succeeded: true):
+            hasEvidence = true
+            isConnected = true
+            consecutiveTimeouts = 0
+            nextBackoff = configuration.initialBackoff
+            return .cancel
+
+        case .traffic(.unreachable):
+            hasEvidence = true
+            guard isConnected else { return .unchanged }
+            isConnected = false
+            nextBackoff = configuration.initialBackoff
+            return backoffProbe()
+
+        case .traffic(.timedOut):
+            hasEvidence = true
+            guard isConnected else { return .unchanged }
+            consecutiveTimeouts += 1
+            guard consecutiveTimeouts >= configuration.timeoutsToDisconnect else {
+                // Slow or dead? Ask our own hosts right away
+                return .after(0)
+            }
+            isConnected = false
+            nextBackoff = configuration.initialBackoff
+            return backoffProbe()
+
+        case .probe(succeeded: false):
+            hasEvidence = true
+            isConnected = false
+            return backoffProbe()
+
+        case .path(isSatisfied: false):
+            // No usable interface: offline now, keep slow probes in case the path report is stale
+            guard isConnected else { return .unchanged }
+            isConnected = false
+            nextBackoff = configuration.initialBackoff
+            return backoffProbe()
+
+        case .path(isSatisfied: true):
+            // An interface came back while offline: confirm immediately; online path changes are
+            // left to the next real request
+            guard !isConnected else { return .unchanged }
+            nextBackoff = configuration.initialBackoff
+            return .after(0)
+        }
+    }
+
+    /// Current backoff delay, doubling the next one up to the cap
+    private mutating func backoffProbe() -> ProbeAction {
+        let delay = nextBackoff
+        nextBackoff = min(nextBackoff * 2, configuration.maxBackoff)
+        return .after(delay)
+    }
+}
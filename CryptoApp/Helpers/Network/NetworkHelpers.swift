@@ -43,6 +43,36 @@ extension URLSession {
     }
 }
 
+// MARK: - Traffic Reporting
+extension Publisher where Output == URLSession.DataTaskPublisher.Output, Failure == URLError {
+    
+    // Reports the request's outcome (any HTTP answer, or a connectivity-related failure) so
+    // connectivity can be inferred from real traffic instead of probe requests
+    func reportingTraffic(to reporter: NetworkTrafficReporting?) -> Publishers.HandleEvents<Self> {
+        handleEvents(
+            receiveOutput: { _ in
+                reporter?.reportTraffic(.responded)
+            },
+            receiveCompletion: { completion in
+                if case .failure(let error) = completion, let outcome = NetworkTrafficOutcome(error: error) {
+                    reporter?.reportTraffic(outcome)
+                }
+            }
+        )
+    }
+}
+
+// MARK: - Timed Decoding
+extension Publisher where Output == Data {
+    
+    // `decode(type:decoder:)` that also records decode time in MetricsRegistry (network.decode_ms)
+    func timedDecode<Item: Decodable>(type: Item.Type, decoder: JSONDecoder = JSONDecoder()) -> Publishers.TryMap<Self, Item> {
+        tryMap { data in
+            try Metrics.responseDecode.time { try decoder.decode(type, from: data) }
+        }
+    }
+}
+
 // MARK: - Generic Network Service Protocol
 protocol NetworkService {
     var baseURL: String { get }
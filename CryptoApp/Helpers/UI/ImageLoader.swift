@@ -2,122 +2,196 @@
 //  ImageLoader.swift
 //  CryptoApp
 //
-//  Image loading helper that integrates with existing CacheService
+//  Image loading helper backed by the two-tier LogoImageCache
 //
 
 import UIKit
 import Foundation
 
-/// Lightweight image loader that uses the existing CacheService for optimal integration
+// MARK: - Load Priority
+
+/// Priority classes for logo loads, highest first
+@objc enum ImageLoadPriority: Int, CaseIterable, Comparable {
+    /// On screen now (cell configuration)
+    case visible
+    /// About to scroll into view (collection view prefetching)
+    case prefetch
+    /// Further ahead of the scroll; first to be dropped
+    case speculative
+
+    static func < (lhs: ImageLoadPriority, rhs: ImageLoadPriority) -> Bool {
+        // Lower raw value = more urgent
+        lhs.rawValue > rhs.rawValue
+    }
+
+    var taskPriority: Float {
+        switch self {
+        case .visible: return URLSessionTask.highPriority
+        case .prefetch: return URLSessionTask.lowPriority
+        case .speculative: return 0.1
+        }
+    }
+
+    var decodePriority: Operation.QueuePriority {
+        switch self {
+        case .visible: return .veryHigh
+        case .prefetch: return .normal
+        case .speculative: return .veryLow
+        }
+    }
+}
+
+/// Lightweight image loader backed by the two-tier LogoImageCache
+///
+/// Pipeline: memory tier → disk tier probe on the decode pool → one shared URLSession (connection
+/// reuse across all logos) behind a priority scheduler that caps in-flight downloads → bounded
+/// decode pool for downsampling. Nothing blocks a thread while waiting on the network;
+/// completion handlers run on the session's delegate queue.
 @objc final class ImageLoader: NSObject {
-    
+
     // MARK: - Singleton
     @objc static let shared = ImageLoader()
-    
+
+    // MARK: - Types
+
+    /// One in-flight or pending load per URL; completions are coalesced onto it
+    private final class Request {
+        let url: URL
+        var priority: ImageLoadPriority
+        var completions: [(UIImage?) -> Void] = []
+        var task: URLSessionDataTask?
+        /// Disk tier lookup still running; not eligible for the network until it misses
+        var isProbingDisk = true
+
+        init(url: URL, priority: ImageLoadPriority) {
+            self.url = url
+            self.priority = priority
+        }
+    }
+
     // MARK: - Properties
-    
-    /// Track active downloads to prevent duplicates
-    private var activeDownloads = Set<String>()
 
-    /// Map URL -> operation for cancellation/promotion
-    private var operationsByURL = [String: ImageDownloadOperation]()
+    /// Pending and running requests by URL (syncQueue only)
+    private var requests = [String: Request]()
 
-    /// Coalesce multiple callbacks for the same URL
-    private var completionsByURL = [String: [(UIImage?) -> Void]]()
+    /// Pending URLs by priority class (syncQueue only)
+    private var pendingQueue = ImageRequestQueue()
+
+    /// Downloads currently on the network (syncQueue only)
+    private var runningCount = 0
 
     /// Serial queue to synchronize internal state
     private let syncQueue = DispatchQueue(label: "image.loader.sync")
-    
-    /// Operation queue for managing concurrent downloads
-    private let downloadQueue = OperationQueue()
-    
-    /// URLs pending prefetch (lower priority)
-    private var prefetchURLs = Set<String>()
-    
+
+    /// Shared session: keeps connections (and TLS sessions) alive between logos
+    private let session: URLSession
+
+    /// Decoding/downsampling runs here, separate from network I/O
+    private let decodeQueue = OperationQueue()
+
+    private let logoCache = LogoImageCache.shared
+
     // MARK: - Configuration
-    
+
     private struct Config {
         static let maxConcurrentDownloads = 6
+        static let maxConcurrentDecodes = 2
+        static let requestTimeout: TimeInterval = 15
+        static let maxDimension: CGFloat = 64
     }
-    
+
     // MARK: - Initialization
-    
+
     private override init() {
+        let config = URLSessionConfiguration.default
+        config.requestCachePolicy = .returnCacheDataElseLoad
+        config.timeoutIntervalForRequest = Config.requestTimeout
+        config.httpMaximumConnectionsPerHost = Config.maxConcurrentDownloads
+        config.waitsForConnectivity = false
+        session = URLSession(configuration: config)
         super.init()
-        setupDownloadQueue()
+        setupDecodeQueue()
     }
-    
-    private func setupDownloadQueue() {
-        downloadQueue.maxConcurrentOperationCount = Config.maxConcurrentDownloads
-        downloadQueue.qualityOfService = .utility
+
+    private func setupDecodeQueue() {
+        decodeQueue.name = "image.loader.decode"
+        decodeQueue.maxConcurrentOperationCount = Config.maxConcurrentDecodes
+        decodeQueue.qualityOfService = .userInitiated
     }
-    
+
     // MARK: - Public Interface
-    
-    /// Load image with completion handler, using existing CacheService
+
+    /// Load image with completion handler (memory, then disk, then network)
     @objc(loadImageFrom:completion:)
     func loadImage(from urlString: String, completion: @escaping (UIImage?) -> Void) {
         guard !urlString.isEmpty, let url = URL(string: urlString) else {
             completion(nil)
             return
         }
-        
-        // 1. Check existing CacheService first (fastest)
-        if let cachedImage = CacheService.shared.getCachedImage(for: urlString) {
+
+        // 1. Decoded logos in memory (fastest)
+        if let cachedImage = logoCache.memoryImage(for: urlString) {
             completion(cachedImage)
             return
         }
 
-       // 2. If download is in progress, attach completion and raise its priority
-        var shouldStartDownload = false
+        // 2. Attach to an existing load (raising it to visible) or start a new one (disk, then network)
         syncQueue.sync {
-            // Queue completion
-            var list = completionsByURL[urlString] ?? []
-            list.append(completion)
-            completionsByURL[urlString] = list
-
-            if let op = operationsByURL[urlString] {
-                // Promote prefetch to high priority if now visible
-                if op.priority == .low { op.promoteToHighPriority() }
-            } else {
-                shouldStartDownload = true
-            }
-        }
-
-        if shouldStartDownload {
-            downloadImage(from: url, priority: .high)
+            let request = requestLocked(for: urlString, url: url, priority: .visible)
+            request.completions.append(completion)
+            pumpLocked()
         }
     }
-    
+
     /// Prefetch images for upcoming cells (for scrolling optimization)
     @objc(prefetchImages:)
     func prefetchImages(urls: [String]) {
-        for urlString in urls {
+        prefetchImages(urls: urls, priority: .prefetch)
+    }
+
+    /// Prefetch images at a given priority class; existing loads are only ever raised, never lowered
+    @objc(prefetchImages:priority:)
+    func prefetchImages(urls: [String], priority: ImageLoadPriority) {
+        let candidates = urls.compactMap { urlString -> (String, URL)? in
             guard !urlString.isEmpty,
                   let url = URL(string: urlString),
-                  !isLoading(urlString: urlString),
-                  CacheService.shared.getCachedImage(for: urlString) == nil else {
-                continue
-            }
-            
-            syncQueue.async { [weak self] in
-                self?.prefetchURLs.insert(urlString)
+                  logoCache.memoryImage(for: urlString) == nil else { return nil }
+            return (urlString, url)
+        }
+        guard !candidates.isEmpty else { return }
+
+        syncQueue.sync {
+            for (urlString, url) in candidates {
+                _ = requestLocked(for: urlString, url: url, priority: priority)
             }
-            
-            // Start prefetch download with lower priority
-            downloadImage(from: url, priority: .low)
+            pumpLocked()
         }
     }
-    
-    /// Cancel prefetch operations
+
+    /// Cancel prefetch operations (loads nobody is waiting on)
     @objc func cancelPrefetching() {
-        downloadQueue.operations.forEach { operation in
-            if let imageOp = operation as? ImageDownloadOperation, imageOp.priority == .low {
-                imageOp.cancel()
+        syncQueue.async { [weak self] in
+            guard let self = self else { return }
+            for (urlString, request) in self.requests where request.priority != .visible && request.completions.isEmpty {
+                self.requests.removeValue(forKey: urlString)
+                request.task?.cancel()
             }
         }
+    }
+
+    /// Cancel prefetches for specific URLs only; loads a cell is waiting on are kept
+    @objc(cancelPrefetchingURLs:)
+    func cancelPrefetching(urls: [String]) {
+        guard !urls.isEmpty else { return }
         syncQueue.async { [weak self] in
-            self?.prefetchURLs.removeAll()
+            guard let self = self else { return }
+            for urlString in urls {
+                guard let request = self.requests[urlString],
+                      request.priority != .visible,
+                      request.completions.isEmpty else { continue }
+                self.requests.removeValue(forKey: urlString)
+                request.task?.cancel()
+            }
         }
     }
 
@@ -125,147 +199,161 @@ import Foundation
     @objc(cancelLoadFor:)
     func cancelLoad(for urlString: String) {
         syncQueue.async { [weak self] in
-            guard let self = self else { return }
-            if let op = self.operationsByURL[urlString] {
-                op.cancel()
-            }
-            self.operationsByURL.removeValue(forKey: urlString)
-            self.activeDownloads.remove(urlString)
-            self.completionsByURL.removeValue(forKey: urlString)
-            self.prefetchURLs.remove(urlString)
+            guard let self = self, let request = self.requests.removeValue(forKey: urlString) else { return }
+            request.task?.cancel()
         }
     }
-    
-    // MARK: - Private Methods
-    
-    private func downloadImage(from url: URL, priority: Priority) {
-        let urlString = url.absoluteString
-
-        // Prevent duplicate downloads
-        var shouldEnqueue = false
-        syncQueue.sync {
-            if !activeDownloads.contains(urlString) {
-                activeDownloads.insert(urlString)
-                shouldEnqueue = true
+
+    // MARK: - Scheduling (syncQueue only)
+
+    /// Existing request for the URL, raised to `priority` if needed, or a new one probing disk first
+    private func requestLocked(for urlString: String, url: URL, priority: ImageLoadPriority) -> Request {
+        if let request = requests[urlString] {
+            if priority > request.priority {
+                request.priority = priority
+                if let task = request.task {
+                    // URLSessionTask priority can be adjusted after resume
+                    task.priority = priority.taskPriority
+                } else if !request.isProbingDisk {
+                    pendingQueue.enqueue(urlString, priority: priority)
+                }
             }
+            return request
         }
-        guard shouldEnqueue else { return }
 
-        let operation = ImageDownloadOperation(url: url, priority: priority) { [weak self] image in
-            guard let self = self else { return }
+        let request = Request(url: url, priority: priority)
+        requests[urlString] = request
+        probeDiskLocked(request, key: urlString)
+        return request
+    }
 
-            // Cache downsampled image
-            if let image = image {
-                CacheService.shared.storeCachedImage(image, for: urlString)
+    /// Reads the disk tier on the decode pool; a miss queues the request for the network
+    private func probeDiskLocked(_ request: Request, key urlString: String) {
+        let operation = BlockOperation { [weak self] in
+            guard let self = self else { return }
+            if let image = self.logoCache.diskImage(for: urlString) {
+                self.deliver(image, for: request, key: urlString)
+                return
             }
-
-            // Drain all coalesced completions
-            var completions: [(UIImage?) -> Void] = []
             self.syncQueue.sync {
-                completions = self.completionsByURL[urlString] ?? []
-                self.completionsByURL.removeValue(forKey: urlString)
-                self.operationsByURL.removeValue(forKey: urlString)
-                self.activeDownloads.remove(urlString)
-            }
-            DispatchQueue.main.async {
-                if completions.isEmpty {
-                    // No coalesced completions, nothing to deliver
-                } else {
-                    completions.forEach { $0(image) }
-                }
+                guard self.requests[urlString] === request else { return }
+                request.isProbingDisk = false
+                self.pendingQueue.enqueue(urlString, priority: request.priority)
+                self.pumpLocked()
             }
         }
+        operation.queuePriority = request.priority.decodePriority
+        decodeQueue.addOperation(operation)
+    }
 
-        // Track operation
-        syncQueue.async { [weak self] in
-            self?.operationsByURL[urlString] = operation
+    /// Starts pending downloads, most urgent first, until the in-flight cap is reached
+    private func pumpLocked() {
+        while runningCount < Config.maxConcurrentDownloads {
+            // Entries for cancelled, promoted or already-started requests are stale; skip them
+            guard let urlString = pendingQueue.dequeue(where: { key, priority in
+                guard let request = requests[key] else { return false }
+                return request.task == nil && !request.isProbingDisk && request.priority == priority
+            }), let request = requests[urlString] else { return }
+            startLocked(request, key: urlString)
+        }
+    }
+
+    private func startLocked(_ request: Request, key urlString: String) {
+        runningCount += 1
+        let task = session.dataTask(with: request.url) { [weak self] data, _, _ in
+            self?.downloadFinished(request, key: urlString, data: data)
+        }
+        task.priority = request.priority.taskPriority
+        request.task = task
+        task.resume()
+    }
+
+    // MARK: - Completion
+
+    private func downloadFinished(_ request: Request, key urlString: String, data: Data?) {
+        let priority: ImageLoadPriority? = syncQueue.sync {
+            runningCount -= 1
+            pumpLocked()
+            return requests[urlString] === request ? request.priority : nil
+        }
+
+        // Cancelled loads are dropped; the bytes already fetched stay in the URL cache
+        guard let priority = priority else { return }
+        guard let data = data else {
+            deliver(nil, for: request, key: urlString)
+            return
         }
 
-        downloadQueue.addOperation(operation)
+        let operation = BlockOperation { [weak self] in
+            let image = downsampleImage(data: data, maxDimension: Config.maxDimension)
+            if let image = image {
+                // Keep the downsampled bitmap in memory and on disk
+                self?.logoCache.store(image, for: urlString)
+            }
+            self?.deliver(image, for: request, key: urlString)
+        }
+        operation.queuePriority = priority.decodePriority
+        decodeQueue.addOperation(operation)
     }
 
-    private func isLoading(urlString: String) -> Bool {
-        var loading = false
-        syncQueue.sync { loading = activeDownloads.contains(urlString) || operationsByURL[urlString] != nil }
-        return loading
+    /// Drains all coalesced completions on main, unless the request was cancelled meanwhile
+    private func deliver(_ image: UIImage?, for request: Request, key urlString: String) {
+        let completions: [(UIImage?) -> Void] = syncQueue.sync {
+            guard requests[urlString] === request else { return [] }
+            requests.removeValue(forKey: urlString)
+            return request.completions
+        }
+        guard !completions.isEmpty else { return }
+        DispatchQueue.main.async {
+            completions.forEach { $0(image) }
+        }
     }
 }
 
-// MARK: - Image Download Operation
+// MARK: - Priority Queue
 
-private class ImageDownloadOperation: Operation, @unchecked Sendable {
-    enum Priority {
-        case high, low
+/**
+ * FIFO queue per priority class with lazy deletion: promoting or cancelling a request never
+ * searches the queues, stale entries are skipped by the caller's predicate on dequeue.
+ */
+struct ImageRequestQueue {
+
+    private var queues: [[String]] = ImageLoadPriority.allCases.map { _ in [] }
+    private var heads: [Int] = ImageLoadPriority.allCases.map { _ in 0 }
+
+    var isEmpty: Bool {
+        queues.indices.allSatisfy { heads[$0] >= queues[$0].count }
     }
-    
-    private let url: URL
-    let priority: Priority
-    private let completion: (UIImage?) -> Void
-    private var task: URLSessionDataTask?
-    private let maxDimension: CGFloat = 64
-    
-    init(url: URL, priority: Priority, completion: @escaping (UIImage?) -> Void) {
-        self.url = url
-        self.priority = priority
-        self.completion = completion
-        super.init()
+
+    mutating func enqueue(_ key: String, priority: ImageLoadPriority) {
+        queues[priority.rawValue].append(key)
     }
-    
-    override func main() {
-        guard !isCancelled else { return }
-        
-        let semaphore = DispatchSemaphore(value: 0)
-        
-        // Use optimized URL session configuration
-        let config = URLSessionConfiguration.default
-        config.requestCachePolicy = .returnCacheDataElseLoad
-        config.timeoutIntervalForRequest = 15.0
-        let session = URLSession(configuration: config)
-        
-        task = session.dataTask(with: url) { [weak self] data, response, error in
-            defer { semaphore.signal() }
-            
-            guard let self = self, !self.isCancelled else { return }
-            
-            if let data = data, let image = downsampleImage(data: data, maxDimension: self.maxDimension) {
-                DispatchQueue.main.async {
-                    self.completion(image)
-                }
-            } else {
-                DispatchQueue.main.async {
-                    self.completion(nil)
+
+    /// Next key from the most urgent class for which `isCurrent` holds; stale keys are discarded
+    mutating func dequeue(where isCurrent: (String, ImageLoadPriority) -> Bool) -> String? {
+        for priority in ImageLoadPriority.allCases {
+            let index = priority.rawValue
+            while heads[index] < queues[index].count {
+                let key = queues[index][heads[index]]
+                heads[index] += 1
+                if isCurrent(key, priority) {
+                    compact(index)
+                    return key
                 }
             }
+            compact(index)
         }
-        
-        // Apply URLSession task priority based on operation priority
-        switch priority {
-        case .high: task?.priority = URLSessionTask.highPriority
-        case .low: task?.priority = URLSessionTask.lowPriority
-        }
-
-        task?.resume()
-        semaphore.wait()
-    }
-    
-    override func cancel() {
-        task?.cancel()
-        super.cancel()
+        return nil
     }
 
-    func promoteToHighPriority() {
-        guard !isCancelled else { return }
-        if priority == .low {
-            // Note: URLSessionTask priority can be adjusted after resume
-            task?.priority = URLSessionTask.highPriority
-        }
+    /// Drops consumed entries once they dominate the backing array
+    private mutating func compact(_ index: Int) {
+        guard heads[index] > 64 || heads[index] == queues[index].count else { return }
+        queues[index].removeFirst(heads[index])
+        heads[index] = 0
     }
 }
 
-// MARK: - Priority Type Alias
-
-private typealias Priority = ImageDownloadOperation.Priority
-
 // MARK: - Image Downsampling
 
 private func downsampleImage(data: Data, maxDimension: CGFloat) -> UIImage? {
@@ -0,0 +1,198 @@
+//
+//  ScrollPrefetchScheduler.swift
+//  CryptoApp
+//
+
+import UIKit
+
+/**
+ * SCROLL PREFETCH SCHEDULER
+ *
+ * Predicts where a vertical list will come to rest and turns that into a prefetch window of
+ * rows, so logos and quotes are fetched for rows the user will actually stop on instead of
+ * every row a fling passes through.
+ *
+ * - While dragging: velocity is smoothed from scroll samples and projected with the scroll
+ *   view's deceleration curve (distance = v · r / (1 − r), r per millisecond)
+ * - On release: UIKit's own target content offset is used as-is until the scroll settles
+ * - The window is the predicted viewport plus a lead ahead of the scroll direction (prefetch
+ *   class), followed by a speculative band; rows are only cancelled once they leave both
+ *
+ * Works on row indices for a single column of fixed-pitch rows (the coin list's flow layout);
+ * the owner maps rows to coins. Main thread only.
+ */
+final class ScrollPrefetchScheduler {
+
+    // MARK: - Types
+
+    struct Configuration {
+        /// UIScrollView deceleration factor per millisecond
+        var decelerationRate: CGFloat = UIScrollView.DecelerationRate.normal.rawValue
+        /// Viewport heights prefetched ahead of the predicted viewport
+        var leadScreens: CGFloat = 0.5
+        /// Viewport heights beyond the lead fetched at speculative priority
+        var speculativeScreens: CGFloat = 1
+        /// Below this speed (points per second) the scroll counts as settled
+        var settleSpeed: CGFloat = 150
+        /// Weight of the newest sample in the smoothed velocity
+        var velocitySmoothing: CGFloat = 0.35
+        /// How long a batched quote refresh keeps a row fresh
+        var quoteFreshness: TimeInterval = 15
+    }
+
+    /// Layout inputs in points
+    struct Geometry {
+        let viewportHeight: CGFloat
+        let contentHeight: CGFloat
+        /// Row height plus inter-row spacing
+        let rowPitch: CGFloat
+        let rowCount: Int
+    }
+
+    /// Rows to fetch by priority class, and rows that dropped out of the window
+    struct Plan: Equatable {
+        let prefetch: [Int]
+        let speculative: [Int]
+        let cancelled: [Int]
+    }
+
+    // MARK: - Properties
+
+    let configuration: Configuration
+
+    /// Smoothed scroll velocity in points per second (positive = down the list)
+    private(set) var velocity: CGFloat = 0
+    /// Direction of the last decisive movement; the lead goes this way
+    private(set) var isScrollingUp = false
+    private var lastSample: (offset: CGFloat, time: TimeInterval)?
+    /// Release target reported by UIKit; authoritative until the scroll settles
+    private var releaseTarget: CGFloat?
+
+    private(set) var prefetchRows: Range<Int> = 0..<0
+    private(set) var speculativeRows: Range<Int> = 0..<0
+
+    /// Item key → time of its last batched quote refresh (keyed by item so it survives reordering)
+    private var quotedAt: [Int: TimeInterval] = [:]
+
+    // MARK: - Initialization
+
+    init(configuration: Configuration = Configuration()) {
+        self.configuration = configuration
+    }
+
+    // MARK: - Scroll Events
+
+    /// Feeds a scroll sample; returns a plan when the predicted window changed
+    func didScroll(offset: CGFloat, at time: TimeInterval, geometry: Geometry) -> Plan? {
+        if let last = lastSample, time > last.time {
+            let instant = (offset - last.offset) / CGFloat(time - last.time)
+            velocity += configuration.velocitySmoothing * (instant - velocity)
+        }
+        lastSample = (offset, time)
+        if abs(velocity) >= configuration.settleSpeed {
+            isScrollingUp = velocity < 0
+        }
+        return replan(settleOffset: predictedSettleOffset(from: offset), geometry: geometry)
+    }
+
+    /// Finger lifted: UIKit already knows where the scroll will stop
+    func willEndDragging(targetOffset: CGFloat, geometry: Geometry) -> Plan? {
+        releaseTarget = targetOffset
+        if let last = lastSample, targetOffset != last.offset {
+            isScrollingUp = targetOffset < last.offset
+        }
+        return replan(settleOffset: targetOffset, geometry: geometry)
+    }
+
+    /// A new drag invalidates the release target
+    func willBeginDragging() {
+        releaseTarget = nil
+        lastSample = nil
+        velocity = 0
+    }
+
+    /// Scroll came to rest (or the list changed underneath); re-anchors the window at `offset`
+    func didSettle(offset: CGFloat, geometry: Geometry) -> Plan? {
+        releaseTarget = nil
+        lastSample = nil
+        velocity = 0
+        return replan(settleOffset: offset, geometry: geometry)
+    }
+
+    /// Rows now map to different items: replans from scratch, keeping the scroll prediction
+    func dataDidChange(offset: CGFloat, geometry: Geometry) -> Plan? {
+        prefetchRows = 0..<0
+        speculativeRows = 0..<0
+        return replan(settleOffset: predictedSettleOffset(from: offset), geometry: geometry)
+    }
+
+    /// Where the scroll is expected to stop if released now
+    func predictedSettleOffset(from offset: CGFloat) -> CGFloat {
+        if let target = releaseTarget {
+            return target
+        }
+        guard abs(velocity) >= configuration.settleSpeed else { return offset }
+        let rate = configuration.decelerationRate
+        return offset + velocity / 1000 * rate / (1 - rate)
+    }
+
+    // MARK: - Quote Batching
+
+    /// Keys from `keys` without a batched quote within the freshness interval
+    func keysNeedingQuotes(_ keys: [Int], at time: TimeInterval) -> [Int] {
+        keys.filter { key in
+            guard let last = quotedAt[key] else { return true }
+            return time - last >= configuration.quoteFreshness
+        }
+    }
+
+    /// Records a batched quote for `keys`; call only once the fetch has actually succeeded
+    func markQuoted(_ keys: [Int], at time: TimeInterval) {
+        keys.forEach { quotedAt[$0] = time }
+    }
+
+    // MARK: - Planning
+
+    private func replan(settleOffset: CGFloat, geometry: Geometry) -> Plan? {
+        guard geometry.rowPitch > 0, geometry.viewportHeight > 0 else { return nil }
+        let maxOffset = max(0, geometry.contentHeight - geometry.viewportHeight)
+        let top = min(max(settleOffset, 0), maxOffset)
+        let bottom = top + geometry.viewportHeight
+        let lead = configuration.leadScreens * geometry.viewportHeight
+        let speculative = configuration.speculativeScreens * geometry.viewportHeight
+
+        let prefetch: Range<Int>
+        let speculativeBand: Range<Int>
+        if isScrollingUp {
+            // Lead and speculative band sit above the viewport
+            prefetch = Self.rows(from: top - lead, to: bottom, geometry: geometry)
+            speculativeBand = Self.rows(from: top - lead - speculative, to: top - lead, geometry: geometry)
+                .clamped(to: 0..<prefetch.lowerBound)
+        } else {
+            prefetch = Self.rows(from: top, to: bottom + lead, geometry: geometry)
+            speculativeBand = Self.rows(from: bottom + lead, to: bottom + lead + speculative, geometry: geometry)
+                .clamped(to: prefetch.upperBound..<geometry.rowCount)
+        }
+        let speculativeOnly = speculativeBand.isEmpty ? 0..<0 : speculativeBand
+
+        guard prefetch != prefetchRows || speculativeOnly != speculativeRows else { return nil }
+
+        let previous = Set(prefetchRows).union(speculativeRows)
+        let current = Set(prefetch).union(speculativeOnly)
+        let plan = Plan(
+            prefetch: prefetch.filter { !prefetchRows.contains($0) },
+            speculative: speculativeOnly.filter { !previous.contains($0) },
+            cancelled: previous.subtracting(current).sorted()
+        )
+        prefetchRows = prefetch
+        speculativeRows = speculativeOnly
+        return plan
+    }
+
+    /// Rows intersecting [from, to) for fixed-pitch rows starting at y = 0
+    static func rows(from minY: CGFloat, to maxY: CGFloat, geometry: Geometry) -> Range<Int> {
+        let lower = max(0, Int((minY / geometry.rowPitch).rounded(.down)))
+        let upper = min(geometry.rowCount, Int((maxY / geometry.rowPitch).rounded(.up)))
+        return lower < upper ? lower..<upper : 0..<0
+    }
+}
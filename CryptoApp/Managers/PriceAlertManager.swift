@@ -0,0 +1,184 @@
+import Foundation
+import Combine
+
+/**
+ * PRICE ALERT MANAGER
+ *
+ * Owns the user's alert rules and evaluates them on every SharedCoinDataManager update:
+ * - Rules persist in UserDefaults (same approach as indicator settings)
+ * - Alert coins are registered as watched, so coins outside the shared refresh set are
+ *   evaluated from their watched quotes
+ * - Evaluation runs on a serial background queue through PriceAlertEngine
+ * - Indicator rules are warmed up from cached chart closes when added or loaded
+ * - Triggered alerts are published on the main queue
+ */
+final class PriceAlertManager: PriceAlertManagerProtocol {
+
+    // MARK: - Properties
+
+    private let sharedCoinDataManager: SharedCoinDataManagerProtocol
+    private let userDefaults: UserDefaults
+    private let cacheService: CacheServiceProtocol
+    private let engine = PriceAlertEngine()
+    private let evaluationQueue = DispatchQueue(label: "price.alert.evaluation", qos: .utility)
+    private var cancellables = Set<AnyCancellable>()
+
+    private let rulesSubject: CurrentValueSubject<[PriceAlertRule], Never>
+    private let triggeredSubject = PassthroughSubject<[PriceAlertEvent], Never>()
+    // Watched quotes already evaluated (evaluation queue only); each emission repeats earlier quotes
+    private var evaluatedWatchedQuotes: [Int: Quote] = [:]
+
+    static let rulesDefaultsKey = "PriceAlertRules"
+
+    /// Cached series tried for indicator warm-up, finest resolution first
+    private static let seedRanges = ["1", "7", "30", "365"]
+
+    // MARK: - PriceAlertManagerProtocol Conformance
+
+    /// Publisher that emits the current rule list whenever it changes
+    var rules: AnyPublisher<[PriceAlertRule], Never> {
+        rulesSubject.eraseToAnyPublisher()
+    }
+
+    /// Publisher that emits alerts triggered by a shared data update (main queue)
+    var triggeredAlerts: AnyPublisher<[PriceAlertEvent], Never> {
+        triggeredSubject.eraseToAnyPublisher()
+    }
+
+    /// Get current rules synchronously
+    var currentRules: [PriceAlertRule] {
+        rulesSubject.value
+    }
+
+    // MARK: - Dependency Injection Initializer
+
+    init(
+        sharedCoinDataManager: SharedCoinDataManagerProtocol,
+        userDefaults: UserDefaults = .standard,
+        cacheService: CacheServiceProtocol = CacheService.shared
+    ) {
+        self.sharedCoinDataManager = sharedCoinDataManager
+        self.userDefaults = userDefaults
+        self.cacheService = cacheService
+
+        let storedRules = PriceAlertManager.loadRules(from: userDefaults)
+        self.rulesSubject = CurrentValueSubject(storedRules)
+        storedRules.forEach { engine.addRule($0) }
+        storedRules.forEach { seedFromCache($0) }
+        registerWatchedCoins(storedRules)
+
+        bindSharedData()
+    }
+
+    // MARK: - Rule Management
+
+    func addRule(_ rule: PriceAlertRule) {
+        var updated = rulesSubject.value.filter { $0.id != rule.id }
+        updated.append(rule)
+        commit(updated)
+        evaluationQueue.async { [engine] in
+            engine.addRule(rule)
+        }
+        seedFromCache(rule)
+    }
+
+    func removeRule(id: UUID) {
+        commit(rulesSubject.value.filter { $0.id != id })
+        evaluationQueue.async { [engine] in
+            engine.removeRule(id: id)
+        }
+    }
+
+    func removeAllRules() {
+        commit([])
+        evaluationQueue.async { [engine] in
+            engine.removeAllRules()
+        }
+    }
+
+    /// Warms up indicator rules (RSI / SMA crossover) from historical closes, oldest first
+    func seedIndicators(coinId: Int, prices: [Double]) {
+        evaluationQueue.async { [engine] in
+            engine.seedIndicators(coinId: coinId, prices: prices)
+        }
+    }
+
+    // MARK: - Private Methods
+
+    /// Seeds an indicator rule from the finest cached chart or OHLC series long enough to warm it up
+    private func seedFromCache(_ rule: PriceAlertRule) {
+        guard let warmUpLength = rule.condition.warmUpLength,
+              let geckoID = rule.geckoID ?? sharedCoinDataManager.getCoinsForIds([rule.coinId]).first?.slug?.lowercased() else {
+            return
+        }
+        evaluationQueue.async { [engine, cacheService] in
+            for days in PriceAlertManager.seedRanges {
+                let closes = cacheService.getChartData(for: geckoID, currency: "usd", days: days)
+                    ?? cacheService.getOHLCData(for: geckoID, currency: "usd", days: days)?.map { $0.close }
+                guard let closes = closes, closes.count >= warmUpLength else { continue }
+                engine.seedIndicators(coinId: rule.coinId, prices: closes)
+                return
+            }
+        }
+    }
+
+    private func bindSharedData() {
+        // Listed coins, except those currently priced by a watched quote
+        let listedTicks = sharedCoinDataManager.allCoins
+            .filter { !$0.isEmpty }
+            .map { [sharedCoinDataManager] coins -> [PriceTick] in
+                let watchedQuotes = sharedCoinDataManager.currentWatchedQuotes
+                return coins.compactMap { watchedQuotes[$0.id] == nil ? $0.priceTick : nil }
+            }
+            .receive(on: evaluationQueue)
+
+        // Coins outside the shared refresh set; only quotes not evaluated before become ticks
+        let watchedTicks = sharedCoinDataManager.watchedQuotes
+            .receive(on: evaluationQueue)
+            .map { [weak self] quotes -> [PriceTick] in
+                guard let self = self else { return [] }
+                let fresh = quotes.filter { id, quote in
+                    guard let previous = self.evaluatedWatchedQuotes[id] else { return true }
+                    return previous.price != quote.price || previous.lastUpdated != quote.lastUpdated
+                }
+                self.evaluatedWatchedQuotes = quotes
+                return fresh.compactMap { PriceTick(coinId: $0.key, quote: $0.value) }
+            }
+
+        listedTicks
+            .merge(with: watchedTicks)
+            .filter { !$0.isEmpty }
+            .map { [engine] ticks -> [PriceAlertEvent] in
+                guard engine.ruleCount > 0 else { return [] }
+                return engine.evaluate(ticks)
+            }
+            .filter { !$0.isEmpty }
+            .receive(on: DispatchQueue.main)
+            .sink { [weak self] events in
+                AppLogger.price("Price alerts triggered: \(events.count)")
+                self?.triggeredSubject.send(events)
+            }
+            .store(in: &cancellables)
+    }
+
+    /// Keeps every alert coin priced each cycle, including coins outside the shared refresh set
+    private func registerWatchedCoins(_ rules: [PriceAlertRule]) {
+        sharedCoinDataManager.setWatchedCoinIds(Set(rules.map { $0.coinId }), for: .priceAlerts)
+    }
+
+    private func commit(_ rules: [PriceAlertRule]) {
+        rulesSubject.send(rules)
+        registerWatchedCoins(rules)
+        if let data = try? JSONEncoder().encode(rules) {
+            userDefaults.set(data, forKey: PriceAlertManager.rulesDefaultsKey)
+        }
+    }
+
+    private static func loadRules(from userDefaults: UserDefaults) -> [PriceAlertRule] {
+        guard let data = userDefaults.data(forKey: rulesDefaultsKey),
+              let rules = try? JSONDecoder().decode([PriceAlertRule].self, from: data) else {
+            return []
+        }
+        return rules
+    }
+}
@@ -159,6 +159,7 @@ final class RequestManager: RequestManagerProtocol {
             normalPriorityQueue.removeAll()
             lowPriorityQueue.removeAll()
             isProcessingQueue = false
+            publishQueueDepths()
             
             // Cancel all active subscriptions
             cancellables.removeAll()
@@ -194,11 +195,13 @@ final class RequestManager: RequestManagerProtocol {
                     if priority == .high {
                         let timeSinceLastRequest = Date().timeIntervalSince(lastTime)
                         if timeSinceLastRequest < 1.0 { // Only throttle if less than 1 second
+                            Metrics.requestsThrottled.increment()
                             promise(.failure(RequestError.throttled))
                             return
                         }
                     } else {
                         // Normal/low priority requests still get full throttling
+                        Metrics.requestsThrottled.increment()
                         promise(.failure(RequestError.throttled))
                         return
                     }
@@ -206,7 +209,8 @@ final class RequestManager: RequestManagerProtocol {
                 
                 // This checks if request is already running -> this prevents duplicate API calls
                 if let existingRequest = self.activeRequests[key] {
-                    AppLogger.performance("\(priority.description) request deduplication: \(key)")
+                    AppLogger.performance("\(priority.description) request deduplication: \(key)", level: .debug)
+                    Metrics.requestsDeduplicated.increment()
                     // Return the existing request, cast to the correct type
                     existingRequest
                         .tryMap { result in
@@ -236,7 +240,8 @@ final class RequestManager: RequestManagerProtocol {
                 let publisher = request()
                     .handleEvents(
                         receiveSubscription: { _ in
-                            AppLogger.network("\(priority.description) request started: \(key)")
+                            Metrics.requestsStarted.increment()
+                            AppLogger.network("\(priority.description) request started: \(key)", level: .debug)
                         },
                         
                         // After we get a response, update lastRequestTimes so throttling can work next time.
@@ -250,8 +255,9 @@ final class RequestManager: RequestManagerProtocol {
                         receiveCompletion: { [weak self] completion in
                             switch completion {
                             case .finished:
-                                AppLogger.success("\(priority.description) request completed: \(key)")
+                                AppLogger.network("\(priority.description) request completed: \(key)", level: .debug)
                             case .failure(let error):
+                                Metrics.requestsFailed.increment()
                                 AppLogger.error("\(priority.description) request failed: \(key)", error: error)
                             }
                             self?.queue.async(flags: .barrier) {
@@ -439,6 +445,7 @@ final class RequestManager: RequestManagerProtocol {
                 case .low:
                     self.lowPriorityQueue.append(requestAction) // Background operations
                 }
+                self.publishQueueDepths()
                 
                 // Process queue if not already processing
                 if !self.isProcessingQueue {
@@ -533,6 +540,7 @@ final class RequestManager: RequestManagerProtocol {
                 case .low:
                     self.lowPriorityQueue.append(requestAction) // Background operations
                 }
+                self.publishQueueDepths()
                 
                 // Process queue if not already processing
                 if !self.isProcessingQueue {
@@ -550,6 +558,7 @@ final class RequestManager: RequestManagerProtocol {
     // Then runs next item 
     private func processPriorityQueue() {
         isProcessingQueue = true
+        defer { publishQueueDepths() }
         
         // Process high priority requests first
         if !highPriorityQueue.isEmpty {
@@ -701,6 +710,7 @@ final class RequestManager: RequestManagerProtocol {
             self.highPriorityQueue.removeAll()
             self.normalPriorityQueue.removeAll()
             self.lowPriorityQueue.removeAll()
+            self.publishQueueDepths()
         }
     }
     
@@ -742,7 +752,14 @@ final class RequestManager: RequestManagerProtocol {
         return utilizationRate > 0.8 // Use cache when > 80% of rate limit used
     }
     
-    // This method is added to help debug the queue system
+    /// Mirrors queue depths into MetricsRegistry (call on `queue`)
+    private func publishQueueDepths() {
+        Metrics.requestQueueHigh.set(highPriorityQueue.count)
+        Metrics.requestQueueNormal.set(normalPriorityQueue.count)
+        Metrics.requestQueueLow.set(lowPriorityQueue.count)
+    }
+    
+    // Pending requests per priority; the same depths are exported as requests.queue.* gauges
     func getQueueStatus() -> (high: Int, normal: Int, low: Int) {
         return queue.sync {
             return (
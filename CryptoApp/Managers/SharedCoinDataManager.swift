@@ -1,6 +1,13 @@
 import Foundation
 import Combine
 
+/// One emission of the shared coin list, paired with the root span of the price tick that produced it
+struct CoinDataUpdate {
+    let coins: [Coin]
+    /// Open root span for a quotes tick; nil for the initial fetch and for replays to new subscribers
+    let tick: SpanTracer.Span?
+}
+
 /// Shared data manager that ensures price consistency across all ViewModels
 final class SharedCoinDataManager: SharedCoinDataManagerProtocol {
     
@@ -9,16 +16,31 @@ final class SharedCoinDataManager: SharedCoinDataManagerProtocol {
     private let coinManager: CoinManagerProtocol
     private var cancellables = Set<AnyCancellable>()
     private let updateInterval: TimeInterval = 30.0
+    private let sharedRefreshLimit = 200 // Top coins refreshed with fresh quotes each cycle
     private var updateTimer: Timer?
     
     // Single source of truth for all coin data
     private let coinDataSubject = CurrentValueSubject<[Coin], Never>([])
+    private let coinUpdateSubject = PassthroughSubject<CoinDataUpdate, Never>()
     private let errorSubject = PassthroughSubject<Error, Never>()
     private let isLoadingSubject = CurrentValueSubject<Bool, Never>(false)
     private let isFetchingFreshDataSubject = CurrentValueSubject<Bool, Never>(false)
     private var lastUpdateTime: Date?
     private var isUpdating = false
     
+    // O(1) lookups into the shared list (rebuilt only when the coin list itself changes)
+    private var coinIndexById: [Int: Int] = [:]
+    // Coins that received fresh quotes in the latest cycle
+    private var refreshedCoinIds: Set<Int> = []
+    
+    // Watched coins (watchlist, price alerts) and their quotes when they fall outside the shared refresh set
+    private var watchedCoinIdsByOwner: [WatchedCoinsOwner: Set<Int>] = [:]
+    private var watchedCoinIds: Set<Int> = [] // Union over all owners
+    private let watchedQuotesSubject = CurrentValueSubject<[Int: Quote], Never>([:])
+    private var isFetchingWatchedQuotes = false
+    // Watched coins that needed quotes while a batch was in flight; fetched when it completes
+    private var pendingWatchedCoinIds: Set<Int> = []
+    
     // MARK: - SharedCoinDataManagerProtocol Conformance
     
     /// Publisher that emits the current list of all coins
@@ -26,6 +48,13 @@ final class SharedCoinDataManager: SharedCoinDataManagerProtocol {
         coinDataSubject.eraseToAnyPublisher()
     }
     
+    /// Same emissions as `allCoins`, each carrying its own tick span; the current list is replayed without one
+    var coinUpdates: AnyPublisher<CoinDataUpdate, Never> {
+        coinUpdateSubject
+            .prepend(CoinDataUpdate(coins: coinDataSubject.value, tick: nil))
+            .eraseToAnyPublisher()
+    }
+    
     /// Publisher that emits errors from shared data fetching
     var errors: AnyPublisher<Error, Never> {
         errorSubject.eraseToAnyPublisher()
@@ -46,6 +75,16 @@ final class SharedCoinDataManager: SharedCoinDataManagerProtocol {
         coinDataSubject.value
     }
     
+    /// Publisher that emits fresh quotes for watched coins outside the shared refresh set
+    var watchedQuotes: AnyPublisher<[Int: Quote], Never> {
+        watchedQuotesSubject.eraseToAnyPublisher()
+    }
+    
+    /// Get watched-coin quotes synchronously
+    var currentWatchedQuotes: [Int: Quote] {
+        watchedQuotesSubject.value
+    }
+    
     // MARK: - Dependency Injection Initializer
     
     /**
@@ -100,6 +139,8 @@ final class SharedCoinDataManager: SharedCoinDataManagerProtocol {
         isLoadingSubject.send(false)
         isFetchingFreshDataSubject.send(false)
         isUpdating = false
+        isFetchingWatchedQuotes = false
+        pendingWatchedCoinIds.removeAll()
         
         print("🌐 SharedCoinDataManager: Stopped shared updates")
     }
@@ -109,10 +150,49 @@ final class SharedCoinDataManager: SharedCoinDataManagerProtocol {
         fetchSharedData()
     }
     
-    /// Get coins filtered by IDs (for watchlist)
+    /// Get coins by IDs (for watchlist) via the index - O(ids) instead of scanning the full list
+    /// Coins outside the shared refresh set carry their latest watched quote when available
     func getCoinsForIds(_ ids: [Int]) -> [Coin] {
-        let idSet = Set(ids)
-        return currentCoins.filter { idSet.contains($0.id) }
+        let coins = currentCoins
+        let watchedQuotes = watchedQuotesSubject.value
+        var seen = Set<Int>()
+        return ids.compactMap { id -> Coin? in
+            guard seen.insert(id).inserted,
+                  let index = coinIndexById[id], index < coins.count else { return nil }
+            var coin = coins[index]
+            if let quote = watchedQuotes[id] {
+                coin.quote?["USD"] = quote
+            }
+            return coin
+        }
+    }
+    
+    /**
+     * WATCHED COIN REGISTRATION
+     * 
+     * Consumers (watchlist, price alerts) register the coin IDs they need; each owner's set
+     * replaces only its own previous registration. Each cycle, watched coins
+     * outside the shared refresh set are priced with ONE batched low-priority quote request,
+     * so every coin is fetched exactly once per cycle. Newly watched coins without a quote
+     * are fetched immediately so they don't wait a full cycle.
+     */
+    func setWatchedCoinIds(_ ids: Set<Int>, for owner: WatchedCoinsOwner) {
+        watchedCoinIdsByOwner[owner] = ids
+        let union = watchedCoinIdsByOwner.values.reduce(into: Set<Int>()) { $0.formUnion($1) }
+        let added = union.subtracting(watchedCoinIds)
+        watchedCoinIds = union
+        
+        // Drop quotes for coins no longer watched by any owner
+        let retained = watchedQuotesSubject.value.filter { union.contains($0.key) }
+        if retained.count != watchedQuotesSubject.value.count {
+            watchedQuotesSubject.send(retained)
+        }
+        
+        guard !currentCoins.isEmpty else { return } // The next cycle will cover them
+        let missing = added.subtracting(refreshedCoinIds).filter { retained[$0] == nil }
+        if !missing.isEmpty {
+            fetchWatchedQuotes(for: missing)
+        }
     }
     
     // MARK: - Private Methods
@@ -137,7 +217,11 @@ final class SharedCoinDataManager: SharedCoinDataManagerProtocol {
             // Price update only - don't show skeleton loading
             print("📊 SharedCoinDataManager: Updating prices for existing coins")
             
-            let coinIds = Array(currentCoins.prefix(200).map { $0.id }) // Update top 200 coins
+            let coinIds = Array(currentCoins.prefix(sharedRefreshLimit).map { $0.id }) // Update top 200 coins
+            refreshedCoinIds = Set(coinIds)
+            
+            // Watched coins outside the top 200 → one batched low-priority request for this cycle
+            fetchWatchedQuotes(for: watchedCoinIds.subtracting(refreshedCoinIds))
             
             coinManager.getQuotes(for: coinIds, convert: "USD", priority: .high).sinkForUI(
                 receiveCompletion: { [weak self] completion in
@@ -150,11 +234,14 @@ final class SharedCoinDataManager: SharedCoinDataManagerProtocol {
                 },
                 receiveValue: { [weak self] updatedQuotes in
                     guard let self = self else { return }
+                    // Root span for this tick; it travels with the update and CoinListVM ends it
+                    let tick = SpanTracer.shared.beginTrace(.priceTick)
                     
                     self.isUpdating = false
                     self.isLoadingSubject.send(false)
                     
                     // Update existing coins with fresh quotes
+                    let merge = SpanTracer.shared.begin(.tickMerge, parent: tick)
                     var updatedCoins = self.currentCoins
                     for i in 0..<updatedCoins.count {
                         let coinId = updatedCoins[i].id
@@ -162,8 +249,16 @@ final class SharedCoinDataManager: SharedCoinDataManagerProtocol {
                             updatedCoins[i].quote?["USD"] = newQuote
                         }
                     }
+                    SpanTracer.shared.end(merge)
                     
-                    self.coinDataSubject.send(updatedCoins)
+                    // Coins back inside the refresh set are priced by the list again
+                    let watchedQuotes = self.watchedQuotesSubject.value
+                    let retained = watchedQuotes.filter { !self.refreshedCoinIds.contains($0.key) }
+                    if retained.count != watchedQuotes.count {
+                        self.watchedQuotesSubject.send(retained)
+                    }
+                    
+                    self.publish(updatedCoins, tick: tick)
                     
                     print("✅ SharedCoinDataManager: Updated prices for \(updatedQuotes.count) coins with FRESH quotes")
                     
@@ -205,10 +300,15 @@ final class SharedCoinDataManager: SharedCoinDataManagerProtocol {
                     self.isUpdating = false
                     self.isLoadingSubject.send(false)
                     self.isFetchingFreshDataSubject.send(false)
-                    self.coinDataSubject.send(coins)
+                    self.rebuildIndex(for: coins)
+                    self.refreshedCoinIds = Set(coins.map { $0.id })
+                    self.publish(coins, tick: nil)
                     
                     print("✅ SharedCoinDataManager: Initial load with \(coins.count) coins")
                     
+                    // Watched coins not in the initial list still need a price for this cycle
+                    self.fetchWatchedQuotes(for: self.watchedCoinIds.subtracting(self.refreshedCoinIds))
+                    
                     // 🖼️ FETCH LOGOS: Start downloading logos for top coins (first 50)
                     let topCoins = Array(coins.prefix(50))
                     let logoIds = topCoins.map { $0.id }
@@ -223,4 +323,61 @@ final class SharedCoinDataManager: SharedCoinDataManagerProtocol {
             )
         }
     }
-} 
+    
+    /// Emits the list to `allCoins` subscribers, then the same list with its tick span to `coinUpdates`
+    private func publish(_ coins: [Coin], tick: SpanTracer.Span?) {
+        coinDataSubject.send(coins)
+        coinUpdateSubject.send(CoinDataUpdate(coins: coins, tick: tick))
+    }
+    
+    private func rebuildIndex(for coins: [Coin]) {
+        var index: [Int: Int] = [:]
+        index.reserveCapacity(coins.count)
+        for (position, coin) in coins.enumerated() where index[coin.id] == nil {
+            index[coin.id] = position
+        }
+        coinIndexById = index
+    }
+    
+    /// Single batched low-priority quote request for watched coins the shared refresh doesn't cover.
+    /// IDs arriving while a batch is in flight are queued and sent as the next batch.
+    private func fetchWatchedQuotes(for ids: Set<Int>) {
+        guard !ids.isEmpty else { return }
+        guard !isFetchingWatchedQuotes else {
+            pendingWatchedCoinIds.formUnion(ids)
+            return
+        }
+        isFetchingWatchedQuotes = true
+        
+        coinManager.getQuotes(for: ids.sorted(), convert: "USD", priority: .low).sinkForUI(
+            receiveCompletion: { [weak self] completion in
+                guard let self = self else { return }
+                self.isFetchingWatchedQuotes = false
+                if case .failure(let error) = completion {
+                    AppLogger.price("SharedCoinDataManager: Watched quote fetch failed - \(error.localizedDescription)", level: .warning)
+                }
+                
+                // Queued coins that are still watched and weren't part of this batch
+                let next = self.pendingWatchedCoinIds
+                    .intersection(self.watchedCoinIds)
+                    .subtracting(self.refreshedCoinIds)
+                    .subtracting(ids)
+                self.pendingWatchedCoinIds.removeAll()
+                self.fetchWatchedQuotes(for: next)
+            },
+            receiveValue: { [weak self] quotes in
+                guard let self = self else { return }
+                self.isFetchingWatchedQuotes = false
+                
+                // Only keep quotes for coins that are still watched
+                var merged = self.watchedQuotesSubject.value.filter { self.watchedCoinIds.contains($0.key) }
+                for (id, quote) in quotes where self.watchedCoinIds.contains(id) {
+                    merged[id] = quote
+                }
+                self.watchedQuotesSubject.send(merged)
+                AppLogger.price("SharedCoinDataManager: Updated \(quotes.count) watched coins outside the shared refresh set")
+            },
+            storeIn: &cancellables
+        )
+    }
+}
@@ -113,6 +113,7 @@ final class WatchlistManager: ObservableObject, WatchlistManagerProtocol {
             self.syncQueue.async(flags: .barrier) {
                 self.localWatchlistItems = sortedItems
                 self.localWatchlistCoinIds = Set(sortedItems.map { $0.coinId })
+                Metrics.watchlistSize.set(sortedItems.count)
                 self.isInitialized = true
             }
             
@@ -156,7 +157,7 @@ final class WatchlistManager: ObservableObject, WatchlistManagerProtocol {
         }
         
         operationCount += 1
-        let _ = operationCount
+        Metrics.watchlistOperations.increment()
         
         #if DEBUG
         print("➕ Adding \(coin.symbol) to watchlist")
@@ -238,7 +239,7 @@ final class WatchlistManager: ObservableObject, WatchlistManagerProtocol {
         }
         
         operationCount += 1
-        let _ = operationCount
+        Metrics.watchlistOperations.increment()
         
         #if DEBUG
         let coinToRemove = localWatchlistItems.first { $0.coinId == coinId }
@@ -549,6 +550,7 @@ final class WatchlistManager: ObservableObject, WatchlistManagerProtocol {
             self.syncQueue.async(flags: .barrier) {
                 self.localWatchlistItems = sortedItems
                 self.localWatchlistCoinIds = Set(sortedItems.map { $0.coinId })
+                Metrics.watchlistSize.set(sortedItems.count)
             }
             
             DispatchQueue.main.async {
@@ -739,7 +741,7 @@ final class WatchlistManager: ObservableObject, WatchlistManagerProtocol {
                     ("\($0.symbol ?? "?") (\($0.name ?? "Unknown"))", "ID: \($0.coinId)")
                 }
                 AppLogger.databaseTable("Watchlist Manager State - \(items.count) items", items: tableData)
-                AppLogger.performance("Operations: \(self.operationCount) | Cache: \(self.localWatchlistItems.count) items | Hit rate: ~100%")
+                AppLogger.performance("Operations: \(self.operationCount) | Cache: \(self.localWatchlistItems.count) items")
             }
         }
     }
@@ -748,14 +750,12 @@ final class WatchlistManager: ObservableObject, WatchlistManagerProtocol {
         return "📊 Watchlist: \(getWatchlistCount()) items (Optimized)"
     }
     
+    /// Measured state only; app-wide counters are exported through MetricsRegistry
     func getPerformanceMetrics() -> [String: Any] {
         return [
             "operationCount": operationCount,
-            "cacheSize": localWatchlistItems.count,
-            "isInitialized": isInitialized,
-            "lookupComplexity": "O(1)",
-            "backgroundOperations": true,
-            "batchSupport": true
+            "cacheSize": syncQueue.sync { localWatchlistItems.count },
+            "isInitialized": isInitialized
         ]
     }
 }
@@ -0,0 +1,209 @@
+//
+//  ChartModel.swift
+//  CryptoApp
+//
+
+import Foundation
+
+/**
+ * CHART MODEL
+ *
+ * Immutable, render-ready chart data for one (coin, range, timeframe, indicator settings):
+ * - Line series with its synthesized dates and price bounds
+ * - Candle series with dates, closes and price bounds
+ * - Index-aligned SMA/EMA/RSI buffers for the enabled indicators, over the line points
+ *   and over the candle closes
+ * - Per-candle pattern masks for chart annotations
+ * - Volume values, bar directions and volume analysis for the volume pane
+ *
+ * Built once off the main thread by CoinDetailsVM and shared by the portrait chart cell,
+ * the landscape chart and the volume pane, so rotating or toggling the volume pane
+ * re-renders from the same arrays instead of recomputing them per view. Views handed raw
+ * series (`update(_:range:)`) build their own model on `buildQueue`.
+ *
+ * NOTE: Views that patch their series in place (live appends) stop using the model's
+ * derived values until the next model arrives.
+ */
+final class ChartModel {
+
+    // MARK: - Types
+
+    /// Which series an indicator buffer is computed over
+    enum Series {
+        case line
+        case candles
+    }
+
+    struct Key: Equatable {
+        let coinID: Int
+        let range: String
+        let timeframe: OHLCTimeframe
+        let settings: TechnicalIndicators.IndicatorSettings
+    }
+
+    /// Min/max of a price series (non-finite values ignored)
+    struct PriceBounds: Equatable {
+        let min: Double
+        let max: Double
+
+        init(min: Double, max: Double) {
+            self.min = min
+            self.max = max
+        }
+
+        init?<S: Sequence>(lows: S, highs: S) where S.Element == Double {
+            var low = Double.infinity
+            var high = -Double.infinity
+            for value in lows where value.isFinite { low = Swift.min(low, value) }
+            for value in highs where value.isFinite { high = Swift.max(high, value) }
+            guard low <= high else { return nil }
+            self.init(min: low, max: high)
+        }
+
+        /// Bounds widened to include a new low/high (live updates)
+        func including(low: Double, high: Double) -> PriceBounds {
+            PriceBounds(min: low.isFinite ? Swift.min(min, low) : min,
+                        max: high.isFinite ? Swift.max(max, high) : max)
+        }
+    }
+
+    /// Background queue for models built by the views themselves
+    static let buildQueue = DispatchQueue(label: "chart.model.build", qos: .userInitiated)
+
+    // MARK: - Properties
+
+    let key: Key
+    /// Bumped by the producer whenever the line / candle input series changes
+    let pointsRevision: Int
+    let ohlcRevision: Int
+
+    // Line chart
+    let points: [Double]
+    let lineDates: [Date]
+    let lineBounds: PriceBounds?
+    let lineSMA: TechnicalIndicators.IndicatorBuffer?
+    let lineEMA: TechnicalIndicators.IndicatorBuffer?
+    let lineRSI: TechnicalIndicators.IndicatorBuffer?
+
+    // Candlestick chart
+    let ohlc: [OHLCData]
+    let candleDates: [Date]
+    let closes: [Double]
+    let candleBounds: PriceBounds?
+    let sma: TechnicalIndicators.IndicatorBuffer?
+    let ema: TechnicalIndicators.IndicatorBuffer?
+    let rsi: TechnicalIndicators.IndicatorBuffer?
+    let patterns: [CandlePattern]
+
+    // Volume pane
+    let volumes: [Double]
+    let volumeIsBullish: [Bool]
+    let volumeAnalysis: TechnicalIndicators.VolumeAnalysis?
+
+    // MARK: - Initialization
+
+    /// Does all the preparation work; call off the main thread for full-size series
+    init(key: Key,
+         points: [Double],
+         ohlc: [OHLCData],
+         pointsRevision: Int = 0,
+         ohlcRevision: Int = 0,
+         now: Date = Date()) {
+        self.key = key
+        self.pointsRevision = pointsRevision
+        self.ohlcRevision = ohlcRevision
+
+        self.points = points
+        self.lineDates = ChartModel.lineDates(count: points.count, range: key.range, end: now)
+        self.lineBounds = PriceBounds(lows: points, highs: points)
+        let settings = key.settings
+        (self.lineSMA, self.lineEMA, self.lineRSI) = ChartModel.indicatorBuffers(over: points, settings: settings)
+
+        self.ohlc = ohlc
+        self.candleDates = ohlc.map { $0.timestamp }
+        let closes = ohlc.map { $0.close }
+        self.closes = closes
+        self.candleBounds = PriceBounds(lows: ohlc.lazy.map { Swift.min($0.low, $0.open, $0.close) },
+                                        highs: ohlc.lazy.map { Swift.max($0.high, $0.open, $0.close) })
+
+        (self.sma, self.ema, self.rsi) = ChartModel.indicatorBuffers(over: closes, settings: settings)
+
+        self.patterns = CandlePatternScanner.scan(ohlc)
+
+        let volumes = ohlc.map { $0.volume ?? 0.0 }
+        self.volumes = volumes
+        self.volumeIsBullish = ohlc.map { $0.isBullish }
+        self.volumeAnalysis = volumes.isEmpty ? nil : TechnicalIndicators.analyzeVolume(volumes: volumes)
+    }
+
+    /// Model for a single series (direct `update(_:range:)` callers); build it on `buildQueue`
+    convenience init(points: [Double] = [],
+                     ohlc: [OHLCData] = [],
+                     range: String,
+                     settings: TechnicalIndicators.IndicatorSettings = TechnicalIndicators.IndicatorSettings()) {
+        self.init(key: Key(coinID: 0, range: range, timeframe: .native, settings: settings),
+                  points: points,
+                  ohlc: ohlc)
+    }
+
+    private static func indicatorBuffers(
+        over prices: [Double],
+        settings: TechnicalIndicators.IndicatorSettings
+    ) -> (TechnicalIndicators.IndicatorBuffer?, TechnicalIndicators.IndicatorBuffer?, TechnicalIndicators.IndicatorBuffer?) {
+        let sma = settings.showSMA && !prices.isEmpty
+            ? TechnicalIndicators.IndicatorBuffer(TechnicalIndicators.calculateSMA(prices: prices, period: settings.smaPeriod))
+            : nil
+        let ema = settings.showEMA && !prices.isEmpty
+            ? TechnicalIndicators.IndicatorBuffer(TechnicalIndicators.calculateEMA(prices: prices, period: settings.emaPeriod))
+            : nil
+        let rsi = settings.showRSI && prices.count > settings.rsiPeriod
+            ? TechnicalIndicators.IndicatorBuffer(TechnicalIndicators.calculateRSI(prices: prices, period: settings.rsiPeriod,
+                                                                                  overbought: settings.rsiOverbought,
+                                                                                  oversold: settings.rsiOversold))
+            : nil
+        return (sma, ema, rsi)
+    }
+
+    // MARK: - Indicator Access
+
+    /// Prepared buffers when they match the requested settings, otherwise nil (caller computes)
+    func smaBuffer(for settings: TechnicalIndicators.IndicatorSettings, series: Series = .candles) -> TechnicalIndicators.IndicatorBuffer? {
+        guard let sma = series == .line ? lineSMA : sma, sma.period == settings.smaPeriod else { return nil }
+        return sma
+    }
+
+    func emaBuffer(for settings: TechnicalIndicators.IndicatorSettings, series: Series = .candles) -> TechnicalIndicators.IndicatorBuffer? {
+        guard let ema = series == .line ? lineEMA : ema, ema.period == settings.emaPeriod else { return nil }
+        return ema
+    }
+
+    func rsiBuffer(for settings: TechnicalIndicators.IndicatorSettings, series: Series = .candles) -> TechnicalIndicators.IndicatorBuffer? {
+        // Overbought/oversold levels only affect drawing, not the values
+        guard let rsi = series == .line ? lineRSI : rsi, rsi.period == settings.rsiPeriod else { return nil }
+        return rsi
+    }
+
+    // MARK: - Date Synthesis
+
+    /**
+     * Evenly spaced dates ending at `end` for a line series of `count` points.
+     * The market_chart endpoint only returns prices here, so dates are spread over the range.
+     */
+    static func lineDates(count: Int, range: String, end: Date) -> [Date] {
+        let timeInterval: TimeInterval = range == "24h" ? 86400 :
+                                         range == "7d" ? 604800 :
+                                         range == "30d" ? 2592000 : 31536000
+        let start = end.addingTimeInterval(-timeInterval)
+
+        // Guard against single-point datasets to avoid division by zero which
+        // results in NaN timestamps and an invisible chart.
+        guard count >= 2 else {
+            return count == 0 ? [] : [start, end]
+        }
+
+        let step = timeInterval / Double(count - 1)
+        return (0..<count).map { i in
+            start.addingTimeInterval(Double(i) * step)
+        }
+    }
+}
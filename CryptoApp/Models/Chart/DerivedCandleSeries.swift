@@ -0,0 +1,363 @@
+//
+//  DerivedCandleSeries.swift
+//  CryptoApp
+//
+
+import Foundation
+import Accelerate
+
+// MARK: - Candle Series Mode
+
+/// How the candlestick chart presents its candles
+enum CandleSeriesMode: String, CaseIterable {
+    case standard
+    case heikinAshi
+    case logarithmic
+    case percentFromStart
+
+    static let userDefaultsKey = "ChartCandleSeriesMode"
+
+    /// Persisted choice from chart settings (standard when unset)
+    static var saved: CandleSeriesMode {
+        UserDefaults.standard.string(forKey: userDefaultsKey).flatMap(CandleSeriesMode.init(rawValue:)) ?? .standard
+    }
+
+    var displayName: String {
+        switch self {
+        case .standard: return "Standard"
+        case .heikinAshi: return "Heikin-Ashi"
+        case .logarithmic: return "Log"
+        case .percentFromStart: return "% Change"
+        }
+    }
+
+    /// Log and percent values can go below zero, so the axis must not clamp at 0
+    var allowsNegativeValues: Bool {
+        self == .logarithmic || self == .percentFromStart
+    }
+
+    /// Pattern masks describe the raw candle shapes; Heikin-Ashi candles are synthetic
+    var showsPatternAnnotations: Bool {
+        self != .heikinAshi
+    }
+}
+
+// MARK: - Derived Candle Series
+
+/**
+ * DERIVED CANDLE SERIES
+ *
+ * Columnar base candle series plus lazily built views of it for each CandleSeriesMode:
+ * - Heikin-Ashi: averaged candles (closes vectorised, opens in one recurrence pass)
+ * - Logarithmic: log10 of every price, so equal ratios get equal heights
+ * - Percent-from-start: change relative to the first candle's open
+ *
+ * Performance:
+ * - A view is only built the first time its mode is shown, then cached for the current base
+ *   version; switching modes back and forth never recomputes or refetches anything
+ * - Appending or replacing the last candle patches every cached view in O(1) (Heikin-Ashi
+ *   only needs the previous derived candle) instead of invalidating it
+ * - Views whose reference changed (percent base on the first candle) are dropped and rebuilt
+ *   lazily on next access
+ *
+ * NOTE: Main-thread only, owned by the chart view that renders it.
+ */
+final class DerivedCandleSeries {
+
+    // MARK: - Types
+
+    struct Columns {
+        private(set) var opens: [Double] = []
+        private(set) var highs: [Double] = []
+        private(set) var lows: [Double] = []
+        private(set) var closes: [Double] = []
+
+        var count: Int { closes.count }
+        var isEmpty: Bool { closes.isEmpty }
+
+        init() {}
+
+        init<C: Collection>(_ candles: C) where C.Element == OHLCData {
+            opens = candles.map { $0.open }
+            highs = candles.map { $0.high }
+            lows = candles.map { $0.low }
+            closes = candles.map { $0.close }
+        }
+
+        init(opens: [Double], highs: [Double], lows: [Double], closes: [Double]) {
+            self.opens = opens
+            self.highs = highs
+            self.lows = lows
+            self.closes = closes
+        }
+
+        func candle(at index: Int) -> Candle {
+            Candle(open: opens[index], high: highs[index], low: lows[index], close: closes[index])
+        }
+
+        mutating func append(_ candle: Candle) {
+            opens.append(candle.open)
+            highs.append(candle.high)
+            lows.append(candle.low)
+            closes.append(candle.close)
+        }
+
+        mutating func replaceLast(with candle: Candle) {
+            guard let index = closes.indices.last else { return }
+            opens[index] = candle.open
+            highs[index] = candle.high
+            lows[index] = candle.low
+            closes[index] = candle.close
+        }
+    }
+
+    struct Candle: Equatable {
+        let open: Double
+        let high: Double
+        let low: Double
+        let close: Double
+
+        var isFinite: Bool {
+            open.isFinite && high.isFinite && low.isFinite && close.isFinite
+        }
+    }
+
+    private struct CachedView {
+        let version: Int
+        var columns: Columns
+        var bounds: ChartModel.PriceBounds?
+    }
+
+    // MARK: - Properties
+
+    /// Bumped on every base change; cached views are only valid for the version they were built at
+    private(set) var version = 0
+    private(set) var base = Columns()
+    private var baseBounds: ChartModel.PriceBounds?
+    /// Reference price for percent-from-start (first finite, positive open)
+    private(set) var startPrice: Double?
+    private var views: [CandleSeriesMode: CachedView] = [:]
+
+    var count: Int { base.count }
+
+    /// Modes with a view built for the current base (diagnostics and tests)
+    var cachedModes: Set<CandleSeriesMode> {
+        Set(views.filter { $0.value.version == version }.keys)
+    }
+
+    // MARK: - Base Series
+
+    /// Replaces the base series; derived views are rebuilt lazily when next shown
+    func reset<C: Collection>(_ candles: C, bounds: ChartModel.PriceBounds? = nil) where C.Element == OHLCData {
+        version += 1
+        base = Columns(candles)
+        baseBounds = bounds ?? ChartModel.PriceBounds(lows: base.lows, highs: base.highs)
+        startPrice = DerivedCandleSeries.startPrice(in: base)
+        views.removeAll(keepingCapacity: true)
+    }
+
+    func append(_ candle: OHLCData) {
+        let value = Candle(candle)
+        base.append(value)
+        patchViews(with: value, at: base.count - 1, appended: true)
+    }
+
+    func replaceLast(_ candle: OHLCData) {
+        guard !base.isEmpty else { return }
+        let value = Candle(candle)
+        base.replaceLast(with: value)
+        patchViews(with: value, at: base.count - 1, appended: false)
+    }
+
+    // MARK: - Views
+
+    /// Columns for `mode`, building and caching the view on first access
+    func columns(for mode: CandleSeriesMode) -> Columns {
+        guard mode != .standard else { return base }
+        return view(for: mode).columns
+    }
+
+    /// Min/max of the displayed lows/highs for `mode`
+    func bounds(for mode: CandleSeriesMode) -> ChartModel.PriceBounds? {
+        guard mode != .standard else { return baseBounds }
+        return view(for: mode).bounds
+    }
+
+    /// Maps a raw price (indicator value, current price) into `mode`'s value space
+    func displayValue(forPrice price: Double, mode: CandleSeriesMode) -> Double {
+        switch mode {
+        case .standard, .heikinAshi:
+            return price
+        case .logarithmic:
+            return price > 0 ? log10(price) : .nan
+        case .percentFromStart:
+            guard let start = startPrice else { return .nan }
+            return (price / start - 1) * 100
+        }
+    }
+
+    /// Inverse of `displayValue(forPrice:mode:)`, for axis labels and tooltips
+    func price(forDisplayValue value: Double, mode: CandleSeriesMode) -> Double {
+        switch mode {
+        case .standard, .heikinAshi:
+            return value
+        case .logarithmic:
+            return pow(10, value)
+        case .percentFromStart:
+            guard let start = startPrice else { return .nan }
+            return start * (1 + value / 100)
+        }
+    }
+
+    private func view(for mode: CandleSeriesMode) -> CachedView {
+        if let cached = views[mode], cached.version == version {
+            return cached
+        }
+        let columns = DerivedCandleSeries.derive(base, mode: mode, startPrice: startPrice)
+        let view = CachedView(version: version,
+                              columns: columns,
+                              bounds: ChartModel.PriceBounds(lows: columns.lows, highs: columns.highs))
+        views[mode] = view
+        return view
+    }
+
+    // MARK: - Incremental Updates
+
+    private func patchViews(with candle: Candle, at index: Int, appended: Bool) {
+        let previousVersion = version
+        version += 1
+        baseBounds = DerivedCandleSeries.widen(baseBounds, with: candle)
+
+        let start = DerivedCandleSeries.startPrice(in: base)
+        let startChanged = start != startPrice
+        startPrice = start
+
+        for mode in Array(views.keys) {
+            // Take the view out of the dictionary so its arrays are uniquely referenced (no copy on write)
+            guard var view = views.removeValue(forKey: mode), view.version == previousVersion else { continue }
+            if mode == .percentFromStart && startChanged { continue }
+
+            let derived = DerivedCandleSeries.derivedCandle(candle, at: index, mode: mode, previous: view.columns,
+                                                            startPrice: start)
+            if appended {
+                view.columns.append(derived)
+            } else {
+                view.columns.replaceLast(with: derived)
+            }
+            views[mode] = CachedView(version: version,
+                                     columns: view.columns,
+                                     bounds: DerivedCandleSeries.widen(view.bounds, with: derived))
+        }
+    }
+
+    // MARK: - Transforms
+
+    static func derive(_ base: Columns, mode: CandleSeriesMode, startPrice: Double?) -> Columns {
+        guard !base.isEmpty else { return Columns() }
+        switch mode {
+        case .standard:
+            return base
+        case .heikinAshi:
+            return heikinAshi(base)
+        case .logarithmic:
+            return Columns(opens: logColumn(base.opens), highs: logColumn(base.highs),
+                           lows: logColumn(base.lows), closes: logColumn(base.closes))
+        case .percentFromStart:
+            guard let start = startPrice else {
+                let empty = [Double](repeating: .nan, count: base.count)
+                return Columns(opens: empty, highs: empty, lows: empty, closes: empty)
+            }
+            // (price / start - 1) × 100 as one multiply-add per column
+            let scale = 100 / start
+            func percent(_ column: [Double]) -> [Double] { vDSP.add(-100, vDSP.multiply(scale, column)) }
+            return Columns(opens: percent(base.opens), highs: percent(base.highs),
+                           lows: percent(base.lows), closes: percent(base.closes))
+        }
+    }
+
+    /**
+     * Heikin-Ashi candles:
+     * - close = (open + high + low + close) / 4
+     * - open = (previous HA open + previous HA close) / 2, seeded with (open + close) / 2
+     * - high/low = extremes of the raw high/low and the HA open/close
+     */
+    static func heikinAshi(_ base: Columns) -> Columns {
+        let count = base.count
+        guard count > 0 else { return Columns() }
+
+        let closes = vDSP.multiply(0.25, vDSP.add(vDSP.add(base.opens, base.highs), vDSP.add(base.lows, base.closes)))
+
+        // Each open depends on the previous HA candle, so this part is one sequential pass
+        var opens = [Double](repeating: .nan, count: count)
+        for index in 0..<count {
+            opens[index] = heikinAshiOpen(open: base.opens[index], close: base.closes[index],
+                                          previousOpen: index > 0 ? opens[index - 1] : nil,
+                                          previousClose: index > 0 ? closes[index - 1] : nil)
+        }
+
+        let highs = vDSP.maximum(base.highs, vDSP.maximum(opens, closes))
+        let lows = vDSP.minimum(base.lows, vDSP.minimum(opens, closes))
+        return Columns(opens: opens, highs: highs, lows: lows, closes: closes)
+    }
+
+    /// One derived candle from its raw candle and the view's previous candle (O(1))
+    static func derivedCandle(_ candle: Candle, at index: Int, mode: CandleSeriesMode,
+                              previous view: Columns, startPrice: Double?) -> Candle {
+        switch mode {
+        case .standard:
+            return candle
+        case .heikinAshi:
+            let hasPrevious = index > 0 && index - 1 < view.count
+            let close = (candle.open + candle.high + candle.low + candle.close) / 4
+            let open = heikinAshiOpen(open: candle.open, close: candle.close,
+                                      previousOpen: hasPrevious ? view.opens[index - 1] : nil,
+                                      previousClose: hasPrevious ? view.closes[index - 1] : nil)
+            return Candle(open: open,
+                          high: Swift.max(candle.high, open, close),
+                          low: Swift.min(candle.low, open, close),
+                          close: close)
+        case .logarithmic:
+            func log(_ value: Double) -> Double { value > 0 ? Foundation.log10(value) : .nan }
+            return Candle(open: log(candle.open), high: log(candle.high), low: log(candle.low), close: log(candle.close))
+        case .percentFromStart:
+            guard let start = startPrice else { return Candle(open: .nan, high: .nan, low: .nan, close: .nan) }
+            func percent(_ value: Double) -> Double { (value / start - 1) * 100 }
+            return Candle(open: percent(candle.open), high: percent(candle.high),
+                          low: percent(candle.low), close: percent(candle.close))
+        }
+    }
+
+    private static func heikinAshiOpen(open: Double, close: Double, previousOpen: Double?, previousClose: Double?) -> Double {
+        // A NaN candle would otherwise poison every later open through the recurrence
+        if let previousOpen = previousOpen, let previousClose = previousClose,
+           previousOpen.isFinite, previousClose.isFinite {
+            return (previousOpen + previousClose) / 2
+        }
+        return (open + close) / 2
+    }
+
+    /// Element-wise log10; non-positive prices become NaN (skipped when drawing)
+    private static func logColumn(_ column: [Double]) -> [Double] {
+        let positive = column.map { $0 > 0 ? $0 : .nan }
+        return vForce.log10(positive)
+    }
+
+    private static func startPrice(in base: Columns) -> Double? {
+        base.opens.first { $0.isFinite && $0 > 0 }
+    }
+
+    private static func widen(_ bounds: ChartModel.PriceBounds?, with candle: Candle) -> ChartModel.PriceBounds? {
+        guard let bounds = bounds else {
+            return ChartModel.PriceBounds(lows: [candle.low], highs: [candle.high])
+        }
+        return bounds.including(low: candle.low, high: candle.high)
+    }
+}
+
+// MARK: - OHLCData Conversion
+
+private extension DerivedCandleSeries.Candle {
+    init(_ candle: OHLCData) {
+        self.init(open: candle.open, high: candle.high, low: candle.low, close: candle.close)
+    }
+}
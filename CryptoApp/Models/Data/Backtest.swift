@@ -0,0 +1,67 @@
+//
+//  Backtest.swift
+//  CryptoApp
+//
+
+import Foundation
+
+// MARK: - Backtest Strategy
+
+/// Long-only rule evaluated at each bar close; positions apply from the next bar
+enum BacktestStrategy: Hashable {
+    /// Long while the fast SMA is above the slow SMA
+    case smaCrossover(fast: Int, slow: Int)
+    /// Enter when RSI drops below `oversold`, exit when it rises above `overbought`
+    case rsiMeanReversion(period: Int, oversold: Double, overbought: Double)
+    /// Enter on a close above the prior `lookback` highs, exit on a close below the prior lows
+    case breakout(lookback: Int)
+
+    /// Every fast < slow combination from the two period lists
+    static func smaCrossoverGrid(fast: [Int], slow: [Int]) -> [BacktestStrategy] {
+        fast.flatMap { f in slow.filter { $0 > f }.map { .smaCrossover(fast: f, slow: $0) } }
+    }
+}
+
+// MARK: - Backtest Configuration
+
+struct BacktestConfiguration {
+    /// Fee charged on every position change as a fraction of equity (0.001 = 0.1%)
+    var feeRate: Double = 0.001
+    /// Bars per year used to annualise the Sharpe ratio (8760 for hourly)
+    var periodsPerYear: Double = 8760
+}
+
+// MARK: - Backtest Results
+
+struct BacktestTrade: Equatable {
+    let entryIndex: Int
+    let exitIndex: Int
+    let entryPrice: Double
+    let exitPrice: Double
+
+    var returnPercent: Double { (exitPrice / entryPrice - 1) * 100 }
+    var isWin: Bool { exitPrice > entryPrice }
+}
+
+/// Scalar metrics only — what parameter sweeps return so no per-bar arrays are allocated
+struct BacktestSummary {
+    let strategy: BacktestStrategy
+    /// Final equity / initial equity - 1
+    let totalReturn: Double
+    /// Largest peak-to-trough decline as a positive fraction (0.25 = 25%)
+    let maxDrawdown: Double
+    /// Annualised Sharpe ratio of per-bar strategy returns (risk-free rate 0)
+    let sharpe: Double
+    let tradeCount: Int
+    /// Fraction of closed trades that were profitable
+    let winRate: Double
+}
+
+struct BacktestResult {
+    let summary: BacktestSummary
+    /// Equity per bar starting at 1.0
+    let equityCurve: [Double]
+    /// Drawdown per bar as a non-positive fraction of the running peak
+    let drawdown: [Double]
+    let trades: [BacktestTrade]
+}
@@ -193,7 +193,10 @@ extension Coin {
     
     var sparklineData: [Double] {
         // Generate sample sparkline data based on the 24h percentage change
-        return SparklineView.generateSampleData(for: percentChange24hValue, points: 20)
+        // Seeded by coin and change so the series (and its cached geometry) is stable until the change moves
+        let change = percentChange24hValue
+        let seed = UInt64(bitPattern: Int64(id)) ^ change.bitPattern
+        return SparklineView.generateSampleData(for: change, points: 20, seed: seed)
     }
 
     var marketSupplyString: String {
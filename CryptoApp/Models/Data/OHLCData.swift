@@ -8,7 +8,7 @@
 import Foundation
 
 // MARK: - OHLC Data Model for Candlestick Charts
-struct OHLCData {
+struct OHLCData: Codable {
     let timestamp: Date
     let open: Double
     let high: Double
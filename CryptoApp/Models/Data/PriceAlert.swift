@@ -0,0 +1,148 @@
+//
+//  PriceAlert.swift
+//  CryptoApp
+//
+
+import Foundation
+
+// MARK: - Price Alert Rule
+
+/// A user-defined alert evaluated against every shared price update
+struct PriceAlertRule: Codable, Equatable {
+
+    enum Condition: Codable, Equatable {
+        /// Price crosses upward through the given USD level
+        case priceAbove(Double)
+        /// Price crosses downward through the given USD level
+        case priceBelow(Double)
+        /// Absolute 24h change moves beyond the given percentage (e.g. 10 = ±10%)
+        case percentChange24hBeyond(Double)
+        /// RSI over live ticks rises above the given level
+        case rsiAbove(Double, period: Int)
+        /// RSI over live ticks falls below the given level
+        case rsiBelow(Double, period: Int)
+        /// Fast SMA crosses the slow SMA in either direction
+        case smaCrossover(fast: Int, slow: Int)
+    }
+
+    let id: UUID
+    let coinId: Int
+    /// CoinGecko ID of the coin, used to warm up indicator rules from cached chart data
+    let geckoID: String?
+    let condition: Condition
+    /// Fraction the value must retreat past the threshold before the rule re-arms (0.01 = 1%)
+    var hysteresis: Double
+    /// Minimum time between two notifications for the same rule
+    var cooldown: TimeInterval
+    var isEnabled: Bool
+
+    init(
+        id: UUID = UUID(),
+        coinId: Int,
+        geckoID: String? = nil,
+        condition: Condition,
+        hysteresis: Double = 0.01,
+        cooldown: TimeInterval = 300,
+        isEnabled: Bool = true
+    ) {
+        self.id = id
+        self.coinId = coinId
+        self.geckoID = geckoID
+        self.condition = condition
+        self.hysteresis = max(0, hysteresis)
+        self.cooldown = max(0, cooldown)
+        self.isEnabled = isEnabled
+    }
+}
+
+// MARK: - Price Alert Event
+
+/// Emitted once per rule each time its condition is newly met
+struct PriceAlertEvent: Equatable {
+
+    enum Direction: Equatable {
+        case up
+        case down
+    }
+
+    let ruleId: UUID
+    let coinId: Int
+    let condition: PriceAlertRule.Condition
+    let direction: Direction
+    /// Observed value that triggered the rule (price, % change, RSI or fast-slow SMA spread)
+    let value: Double
+    /// Latest price of the coin when the rule fired
+    let price: Double
+    let timestamp: Date
+}
+
+// MARK: - Price Tick
+
+/// Minimal per-coin snapshot consumed by the alert engine
+struct PriceTick {
+    let coinId: Int
+    let price: Double
+    let percentChange24h: Double?
+}
+
+extension PriceTick {
+    /// Builds an alert tick from a USD quote, nil when no price is available
+    init?(coinId: Int, quote: Quote) {
+        guard let price = quote.price, price.isFinite else { return nil }
+        self.init(coinId: coinId, price: price, percentChange24h: quote.percentChange24h)
+    }
+}
+
+extension Coin {
+    /// Builds an alert tick from the USD quote, nil when no price is available
+    var priceTick: PriceTick? {
+        quote?["USD"].flatMap { PriceTick(coinId: id, quote: $0) }
+    }
+}
+
+// MARK: - Indicator Warm-up
+
+extension PriceAlertRule.Condition {
+    /// Closes an indicator rule needs before it produces a value, nil for plain threshold rules
+    var warmUpLength: Int? {
+        switch self {
+        case .priceAbove, .priceBelow, .percentChange24hBeyond:
+            return nil
+        case .rsiAbove(_, let period), .rsiBelow(_, let period):
+            return period + 1
+        case .smaCrossover(let fast, let slow):
+            return max(fast, slow)
+        }
+    }
+}
+
+// MARK: - Display
+
+extension PriceAlertRule.Condition {
+    /// Short user-facing description ("Price above $65,000.00")
+    var displayText: String {
+        switch self {
+        case .priceAbove(let level):
+            return "Price above \(Self.formatPrice(level))"
+        case .priceBelow(let level):
+            return "Price below \(Self.formatPrice(level))"
+        case .percentChange24hBeyond(let percent):
+            return String(format: "24h change beyond ±%.1f%%", percent)
+        case .rsiAbove(let level, let period):
+            return String(format: "RSI(%d) above %.0f", period, level)
+        case .rsiBelow(let level, let period):
+            return String(format: "RSI(%d) below %.0f", period, level)
+        case .smaCrossover(let fast, let slow):
+            return "SMA(\(fast)) crosses SMA(\(slow))"
+        }
+    }
+
+    static func formatPrice(_ value: Double) -> String {
+        let formatter = NumberFormatter()
+        formatter.numberStyle = .currency
+        formatter.currencyCode = "USD"
+        formatter.locale = Locale(identifier: "en_US")
+        formatter.maximumFractionDigits = value < 1 ? 6 : 2
+        return formatter.string(from: NSNumber(value: value)) ?? String(format: "$%.2f", value)
+    }
+}
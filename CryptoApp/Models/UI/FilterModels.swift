@@ -83,11 +83,68 @@ enum TopCoinsFilter: Int, CaseIterable {
     }
 }
 
+// MARK: - Candle Pattern Filter Types
+
+enum PatternFilter: String, CaseIterable {
+    case off = "off"
+    case anyPattern = "any"
+    case bullish = "bullish"
+    case bearish = "bearish"
+    case doji = "doji"
+    
+    var displayName: String {
+        switch self {
+        case .off:
+            return "All Coins"
+        case .anyPattern:
+            return "Any Pattern Found"
+        case .bullish:
+            return "Bullish (Hammer, Engulfing, Morning Star)"
+        case .bearish:
+            return "Bearish (Engulfing, Evening Star)"
+        case .doji:
+            return "Doji"
+        }
+    }
+    
+    var shortDisplayName: String {
+        switch self {
+        case .off:
+            return "Patterns"
+        case .anyPattern:
+            return "Any"
+        case .bullish:
+            return "Bullish"
+        case .bearish:
+            return "Bearish"
+        case .doji:
+            return "Doji"
+        }
+    }
+    
+    /// Patterns a coin must show (any of) to pass; empty = no filtering
+    var patterns: CandlePattern {
+        switch self {
+        case .off:
+            return []
+        case .anyPattern:
+            return .all
+        case .bullish:
+            return .bullish
+        case .bearish:
+            return .bearish
+        case .doji:
+            return .doji
+        }
+    }
+}
+
 // MARK: - Combined Filter State
 
 struct FilterState: Equatable {
     let priceChangeFilter: PriceChangeFilter
     let topCoinsFilter: TopCoinsFilter
+    var patternFilter: PatternFilter = .off
     
     // Default state matching CoinMarketCap defaults
     static let defaultState = FilterState(
@@ -109,6 +166,13 @@ struct FilterState: Equatable {
             subtitle: ""
         )
     }
+    
+    var patternDisplayText: (title: String, subtitle: String) {
+        return (
+            title: patternFilter.shortDisplayName,
+            subtitle: ""
+        )
+    }
 }
 
 // MARK: - Popular Coins Filter Types
@@ -173,11 +237,21 @@ struct TopCoinsFilterOption: FilterOption {
     }
 }
 
+struct PatternFilterOption: FilterOption {
+    let filter: PatternFilter
+    var isSelected: Bool
+    
+    var displayName: String {
+        return filter.displayName
+    }
+}
+
 // MARK: - Filter Type Enum
 
 enum FilterType {
     case priceChange
     case topCoins
+    case patterns
     
     var title: String {
         switch self {
@@ -185,6 +259,8 @@ enum FilterType {
             return "Price Change Period"
         case .topCoins:
             return "Number of Coins"
+        case .patterns:
+            return "Candle Pattern Found"
         }
     }
 } 
@@ -32,6 +32,12 @@ class AppDelegate: UIResponder, UIApplicationDelegate {
         _ = Dependencies.container.sharedCoinDataManager()
         AppLogger.ui("AppDelegate: SharedCoinDataManager started at app launch")
         
+        // 🔔 START PRICE ALERTS: Rules are evaluated on every shared update, even before any alert screen opens
+        PriceAlertNotifier.shared.startMonitoring(
+            alertManager: Dependencies.container.priceAlertManager(),
+            sharedCoinDataManager: Dependencies.container.sharedCoinDataManager()
+        )
+        
         #if DEBUG
         AppLogger.ui("CryptoApp launched in DEBUG mode with Dependency Injection")
         #endif
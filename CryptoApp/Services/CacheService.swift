@@ -6,6 +6,8 @@ import UIKit
 // This is centralized, thread-safe memory cache that stores: Coin lists, Coin logos, Price updates, Chart data
 // Uses NSCache under the hood and supports:
 // Expiration (via TTL: Time To Live) , Memory pressure handling, Type-safe generic access, Thread-safe reads/writes using GCD (DispatchQueue)
+// Under memory pressure entries go by refetch cost (cheap → expensive), then recency; expensive series are spilled to disk first
+// and read back asynchronously (restoreSpilledChartData / restoreSpilledOHLCData) before a refetch
 
 // A wrapper for cached values that includes expiration logic and memory size estimation
 struct CacheEntry<T> {
@@ -26,6 +28,96 @@ struct CacheEntry<T> {
     }
 }
 
+// MARK: - Refetch Cost
+
+/// What it takes to get an entry back once it's dropped; memory pressure evicts cheapest first
+enum RefetchCost: Int, Comparable, CustomStringConvertible {
+    /// Short-TTL data rebuilt from disk or one unthrottled call (coin lists, quotes)
+    case cheap = 0
+    /// Logo URL map: one large call for data that rarely changes
+    case medium = 1
+    /// Chart and OHLC series fetched under CoinGecko rate limits
+    case expensive = 2
+
+    init(upTo tier: MemoryPressureTier) {
+        switch tier {
+        case .derived: self = .cheap
+        case .images: self = .medium
+        case .series: self = .expensive
+        }
+    }
+
+    /// Accountant tier that releases entries of this class
+    var pressureTier: MemoryPressureTier {
+        switch self {
+        case .cheap: return .derived
+        case .medium: return .images
+        case .expensive: return .series
+        }
+    }
+
+    static func < (lhs: RefetchCost, rhs: RefetchCost) -> Bool {
+        lhs.rawValue < rhs.rawValue
+    }
+
+    var description: String {
+        switch self {
+        case .cheap: return "cheap"
+        case .medium: return "medium"
+        case .expensive: return "expensive"
+        }
+    }
+}
+
+// MARK: - Cache Box
+
+// NSCache stores objects; the box carries the key, cost and eviction metadata so both NSCache
+// callbacks and the pressure policy can be accounted
+private final class CacheBox {
+    let key: String
+    let entry: Any
+    let memorySize: Int
+    let cost: RefetchCost
+    let expiresAt: Date
+    /// Encodes the entry for a disk spill; only set for expensive entries of spillable types
+    let spill: (() -> Data?)?
+    /// Access tick for LRU order; written lock-free from concurrent reads
+    private let lastAccessCell: UnsafeMutablePointer<Int64>
+
+    init(key: String, entry: Any, memorySize: Int, cost: RefetchCost, expiresAt: Date, spill: (() -> Data?)?, tick: Int64) {
+        self.key = key
+        self.entry = entry
+        self.memorySize = memorySize
+        self.cost = cost
+        self.expiresAt = expiresAt
+        self.spill = spill
+        self.lastAccessCell = UnsafeMutablePointer<Int64>.allocate(capacity: 1)
+        self.lastAccessCell.initialize(to: tick)
+    }
+
+    deinit {
+        lastAccessCell.deallocate()
+    }
+
+    var lastAccess: Int64 {
+        metrics_atomic_load(lastAccessCell)
+    }
+
+    func touch(_ tick: Int64) {
+        metrics_atomic_store(lastAccessCell, tick)
+    }
+
+    func isExpired(at date: Date) -> Bool {
+        expiresAt <= date
+    }
+}
+
+/// On-disk form of a spilled series, keeping its original expiry
+private struct SpilledEntry<T: Codable>: Codable {
+    let expiresAt: Date
+    let data: T
+}
+
 // MARK: - Cache Service
 
 // A centralized caching service for coins, logos, price updates, and chart data
@@ -40,8 +132,27 @@ final class CacheService: NSObject, CacheServiceProtocol {
 
     // Memory limits
     private var currentMemoryUsage: Int = 0
+    /// Live boxes by key (queue-protected), so count and usage reflect what NSCache actually holds
+    private var liveBoxes: [String: CacheBox] = [:]
     private let maxMemoryUsage: Int = 100 * 1024 * 1024 // 100MB max
-    private var memoryPressureObserver: NSObjectProtocol?
+    /// Memory warnings past the derived tier evict down to this many bytes (queue-protected)
+    private var pressureTargetBytes: Int = 4 * 1024 * 1024
+    /// Monotonic tick for LRU order
+    private let accessClock: UnsafeMutablePointer<Int64> = {
+        let cell = UnsafeMutablePointer<Int64>.allocate(capacity: 1)
+        cell.initialize(to: 0)
+        return cell
+    }()
+
+    // Disk spill for expensive entries dropped under pressure (nil directory disables it)
+    let spillDirectory: URL?
+    private let spillQueue = DispatchQueue(label: "cache.spill", qos: .utility)
+    /// Keys with a spill file written or pending (queue-protected)
+    private var spilledKeys: Set<String> = []
+    static var defaultSpillDirectory: URL {
+        FileManager.default.urls(for: .cachesDirectory, in: .userDomainMask)[0]
+            .appendingPathComponent("CacheSpill", isDirectory: true)
+    }
 
     // TTL values (in seconds) - Optimized for crypto data patterns
     static let coinListTTL: TimeInterval = 30           // 30s - Rankings change frequently  
@@ -60,13 +171,19 @@ final class CacheService: NSObject, CacheServiceProtocol {
      * 
      * Internal access allows for:
      * - Testing with fresh instances
-     * - Dependency injection in tests
+     * - Dependency injection in tests (pass `spillDirectory: nil` to keep everything in memory)
      * - Production singleton pattern
      */
-    override init() {
+    init(spillDirectory: URL? = CacheService.defaultSpillDirectory) {
+        self.spillDirectory = spillDirectory
         super.init()
         setupCache()
-        setupMemoryPressureHandling()
+        setupSpillDirectory()
+        MemoryAccountant.shared.register(self) // Memory warnings arrive as tiered releases
+    }
+
+    deinit {
+        accessClock.deallocate()
     }
 
     private func setupCache() {
@@ -75,60 +192,146 @@ final class CacheService: NSObject, CacheServiceProtocol {
         cache.delegate = self
     }
 
-    private func setupMemoryPressureHandling() {
-        memoryPressureObserver = NotificationCenter.default.addObserver(
-            forName: UIApplication.didReceiveMemoryWarningNotification,
-            object: nil,
-            queue: nil
-        ) { [weak self] _ in
-            self?.handleMemoryPressure()
+    private func setupSpillDirectory() {
+        guard let directory = spillDirectory else { return }
+        spillQueue.async {
+            // Spills only outlive their entry within one process; leftovers are stale
+            try? FileManager.default.removeItem(at: directory)
+            try? FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
         }
     }
 
-    private func handleMemoryPressure() {
-                    AppLogger.cache("Memory pressure detected - cleaning cache", level: .warning)
-        queue.async(flags: .barrier) {
-            if self.currentMemoryUsage > self.maxMemoryUsage / 2 {
-                self.cache.removeAllObjects()
-                self.currentMemoryUsage = 0
-                AppLogger.cache("Cleared all cache due to memory pressure")
-            }
+    /// Default refetch cost from the key prefix ("chart_btc_usd_7" → "chart")
+    static func refetchCost(forKey key: String) -> RefetchCost {
+        switch category(forKey: key) {
+        case "chart", "ohlc":
+            return .expensive   // Rate-limited CoinGecko fetches
+        case "logos":
+            return .medium      // Large map, rarely changes
+        default:
+            return .cheap       // Lists and quotes: short TTLs, also persisted on disk
         }
     }
 
+    static func category(forKey key: String) -> String {
+        String(key.prefix { $0 != "_" })
+    }
+
+    // MARK: - Memory Pressure
+
+    /// Bytes that memory warnings past the derived tier leave resident
+    var memoryPressureTarget: Int {
+        get { queue.sync { pressureTargetBytes } }
+        set { queue.async(flags: .barrier) { self.pressureTargetBytes = max(0, newValue) } }
+    }
+
+    /**
+     * Memory-warning response for one accountant tier
+     *
+     * Evicts entries whose refetch cost falls within `tier` (expired entries of any cost go
+     * first), cheapest then least recently used, until usage reaches `memoryPressureTarget`.
+     * The derived tier has no floor: every cheap entry goes. Expensive entries are spilled to
+     * disk before they're dropped and read back on the next miss. Returns the bytes freed.
+     */
+    @discardableResult
+    func handleMemoryPressure(tier: MemoryPressureTier) -> Int {
+        return queue.sync(flags: .barrier) {
+            let target = tier == .derived ? 0 : pressureTargetBytes
+            let evicted = evictLocked(toTarget: target, maxCost: RefetchCost(upTo: tier))
+            if evicted.count > 0 {
+                AppLogger.cache("Memory pressure (\(tier)): dropped \(evicted.count) entries, \(evicted.bytes / 1024) KB", level: .warning)
+            }
+            return evicted.bytes
+        }
+    }
 
+    /**
+     * Eviction policy shared by memory pressure and the byte budget (call inside a barrier)
+     *
+     * Order: expired entries, then by refetch cost (cheap → expensive, none above `maxCost`),
+     * then least recently used. Stops once usage is at or below `targetBytes`.
+     */
+    private func evictLocked(toTarget targetBytes: Int, maxCost: RefetchCost) -> (count: Int, bytes: Int) {
+        guard currentMemoryUsage > targetBytes else { return (0, 0) }
+        let now = Date()
+        let candidates = liveBoxes.values
+            .filter { $0.cost <= maxCost || $0.isExpired(at: now) }
+            .map { box in (box: box, order: (box.isExpired(at: now) ? 0 : 1, box.cost.rawValue, box.lastAccess)) }
+            .sorted { $0.order < $1.order }
+
+        let before = currentMemoryUsage
+        var count = 0
+        for candidate in candidates {
+            guard currentMemoryUsage > targetBytes else { break }
+            let box = candidate.box
+            if !box.isExpired(at: now) {
+                spillLocked(box)
+            }
+            removeLocked(key: box.key)
+            Metrics.cacheEvictions.increment()
+            count += 1
+        }
+        return (count, before - currentMemoryUsage)
+    }
 
     // MARK: - Generic Get/Set Methods
 
     //
     func get<T>(key: String, type: T.Type) -> T? {
-        return queue.sync {
-            guard let entry = cache.object(forKey: NSString(string: key)) as? CacheEntry<T> else {
-                return nil
-            }
+        let entry: CacheEntry<T>? = queue.sync {
+            guard let box = cache.object(forKey: NSString(string: key)) as? CacheBox else { return nil }
+            box.touch(metrics_atomic_add(accessClock, 1) + 1)
+            return box.entry as? CacheEntry<T>
+        }
 
-            if entry.isExpired {
-                cache.removeObject(forKey: NSString(string: key))
-                currentMemoryUsage -= entry.memorySize
-                return nil
-            }
+        guard let entry = entry else {
+            Metrics.cacheMisses.increment()
+            return nil
+        }
 
-            return entry.data
+        if entry.isExpired {
+            // Reads run concurrently; removal needs the barrier
+            Metrics.cacheMisses.increment()
+            Metrics.cacheExpirations.increment()
+            queue.async(flags: .barrier) {
+                self.removeLocked(key: key)
+            }
+            return nil
         }
+
+        Metrics.cacheHits.increment()
+        return entry.data
     }
 
-    func set<T>(key: String, value: T, ttl: TimeInterval) {
+    /// Stores `value`; `cost` defaults to the class implied by the key prefix
+    func set<T>(key: String, value: T, ttl: TimeInterval, cost: RefetchCost? = nil) {
         queue.async(flags: .barrier) {
-            let memorySize = self.calculateMemorySize(for: value)
-
-            if self.currentMemoryUsage + memorySize > self.maxMemoryUsage {
-                self.evictOldestEntries(toFreeBytes: memorySize)
-            }
+            self.insertLocked(key: key, value: value, ttl: ttl, cost: cost)
+        }
+    }
 
-            let entry = CacheEntry(data: value, ttl: ttl, memorySize: memorySize)
-            self.cache.setObject(entry as AnyObject, forKey: NSString(string: key), cost: memorySize)
-            self.currentMemoryUsage += memorySize
+    private func insertLocked<T>(key: String, value: T, ttl: TimeInterval, cost: RefetchCost?) {
+        let memorySize = calculateMemorySize(for: value)
+        let entryCost = cost ?? Self.refetchCost(forKey: key)
+        let entry = CacheEntry(data: value, ttl: ttl, memorySize: memorySize)
+        let expiresAt = entry.timestamp.addingTimeInterval(ttl)
+        let box = CacheBox(key: key, entry: entry, memorySize: memorySize, cost: entryCost, expiresAt: expiresAt,
+                           spill: entryCost == .expensive ? Self.spillEncoder(for: value, expiresAt: expiresAt) : nil,
+                           tick: metrics_atomic_add(accessClock, 1) + 1)
+
+        // Overwrites replace the old entry's cost rather than adding to it; a fresh value
+        // also supersedes anything spilled under the key
+        forgetLocked(key: key)
+        discardSpillLocked(key: key)
+
+        if currentMemoryUsage + memorySize > maxMemoryUsage {
+            _ = evictLocked(toTarget: maxMemoryUsage - memorySize, maxCost: .expensive)
         }
+
+        cache.setObject(box, forKey: NSString(string: key), cost: memorySize)
+        liveBoxes[key] = box
+        currentMemoryUsage += memorySize
+        publishGaugesLocked()
     }
 
     // MARK: - Memory Size Estimation
@@ -136,49 +339,155 @@ final class CacheService: NSObject, CacheServiceProtocol {
     private func calculateMemorySize<T>(for value: T) -> Int {
         switch value {
         case let doubles as [Double]:
-            return doubles.count * MemoryLayout<Double>.size + 32
+            return MemoryEstimate.doubles(doubles.count)
         case let coins as [Coin]:
-            return coins.count * 500 + 64
+            return MemoryEstimate.coins(coins.count)
         case let logos as [Int: String]:
-            return logos.count * 100 + 32
+            return MemoryEstimate.urls(logos.count)
         case let image as UIImage:
             // Estimate image memory size based on dimensions
-            return Int(image.size.width * image.size.height * 4) // 4 bytes per pixel (RGBA)
+            return MemoryEstimate.bitmap(pixels: Int(image.size.width * image.size.height))
         case let quotes as [Int: Quote]:
-            return quotes.count * 200 + 32
+            return MemoryEstimate.quotes(quotes.count)
+        case let candles as [OHLCData]:
+            return MemoryEstimate.candles(candles.count)
         default:
             return 1024
         }
     }
 
-    private func evictOldestEntries(toFreeBytes bytes: Int) {
-        AppLogger.cache("Evicting cache entries to free \(bytes) bytes (note: NSCache manages this automatically)")
+    // MARK: - Disk Spill
+
+    /// Disk encoder for the series types worth spilling; nil for everything else
+    private static func spillEncoder<T>(for value: T, expiresAt: Date) -> (() -> Data?)? {
+        switch value {
+        case let doubles as [Double]:
+            return { try? JSONEncoder().encode(SpilledEntry(expiresAt: expiresAt, data: doubles)) }
+        case let candles as [OHLCData]:
+            return { try? JSONEncoder().encode(SpilledEntry(expiresAt: expiresAt, data: candles)) }
+        default:
+            return nil
+        }
+    }
+
+    private func spillURL(for key: String) -> URL? {
+        spillDirectory?.appendingPathComponent(key + ".json", isDirectory: false)
+    }
+
+    /// Marks the key spilled and hands the box to the spill queue, which encodes and writes it
+    /// outside the cache barrier (the closure keeps the value alive until then)
+    private func spillLocked(_ box: CacheBox) {
+        guard let url = spillURL(for: box.key), let encode = box.spill else { return }
+        spilledKeys.insert(box.key)
+        Metrics.cacheSpills.increment()
+        let key = box.key
+        spillQueue.async {
+            guard let data = encode() else { return }
+            do {
+                try data.write(to: url, options: .atomic)
+            } catch {
+                AppLogger.cache("Cache spill write failed for \(key): \(error.localizedDescription)", level: .warning)
+            }
+        }
+    }
+
+    private func discardSpillLocked(key: String) {
+        guard spilledKeys.remove(key) != nil, let url = spillURL(for: key) else { return }
+        spillQueue.async {
+            try? FileManager.default.removeItem(at: url)
+        }
+    }
+
+    /**
+     * Reads a spilled entry back in on the spill queue and re-inserts it with its remaining TTL
+     *
+     * Emits nil right away when nothing is spilled under the key; otherwise emits on the main
+     * queue once the file is read (the serial spill queue runs it after any pending write).
+     * A value stored while the read was in flight wins over the restored one.
+     */
+    private func restoreSpilled<T: Codable>(key: String, type: T.Type) -> AnyPublisher<T?, Never> {
+        let isSpilled = queue.sync { spilledKeys.contains(key) }
+        guard isSpilled, let url = spillURL(for: key) else {
+            return Just(nil).eraseToAnyPublisher()
+        }
+
+        return Deferred {
+            Future<T?, Never> { promise in
+                self.spillQueue.async {
+                    let spilled = (try? Data(contentsOf: url))
+                        .flatMap { try? JSONDecoder().decode(SpilledEntry<T>.self, from: $0) }
+                        .flatMap { $0.expiresAt.timeIntervalSinceNow > 0 ? $0 : nil }
+
+                    let restored: T? = self.queue.sync(flags: .barrier) {
+                        guard self.spilledKeys.contains(key) else { return nil } // Superseded meanwhile
+                        guard let spilled = spilled else {
+                            self.discardSpillLocked(key: key)
+                            return nil
+                        }
+                        // Re-inserting also discards the spill file
+                        self.insertLocked(key: key, value: spilled.data, ttl: spilled.expiresAt.timeIntervalSinceNow, cost: nil)
+                        return spilled.data
+                    }
+                    if restored != nil {
+                        Metrics.cacheSpillRestores.increment()
+                    }
+                    promise(.success(restored))
+                }
+            }
+        }
+        .receive(on: DispatchQueue.main)
+        .eraseToAnyPublisher()
     }
 
     // MARK: - Removal / Clearing
 
     func remove(key: String) {
         queue.async(flags: .barrier) {
-            if let entry = self.cache.object(forKey: NSString(string: key)) as? CacheEntry<Any> {
-                self.currentMemoryUsage -= entry.memorySize
-            }
-            self.cache.removeObject(forKey: NSString(string: key))
+            self.removeLocked(key: key)
+            self.discardSpillLocked(key: key)
         }
     }
 
     func clear() {
         queue.async(flags: .barrier) {
-            self.cache.removeAllObjects()
-            self.currentMemoryUsage = 0
+            self.removeAllLocked()
         }
     }
 
+    // MARK: - Accounting (call inside a barrier)
+
+    /// Drops a key from the accounting; NSCache's eviction callback for it is then ignored
+    private func forgetLocked(key: String) {
+        guard let live = liveBoxes.removeValue(forKey: key) else { return }
+        currentMemoryUsage -= live.memorySize
+    }
+
+    private func removeLocked(key: String) {
+        forgetLocked(key: key)
+        cache.removeObject(forKey: NSString(string: key))
+        publishGaugesLocked()
+    }
+
+    private func removeAllLocked() {
+        liveBoxes.removeAll()
+        currentMemoryUsage = 0
+        cache.removeAllObjects()
+        Array(spilledKeys).forEach { discardSpillLocked(key: $0) }
+        publishGaugesLocked()
+    }
+
+    private func publishGaugesLocked() {
+        Metrics.cacheEntries.set(liveBoxes.count)
+        Metrics.cacheBytes.set(currentMemoryUsage)
+    }
+
     // MARK: - Statistics
 
+    /// Entries and estimated bytes currently held (hit rate lives in MetricsRegistry)
     func getCacheStats() -> (count: Int, memoryUsage: Int, maxMemory: Int) {
         return queue.sync {
             return (
-                count: cache.countLimit,
+                count: liveBoxes.count,
                 memoryUsage: currentMemoryUsage,
                 maxMemory: maxMemoryUsage
             )
@@ -208,17 +517,17 @@ final class CacheService: NSObject, CacheServiceProtocol {
     }
     
     // MARK: - Image Data Caching
+    // Logo bitmaps live in LogoImageCache (pixel-sized memory LRU + persistent disk store keyed by
+    // SHA-256 of the URL), so they don't compete with chart data for this cache's budget.
     
     @objc(getCachedImageFor:)
     func getCachedImage(for url: String) -> UIImage? {
-        let key = "image_\(url.hash)"
-        return get(key: key, type: UIImage.self)
+        return LogoImageCache.shared.memoryImage(for: url)
     }
     
     @objc(storeCachedImage:forUrl:)
     func storeCachedImage(_ image: UIImage, for url: String) {
-        let key = "image_\(url.hash)"
-        set(key: key, value: image, ttl: CacheService.logoTTL) // Same TTL as logo URLs
+        LogoImageCache.shared.store(image, for: url)
     }
 
     func getQuotes(for ids: [Int], convert: String) -> [Int: Quote]? {
@@ -251,10 +560,17 @@ final class CacheService: NSObject, CacheServiceProtocol {
         set(key: key, value: data, ttl: CacheService.ohlcDataTTL)
     }
     
+    func restoreSpilledChartData(for coinId: String, currency: String, days: String) -> AnyPublisher<[Double]?, Never> {
+        restoreSpilled(key: "chart_\(coinId)_\(currency)_\(days)", type: [Double].self)
+    }
+    
+    func restoreSpilledOHLCData(for coinId: String, currency: String, days: String) -> AnyPublisher<[OHLCData]?, Never> {
+        restoreSpilled(key: "ohlc_\(coinId)_\(currency)_\(days)", type: [OHLCData].self)
+    }
+    
     func clearCache() {
         queue.async(flags: .barrier) {
-            self.cache.removeAllObjects()
-            self.currentMemoryUsage = 0
+            self.removeAllLocked()
             AppLogger.cache("Cache cleared - all objects removed")
         }
     }
@@ -266,23 +582,52 @@ final class CacheService: NSObject, CacheServiceProtocol {
             AppLogger.cache("Expired entries cleanup requested (automatic for NSCache)")
         }
     }
+}
 
-    deinit {
-        if let observer = memoryPressureObserver {
-            NotificationCenter.default.removeObserver(observer)
+// MARK: - Memory Accounting
+
+extension CacheService: MemoryAccountable {
+
+    /// One child per key category, filed under the tier its refetch cost maps to
+    func memoryFootprint() -> MemoryFootprint {
+        let byCategory: [String: (bytes: Int, cost: RefetchCost)] = queue.sync {
+            liveBoxes.values.reduce(into: [:]) { result, box in
+                let category = Self.category(forKey: box.key)
+                let current = result[category]
+                result[category] = ((current?.bytes ?? 0) + box.memorySize, max(current?.cost ?? box.cost, box.cost))
+            }
         }
+        return MemoryFootprint(
+            name: "CacheService",
+            children: byCategory.keys.sorted().map { category in
+                let group = byCategory[category]!
+                return MemoryFootprint(name: category, bytes: group.bytes, tier: group.cost.pressureTier)
+            }
+        )
+    }
+
+    func releaseMemory(for tier: MemoryPressureTier) -> Int {
+        return handleMemoryPressure(tier: tier)
     }
 }
 
 // MARK: - NSCacheDelegate
 
 extension CacheService: NSCacheDelegate {
+    /// Also called for our own removals; those were already forgotten, so only
+    /// NSCache-initiated evictions of a still-live box change the accounting (and spill it)
     func cache(_ cache: NSCache<AnyObject, AnyObject>, willEvictObject obj: Any) {
-        if let entry = obj as? CacheEntry<Any> {
-            queue.async(flags: .barrier) {
-                self.currentMemoryUsage -= entry.memorySize
+        guard let box = obj as? CacheBox else { return }
+        queue.async(flags: .barrier) {
+            guard self.liveBoxes[box.key] === box else { return }
+            if !box.isExpired(at: Date()) {
+                self.spillLocked(box)
             }
-            AppLogger.cache("Cache evicted entry, freed \(entry.memorySize) bytes")
+            self.liveBoxes.removeValue(forKey: box.key)
+            self.currentMemoryUsage -= box.memorySize
+            self.publishGaugesLocked()
+            Metrics.cacheEvictions.increment()
+            AppLogger.cache("Cache evicted \(box.key), freed \(box.memorySize) bytes", level: .debug)
         }
     }
 }
@@ -24,6 +24,7 @@ final class CoinService: CoinServiceProtocol {
     // Injected Dependencies
     private let cacheService: CacheServiceProtocol
     private let requestManager: RequestManagerProtocol
+    private weak var trafficReporter: NetworkTrafficReporting?
     
     // MARK: - Debug Testing Configuration
     #if DEBUG
@@ -58,10 +59,12 @@ final class CoinService: CoinServiceProtocol {
      */
     init(
         cacheService: CacheServiceProtocol,
-        requestManager: RequestManagerProtocol
+        requestManager: RequestManagerProtocol,
+        trafficReporter: NetworkTrafficReporting? = nil
     ) {
         self.cacheService = cacheService
         self.requestManager = requestManager
+        self.trafficReporter = trafficReporter
     }
 
     
@@ -145,6 +148,7 @@ final class CoinService: CoinServiceProtocol {
         // This runs in the background automatically (on a background thread).
         // Combine wraps this in a publisher so it becomes part of reactive chain
         return URLSession.shared.dataTaskPublisher(for: request)
+            .reportingTraffic(to: trafficReporter)
             //Background thread (network/data parsing) 
             .tryMap { output in
                 guard let response = output.response as? HTTPURLResponse,
@@ -154,10 +158,7 @@ final class CoinService: CoinServiceProtocol {
 
                 return output.data
             }
-            .decode(type: MarketResponse.self, decoder: {
-                let decoder = JSONDecoder()
-                return decoder
-            }())
+            .timedDecode(type: MarketResponse.self)
             .map { $0.data }
             .receive(on: DispatchQueue.main) // Switches to main thread
             .mapError { error in
@@ -180,24 +181,25 @@ final class CoinService: CoinServiceProtocol {
     // 3. Calls performCoinLogosRequest to get logo URLs from:
 
     func fetchCoinLogos(forIDs ids: [Int], priority: RequestPriority = .low) -> AnyPublisher<[Int: String], Never> {
-        AppLogger.network("CoinService.fetchCoinLogos | Requested IDs: \(ids)")
+        AppLogger.network("CoinService.fetchCoinLogos | Requested \(ids.count) IDs", level: .debug)
         
         // PARTIAL CACHE LOGIC: Check which requested IDs are already cached
         let allCachedLogos = cacheService.getCoinLogos() ?? [:]
-        let requestedCachedLogos = allCachedLogos.filter { ids.contains($0.key) }
+        let requestedIds = Set(ids)
+        let requestedCachedLogos = allCachedLogos.filter { requestedIds.contains($0.key) }
         let missingIds = ids.filter { allCachedLogos[$0] == nil }
         
-        AppLogger.cache("CoinService.fetchCoinLogos | Cache status: \(requestedCachedLogos.count)/\(ids.count) cached, \(missingIds.count) missing")
+        AppLogger.cache("CoinService.fetchCoinLogos | Cache status: \(requestedCachedLogos.count)/\(ids.count) cached, \(missingIds.count) missing", level: .debug)
         
         // If all requested logos are cached, return them immediately
         if missingIds.isEmpty {
-            AppLogger.success("CoinService.fetchCoinLogos | All requested logos cached, returning \(requestedCachedLogos.count) logos")
+            AppLogger.cache("CoinService.fetchCoinLogos | All requested logos cached, returning \(requestedCachedLogos.count) logos", level: .debug)
             return Just(requestedCachedLogos)
                 .eraseToAnyPublisher()
         }
         
         // If some logos are missing, fetch missing ones and merge with cached
-        AppLogger.network("CoinService.fetchCoinLogos | Fetching \(missingIds.count) missing logos: \(missingIds)")
+        AppLogger.network("CoinService.fetchCoinLogos | Fetching \(missingIds.count) missing logos")
         
         // Use request manager with priority - logos get low priority since they're not urgent
         return requestManager.fetchCoinLogos(ids: missingIds, priority: priority) { [weak self] in
@@ -234,6 +236,7 @@ final class CoinService: CoinServiceProtocol {
         request.httpMethod = "GET"
 
         return URLSession.shared.dataTaskPublisher(for: request)
+            .reportingTraffic(to: trafficReporter)
             .tryMap { output -> [Int: String] in
                 guard let response = output.response as? HTTPURLResponse,
                       response.statusCode == 200 else {
@@ -312,11 +315,15 @@ final class CoinService: CoinServiceProtocol {
         request.setValue(apiKey, forHTTPHeaderField: "X-CMC_PRO_API_KEY")
 
         return URLSession.shared.dataTaskPublisher(for: request)
+            .reportingTraffic(to: trafficReporter)
             .tryMap { output -> [Int: Quote] in
                 guard let response = output.response as? HTTPURLResponse, response.statusCode == 200 else {
                     throw NetworkError.invalidResponse
                 }
 
+                let decodeStart = DispatchTime.now().uptimeNanoseconds
+                defer { Metrics.responseDecode.recordElapsed(since: decodeStart) }
+
                 let json = try JSONSerialization.jsonObject(with: output.data) as? [String: Any]
                 guard let dataDict = json?["data"] as? [String: Any] else {
                     throw NetworkError.decodingError
@@ -371,6 +378,21 @@ final class CoinService: CoinServiceProtocol {
         
         AppLogger.cache("Cache miss for OHLC data: \(coinId) - \(days) (priority: \(priority.description))")
         
+        // Series dropped under memory pressure may be waiting on disk; read that before spending rate limit
+        return cacheService.restoreSpilledOHLCData(for: coinId, currency: currency, days: days)
+            .setFailureType(to: NetworkError.self)
+            .flatMap { [weak self] restored -> AnyPublisher<[OHLCData], NetworkError> in
+                if let restored = restored {
+                    AppLogger.cache("Restored spilled OHLC data: \(coinId) - \(days) (\(restored.count) candles)")
+                    return Just(restored).setFailureType(to: NetworkError.self).eraseToAnyPublisher()
+                }
+                return self?.requestOHLCData(for: coinId, currency: currency, days: days, priority: priority) ??
+                    Fail(error: NetworkError.unknown(NSError(domain: "CoinService", code: -1, userInfo: nil))).eraseToAnyPublisher()
+            }
+            .eraseToAnyPublisher()
+    }
+    
+    private func requestOHLCData(for coinId: String, currency: String, days: String, priority: RequestPriority) -> AnyPublisher<[OHLCData], NetworkError> {
         return requestManager.fetchOHLCData(
             coinId: coinId,
             currency: currency,
@@ -414,6 +436,21 @@ final class CoinService: CoinServiceProtocol {
         
         AppLogger.cache("Cache miss for chart data: \(coinId) - \(days) (priority: \(priority.description))")
         
+        // Series dropped under memory pressure may be waiting on disk; read that before spending rate limit
+        return cacheService.restoreSpilledChartData(for: coinId, currency: currency, days: days)
+            .setFailureType(to: NetworkError.self)
+            .flatMap { [weak self] restored -> AnyPublisher<[Double], NetworkError> in
+                if let restored = restored {
+                    AppLogger.cache("Restored spilled chart data: \(coinId) - \(days) (\(restored.count) points)")
+                    return Just(restored).setFailureType(to: NetworkError.self).eraseToAnyPublisher()
+                }
+                return self?.requestChartData(for: coinId, currency: currency, days: days, priority: priority) ??
+                    Fail(error: NetworkError.unknown(NSError(domain: "CoinService", code: -1, userInfo: nil))).eraseToAnyPublisher()
+            }
+            .eraseToAnyPublisher()
+    }
+    
+    private func requestChartData(for coinId: String, currency: String, days: String, priority: RequestPriority) -> AnyPublisher<[Double], NetworkError> {
         // Use request manager with priority for non-cached data
         // High priority requests (filter changes) get processed faster
         return requestManager.fetchChartData(
@@ -464,6 +501,7 @@ final class CoinService: CoinServiceProtocol {
         request.setValue(coinGeckoApiKey, forHTTPHeaderField: "x-cg-demo-api-key")
         
         return URLSession.shared.dataTaskPublisher(for: request)
+            .reportingTraffic(to: trafficReporter)
             .tryMap { output in
                 guard let response = output.response as? HTTPURLResponse else {
                     AppLogger.error("No HTTP response for OHLC")
@@ -484,7 +522,7 @@ final class CoinService: CoinServiceProtocol {
                 }
                 return output.data
             }
-            .decode(type: CoinGeckoOHLCResponse.self, decoder: JSONDecoder())
+            .timedDecode(type: CoinGeckoOHLCResponse.self)
             .map { response in
                 let ohlcData = response.toOHLCData()
                 AppLogger.success("Successfully fetched \(ohlcData.count) OHLC candles for '\(geckoId)'")
@@ -536,6 +574,7 @@ final class CoinService: CoinServiceProtocol {
         request.setValue(coinGeckoApiKey, forHTTPHeaderField: "x-cg-demo-api-key")
         
         return URLSession.shared.dataTaskPublisher(for: request)
+            .reportingTraffic(to: trafficReporter)
             .tryMap { output in
                 guard let response = output.response as? HTTPURLResponse else {
                     AppLogger.error("No HTTP response for volume data")
@@ -553,7 +592,7 @@ final class CoinService: CoinServiceProtocol {
                 }
                 return output.data
             }
-            .decode(type: CoinGeckoChartResponse.self, decoder: JSONDecoder())
+            .timedDecode(type: CoinGeckoChartResponse.self)
             .map { response in
                 AppLogger.success("Successfully fetched volume data with \(response.total_volumes.count) points")
                 return response.total_volumes
@@ -647,6 +686,7 @@ final class CoinService: CoinServiceProtocol {
         request.setValue(coinGeckoApiKey, forHTTPHeaderField: "x-cg-demo-api-key") // CoinGecko Demo API key
 
         return URLSession.shared.dataTaskPublisher(for: request)
+            .reportingTraffic(to: trafficReporter)
             .tryMap { output in
                 guard let response = output.response as? HTTPURLResponse else {
                     AppLogger.error("No HTTP response")
@@ -667,7 +707,7 @@ final class CoinService: CoinServiceProtocol {
                 }
                 return output.data
             }
-            .decode(type: CoinGeckoChartResponse.self, decoder: JSONDecoder())
+            .timedDecode(type: CoinGeckoChartResponse.self)
             .map { response in
                 // CoinGecko returns prices as [[timestamp, price]]. We only want the price.
                 let chartPrices = response.prices.map { $0[1] }
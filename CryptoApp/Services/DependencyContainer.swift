@@ -27,7 +27,8 @@ final class DependencyContainer {
     private lazy var _coreDataManager: CoreDataManagerProtocol = CoreDataManager()
     private lazy var _coinService: CoinServiceProtocol = CoinService(
         cacheService: cacheService(),
-        requestManager: requestManager()
+        requestManager: requestManager(),
+        trafficReporter: networkConnectivityMonitor()
     )
     private lazy var _coinManager: CoinManagerProtocol = CoinManager(
         coinService: coinService()
@@ -40,6 +41,10 @@ final class DependencyContainer {
     private lazy var _sharedCoinDataManager: SharedCoinDataManagerProtocol = SharedCoinDataManager(
         coinManager: coinManager()
     )
+    private lazy var _priceAlertManager: PriceAlertManagerProtocol = PriceAlertManager(
+        sharedCoinDataManager: sharedCoinDataManager(),
+        cacheService: cacheService()
+    )
     private lazy var _networkConnectivityMonitor: NetworkConnectivityMonitor = NetworkConnectivityMonitor()
     
     // MARK: - Singleton Service Access
@@ -78,6 +83,16 @@ final class DependencyContainer {
         return _sharedCoinDataManager
     }
     
+    /**
+     * Returns the shared PriceAlertManager singleton instance
+     * 
+     * NOTE: Alert rules are evaluated against the shared coin stream, so a single
+     * instance keeps hysteresis/deduplication state consistent across screens
+     */
+    func priceAlertManager() -> PriceAlertManagerProtocol {
+        return _priceAlertManager
+    }
+    
     // MARK: - View Models
     
     /**
@@ -87,7 +102,8 @@ final class DependencyContainer {
         return CoinListVM(
             coinManager: coinManager(),
             sharedCoinDataManager: sharedCoinDataManager(),
-            persistenceService: persistenceService()
+            persistenceService: persistenceService(),
+            cacheService: cacheService()
         )
     }
     
@@ -125,6 +141,37 @@ final class DependencyContainer {
         )
     }
     
+    /**
+     * Creates a new WatchlistAnalyticsVM instance with injected dependencies
+     */
+    func watchlistAnalyticsViewModel() -> WatchlistAnalyticsVM {
+        return WatchlistAnalyticsVM(
+            watchlistManager: watchlistManager(),
+            coinManager: coinManager(),
+            sharedCoinDataManager: sharedCoinDataManager()
+        )
+    }
+    
+    /**
+     * Creates a new CoinComparisonVM instance with injected dependencies
+     */
+    func coinComparisonViewModel() -> CoinComparisonVM {
+        return CoinComparisonVM(
+            watchlistManager: watchlistManager(),
+            coinManager: coinManager(),
+            sharedCoinDataManager: sharedCoinDataManager()
+        )
+    }
+    
+    // MARK: - Helpers
+    
+    /**
+     * Creates a new ChartDataExporter writing into the temporary directory
+     */
+    func chartDataExporter() -> ChartDataExporter {
+        return ChartDataExporter(coinManager: coinManager())
+    }
+    
     // MARK: - Singleton Service Accessors
     
     /**
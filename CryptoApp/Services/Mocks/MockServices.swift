@@ -427,6 +427,9 @@ final class MockSharedCoinDataManager: SharedCoinDataManagerProtocol {
     private let errorsSubject = PassthroughSubject<Error, Never>()
     private let isLoadingSubject = CurrentValueSubject<Bool, Never>(false)
     private let isFetchingFreshDataSubject = CurrentValueSubject<Bool, Never>(false)
+    private let watchedQuotesSubject = CurrentValueSubject<[Int: Quote], Never>([:])
+    private(set) var watchedCoinIdsByOwner: [WatchedCoinsOwner: Set<Int>] = [:]
+    var watchedCoinIds: Set<Int> { watchedCoinIdsByOwner.values.reduce(into: []) { $0.formUnion($1) } }
     
     // Test configuration
     var shouldFailUpdates: Bool = false
@@ -439,6 +442,8 @@ final class MockSharedCoinDataManager: SharedCoinDataManagerProtocol {
     var isLoading: AnyPublisher<Bool, Never> { isLoadingSubject.eraseToAnyPublisher() }
     var isFetchingFreshData: AnyPublisher<Bool, Never> { isFetchingFreshDataSubject.eraseToAnyPublisher() }
     var currentCoins: [Coin] { coinsSubject.value }
+    var watchedQuotes: AnyPublisher<[Int: Quote], Never> { watchedQuotesSubject.eraseToAnyPublisher() }
+    var currentWatchedQuotes: [Int: Quote] { watchedQuotesSubject.value }
     
     func forceUpdate() {
         guard !shouldFailUpdates else { return }
@@ -467,6 +472,8 @@ final class MockSharedCoinDataManager: SharedCoinDataManagerProtocol {
     func setMockCoins(_ coins: [Coin]) { coinsSubject.send(coins) }
     func getMockCoinCount() -> Int { currentCoins.count }
     func getCoinsForIds(_ ids: [Int]) -> [Coin] { currentCoins.filter { ids.contains($0.id) } }
+    func setWatchedCoinIds(_ ids: Set<Int>, for owner: WatchedCoinsOwner) { watchedCoinIdsByOwner[owner] = ids }
+    func setMockWatchedQuotes(_ quotes: [Int: Quote]) { watchedQuotesSubject.send(quotes) }
     
     // New: public helper to emit errors for tests
     func emitError(_ error: Error) { errorsSubject.send(error) }
@@ -764,6 +771,9 @@ final class MockCoinManager: CoinManagerProtocol {
     var mockChartData: [Double] = []
     var mockOHLCData: [OHLCData] = []
     
+    // Call recording
+    private(set) var quoteRequests: [(ids: [Int], priority: RequestPriority)] = []
+    
     // MARK: - CoinManagerProtocol Implementation
     
     func getTopCoins(
@@ -803,6 +813,7 @@ final class MockCoinManager: CoinManagerProtocol {
         priority: RequestPriority
     ) -> AnyPublisher<[Int: Quote], NetworkError> {
         
+        quoteRequests.append((ids: ids, priority: priority))
         if shouldSucceed {
             return Just(mockQuotes)
                 .delay(for: .seconds(mockDelay), scheduler: DispatchQueue.main)
@@ -0,0 +1,139 @@
+//
+//  PriceAlertNotifier.swift
+//  CryptoApp
+//
+
+import Foundation
+import Combine
+import UserNotifications
+
+/**
+ * PriceAlertNotifier
+ *
+ * Turns alerts triggered by PriceAlertManager into local notifications.
+ *
+ * Features:
+ * - Started once at app launch, alongside the shared coin data manager
+ * - Asks for notification permission the first time a rule exists, not at launch
+ * - Shows alerts as banners while the app is in the foreground too
+ * - Delivery is injectable so tests can observe what would be shown
+ */
+final class PriceAlertNotifier: NSObject {
+
+    // MARK: - Singleton
+
+    static let shared = PriceAlertNotifier()
+
+    /// Receives (identifier, title, body) for each triggered alert
+    typealias Delivery = (_ identifier: String, _ title: String, _ body: String) -> Void
+
+    // MARK: - Private Properties
+
+    private let delivery: Delivery?
+    private var cancellables = Set<AnyCancellable>()
+    private var sharedCoinDataManager: SharedCoinDataManagerProtocol?
+    private var hasRequestedAuthorization = false
+
+    // MARK: - Initialization
+
+    /// `delivery` replaces the system notification center (tests)
+    init(delivery: Delivery? = nil) {
+        self.delivery = delivery
+        super.init()
+    }
+
+    // MARK: - Public Methods
+
+    /**
+     * Start delivering triggered alerts
+     * Should be called once during app initialization
+     */
+    func startMonitoring(alertManager: PriceAlertManagerProtocol, sharedCoinDataManager: SharedCoinDataManagerProtocol) {
+        cancellables.removeAll()
+        self.sharedCoinDataManager = sharedCoinDataManager
+
+        if delivery == nil {
+            UNUserNotificationCenter.current().delegate = self
+        }
+
+        alertManager.rules
+            .filter { !$0.isEmpty }
+            .first()
+            .sink { [weak self] _ in
+                self?.requestAuthorizationIfNeeded()
+            }
+            .store(in: &cancellables)
+
+        // Published on the main queue by PriceAlertManager
+        alertManager.triggeredAlerts
+            .sink { [weak self] events in
+                self?.deliver(events)
+            }
+            .store(in: &cancellables)
+
+        AppLogger.ui("PriceAlertNotifier started monitoring")
+    }
+
+    func stopMonitoring() {
+        cancellables.removeAll()
+    }
+
+    /// Notification title and body for one triggered alert
+    static func content(for event: PriceAlertEvent, symbol: String?) -> (title: String, body: String) {
+        let name = symbol?.uppercased() ?? "Coin #\(event.coinId)"
+        let title = "\(name) \(event.direction == .up ? "▲" : "▼") \(PriceAlertRule.Condition.formatPrice(event.price))"
+        return (title, "\(event.condition.displayText) triggered")
+    }
+
+    // MARK: - Private Methods
+
+    private func deliver(_ events: [PriceAlertEvent]) {
+        let coinIds = Array(Set(events.map(\.coinId)))
+        let symbols = Dictionary((sharedCoinDataManager?.getCoinsForIds(coinIds) ?? []).map { ($0.id, $0.symbol) },
+                                 uniquingKeysWith: { first, _ in first })
+        for event in events {
+            let content = Self.content(for: event, symbol: symbols[event.coinId])
+            let identifier = "price-alert-\(event.ruleId.uuidString)"
+            if let delivery = delivery {
+                delivery(identifier, content.title, content.body)
+            } else {
+                post(identifier: identifier, title: content.title, body: content.body)
+            }
+        }
+    }
+
+    private func post(identifier: String, title: String, body: String) {
+        let content = UNMutableNotificationContent()
+        content.title = title
+        content.body = body
+        content.sound = .default
+        // Same identifier per rule, so a re-fired rule replaces its previous notification
+        let request = UNNotificationRequest(identifier: identifier, content: content, trigger: nil)
+        UNUserNotificationCenter.current().add(request) { error in
+            if let error = error {
+                AppLogger.ui("Price alert notification failed: \(error.localizedDescription)", level: .warning)
+            }
+        }
+    }
+
+    private func requestAuthorizationIfNeeded() {
+        guard delivery == nil, !hasRequestedAuthorization else { return }
+        hasRequestedAuthorization = true
+        UNUserNotificationCenter.current().requestAuthorization(options: [.alert, .sound]) { granted, _ in
+            AppLogger.ui("Price alert notifications \(granted ? "authorized" : "denied")")
+        }
+    }
+}
+
+// MARK: - UNUserNotificationCenterDelegate
+
+extension PriceAlertNotifier: UNUserNotificationCenterDelegate {
+    /// Alerts are time-sensitive, so show them even while the app is open
+    func userNotificationCenter(
+        _ center: UNUserNotificationCenter,
+        willPresent notification: UNNotification,
+        withCompletionHandler completionHandler: @escaping (UNNotificationPresentationOptions) -> Void
+    ) {
+        completionHandler([.banner, .list, .sound])
+    }
+}
@@ -43,6 +43,21 @@ protocol CacheServiceProtocol {
     func storeOHLCData(_ data: [OHLCData], for coinId: String, currency: String, days: String)
     func clearCache()
     func clearExpiredEntries()
+    /// Reads a series spilled to disk under memory pressure back in without blocking the caller;
+    /// emits nil (immediately when nothing was spilled) so the caller falls back to the network
+    func restoreSpilledChartData(for coinId: String, currency: String, days: String) -> AnyPublisher<[Double]?, Never>
+    func restoreSpilledOHLCData(for coinId: String, currency: String, days: String) -> AnyPublisher<[OHLCData]?, Never>
+}
+
+extension CacheServiceProtocol {
+    /// Caches without a disk spill have nothing to restore
+    func restoreSpilledChartData(for coinId: String, currency: String, days: String) -> AnyPublisher<[Double]?, Never> {
+        Just(nil).eraseToAnyPublisher()
+    }
+
+    func restoreSpilledOHLCData(for coinId: String, currency: String, days: String) -> AnyPublisher<[OHLCData]?, Never> {
+        Just(nil).eraseToAnyPublisher()
+    }
 }
 
 // MARK: - Request Manager Protocol
@@ -280,6 +295,12 @@ protocol CoinManagerProtocol {
 
 // MARK: - Shared Coin Data Manager Protocol
 
+/// Consumers that register watched coins independently; the shared manager watches their union
+enum WatchedCoinsOwner: Hashable {
+    case watchlist
+    case priceAlerts
+}
+
 /**
  * SHARED COIN DATA MANAGER PROTOCOL
  * 
@@ -290,12 +311,48 @@ protocol CoinManagerProtocol {
  */
 protocol SharedCoinDataManagerProtocol {
     var allCoins: AnyPublisher<[Coin], Never> { get }
+    var coinUpdates: AnyPublisher<CoinDataUpdate, Never> { get }
     var errors: AnyPublisher<Error, Never> { get }
     var isLoading: AnyPublisher<Bool, Never> { get }
     var isFetchingFreshData: AnyPublisher<Bool, Never> { get }
     var currentCoins: [Coin] { get }
+    var watchedQuotes: AnyPublisher<[Int: Quote], Never> { get }
+    var currentWatchedQuotes: [Int: Quote] { get }
     func forceUpdate()
     func startAutoUpdate()
     func stopAutoUpdate()
     func getCoinsForIds(_ ids: [Int]) -> [Coin]
-} 
\ No newline at end of file
+    func setWatchedCoinIds(_ ids: Set<Int>, for owner: WatchedCoinsOwner)
+}
+
+extension SharedCoinDataManagerProtocol {
+    /// Registers the watchlist's coins
+    func setWatchedCoinIds(_ ids: Set<Int>) {
+        setWatchedCoinIds(ids, for: .watchlist)
+    }
+
+    /// Managers that don't trace price ticks publish their list without a span
+    var coinUpdates: AnyPublisher<CoinDataUpdate, Never> {
+        allCoins.map { CoinDataUpdate(coins: $0, tick: nil) }.eraseToAnyPublisher()
+    }
+}
+
+// MARK: - Price Alert Manager Protocol
+
+/**
+ * PRICE ALERT MANAGER PROTOCOL
+ * 
+ * Defines the interface for user price/indicator alerts, enabling:
+ * - Mock implementations for testing
+ * - Different evaluation strategies
+ * - Clear separation of concerns
+ */
+protocol PriceAlertManagerProtocol {
+    var rules: AnyPublisher<[PriceAlertRule], Never> { get }
+    var triggeredAlerts: AnyPublisher<[PriceAlertEvent], Never> { get }
+    var currentRules: [PriceAlertRule] { get }
+    func addRule(_ rule: PriceAlertRule)
+    func removeRule(id: UUID)
+    func removeAllRules()
+    func seedIndicators(coinId: Int, prices: [Double])
+}
@@ -10,6 +10,8 @@
 
 @interface CoinImageView ()
 @property (nonatomic, strong) NSString *currentDownloadURL;
+// Shows a logo straight from a shared LogoAtlas sheet (no per-cell UIImage)
+@property (nonatomic, strong) CALayer *atlasLayer;
 @end
 
 @implementation CoinImageView
@@ -26,12 +28,49 @@
     self.translatesAutoresizingMaskIntoConstraints = NO;
     self.contentMode = UIViewContentModeScaleAspectFit;
     self.clipsToBounds = YES;
+    [self setupAtlasLayer];
     [self setPlaceholder];
     // No longer need per-instance cache - using shared ImageCacheService
 }
 
+- (void)setupAtlasLayer {
+    self.atlasLayer = [CALayer layer];
+    self.atlasLayer.contentsGravity = kCAGravityResizeAspect;
+    self.atlasLayer.hidden = YES;
+    [self.layer addSublayer:self.atlasLayer];
+}
+
+- (void)layoutSubviews {
+    [super layoutSubviews];
+    [CATransaction begin];
+    [CATransaction setDisableActions:YES];
+    self.atlasLayer.frame = self.bounds;
+    self.atlasLayer.contentsScale = self.window.screen.scale ?: UIScreen.mainScreen.scale;
+    [CATransaction commit];
+}
+
+- (void)showAtlasSlot:(LogoAtlasSlot *)slot {
+    [CATransaction begin];
+    [CATransaction setDisableActions:YES];
+    self.atlasLayer.contents = (__bridge id)slot.sheet;
+    self.atlasLayer.contentsRect = slot.contentsRect;
+    self.atlasLayer.hidden = NO;
+    [CATransaction commit];
+    self.image = nil;
+}
+
+- (void)hideAtlasSlot {
+    if (self.atlasLayer.hidden) return;
+    [CATransaction begin];
+    [CATransaction setDisableActions:YES];
+    self.atlasLayer.hidden = YES;
+    self.atlasLayer.contents = nil;
+    [CATransaction commit];
+}
+
 - (void)setPlaceholder {
     [self cancelCurrentDownload];
+    [self hideAtlasSlot];
     self.image = [UIImage imageNamed:@"coin_placeholder"];
 }
 
@@ -52,6 +91,14 @@
     // Cancel any existing download first
     [self cancelCurrentDownload];
     
+    // Top coins are pre-packed into a shared atlas: no load or decode needed
+    LogoAtlasSlot *slot = [[LogoAtlas shared] slotForURL:urlString];
+    if (slot) {
+        [self showAtlasSlot:slot];
+        return;
+    }
+    [self hideAtlasSlot];
+    
     // Store the current download URL for race condition prevention
     self.currentDownloadURL = urlString;
 
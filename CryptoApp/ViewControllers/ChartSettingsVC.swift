@@ -47,6 +47,7 @@ final class ChartSettingsVC: UIViewController {
     private let emaPeriodButton = UIButton(type: .system)
     private let showRSISwitch = UISwitch()
     private let rsiSettingsButton = UIButton(type: .system)
+    private let candleModeSegmentedControl = UISegmentedControl(items: CandleSeriesMode.allCases.map { $0.displayName })
     
     // Volume Section
     private let volumeSectionLabel = UILabel()
@@ -149,6 +150,7 @@ final class ChartSettingsVC: UIViewController {
         setupSegmentedControl(colorThemeSegmentedControl)
         setupSegmentedControl(lineThicknessSegmentedControl)
         setupSegmentedControl(animationSpeedSegmentedControl)
+        setupSegmentedControl(candleModeSegmentedControl)
         
         // Configure buttons
         setupButton(smoothingAlgorithmButton, title: "Algorithm: Adaptive")
@@ -402,6 +404,7 @@ final class ChartSettingsVC: UIViewController {
             
             // Candlestick-Only Settings
             indicatorsSectionLabel,
+            createLabeledControl(label: "Candle Display", control: candleModeSegmentedControl),
             createSettingRowWithBadges(label: "Simple Moving Average", control: showSMASwitch, chartTypes: [.candlestick], helpText: "Technical analysis overlay for trend identification"),
             smaPeriodButton,
             createSettingRowWithBadges(label: "Exponential Moving Average", control: showEMASwitch, chartTypes: [.candlestick], helpText: "Weighted moving average for faster trend detection"),
@@ -544,6 +547,9 @@ final class ChartSettingsVC: UIViewController {
         default: animationSpeedSegmentedControl.selectedSegmentIndex = 2
         }
         
+        // Load candle display mode
+        candleModeSegmentedControl.selectedSegmentIndex = CandleSeriesMode.allCases.firstIndex(of: CandleSeriesMode.saved) ?? 0
+        
         // Load technical indicator settings
         loadIndicatorSettings()
         
@@ -617,6 +623,7 @@ final class ChartSettingsVC: UIViewController {
         colorThemeSegmentedControl.addTarget(self, action: #selector(colorThemeChanged), for: .valueChanged)
         lineThicknessSegmentedControl.addTarget(self, action: #selector(lineThicknessChanged), for: .valueChanged)
         animationSpeedSegmentedControl.addTarget(self, action: #selector(animationSpeedChanged), for: .valueChanged)
+        candleModeSegmentedControl.addTarget(self, action: #selector(candleModeChanged), for: .valueChanged)
         
         // Technical Indicators actions
         showSMASwitch.addTarget(self, action: #selector(smaSwitchChanged), for: .valueChanged)
@@ -694,6 +701,12 @@ final class ChartSettingsVC: UIViewController {
         delegate?.chartSettingsDidUpdate()
     }
     
+    @objc private func candleModeChanged() {
+        let selectedMode = CandleSeriesMode.allCases[candleModeSegmentedControl.selectedSegmentIndex]
+        UserDefaults.standard.set(selectedMode.rawValue, forKey: CandleSeriesMode.userDefaultsKey)
+        delegate?.chartSettingsDidUpdate()
+    }
+    
     @objc private func tradingPresetTapped() {
         applyTradingPreset()
     }
@@ -0,0 +1,222 @@
+import UIKit
+import Combine
+
+/**
+ * COIN COMPARISON SCREEN
+ *
+ * Overlays up to five coins as percent change from a common start, with a shared crosshair
+ * whose values are mirrored in the legend. Fetching and alignment live in CoinComparisonVM.
+ */
+final class CoinComparisonVC: UIViewController {
+
+    // MARK: - Properties
+
+    private let viewModel: CoinComparisonVM
+    private var cancellables = Set<AnyCancellable>()
+
+    private let ranges: [(title: String, days: String)] = [("24h", "1"), ("7d", "7"), ("30d", "30"), ("1y", "365")]
+    private lazy var rangeControl = UISegmentedControl(items: ranges.map { $0.title })
+    private let chartView = ComparisonChartView()
+    private let legendStack = UIStackView()
+    private let activityIndicator = UIActivityIndicatorView(style: .medium)
+    private let messageLabel = UILabel()
+
+    private var comparison: CoinComparison?
+
+    // MARK: - Dependency Injection Initializer
+
+    init(viewModel: CoinComparisonVM = Dependencies.container.coinComparisonViewModel()) {
+        self.viewModel = viewModel
+        super.init(nibName: nil, bundle: nil)
+    }
+
+    required init?(coder: NSCoder) {
+        self.viewModel = Dependencies.container.coinComparisonViewModel()
+        super.init(coder: coder)
+    }
+
+    // MARK: - Lifecycle
+
+    override func viewDidLoad() {
+        super.viewDidLoad()
+        configureView()
+        bindViewModel()
+        viewModel.loadDefaultCoins()
+    }
+
+    override func viewWillDisappear(_ animated: Bool) {
+        super.viewWillDisappear(animated)
+        viewModel.cancelLoading()
+    }
+
+    // MARK: - UI Setup
+
+    private func configureView() {
+        view.backgroundColor = .systemBackground
+        navigationItem.title = "Compare"
+        navigationItem.rightBarButtonItem = UIBarButtonItem(
+            image: UIImage(systemName: "plus"),
+            style: .plain,
+            target: self,
+            action: #selector(addTapped)
+        )
+
+        rangeControl.selectedSegmentIndex = ranges.firstIndex { $0.days == viewModel.currentRange } ?? 2
+        rangeControl.addTarget(self, action: #selector(rangeChanged), for: .valueChanged)
+
+        chartView.onCrosshairMoved = { [weak self] index in
+            self?.updateLegendValues(at: index)
+        }
+
+        legendStack.axis = .vertical
+        legendStack.spacing = 6
+
+        messageLabel.font = .systemFont(ofSize: 14)
+        messageLabel.textColor = .secondaryLabel
+        messageLabel.textAlignment = .center
+        messageLabel.numberOfLines = 0
+
+        activityIndicator.hidesWhenStopped = true
+
+        view.addSubviews(rangeControl, chartView, legendStack, activityIndicator, messageLabel)
+        [rangeControl, chartView, legendStack, activityIndicator, messageLabel].forEach {
+            $0.translatesAutoresizingMaskIntoConstraints = false
+        }
+
+        NSLayoutConstraint.activate([
+            rangeControl.topAnchor.constraint(equalTo: view.safeAreaLayoutGuide.topAnchor, constant: 12),
+            rangeControl.leadingAnchor.constraint(equalTo: view.leadingAnchor, constant: 16),
+            rangeControl.trailingAnchor.constraint(equalTo: view.trailingAnchor, constant: -16),
+
+            chartView.topAnchor.constraint(equalTo: rangeControl.bottomAnchor, constant: 12),
+            chartView.leadingAnchor.constraint(equalTo: view.leadingAnchor),
+            chartView.trailingAnchor.constraint(equalTo: view.trailingAnchor),
+            chartView.heightAnchor.constraint(equalTo: view.heightAnchor, multiplier: 0.45),
+
+            legendStack.topAnchor.constraint(equalTo: chartView.bottomAnchor, constant: 16),
+            legendStack.leadingAnchor.constraint(equalTo: view.leadingAnchor, constant: 16),
+            legendStack.trailingAnchor.constraint(equalTo: view.trailingAnchor, constant: -16),
+
+            activityIndicator.centerXAnchor.constraint(equalTo: chartView.centerXAnchor),
+            activityIndicator.centerYAnchor.constraint(equalTo: chartView.centerYAnchor),
+
+            messageLabel.leadingAnchor.constraint(equalTo: chartView.leadingAnchor, constant: 16),
+            messageLabel.trailingAnchor.constraint(equalTo: chartView.trailingAnchor, constant: -16),
+            messageLabel.centerYAnchor.constraint(equalTo: chartView.centerYAnchor)
+        ])
+    }
+
+    // MARK: - Bindings
+
+    private func bindViewModel() {
+        viewModel.comparison
+            .sinkForUI({ [weak self] comparison in
+                self?.render(comparison)
+            }, storeIn: &cancellables)
+
+        viewModel.selectedCoins
+            .sinkForUI({ [weak self] _ in
+                guard let self = self else { return }
+                self.navigationItem.rightBarButtonItem?.isEnabled = self.viewModel.canAddCoins
+            }, storeIn: &cancellables)
+
+        viewModel.isLoading
+            .sinkForUI({ [weak self] isLoading in
+                isLoading ? self?.activityIndicator.startAnimating() : self?.activityIndicator.stopAnimating()
+            }, storeIn: &cancellables)
+
+        viewModel.errorMessage
+            .sinkForUI({ [weak self] message in
+                self?.messageLabel.text = message
+                self?.messageLabel.isHidden = message == nil
+            }, storeIn: &cancellables)
+    }
+
+    private func render(_ comparison: CoinComparison?) {
+        self.comparison = comparison
+        chartView.configure(with: comparison)
+        rebuildLegend()
+    }
+
+    // MARK: - Legend
+
+    private func rebuildLegend() {
+        legendStack.arrangedSubviews.forEach { $0.removeFromSuperview() }
+        for (index, line) in (comparison?.lines ?? []).enumerated() {
+            legendStack.addArrangedSubview(makeLegendRow(for: line, color: ComparisonChartView.color(at: index)))
+        }
+        updateLegendValues(at: nil)
+    }
+
+    private func makeLegendRow(for line: CoinComparison.Line, color: UIColor) -> UIView {
+        let swatch = UIView()
+        swatch.backgroundColor = color
+        swatch.layer.cornerRadius = 4
+        swatch.translatesAutoresizingMaskIntoConstraints = false
+
+        let symbolLabel = UILabel()
+        symbolLabel.text = line.symbol
+        symbolLabel.font = .systemFont(ofSize: 15, weight: .semibold)
+
+        let valueLabel = UILabel()
+        valueLabel.font = .monospacedDigitSystemFont(ofSize: 15, weight: .regular)
+        valueLabel.textAlignment = .right
+        valueLabel.tag = line.coinId
+
+        var removeConfiguration = UIButton.Configuration.plain()
+        removeConfiguration.image = UIImage(systemName: "xmark.circle.fill")
+        removeConfiguration.baseForegroundColor = .tertiaryLabel
+        let coinId = line.coinId
+        let removeButton = UIButton(configuration: removeConfiguration, primaryAction: UIAction { [weak self] _ in
+            self?.viewModel.removeCoin(id: coinId)
+        })
+
+        let row = UIStackView(arrangedSubviews: [swatch, symbolLabel, valueLabel, removeButton])
+        row.axis = .horizontal
+        row.spacing = 8
+        row.alignment = .center
+        NSLayoutConstraint.activate([
+            swatch.widthAnchor.constraint(equalToConstant: 12),
+            swatch.heightAnchor.constraint(equalToConstant: 12)
+        ])
+        return row
+    }
+
+    /// Shows each line's change at the crosshair index, or its latest change when nothing is highlighted
+    private func updateLegendValues(at index: Int?) {
+        guard let lines = comparison?.lines else { return }
+        for line in lines {
+            guard let label = legendStack.viewWithTag(line.coinId) as? UILabel else { continue }
+            let value = index.flatMap { line.percentChanges[safe: $0] } ?? line.latestChange
+            if let value = value, value.isFinite {
+                label.text = PercentChangeFormatter().stringForValue(value, axis: nil)
+                label.textColor = value >= 0 ? .systemGreen : .systemRed
+            } else {
+                label.text = "—"
+                label.textColor = .secondaryLabel
+            }
+        }
+    }
+
+    // MARK: - Actions
+
+    @objc private func rangeChanged() {
+        guard let range = ranges[safe: rangeControl.selectedSegmentIndex] else { return }
+        viewModel.setRange(range.days)
+    }
+
+    @objc private func addTapped() {
+        let candidates = viewModel.candidateCoins()
+        guard !candidates.isEmpty else { return }
+
+        let sheet = UIAlertController(title: "Add Coin", message: nil, preferredStyle: .actionSheet)
+        for coin in candidates {
+            sheet.addAction(UIAlertAction(title: "\(coin.symbol) · \(coin.name)", style: .default) { [weak self] _ in
+                self?.viewModel.addCoin(coin)
+            })
+        }
+        sheet.addAction(UIAlertAction(title: "Cancel", style: .cancel))
+        sheet.popoverPresentationController?.barButtonItem = navigationItem.rightBarButtonItem
+        present(sheet, animated: true)
+    }
+}
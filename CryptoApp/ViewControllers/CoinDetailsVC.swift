@@ -16,6 +16,7 @@ final class CoinDetailsVC: UIViewController, ChartSettingsDelegate {
     private let viewModel: CoinDetailsVM
     private let tableView = UITableView(frame: .zero, style: .plain)
     private let watchlistManager: WatchlistManagerProtocol
+    private let priceAlertManager: PriceAlertManagerProtocol
     private let networkMonitor: NetworkConnectivityMonitor
     
     // FIXED: Prevent recursive updates during landscape synchronization
@@ -32,7 +33,6 @@ final class CoinDetailsVC: UIViewController, ChartSettingsDelegate {
     private let statsUpdateSubject = PassthroughSubject<Void, Never>()
     
     // UI state tracking
-    private var lastChartUpdateTime: Date?
     private var isUserInteracting = false
     
     // MARK: - Optimization Properties
@@ -45,6 +45,10 @@ final class CoinDetailsVC: UIViewController, ChartSettingsDelegate {
     // MARK: - Navigation Title View
     private var titleCoinImageView: CoinImageView?
     
+    // Chart export (created on first use)
+    private lazy var chartDataExporter = Dependencies.container.chartDataExporter()
+    private var exportCancellable: AnyCancellable?
+    
     // MARK: - Offline Error View
     private var offlineErrorView: OfflineErrorView?
     
@@ -60,6 +64,7 @@ final class CoinDetailsVC: UIViewController, ChartSettingsDelegate {
         self.coin = coin
         self.viewModel = Dependencies.container.coinDetailsViewModel(coin: coin)
         self.watchlistManager = Dependencies.container.watchlistManager()
+        self.priceAlertManager = Dependencies.container.priceAlertManager()
         self.networkMonitor = Dependencies.container.networkConnectivityMonitor()
         super.init(nibName: nil, bundle: nil)
     }
@@ -91,7 +96,19 @@ final class CoinDetailsVC: UIViewController, ChartSettingsDelegate {
             target: self,
             action: #selector(settingsButtonTapped)
         )
-        navigationItem.rightBarButtonItem = settingsButton
+        let exportButton = UIBarButtonItem(
+            image: UIImage(systemName: "square.and.arrow.up"),
+            style: .plain,
+            target: self,
+            action: #selector(exportButtonTapped)
+        )
+        let alertButton = UIBarButtonItem(
+            image: UIImage(systemName: "bell"),
+            style: .plain,
+            target: self,
+            action: #selector(alertButtonTapped)
+        )
+        navigationItem.rightBarButtonItems = [settingsButton, alertButton, exportButton]
     }
     
     private func createCustomTitleView() -> UIView {
@@ -190,6 +207,94 @@ final class CoinDetailsVC: UIViewController, ChartSettingsDelegate {
         present(navigationController, animated: true)
     }
     
+    @objc private func exportButtonTapped() {
+        guard let model = viewModel.currentChartModel, !model.ohlc.isEmpty else {
+            showExportError(ChartExportError.noData)
+            return
+        }
+        
+        let sheet = UIAlertController(title: "Export Chart Data", message: "OHLC, volume and SMA/EMA/RSI", preferredStyle: .actionSheet)
+        for format in ChartDataExporter.Format.allCases {
+            sheet.addAction(UIAlertAction(title: format.displayName, style: .default) { [weak self] _ in
+                guard let self = self else { return }
+                self.exportCancellable = self.chartDataExporter.export(model: model, symbol: self.coin.symbol, format: format)
+                    .sink(receiveCompletion: { [weak self] completion in
+                        if case .failure(let error) = completion {
+                            self?.showExportError(error)
+                        }
+                    }, receiveValue: { [weak self] url in
+                        self?.presentShareSheet(for: url)
+                    })
+            })
+        }
+        sheet.addAction(UIAlertAction(title: "Cancel", style: .cancel))
+        sheet.popoverPresentationController?.barButtonItem = navigationItem.rightBarButtonItems?.last
+        present(sheet, animated: true)
+    }
+    
+    // MARK: - Price Alerts
+    
+    @objc private func alertButtonTapped() {
+        let rules = priceAlertManager.currentRules.filter { $0.coinId == coin.id }
+        let message = rules.isEmpty
+            ? "No alerts for \(coin.symbol.uppercased()) yet"
+            : rules.map { $0.condition.displayText }.joined(separator: "\n")
+        
+        let sheet = UIAlertController(title: "Price Alerts", message: message, preferredStyle: .actionSheet)
+        sheet.addAction(UIAlertAction(title: "Alert When Price Rises Above…", style: .default) { [weak self] _ in
+            self?.promptForAlertLevel(above: true)
+        })
+        sheet.addAction(UIAlertAction(title: "Alert When Price Falls Below…", style: .default) { [weak self] _ in
+            self?.promptForAlertLevel(above: false)
+        })
+        if !rules.isEmpty {
+            sheet.addAction(UIAlertAction(title: "Remove \(rules.count == 1 ? "Alert" : "All \(rules.count) Alerts")", style: .destructive) { [weak self] _ in
+                rules.forEach { self?.priceAlertManager.removeRule(id: $0.id) }
+            })
+        }
+        sheet.addAction(UIAlertAction(title: "Cancel", style: .cancel))
+        sheet.popoverPresentationController?.barButtonItem = navigationItem.rightBarButtonItems?[1]
+        present(sheet, animated: true)
+    }
+    
+    private func promptForAlertLevel(above: Bool) {
+        let currentPrice = coin.quote?["USD"]?.price
+        let alert = UIAlertController(
+            title: above ? "Price Above" : "Price Below",
+            message: currentPrice.map { "Current price \(PriceAlertRule.Condition.formatPrice($0))" },
+            preferredStyle: .alert
+        )
+        alert.addTextField { field in
+            field.keyboardType = .decimalPad
+            field.placeholder = "USD"
+        }
+        alert.addAction(UIAlertAction(title: "Cancel", style: .cancel))
+        alert.addAction(UIAlertAction(title: "Add", style: .default) { [weak self, weak alert] _ in
+            guard let self = self,
+                  let text = alert?.textFields?.first?.text?.replacingOccurrences(of: ",", with: "."),
+                  let level = Double(text), level > 0 else { return }
+            self.priceAlertManager.addRule(PriceAlertRule(
+                coinId: self.coin.id,
+                geckoID: self.coin.slug?.lowercased(),
+                condition: above ? .priceAbove(level) : .priceBelow(level)
+            ))
+        })
+        present(alert, animated: true)
+    }
+    
+    private func presentShareSheet(for url: URL) {
+        let activityVC = UIActivityViewController(activityItems: [url], applicationActivities: nil)
+        activityVC.popoverPresentationController?.barButtonItem = navigationItem.rightBarButtonItems?.last
+        present(activityVC, animated: true)
+    }
+    
+    private func showExportError(_ error: Error) {
+        let message = (error as? ChartExportError)?.localizedDescription ?? error.localizedDescription
+        let alert = UIAlertController(title: "Export Failed", message: message, preferredStyle: .alert)
+        alert.addAction(UIAlertAction(title: "OK", style: .default))
+        present(alert, animated: true)
+    }
+    
     // MARK: - Lifecycle
     // This runs once when the view loads into memory.
     override func viewDidLoad() {
@@ -198,6 +303,7 @@ final class CoinDetailsVC: UIViewController, ChartSettingsDelegate {
         setupTableView()
         bindViewModel()
         bindFilter()
+        bindTimeframes()
         setupScrollDetection()
         setupNetworkMonitoring()
         checkInitialConnectivity()
@@ -510,26 +616,26 @@ final class CoinDetailsVC: UIViewController, ChartSettingsDelegate {
             }
             .store(in: &cancellables)
         
-        // Chart updates with throttling and debouncing to reduce flashing
+        // Line data only reports API activity - rendering is driven by the prepared chart model below
         viewModel.chartPoints
             .receive(on: DispatchQueue.main)
             .removeDuplicates()
-            .debounce(for: .milliseconds(100), scheduler: DispatchQueue.main) // Debounce rapid changes
-            .throttle(for: .seconds(1), scheduler: DispatchQueue.main, latest: true)
             .sink { [weak self] newPoints in
-                guard let self = self else { return }
-                
-                // Skip if user is interacting or no meaningful change
-                guard !self.isUserInteracting,
-                      self.shouldUpdateChart(newPoints: newPoints) else { return }
-                
                 // Report successful API activity to prevent false disconnections
                 if !newPoints.isEmpty {
-                    self.networkMonitor.reportAPISuccess()
+                    self?.networkMonitor.reportAPISuccess()
                 }
-                
-                self.updateChartCell(newPoints)
-                self.lastChartUpdateTime = Date()
+            }
+            .store(in: &cancellables)
+        
+        // Chart updates: one prepared model (line + candles + indicators + volume) per data change
+        viewModel.chartModel
+            .compactMap { $0 }
+            .receive(on: DispatchQueue.main)
+            .debounce(for: .milliseconds(100), scheduler: DispatchQueue.main) // Debounce rapid changes
+            .sink { [weak self] model in
+                guard let self = self, !self.isUserInteracting else { return }
+                self.updateChartCell(with: model)
             }
             .store(in: &cancellables)
         
@@ -599,7 +705,6 @@ final class CoinDetailsVC: UIViewController, ChartSettingsDelegate {
                     self.networkMonitor.reportAPISuccess()
                 }
                 
-                self.updateChartCellWithOHLC(newOHLCData)
                 // Update StatsCell when OHLC data becomes available for Low/High section
                 if !newOHLCData.isEmpty {
                     // OHLC data loaded, refresh stats
@@ -633,48 +738,14 @@ final class CoinDetailsVC: UIViewController, ChartSettingsDelegate {
             .store(in: &cancellables)
     }
     
-    // Simplified chart update logic
-    private func shouldUpdateChart(newPoints: [Double]) -> Bool {
-        // Skip if no data
-        if newPoints.isEmpty { return false }
-        
-        // Skip if too frequent updates (throttled to 1 second by Combine)
-        if let lastUpdate = lastChartUpdateTime,
-           Date().timeIntervalSince(lastUpdate) < 1.0 {
-            return false
-        }
-        
-        return true
-    }
-    
-    private func updateChartCell(_ points: [Double]) {
+    private func updateChartCell(with model: ChartModel) {
         guard let chartCell = getChartCell() else {
             tableView.reloadSections(IndexSet(integer: 2), with: .none)
             return
         }
         
         // ATOMIC UPDATE: Combine data update + settings application to prevent double flash
-        chartCell.updateChartDataWithSettings(
-            points: points, 
-            ohlcData: nil, 
-            range: selectedRange.value,
-            settings: getCurrentChartSettings()
-        )
-    }
-    
-    private func updateChartCellWithOHLC(_ ohlcData: [OHLCData]) {
-        guard let chartCell = getChartCell() else {
-            tableView.reloadSections(IndexSet(integer: 2), with: .none)
-            return
-        }
-        
-        // ATOMIC UPDATE: Combine OHLC data update + settings application to prevent double flash
-        chartCell.updateChartDataWithSettings(
-            points: nil, 
-            ohlcData: ohlcData, 
-            range: selectedRange.value,
-            settings: getCurrentChartSettings()
-        )
+        chartCell.updateChartModel(model, settings: getCurrentChartSettings())
     }
     
     private func getChartCell() -> ChartCell? {
@@ -771,6 +842,14 @@ final class CoinDetailsVC: UIViewController, ChartSettingsDelegate {
             .store(in: &cancellables)
     }
     
+    private func bindTimeframes() {
+        // Candle timeframe options follow the loaded OHLC series (resampled locally, no fetch)
+        Publishers.CombineLatest(viewModel.availableTimeframes, viewModel.selectedTimeframe)
+            .sinkForUI({ [weak self] timeframes, selected in
+                self?.getSegmentCell()?.setTimeframes(timeframes, selected: selected)
+            }, storeIn: &cancellables)
+    }
+    
     private func getSegmentCell() -> SegmentCell? {
         let segmentIndexPath = IndexPath(row: 0, section: 1)
         
@@ -1041,6 +1120,7 @@ final class CoinDetailsVC: UIViewController, ChartSettingsDelegate {
             selectedChartType: currentChartType,
             points: currentPoints,
             ohlcData: currentOHLCData,
+            chartModel: viewModel.currentChartModel,
             viewModel: viewModel
         )
         
@@ -1103,6 +1183,9 @@ final class CoinDetailsVC: UIViewController, ChartSettingsDelegate {
         
         // Apply indicators using the public method
         chartCell.applyTechnicalIndicators(settings, theme: theme)
+        
+        // Prepare buffers for the new settings so later redraws (and landscape) reuse them
+        viewModel.rebuildChartModel()
     }
     
 
@@ -1146,6 +1229,7 @@ final class CoinDetailsVC: UIViewController, ChartSettingsDelegate {
             "colorTheme": UserDefaults.standard.string(forKey: "ChartColorTheme") ?? "classic",
             "lineThickness": UserDefaults.standard.double(forKey: "ChartLineThickness"),
             "animationSpeed": UserDefaults.standard.double(forKey: "ChartAnimationSpeed"),
+            "candleSeriesMode": CandleSeriesMode.saved.rawValue,
             // Include volume settings for persistence
             "showVolume": indicatorSettings.showVolume
         ]
@@ -1178,6 +1262,8 @@ final class CoinDetailsVC: UIViewController, ChartSettingsDelegate {
         let animationSpeed = UserDefaults.standard.double(forKey: "ChartAnimationSpeed")
         chartCell.setAnimationSpeed(animationSpeed)
         
+        chartCell.setCandleSeriesMode(CandleSeriesMode.saved)
+        
         // Apply volume settings
         let indicatorSettings = TechnicalIndicators.loadIndicatorSettings()
         chartCell.updateVolumeSettings(showVolume: indicatorSettings.showVolume)
@@ -1291,15 +1377,24 @@ extension CoinDetailsVC: UITableViewDataSource {
                 self?.presentLandscapeChart()
             }
             
+            cell.setTimeframes(viewModel.currentAvailableTimeframes, selected: viewModel.currentTimeframe)
+            cell.onTimeframeSelect = { [weak self] timeframe in
+                self?.viewModel.setTimeframe(timeframe)
+            }
+            
             cell.selectionStyle = .none
             return cell
             
         case 2: // Chart section
             let cell = tableView.dequeueReusableCell(withIdentifier: "ChartCell", for: indexPath) as! ChartCell
             
-            // Configure with both line and OHLC data
-            cell.configure(points: viewModel.currentChartPoints, range: selectedRange.value)
-            cell.configure(ohlcData: viewModel.currentOHLCData, range: selectedRange.value)
+            // Configure with both line and OHLC data (prepared model when one is available)
+            if let model = viewModel.currentChartModel {
+                cell.configure(model: model)
+            } else {
+                cell.configure(points: viewModel.currentChartPoints, range: selectedRange.value)
+                cell.configure(ohlcData: viewModel.currentOHLCData, range: selectedRange.value)
+            }
             
             // Switch to current chart type
             cell.switchChartType(to: selectedChartType.value)
@@ -38,6 +38,7 @@ final class CoinListVC: UIViewController, UIGestureRecognizerDelegate, NetworkBa
     
     private var isRefreshing = false                                        // Track if refresh is in progress
     private var lastAutoRefreshTime: Date?                                  // Track last auto-refresh time
+    private let prefetchScheduler = ScrollPrefetchScheduler()               // Predicts where scrolling settles for logo/quote prefetch
     
     // MARK: - Sliding Gesture Properties
     
@@ -710,8 +711,8 @@ final class CoinListVC: UIViewController, UIGestureRecognizerDelegate, NetworkBa
         
         collectionView.dataSource = dataSource
         
-        // Set up prefetching data source for optimized image loading
-        collectionView.prefetchDataSource = self
+        // Logo and quote prefetching is driven by ScrollPrefetchScheduler from the scroll delegate
+        // callbacks rather than UIKit's prefetchDataSource suggestions
     }
     
     private func configureEmptyState() {
@@ -761,6 +762,7 @@ final class CoinListVC: UIViewController, UIGestureRecognizerDelegate, NetworkBa
                     snapshot.appendSections([.main])
                     snapshot.appendItems(coins)
                     self.dataSource.apply(snapshot, animatingDifferences: true)
+                    self.replanPrefetchForDataChange()
                 }
             },
             storeIn: &cancellables
@@ -774,6 +776,20 @@ final class CoinListVC: UIViewController, UIGestureRecognizerDelegate, NetworkBa
             storeIn: &cancellables
         )
         
+        // Keep the logo atlas packed with the top-ranked coins (rebuilt in the background on change)
+        Publishers.CombineLatest(viewModel.coins, viewModel.coinLogos)
+            .debounce(for: .seconds(1), scheduler: DispatchQueue.main)
+            .map { coins, logos in
+                coins.sorted { $0.cmcRank < $1.cmcRank }
+                    .prefix(LogoAtlas.defaultCapacity)
+                    .compactMap { logos[$0.id] }
+            }
+            .sink { urls in
+                // Unchanged sets are ignored by the atlas unless it's still missing logos
+                LogoAtlas.shared.update(urls: urls)
+            }
+            .store(in: &cancellables)
+        
         // Bind error message to show alert with retry option
         // DISABLED: Redundant with network banner - user feedback requested removal
         /*
@@ -1012,7 +1028,7 @@ final class CoinListVC: UIViewController, UIGestureRecognizerDelegate, NetworkBa
         // - This calls a ViewModel method that fetches prices only for the listed coin IDs
         // - Once the update completes, mark refresh as finished
         AppLogger.performance("Auto-Refresh | Starting price update cycle...")
-        viewModel.fetchPriceUpdatesForVisibleCoins(visibleCoinIds) { [weak self] in
+        viewModel.fetchPriceUpdatesForVisibleCoins(visibleCoinIds) { [weak self] _ in
             self?.isRefreshing = false
         }
     }
@@ -1115,29 +1131,55 @@ final class CoinListVC: UIViewController, UIGestureRecognizerDelegate, NetworkBa
       // MARK: - Configuration
 }
 
-// MARK: - UICollectionViewDataSourcePrefetching
+// MARK: - Scroll Prefetching
 
-extension CoinListVC: UICollectionViewDataSourcePrefetching {
+extension CoinListVC {
     
-    func collectionView(_ collectionView: UICollectionView, prefetchItemsAt indexPaths: [IndexPath]) {
-        // Extract coin IDs that will be displayed soon
-        let coins = indexPaths.compactMap { indexPath -> Coin? in
-            guard let coin = dataSource.itemIdentifier(for: indexPath) else { return nil }
-            return coin
-        }
+    /// Current list geometry for the prefetch scheduler (single column of fixed-height rows)
+    private var prefetchGeometry: ScrollPrefetchScheduler.Geometry {
+        let layout = collectionView.collectionViewLayout as? UICollectionViewFlowLayout
+        return ScrollPrefetchScheduler.Geometry(
+            viewportHeight: collectionView.bounds.height,
+            contentHeight: collectionView.contentSize.height,
+            rowPitch: (layout?.itemSize.height ?? 0) + (layout?.minimumLineSpacing ?? 0),
+            rowCount: viewModel.currentCoins.count
+        )
+    }
+    
+    private func replanPrefetchForDataChange() {
+        applyPrefetchPlan(prefetchScheduler.dataDidChange(offset: collectionView.contentOffset.y, geometry: prefetchGeometry))
+    }
+    
+    /// Prefetches logos for rows entering the predicted window and cancels only rows that left it
+    private func applyPrefetchPlan(_ plan: ScrollPrefetchScheduler.Plan?) {
+        guard let plan = plan else { return }
+        let coins = viewModel.currentCoins
+        let logos = viewModel.currentCoinLogos
         
-        // Get logo URLs for prefetching
-        let logoURLs = coins.compactMap { coin -> String? in
-            return viewModel.currentCoinLogos[coin.id]
+        // Logos packed in the atlas never need the loader
+        func logoURLs(_ rows: [Int]) -> [String] {
+            rows.compactMap { coins[safe: $0].flatMap { logos[$0.id] } }
+                .filter { LogoAtlas.shared.slot(for: $0) == nil }
         }
         
-        // Prefetch images for smooth scrolling
-        ImageLoader.shared.prefetchImages(urls: logoURLs)
+        ImageLoader.shared.cancelPrefetching(urls: logoURLs(plan.cancelled))
+        ImageLoader.shared.prefetchImages(urls: logoURLs(plan.prefetch), priority: .prefetch)
+        ImageLoader.shared.prefetchImages(urls: logoURLs(plan.speculative), priority: .speculative)
     }
     
-    func collectionView(_ collectionView: UICollectionView, cancelPrefetchingForItemsAt indexPaths: [IndexPath]) {
-        // Cancel prefetching when cells are no longer needed
-        ImageLoader.shared.cancelPrefetching()
+    /// One batched quote refresh for the rows the scroll is predicted to settle on
+    private func refreshQuotesForPredictedRows() {
+        guard !isRefreshing, !viewModel.currentIsLoading else { return }
+        let ids = prefetchScheduler.prefetchRows.compactMap { viewModel.currentCoins[safe: $0]?.id }
+        let staleIds = prefetchScheduler.keysNeedingQuotes(ids, at: CACurrentMediaTime())
+        guard !staleIds.isEmpty else { return }
+        
+        AppLogger.performance("Prefetch | Batched quote refresh for \(staleIds.count) predicted rows")
+        // Rows only count as fresh once their quotes arrived; skipped or failed batches retry next settle
+        viewModel.fetchPriceUpdatesForVisibleCoins(staleIds) { [weak self] fetched in
+            guard fetched else { return }
+            self?.prefetchScheduler.markQuoted(staleIds, at: CACurrentMediaTime())
+        }
     }
 }
 
@@ -1205,6 +1247,11 @@ extension CoinListVC: UICollectionViewDelegate {
     // Implement infinite scroll thresholding with optimizations
     func scrollViewDidScroll(_ scrollView: UIScrollView) {
         
+        // Keep the logo prefetch window on the predicted resting position
+        applyPrefetchPlan(prefetchScheduler.didScroll(offset: scrollView.contentOffset.y,
+                                                      at: CACurrentMediaTime(),
+                                                      geometry: prefetchGeometry))
+        
         // Handle back to top button visibility based on scroll position (only on coins tab)
         let offsetY = scrollView.contentOffset.y
         let currentIndex = segmentControl?.selectedSegmentIndex ?? 0
@@ -1242,6 +1289,34 @@ extension CoinListVC: UICollectionViewDelegate {
             viewModel.loadMoreCoins()
         }
     }
+    
+    func scrollViewWillBeginDragging(_ scrollView: UIScrollView) {
+        prefetchScheduler.willBeginDragging()
+    }
+    
+    // UIKit knows where a fling will stop: prefetch there and batch its quotes before arriving
+    func scrollViewWillEndDragging(_ scrollView: UIScrollView, withVelocity velocity: CGPoint, targetContentOffset: UnsafeMutablePointer<CGPoint>) {
+        applyPrefetchPlan(prefetchScheduler.willEndDragging(targetOffset: targetContentOffset.pointee.y, geometry: prefetchGeometry))
+        refreshQuotesForPredictedRows()
+    }
+    
+    func scrollViewDidEndDragging(_ scrollView: UIScrollView, willDecelerate decelerate: Bool) {
+        guard !decelerate else { return }
+        scrollDidSettle(scrollView)
+    }
+    
+    func scrollViewDidEndDecelerating(_ scrollView: UIScrollView) {
+        scrollDidSettle(scrollView)
+    }
+    
+    func scrollViewDidEndScrollingAnimation(_ scrollView: UIScrollView) {
+        scrollDidSettle(scrollView)
+    }
+    
+    private func scrollDidSettle(_ scrollView: UIScrollView) {
+        applyPrefetchPlan(prefetchScheduler.didSettle(offset: scrollView.contentOffset.y, geometry: prefetchGeometry))
+        refreshQuotesForPredictedRows()
+    }
 }
 
 // MARK: - SortHeaderViewDelegate
@@ -1282,6 +1357,19 @@ extension CoinListVC: FilterHeaderViewDelegate {
         present(nav, animated: true)
     }
     
+    func filterHeaderView(_ headerView: FilterHeaderView, didTapPatternsButton button: FilterButton) {
+        let modalVC = FilterModalVC(filterType: .patterns, currentState: viewModel.currentFilterState)
+        modalVC.delegate = self
+        let nav = UINavigationController(rootViewController: modalVC)
+        nav.modalPresentationStyle = .pageSheet
+        if let sheet = nav.sheetPresentationController {
+            sheet.detents = [.custom { _ in return 400 }] // One row more than the other filters
+            sheet.prefersGrabberVisible = true
+            sheet.preferredCornerRadius = 16
+        }
+        present(nav, animated: true)
+    }
+    
     func filterHeaderView(_ headerView: FilterHeaderView, didTapAddCoinsButton button: UIButton) {
         // Not needed for coin list page (only used in watchlist), but required for protocol conformance
         // Could optionally navigate to search or add functionality here if desired
@@ -1315,6 +1403,16 @@ extension CoinListVC: FilterModalVCDelegate {
         updateAllVisibleCellsForFilterChange() // Update all visible cells for percentage change
     }
     
+    func filterModalVC(_ modalVC: FilterModalVC, didSelectPatternFilter filter: PatternFilter) {
+        AppLogger.ui("Filter Selected: \(filter.displayName)")
+        
+        // Screening runs on cached candles in the background; the list refreshes when results arrive
+        viewModel.updatePatternFilter(filter)
+        
+        // Update header view state to reflect the new filter
+        filterHeaderView.updateFilterState(viewModel.currentFilterState)
+    }
+    
     func filterModalVCDidCancel(_ modalVC: FilterModalVC) {
         // Handle cancellation if needed
         AppLogger.ui("Filter modal was cancelled")
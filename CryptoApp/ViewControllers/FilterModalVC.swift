@@ -5,9 +5,15 @@ import UIKit
 protocol FilterModalVCDelegate: AnyObject {
     func filterModalVC(_ modalVC: FilterModalVC, didSelectPriceChangeFilter filter: PriceChangeFilter)
     func filterModalVC(_ modalVC: FilterModalVC, didSelectTopCoinsFilter filter: TopCoinsFilter)
+    func filterModalVC(_ modalVC: FilterModalVC, didSelectPatternFilter filter: PatternFilter)
     func filterModalVCDidCancel(_ modalVC: FilterModalVC)
 }
 
+extension FilterModalVCDelegate {
+    // Only the coin list offers pattern filtering
+    func filterModalVC(_ modalVC: FilterModalVC, didSelectPatternFilter filter: PatternFilter) {}
+}
+
 // MARK: - FilterModalVC
 
 class FilterModalVC: UIViewController {
@@ -111,6 +117,13 @@ class FilterModalVC: UIViewController {
                     isSelected: filter == currentState.topCoinsFilter
                 )
             }
+        case .patterns:
+            filterOptions = PatternFilter.allCases.map { filter in
+                PatternFilterOption(
+                    filter: filter,
+                    isSelected: filter == currentState.patternFilter
+                )
+            }
         }
     }
     
@@ -173,6 +186,10 @@ extension FilterModalVC: UITableViewDelegate {
                 if let topCoinsOption = selectedOption as? TopCoinsFilterOption {
                     self.delegate?.filterModalVC(self, didSelectTopCoinsFilter: topCoinsOption.filter)
                 }
+            case .patterns:
+                if let patternOption = selectedOption as? PatternFilterOption {
+                    self.delegate?.filterModalVC(self, didSelectPatternFilter: patternOption.filter)
+                }
             }
             
             self.dismiss(cancelled: false)
@@ -24,6 +24,8 @@ final class LandscapeChartVC: UIViewController {
     // Chart data
     private var currentPoints: [Double] = []
     private var currentOHLCData: [OHLCData] = []
+    // Prepared model shared with the portrait chart (nil until one has been built)
+    private var currentModel: ChartModel?
     
     // UI Components
     private let navigationBar = UINavigationBar()
@@ -37,12 +39,13 @@ final class LandscapeChartVC: UIViewController {
     
     // MARK: - Init
     
-    init(coin: Coin, selectedRange: String, selectedChartType: ChartType, points: [Double], ohlcData: [OHLCData], viewModel: CoinDetailsVM) {
+    init(coin: Coin, selectedRange: String, selectedChartType: ChartType, points: [Double], ohlcData: [OHLCData], chartModel: ChartModel? = nil, viewModel: CoinDetailsVM) {
         self.coin = coin
         self.selectedRange = selectedRange
         self.selectedChartType = selectedChartType
         self.currentPoints = points
         self.currentOHLCData = ohlcData
+        self.currentModel = chartModel
         self.viewModel = viewModel
         super.init(nibName: nil, bundle: nil)
     }
@@ -233,9 +236,15 @@ final class LandscapeChartVC: UIViewController {
             candlestickChartView.trailingAnchor.constraint(equalTo: containerView.trailingAnchor)
         ])
         
-        // Load initial data
-        lineChartView.update(currentPoints, range: selectedRange)
-        candlestickChartView.update(currentOHLCData, range: selectedRange)
+        // Load initial data - reuse the portrait chart's prepared model when it matches this range
+        if let model = currentModel, model.key.range == selectedRange {
+            lineChartView.update(model)
+            candlestickChartView.update(model)
+        } else {
+            currentModel = nil
+            lineChartView.update(currentPoints, range: selectedRange)
+            candlestickChartView.update(currentOHLCData, range: selectedRange)
+        }
     }
     
     // MARK: - Controls Setup
@@ -329,33 +338,12 @@ final class LandscapeChartVC: UIViewController {
     // MARK: - ViewModel Binding
     
     private func bindViewModel() {
-        // Bind chart points updates
-        viewModel.chartPoints
-            .receive(on: DispatchQueue.main)
-            .sink { [weak self] points in
-                guard let self = self else { return }
-                self.currentPoints = points
-                self.lineChartView.update(points, range: self.selectedRange)
-                
-                // Apply chart settings after line chart update
-                self.applyChartSettingsToLineChart()
-                
-                print("📊 Landscape: Updated line chart with \(points.count) points")
-            }
-            .store(in: &cancellables)
-        
-        // Bind OHLC data updates
-        viewModel.ohlcData
+        // Bind prepared chart model updates - only the series whose revision changed is redrawn
+        viewModel.chartModel
+            .compactMap { $0 }
             .receive(on: DispatchQueue.main)
-            .sink { [weak self] ohlcData in
-                guard let self = self else { return }
-                self.currentOHLCData = ohlcData
-                self.candlestickChartView.update(ohlcData, range: self.selectedRange)
-                
-                // Apply chart settings after candlestick chart update
-                self.applyChartSettingsToCandlestickChart()
-                
-                print("📊 Landscape: Updated candlestick chart with \(ohlcData.count) OHLC entries")
+            .sink { [weak self] model in
+                self?.applyChartModel(model)
             }
             .store(in: &cancellables)
         
@@ -392,6 +380,28 @@ final class LandscapeChartVC: UIViewController {
         */
     }
     
+    private func applyChartModel(_ model: ChartModel) {
+        let previous = currentModel
+        currentModel = model
+        let rangeChanged = previous?.key.range != model.key.range
+        
+        if rangeChanged || previous?.pointsRevision != model.pointsRevision {
+            currentPoints = model.points
+            lineChartView.update(model)
+            
+            // Apply chart settings after line chart update
+            applyChartSettingsToLineChart()
+        }
+        
+        if rangeChanged || previous?.key.timeframe != model.key.timeframe || previous?.ohlcRevision != model.ohlcRevision {
+            currentOHLCData = model.ohlc
+            candlestickChartView.update(model)
+            
+            // Apply chart settings after candlestick chart update
+            applyChartSettingsToCandlestickChart()
+        }
+    }
+    
     private func showErrorAlert(message: String) {
         let alert = UIAlertController(title: "Error", message: message, preferredStyle: .alert)
         alert.addAction(UIAlertAction(title: "OK", style: .default))
@@ -518,6 +528,9 @@ final class LandscapeChartVC: UIViewController {
         let animationSpeed = UserDefaults.standard.double(forKey: "ChartAnimationSpeed")
         candlestickChartView.setAnimationSpeed(animationSpeed)
         
+        // Candle display mode (derived views are cached per series, so this is cheap to re-apply)
+        candlestickChartView.setSeriesMode(CandleSeriesMode.saved)
+        
         // Apply technical indicators if any are enabled
         applyTechnicalIndicatorsToCandlestickChart()
     }
@@ -267,7 +267,7 @@ import Combine
         // The search functionality is reactive and will work when needed
         
         // Ensure search functionality is working by checking if data is available
-        if viewModel.cachedCoins.isEmpty {
+        if viewModel.cachedCoins.isEmpty && !viewModel.isReloadingCoins {
             AppLogger.search("SearchVC: Refreshing search data after returning from child")
             viewModel.refreshSearchData()
         }
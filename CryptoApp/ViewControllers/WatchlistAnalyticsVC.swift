@@ -0,0 +1,217 @@
+import UIKit
+import Combine
+
+/**
+ * WATCHLIST ANALYTICS SCREEN
+ *
+ * Correlation heatmap plus per-coin beta vs BTC and realised volatility for the watchlist.
+ * All computation happens in WatchlistAnalyticsVM off the main thread.
+ */
+final class WatchlistAnalyticsVC: UIViewController {
+
+    // MARK: - Properties
+
+    private let viewModel: WatchlistAnalyticsVM
+    private var cancellables = Set<AnyCancellable>()
+
+    private let ranges: [(title: String, days: String)] = [("24h", "1"), ("7d", "7"), ("30d", "30"), ("1y", "365")]
+    private lazy var rangeControl = UISegmentedControl(items: ranges.map { $0.title })
+    private let heatmapView = CorrelationHeatmapView()
+    private let tableView = UITableView(frame: .zero, style: .insetGrouped)
+    private let activityIndicator = UIActivityIndicatorView(style: .medium)
+    private let messageLabel = UILabel()
+
+    private var metrics: [WatchlistAnalytics.CoinMetrics] = []
+
+    // MARK: - Dependency Injection Initializer
+
+    init(viewModel: WatchlistAnalyticsVM = Dependencies.container.watchlistAnalyticsViewModel()) {
+        self.viewModel = viewModel
+        super.init(nibName: nil, bundle: nil)
+    }
+
+    required init?(coder: NSCoder) {
+        self.viewModel = Dependencies.container.watchlistAnalyticsViewModel()
+        super.init(coder: coder)
+    }
+
+    // MARK: - Lifecycle
+
+    override func viewDidLoad() {
+        super.viewDidLoad()
+        configureView()
+        bindViewModel()
+        viewModel.loadAnalytics(range: viewModel.currentRange)
+    }
+
+    override func viewWillDisappear(_ animated: Bool) {
+        super.viewWillDisappear(animated)
+        viewModel.cancelLoading()
+    }
+
+    // MARK: - UI Setup
+
+    private func configureView() {
+        view.backgroundColor = .systemBackground
+        navigationItem.title = "Correlation"
+
+        rangeControl.selectedSegmentIndex = ranges.firstIndex { $0.days == viewModel.currentRange } ?? 2
+        rangeControl.addTarget(self, action: #selector(rangeChanged), for: .valueChanged)
+
+        tableView.dataSource = self
+        tableView.register(UITableViewCell.self, forCellReuseIdentifier: "MetricCell")
+
+        messageLabel.font = .systemFont(ofSize: 14)
+        messageLabel.textColor = .secondaryLabel
+        messageLabel.textAlignment = .center
+        messageLabel.numberOfLines = 0
+
+        activityIndicator.hidesWhenStopped = true
+
+        view.addSubviews(rangeControl, heatmapView, tableView, activityIndicator, messageLabel)
+        [rangeControl, heatmapView, tableView, activityIndicator, messageLabel].forEach {
+            $0.translatesAutoresizingMaskIntoConstraints = false
+        }
+
+        NSLayoutConstraint.activate([
+            rangeControl.topAnchor.constraint(equalTo: view.safeAreaLayoutGuide.topAnchor, constant: 12),
+            rangeControl.leadingAnchor.constraint(equalTo: view.leadingAnchor, constant: 16),
+            rangeControl.trailingAnchor.constraint(equalTo: view.trailingAnchor, constant: -16),
+
+            heatmapView.topAnchor.constraint(equalTo: rangeControl.bottomAnchor, constant: 12),
+            heatmapView.leadingAnchor.constraint(equalTo: view.leadingAnchor, constant: 16),
+            heatmapView.trailingAnchor.constraint(equalTo: view.trailingAnchor, constant: -16),
+            heatmapView.heightAnchor.constraint(equalTo: heatmapView.widthAnchor),
+
+            tableView.topAnchor.constraint(equalTo: heatmapView.bottomAnchor, constant: 8),
+            tableView.leadingAnchor.constraint(equalTo: view.leadingAnchor),
+            tableView.trailingAnchor.constraint(equalTo: view.trailingAnchor),
+            tableView.bottomAnchor.constraint(equalTo: view.bottomAnchor),
+
+            activityIndicator.centerXAnchor.constraint(equalTo: heatmapView.centerXAnchor),
+            activityIndicator.centerYAnchor.constraint(equalTo: heatmapView.centerYAnchor),
+
+            messageLabel.leadingAnchor.constraint(equalTo: heatmapView.leadingAnchor),
+            messageLabel.trailingAnchor.constraint(equalTo: heatmapView.trailingAnchor),
+            messageLabel.centerYAnchor.constraint(equalTo: heatmapView.centerYAnchor)
+        ])
+    }
+
+    // MARK: - Bindings
+
+    private func bindViewModel() {
+        viewModel.analytics
+            .sinkForUI({ [weak self] analytics in
+                self?.render(analytics)
+            }, storeIn: &cancellables)
+
+        viewModel.isLoading
+            .sinkForUI({ [weak self] isLoading in
+                isLoading ? self?.activityIndicator.startAnimating() : self?.activityIndicator.stopAnimating()
+            }, storeIn: &cancellables)
+
+        viewModel.errorMessage
+            .sinkForUI({ [weak self] message in
+                self?.messageLabel.text = message
+                self?.messageLabel.isHidden = message == nil
+            }, storeIn: &cancellables)
+    }
+
+    private func render(_ analytics: WatchlistAnalytics?) {
+        metrics = analytics?.coins ?? []
+        heatmapView.configure(with: analytics)
+        tableView.reloadData()
+    }
+
+    @objc private func rangeChanged() {
+        guard let range = ranges[safe: rangeControl.selectedSegmentIndex] else { return }
+        viewModel.loadAnalytics(range: range.days)
+    }
+}
+
+// MARK: - UITableViewDataSource
+
+extension WatchlistAnalyticsVC: UITableViewDataSource {
+    func tableView(_ tableView: UITableView, numberOfRowsInSection section: Int) -> Int {
+        metrics.count
+    }
+
+    func tableView(_ tableView: UITableView, titleForHeaderInSection section: Int) -> String? {
+        metrics.isEmpty ? nil : "Beta vs BTC · Realised Volatility"
+    }
+
+    func tableView(_ tableView: UITableView, cellForRowAt indexPath: IndexPath) -> UITableViewCell {
+        let cell = tableView.dequeueReusableCell(withIdentifier: "MetricCell", for: indexPath)
+        let metric = metrics[indexPath.row]
+
+        var content = UIListContentConfiguration.valueCell()
+        content.text = metric.symbol
+        let beta = metric.beta.map { String(format: "β %.2f", $0) } ?? "β —"
+        let rolling = metric.rollingBeta.map { String(format: " (%.2f)", $0) } ?? ""
+        content.secondaryText = "\(beta)\(rolling)   σ \(String(format: "%.0f%%", metric.volatility * 100))"
+        cell.contentConfiguration = content
+        cell.selectionStyle = .none
+        return cell
+    }
+}
+
+// MARK: - Correlation Heatmap View
+
+/// Draws the k×k correlation matrix: red for -1, clear for 0, green for +1
+final class CorrelationHeatmapView: UIView {
+
+    private var analytics: WatchlistAnalytics?
+
+    override init(frame: CGRect) {
+        super.init(frame: frame)
+        backgroundColor = .secondarySystemBackground
+        layer.cornerRadius = 8
+        clipsToBounds = true
+        contentMode = .redraw
+    }
+
+    required init?(coder: NSCoder) {
+        fatalError("init(coder:) has not been implemented")
+    }
+
+    func configure(with analytics: WatchlistAnalytics?) {
+        self.analytics = analytics
+        setNeedsDisplay()
+    }
+
+    override func draw(_ rect: CGRect) {
+        guard let analytics = analytics, let context = UIGraphicsGetCurrentContext() else { return }
+        let count = analytics.coins.count
+        guard count > 0 else { return }
+
+        let labelWidth: CGFloat = count <= 12 ? 36 : 0
+        let cellSize = (min(bounds.width, bounds.height) - labelWidth) / CGFloat(count)
+        let font = UIFont.systemFont(ofSize: min(10, cellSize * 0.4), weight: .medium)
+
+        for i in 0..<count {
+            for j in 0..<count {
+                let value = analytics.correlation(i, j)
+                let color: UIColor
+                if value.isNaN {
+                    color = .systemGray4
+                } else {
+                    color = (value >= 0 ? UIColor.systemGreen : UIColor.systemRed).withAlphaComponent(CGFloat(abs(value)))
+                }
+                context.setFillColor(color.cgColor)
+                context.fill(CGRect(x: labelWidth + CGFloat(j) * cellSize,
+                                    y: labelWidth + CGFloat(i) * cellSize,
+                                    width: cellSize - 0.5,
+                                    height: cellSize - 0.5))
+            }
+        }
+
+        guard labelWidth > 0 else { return }
+        let attributes: [NSAttributedString.Key: Any] = [.font: font, .foregroundColor: UIColor.secondaryLabel]
+        for (index, coin) in analytics.coins.enumerated() {
+            let offset = labelWidth + CGFloat(index) * cellSize
+            let label = coin.symbol as NSString
+            label.draw(at: CGPoint(x: 2, y: offset + (cellSize - font.lineHeight) / 2), withAttributes: attributes)
+            label.draw(at: CGPoint(x: offset + 2, y: (labelWidth - font.lineHeight) / 2), withAttributes: attributes)
+        }
+    }
+}
@@ -17,6 +17,8 @@ final class WatchlistVC: UIViewController {
     private var dataSource: UICollectionViewDiffableDataSource<WatchlistSection, Coin>!
     
     private let refreshControl = UIRefreshControl()
+    private lazy var chartDataExporter = Dependencies.container.chartDataExporter()
+    private var exportCancellable: AnyCancellable?
     private var emptyStateView: UIContentUnavailableView!
     private var filterHeaderView: FilterHeaderView!
     private var sortHeaderView: SortHeaderView!
@@ -127,7 +129,70 @@ final class WatchlistVC: UIViewController {
             action: #selector(clearAllTapped)
         )
         clearAllButton.tintColor = .systemRed
-        navigationItem.rightBarButtonItem = clearAllButton
+        let exportButton = UIBarButtonItem(
+            image: UIImage(systemName: "square.and.arrow.up"),
+            style: .plain,
+            target: self,
+            action: #selector(exportTapped)
+        )
+        navigationItem.rightBarButtonItems = [clearAllButton, exportButton]
+        
+        let analyticsButton = UIBarButtonItem(
+            image: UIImage(systemName: "square.grid.3x3.fill"),
+            style: .plain,
+            target: self,
+            action: #selector(analyticsTapped)
+        )
+        let compareButton = UIBarButtonItem(
+            image: UIImage(systemName: "chart.xyaxis.line"),
+            style: .plain,
+            target: self,
+            action: #selector(compareTapped)
+        )
+        navigationItem.leftBarButtonItems = [analyticsButton, compareButton]
+    }
+    
+    @objc private func analyticsTapped() {
+        navigationController?.pushViewController(WatchlistAnalyticsVC(), animated: true)
+    }
+    
+    @objc private func compareTapped() {
+        navigationController?.pushViewController(CoinComparisonVC(), animated: true)
+    }
+    
+    /// Exports a year of candles for every watched coin into one file (streamed coin by coin)
+    @objc private func exportTapped() {
+        let coins = viewModel.currentWatchlistCoins
+        guard !coins.isEmpty else { return }
+        
+        let sheet = UIAlertController(title: "Export Watchlist", message: "1y OHLC, volume and indicators", preferredStyle: .actionSheet)
+        for format in ChartDataExporter.Format.allCases {
+            sheet.addAction(UIAlertAction(title: format.displayName, style: .default) { [weak self] _ in
+                self?.exportWatchlist(coins, format: format)
+            })
+        }
+        sheet.addAction(UIAlertAction(title: "Cancel", style: .cancel))
+        sheet.popoverPresentationController?.barButtonItem = navigationItem.rightBarButtonItems?.last
+        present(sheet, animated: true)
+    }
+    
+    private func exportWatchlist(_ coins: [Coin], format: ChartDataExporter.Format) {
+        navigationItem.rightBarButtonItems?.last?.isEnabled = false
+        exportCancellable = chartDataExporter.exportWatchlist(coins: coins, range: "365", format: format)
+            .sink(receiveCompletion: { [weak self] completion in
+                guard let self = self else { return }
+                self.navigationItem.rightBarButtonItems?.last?.isEnabled = true
+                if case .failure(let error) = completion {
+                    let message = (error as? ChartExportError)?.localizedDescription ?? error.localizedDescription
+                    let alert = UIAlertController(title: "Export Failed", message: message, preferredStyle: .alert)
+                    alert.addAction(UIAlertAction(title: "OK", style: .default))
+                    self.present(alert, animated: true)
+                }
+            }, receiveValue: { [weak self] url in
+                let activityVC = UIActivityViewController(activityItems: [url], applicationActivities: nil)
+                activityVC.popoverPresentationController?.barButtonItem = self?.navigationItem.rightBarButtonItems?.last
+                self?.present(activityVC, animated: true)
+            })
     }
     
     @objc private func clearAllTapped() {
@@ -384,7 +449,8 @@ final class WatchlistVC: UIViewController {
     }
     
     private func updateNavigationItems(hasCoins: Bool) {
-        navigationItem.rightBarButtonItem?.isEnabled = hasCoins
+        navigationItem.rightBarButtonItems?.forEach { $0.isEnabled = hasCoins }
+        navigationItem.leftBarButtonItems?.forEach { $0.isEnabled = hasCoins }
     }
     
     // MARK: - Empty State
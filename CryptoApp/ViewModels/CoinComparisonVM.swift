@@ -0,0 +1,241 @@
+import Foundation
+import Combine
+
+// MARK: - Coin Comparison Model
+
+/// Aligned, percent-normalised price lines for the comparison chart
+struct CoinComparison {
+
+    struct Line {
+        let coinId: Int
+        let symbol: String
+        /// Percent change from the first aligned point, index-aligned with `timestamps`
+        let percentChanges: [Double]
+
+        var latestChange: Double? {
+            percentChanges.last.flatMap { $0.isFinite ? $0 : nil }
+        }
+    }
+
+    let range: String
+    let timestamps: [Date]
+    let lines: [Line]
+
+    var isEmpty: Bool { timestamps.isEmpty || lines.isEmpty }
+}
+
+/**
+ * COIN COMPARISON VIEW MODEL
+ *
+ * Overlays up to `maxCoins` coins as percent change from a common start on one time grid.
+ *
+ * Data flow:
+ * - Candle series come from CoinManager.fetchOHLCData (cache-first, low priority, deduplicated
+ *   by RequestManager), so coins already opened in detail don't hit the network again
+ * - Raw series are kept per range and coin: adding or removing a coin only fetches what is
+ *   missing and re-runs the SeriesAligner merge join, removing never touches the network
+ * - Alignment runs on a background queue; a generation token drops results that were
+ *   overtaken by a newer selection or range
+ */
+final class CoinComparisonVM {
+
+    // MARK: - Private Subjects
+
+    private let comparisonSubject = CurrentValueSubject<CoinComparison?, Never>(nil)
+    private let selectedCoinsSubject = CurrentValueSubject<[Coin], Never>([])
+    private let isLoadingSubject = CurrentValueSubject<Bool, Never>(false)
+    private let errorMessageSubject = CurrentValueSubject<String?, Never>(nil)
+
+    // MARK: - Published AnyPublisher Properties
+
+    var comparison: AnyPublisher<CoinComparison?, Never> {
+        comparisonSubject.eraseToAnyPublisher()
+    }
+
+    var selectedCoins: AnyPublisher<[Coin], Never> {
+        selectedCoinsSubject.eraseToAnyPublisher()
+    }
+
+    var isLoading: AnyPublisher<Bool, Never> {
+        isLoadingSubject.eraseToAnyPublisher()
+    }
+
+    var errorMessage: AnyPublisher<String?, Never> {
+        errorMessageSubject.eraseToAnyPublisher()
+    }
+
+    var currentSelection: [Coin] {
+        selectedCoinsSubject.value
+    }
+
+    var canAddCoins: Bool {
+        selectedCoinsSubject.value.count < Self.maxCoins
+    }
+
+    // MARK: - Dependencies
+
+    private let watchlistManager: WatchlistManagerProtocol
+    private let coinManager: CoinManagerProtocol
+    private let sharedCoinDataManager: SharedCoinDataManagerProtocol
+    private var loadCancellable: AnyCancellable?
+
+    // MARK: - State (main thread)
+
+    private let computeQueue = DispatchQueue(label: "coin.comparison", qos: .userInitiated)
+    /// Raw candles per range, then per coin ID; empty arrays mark coins with no data for that range
+    private var seriesCache: [String: [Int: [OHLCData]]] = [:]
+    private var generation = 0
+
+    private(set) var currentRange = "30"
+
+    // MARK: - Constants
+
+    static let maxCoins = 5
+    static let benchmarkCoinId = WatchlistAnalyticsVM.benchmarkCoinId
+
+    // MARK: - Dependency Injection Initializer
+
+    init(
+        watchlistManager: WatchlistManagerProtocol,
+        coinManager: CoinManagerProtocol,
+        sharedCoinDataManager: SharedCoinDataManagerProtocol
+    ) {
+        self.watchlistManager = watchlistManager
+        self.coinManager = coinManager
+        self.sharedCoinDataManager = sharedCoinDataManager
+    }
+
+    deinit {
+        loadCancellable?.cancel()
+    }
+
+    // MARK: - Selection
+
+    /// BTC plus the first watchlist coins, up to `maxCoins`
+    func loadDefaultCoins() {
+        var coins = sharedCoinDataManager.getCoinsForIds([Self.benchmarkCoinId])
+        for coin in watchlistManager.getWatchlistCoins() where !coins.contains(where: { $0.id == coin.id }) {
+            coins.append(coin)
+        }
+        selectedCoinsSubject.send(Array(coins.prefix(Self.maxCoins)))
+        refresh()
+    }
+
+    func addCoin(_ coin: Coin) {
+        var coins = selectedCoinsSubject.value
+        guard coins.count < Self.maxCoins, !coins.contains(where: { $0.id == coin.id }) else { return }
+        coins.append(coin)
+        selectedCoinsSubject.send(coins)
+        refresh()
+    }
+
+    func removeCoin(id: Int) {
+        var coins = selectedCoinsSubject.value
+        guard let index = coins.firstIndex(where: { $0.id == id }) else { return }
+        coins.remove(at: index)
+        selectedCoinsSubject.send(coins)
+        refresh()
+    }
+
+    func setRange(_ range: String) {
+        guard range != currentRange else { return }
+        currentRange = range
+        refresh()
+    }
+
+    /// Watchlist coins first, then the top shared coins, excluding those already selected
+    func candidateCoins(limit: Int = 20) -> [Coin] {
+        let selected = Set(selectedCoinsSubject.value.map { $0.id })
+        var seen = selected
+        var candidates: [Coin] = []
+        for coin in watchlistManager.getWatchlistCoins() + sharedCoinDataManager.currentCoins
+        where candidates.count < limit && seen.insert(coin.id).inserted {
+            candidates.append(coin)
+        }
+        return candidates
+    }
+
+    func cancelLoading() {
+        loadCancellable?.cancel()
+        isLoadingSubject.send(false)
+    }
+
+    // MARK: - Loading
+
+    /// Fetches only coins missing from the cache for the current range (including earlier failures), then re-aligns
+    private func refresh() {
+        let range = currentRange
+        let cached = seriesCache[range] ?? [:]
+        let missing = selectedCoinsSubject.value.filter { cached[$0.id] == nil }
+
+        guard !missing.isEmpty else {
+            loadCancellable?.cancel()
+            isLoadingSubject.send(false)
+            realign()
+            return
+        }
+
+        isLoadingSubject.send(true)
+        errorMessageSubject.send(nil)
+
+        let requests = missing.map { coin -> AnyPublisher<(Int, [OHLCData]), Never> in
+            coinManager.fetchOHLCData(for: coin.slug?.lowercased() ?? coin.name.lowercased(), range: range, currency: "usd", priority: .low)
+                .map { (coin.id, $0) }
+                .replaceError(with: (coin.id, []))
+                .eraseToAnyPublisher()
+        }
+
+        loadCancellable = Publishers.MergeMany(requests)
+            .collect()
+            .receive(on: DispatchQueue.main)
+            .sink { [weak self] results in
+                guard let self = self else { return }
+                // Failed or empty fetches aren't cached, so the next refresh retries them
+                for (coinId, candles) in results where !candles.isEmpty {
+                    self.seriesCache[range, default: [:]][coinId] = candles
+                }
+                self.isLoadingSubject.send(false)
+                if range == self.currentRange {
+                    self.realign()
+                }
+            }
+    }
+
+    /// Runs the merge join for the current selection off the main thread
+    private func realign() {
+        let range = currentRange
+        let coins = selectedCoinsSubject.value
+        let cached = seriesCache[range] ?? [:]
+        let usable = coins.compactMap { coin -> (Coin, [OHLCData])? in
+            guard let candles = cached[coin.id], candles.count > 1 else { return nil }
+            return (coin, candles)
+        }
+
+        generation += 1
+        let token = generation
+
+        guard !usable.isEmpty else {
+            comparisonSubject.send(nil)
+            errorMessageSubject.send(coins.isEmpty ? "Add coins to compare" : "No price history for this range")
+            return
+        }
+
+        computeQueue.async { [weak self] in
+            let alignment = SeriesAligner.align(candles: usable.map { $0.1 })
+            let percents = alignment.percentChanges()
+            let comparison = CoinComparison(
+                range: range,
+                timestamps: alignment.timestamps,
+                lines: usable.indices.map { i in
+                    CoinComparison.Line(coinId: usable[i].0.id, symbol: usable[i].0.symbol, percentChanges: percents[i])
+                }
+            )
+
+            DispatchQueue.main.async {
+                guard let self = self, token == self.generation else { return }
+                self.errorMessageSubject.send(comparison.isEmpty ? "Price histories don't overlap" : nil)
+                self.comparisonSubject.send(comparison.isEmpty ? nil : comparison)
+            }
+        }
+    }
+}
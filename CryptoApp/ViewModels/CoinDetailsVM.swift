@@ -50,6 +50,9 @@ final class CoinDetailsVM: ObservableObject {
     private let lastErrorSubject = CurrentValueSubject<Error?, Never>(nil)
     private let isLoadingSubject = CurrentValueSubject<Bool, Never>(false)
     private let priceChangeSubject = CurrentValueSubject<PriceChangeIndicator?, Never>(nil)
+    private let selectedTimeframeSubject = CurrentValueSubject<OHLCTimeframe, Never>(.native)
+    private let availableTimeframesSubject = CurrentValueSubject<[OHLCTimeframe], Never>([.native])
+    private let chartModelSubject = CurrentValueSubject<ChartModel?, Never>(nil)
     
     // FIXED: Request cancellation management
     private var chartDataCancellable: AnyCancellable?
@@ -67,6 +70,11 @@ final class CoinDetailsVM: ObservableObject {
         ohlcDataSubject.eraseToAnyPublisher()
     }
     
+    /// Render-ready chart data shared by the portrait cell, landscape chart and volume pane
+    var chartModel: AnyPublisher<ChartModel?, Never> {
+        chartModelSubject.eraseToAnyPublisher()
+    }
+    
     var statsOhlcData: AnyPublisher<[String: [OHLCData]], Never> {
         statsOhlcDataSubject.eraseToAnyPublisher()
     }
@@ -95,6 +103,15 @@ final class CoinDetailsVM: ObservableObject {
         priceChangeSubject.eraseToAnyPublisher()
     }
     
+    var selectedTimeframe: AnyPublisher<OHLCTimeframe, Never> {
+        selectedTimeframeSubject.eraseToAnyPublisher()
+    }
+    
+    /// Candle timeframes derivable from the current OHLC series without another request
+    var availableTimeframes: AnyPublisher<[OHLCTimeframe], Never> {
+        availableTimeframesSubject.eraseToAnyPublisher()
+    }
+    
     // MARK: - Current Value Accessors (For Internal Logic)
     
     var currentChartPoints: [Double] {
@@ -116,6 +133,18 @@ final class CoinDetailsVM: ObservableObject {
     var currentCoin: Coin {
         coinDataSubject.value
     }
+    
+    var currentTimeframe: OHLCTimeframe {
+        selectedTimeframeSubject.value
+    }
+    
+    var currentAvailableTimeframes: [OHLCTimeframe] {
+        availableTimeframesSubject.value
+    }
+    
+    var currentChartModel: ChartModel? {
+        chartModelSubject.value
+    }
 
     // MARK: - Core Dependencies
     
@@ -136,6 +165,17 @@ final class CoinDetailsVM: ObservableObject {
     
     private var currentRange: String = "24h"
     private var currentChartType: ChartType = .line
+    
+    // Source OHLC series as returned by the API, plus timeframes derived from it (cleared when the source changes)
+    private var sourceOHLCData: [OHLCData] = []
+    private var resampledOHLCCache: [OHLCTimeframe: [OHLCData]] = [:]
+    
+    // Chart model preparation: revisions stamp each published series so views can diff models in O(1);
+    // the generation drops builds that were overtaken by newer data before they finished
+    private let chartModelQueue = DispatchQueue(label: "com.cryptoapp.chartmodel", qos: .userInitiated)
+    private var pointsRevision = 0
+    private var ohlcRevision = 0
+    private var chartModelGeneration = 0
 
     // MARK: - Computed Properties
     
@@ -175,8 +215,75 @@ final class CoinDetailsVM: ObservableObject {
         // SUBSCRIBE TO SHARED DATA: Get real-time price updates
         setupSharedCoinDataListener()
         
+        // Prepare one chart model per data change for every chart view
+        setupChartModelPipeline()
+        
         // Fetch initial OHLC data for default stats range (24h)
         fetchStatsOHLCData(for: "24h")
+        
+        MemoryAccountant.shared.register(self)
+    }
+    
+    // MARK: - Chart Model Preparation
+    
+    /**
+     * CHART MODEL PIPELINE
+     *
+     * Every published line/candle series bumps its revision and schedules a ChartModel build
+     * on a background queue. Dates, bounds, volumes and indicator buffers are computed there
+     * once, instead of separately by each chart view on the main thread.
+     */
+    private func setupChartModelPipeline() {
+        chartPointsSubject
+            .dropFirst()
+            .sink { [weak self] _ in
+                guard let self = self else { return }
+                self.pointsRevision += 1
+                self.rebuildChartModel()
+            }
+            .store(in: &cancellables)
+        
+        ohlcDataSubject
+            .dropFirst()
+            .sink { [weak self] _ in
+                guard let self = self else { return }
+                self.ohlcRevision += 1
+                self.rebuildChartModel()
+            }
+            .store(in: &cancellables)
+    }
+    
+    /// Rebuilds the model for the current series and indicator settings (e.g. after settings change)
+    func rebuildChartModel() {
+        let key = ChartModel.Key(coinID: coin.id,
+                                 range: currentRange,
+                                 timeframe: selectedTimeframeSubject.value,
+                                 settings: TechnicalIndicators.loadIndicatorSettings())
+        if let current = chartModelSubject.value,
+           current.key == key,
+           current.pointsRevision == pointsRevision,
+           current.ohlcRevision == ohlcRevision {
+            return
+        }
+        
+        chartModelGeneration += 1
+        let generation = chartModelGeneration
+        let points = chartPointsSubject.value
+        let ohlc = ohlcDataSubject.value
+        let pointsRevision = self.pointsRevision
+        let ohlcRevision = self.ohlcRevision
+        
+        chartModelQueue.async { [weak self] in
+            let model = ChartModel(key: key,
+                                   points: points,
+                                   ohlc: ohlc,
+                                   pointsRevision: pointsRevision,
+                                   ohlcRevision: ohlcRevision)
+            DispatchQueue.main.async {
+                guard let self = self, generation == self.chartModelGeneration else { return }
+                self.chartModelSubject.send(model)
+            }
+        }
     }
     
     // MARK: - Shared Data Management
@@ -255,7 +362,7 @@ final class CoinDetailsVM: ObservableObject {
             if let geckoID = geckoID,
                let cachedOHLCData = CacheService.shared.getOHLCData(for: geckoID, currency: "usd", days: mapRangeToDays(targetRange)),
                !cachedOHLCData.isEmpty {
-                ohlcDataSubject.send(cachedOHLCData)
+                publishOHLCData(cachedOHLCData)
                 errorMessageSubject.send(nil)
                 return
             }
@@ -312,7 +419,7 @@ final class CoinDetailsVM: ObservableObject {
             // FIXED: Always fetch OHLC data for Low/High section, regardless of chart type
             if let cachedOHLCData = CacheService.shared.getOHLCData(for: geckoID, currency: "usd", days: days),
                !cachedOHLCData.isEmpty {
-                ohlcDataSubject.send(cachedOHLCData)
+                publishOHLCData(cachedOHLCData)
             } else {
                 fetchOHLCDataCombine(for: range)
             }
@@ -380,7 +487,7 @@ final class CoinDetailsVM: ObservableObject {
         // Check cache first using Combine
         if let cachedOHLCData = CacheService.shared.getOHLCData(for: geckoID, currency: "usd", days: days),
            !cachedOHLCData.isEmpty {
-            ohlcDataSubject.send(cachedOHLCData)
+            publishOHLCData(cachedOHLCData)
             return
         }
         
@@ -404,11 +511,58 @@ final class CoinDetailsVM: ObservableObject {
                     }
                 },
                 receiveValue: { [weak self] ohlcData in
-                    self?.ohlcDataSubject.send(ohlcData)
+                    self?.publishOHLCData(ohlcData)
                 }
             )
     }
     
+    // MARK: - Candle Timeframes
+    
+    /**
+     * Switches the candle timeframe using the already-loaded series (no network request).
+     * Each derived timeframe is resampled once and cached until the source series changes.
+     */
+    func setTimeframe(_ timeframe: OHLCTimeframe) {
+        guard availableTimeframesSubject.value.contains(timeframe) else { return }
+        selectedTimeframeSubject.send(timeframe)
+        ohlcDataSubject.send(ohlcData(for: timeframe))
+    }
+    
+    private func publishOHLCData(_ source: [OHLCData]) {
+        if !isSameSeries(source, sourceOHLCData) {
+            sourceOHLCData = source
+            resampledOHLCCache.removeAll()
+            
+            let available = OHLCResampler.availableTimeframes(for: source)
+            availableTimeframesSubject.send(available)
+            if !available.contains(selectedTimeframeSubject.value) {
+                selectedTimeframeSubject.send(.native)
+            }
+        }
+        ohlcDataSubject.send(ohlcData(for: selectedTimeframeSubject.value))
+    }
+    
+    private func ohlcData(for timeframe: OHLCTimeframe) -> [OHLCData] {
+        guard timeframe != .native else { return sourceOHLCData }
+        if let cached = resampledOHLCCache[timeframe] {
+            return cached
+        }
+        // A partial first bucket would show a misleading open/range, so it is dropped;
+        // the partial last bucket is the forming candle and stays
+        let result = OHLCResampler.resample(sourceOHLCData, to: timeframe)
+        let resampled = result.isFirstPartial && result.candles.count > 1 ? Array(result.candles.dropFirst()) : result.candles
+        resampledOHLCCache[timeframe] = resampled
+        return resampled
+    }
+    
+    /// Cheap identity check: same length and same first/last candle
+    private func isSameSeries(_ lhs: [OHLCData], _ rhs: [OHLCData]) -> Bool {
+        lhs.count == rhs.count
+            && lhs.first?.timestamp == rhs.first?.timestamp
+            && lhs.last?.timestamp == rhs.last?.timestamp
+            && lhs.last?.close == rhs.last?.close
+    }
+    
     // MARK: - FIXED: Smart Auto-Refresh (Pure Combine)
     
     func smartAutoRefresh(for range: String) {
@@ -490,31 +644,42 @@ final class CoinDetailsVM: ObservableObject {
     // MARK: - Data Processing (Pure Functions)
     
     private func processChartData(_ rawData: [Double], for days: String) -> [Double] {
+        let tracer = SpanTracer.shared
+        let span = tracer.beginTrace(.chartProcessing(range: days))
+        defer { tracer.end(span) }
+        
         // Step 1: Validate data
-        let validData = rawData.compactMap { value -> Double? in
-            guard value.isFinite, value >= 0 else { return nil }
-            return value
+        let validData = tracer.measure(.chartValidate, parent: span) {
+            rawData.compactMap { value -> Double? in
+                guard value.isFinite, value >= 0 else { return nil }
+                return value
+            }
         }
         
         guard !validData.isEmpty else { return [] }
         
         // Step 2: Remove outliers (API errors, data spikes)
-        let cleanedData = ChartSmoothingHelper.removeOutliers(validData)
+        let cleanedData = tracer.measure(.chartOutliers, parent: span) {
+            ChartSmoothingHelper.removeOutliers(validData)
+        }
         
         // Step 3: Apply smoothing before downsampling for better results (if enabled)
-        let smoothedData = isSmoothingEnabled ? 
-            ChartSmoothingHelper.applySmoothingToChartData(cleanedData, type: smoothingType, timeRange: days) : 
-            cleanedData
+        var smoothedData = cleanedData
+        if isSmoothingEnabled {
+            smoothedData = tracer.measure(.chartSmoothing, parent: span) {
+                ChartSmoothingHelper.applySmoothingToChartData(cleanedData, type: smoothingType, timeRange: days)
+            }
+        }
         
         // Step 4: Optimize for performance (downsample if needed)
         let maxPoints = getMaxDataPointsForRange(days)
         if smoothedData.count > maxPoints {
-            let step = max(1, smoothedData.count / maxPoints)
-            let downsampledData = stride(from: 0, to: smoothedData.count, by: step).compactMap { index in
-                index < smoothedData.count ? smoothedData[index] : nil
+            return tracer.measure(.chartDownsample, parent: span) {
+                let step = max(1, smoothedData.count / maxPoints)
+                return stride(from: 0, to: smoothedData.count, by: step).compactMap { index in
+                    index < smoothedData.count ? smoothedData[index] : nil
+                }
             }
-            
-            return downsampledData
         }
         
         return smoothedData
@@ -909,11 +1074,38 @@ final class CoinDetailsVM: ObservableObject {
     }
 }
 
+// MARK: - Memory Accounting
 
-
-
-
-
-
-
-
+extension CoinDetailsVM: MemoryAccountable {
+    
+    func memoryFootprint() -> MemoryFootprint {
+        let resampledCount = resampledOHLCCache.values.reduce(0) { $0 + $1.count }
+        let statsCount = statsOhlcDataSubject.value.values.reduce(0) { $0 + $1.count }
+        return MemoryFootprint(name: "CoinDetailsVM (\(coin.symbol))", children: [
+            MemoryFootprint(name: "chartPoints", bytes: MemoryEstimate.doubles(chartPointsSubject.value.count)),
+            MemoryFootprint(name: "ohlcData", bytes: MemoryEstimate.candles(ohlcDataSubject.value.count)),
+            MemoryFootprint(name: "resampledOHLC", bytes: MemoryEstimate.candles(resampledCount), tier: .derived),
+            MemoryFootprint(name: "statsOHLC", bytes: MemoryEstimate.candles(statsCount), tier: .series)
+        ])
+    }
+    
+    /// Derived: resampled timeframes (recomputed on demand). Series: stats OHLC for ranges other
+    /// than the selected one (refetched, usually from CacheService, when picked again).
+    func releaseMemory(for tier: MemoryPressureTier) -> Int {
+        switch tier {
+        case .derived:
+            let freed = MemoryEstimate.candles(resampledOHLCCache.values.reduce(0) { $0 + $1.count })
+            resampledOHLCCache.removeAll()
+            return freed
+        case .images:
+            return 0
+        case .series:
+            let selected = selectedStatsRangeSubject.value
+            let stats = statsOhlcDataSubject.value
+            let dropped = stats.filter { $0.key != selected }
+            guard !dropped.isEmpty else { return 0 }
+            statsOhlcDataSubject.send(stats.filter { $0.key == selected })
+            return MemoryEstimate.candles(dropped.values.reduce(0) { $0 + $1.count })
+        }
+    }
+}
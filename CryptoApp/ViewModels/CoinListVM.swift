@@ -161,7 +161,10 @@ final class CoinListVM: ObservableObject {
     private let itemsPerPage = 20                          //  Number of coins per page (optimized for performance)
     private var currentPage = 1                            //  Current page number for pagination calculations
     private var canLoadMore = true                         //  Flag to prevent unnecessary pagination calls
-    private var fullFilteredCoins: [Coin] = []             //  Complete dataset for instant local operations
+    private var fullFilteredCoins: [Coin] = [] {            //  Complete dataset for instant local operations
+        didSet { fullFilteredCoinsReleased = false }
+    }
+    private var fullFilteredCoinsReleased = false          //  Dropped under memory pressure, rebuilt on demand
     
     // MARK: - Optimization Properties
     
@@ -177,6 +180,26 @@ final class CoinListVM: ObservableObject {
     private let minimumFetchInterval: TimeInterval = 2.0  //   Minimum 2 seconds between API requests
     private var pendingLogoRequests: Set<Int> = []         //  Prevents duplicate logo download requests
 
+    // MARK: - Candle Pattern Screening Properties
+    
+    /**
+     * PATTERN SCREENING
+     *
+     * The "pattern found" filter screens the top coins' cached OHLC candles (whatever the
+     * detail screens have already fetched - no extra API calls) off the main thread:
+     * - CandlePatternScanner.screen scans each series' tail, coins in parallel
+     * - Results are kept per coin and reused until the coin set changes or they go stale
+     */
+    
+    private let cacheService: CacheServiceProtocol
+    private let patternScreenQueue = DispatchQueue(label: "com.cryptoapp.patternscreen", qos: .userInitiated)
+    private var patternMatches: [Int: CandlePattern] = [:]        //  Patterns found per coin (coins with cached candles only)
+    private var lastPatternScreen: (coinIds: [Int], date: Date)?
+    private var isScreeningPatterns = false
+    private let maxPatternScreenCoins = 500
+    private let patternRescreenInterval: TimeInterval = 60
+    private static let patternScreenDays = ["1", "7", "30", "365"] //  Cached OHLC ranges tried per coin, most recent candles first
+
     // MARK: - Initialization
     
     /**
@@ -197,10 +220,11 @@ final class CoinListVM: ObservableObject {
      * 
      * Falls back to default CoinManager for backward compatibility
      */
-    init(coinManager: CoinManagerProtocol, sharedCoinDataManager: SharedCoinDataManagerProtocol, persistenceService: PersistenceServiceProtocol) {
+    init(coinManager: CoinManagerProtocol, sharedCoinDataManager: SharedCoinDataManagerProtocol, persistenceService: PersistenceServiceProtocol, cacheService: CacheServiceProtocol = CacheService.shared) {
         self.coinManager = coinManager
         self.sharedCoinDataManager = sharedCoinDataManager
         self.persistenceService = persistenceService
+        self.cacheService = cacheService
         
         // 🔧 SMART CACHE MANAGEMENT: Clear cache if it has insufficient data
         if let cachedCoins = persistenceService.loadCoinList(), 
@@ -210,9 +234,9 @@ final class CoinListVM: ObservableObject {
         }
         
         // 🌐 SUBSCRIBE TO SHARED DATA: Listen to shared coin data for consistency
-        sharedCoinDataManager.allCoins.sinkForUI(
-            { [weak self] allCoins in
-                self?.handleSharedDataUpdate(allCoins)
+        sharedCoinDataManager.coinUpdates.sinkForUI(
+            { [weak self] update in
+                self?.handleSharedDataUpdate(update.coins, tick: update.tick)
             },
             storeIn: &cancellables
         )
@@ -224,6 +248,8 @@ final class CoinListVM: ObservableObject {
             },
             storeIn: &cancellables
         )
+        
+        MemoryAccountant.shared.register(self)
     }
     
     // MARK: - Utility Methods
@@ -248,17 +274,19 @@ final class CoinListVM: ObservableObject {
     }
     
     /// Handle updates from SharedCoinDataManager
-    private func handleSharedDataUpdate(_ allCoins: [Coin]) {
+    /// - Parameter tick: root span of the price tick that produced `allCoins`, ended after the last stage
+    private func handleSharedDataUpdate(_ allCoins: [Coin], tick: SpanTracer.Span? = nil) {
         // Only update if we don't have fresh data or if this is more recent
         guard !allCoins.isEmpty else { return }
+        let tracer = SpanTracer.shared
         
         let timestamp = Date().timeIntervalSince1970
         let btcPrice = allCoins.first(where: { $0.symbol == "BTC" })?.quote?["USD"]?.price ?? 0
         AppLogger.data("CoinListVM: Received shared data update with \(allCoins.count) coins at \(timestamp) | BTC: $\(String(format: "%.2f", btcPrice))")
         
         // Apply current filters and sorting
-        let filteredCoins = applyCurrentFilters(to: allCoins)
-        let sortedCoins = sortCoins(filteredCoins)
+        let filteredCoins = tracer.measure(.tickFilter, parent: tick) { applyCurrentFilters(to: allCoins) }
+        let sortedCoins = tracer.measure(.tickSort, parent: tick) { sortCoins(filteredCoins) }
         
         // Store full dataset for pagination
         fullFilteredCoins = sortedCoins
@@ -269,10 +297,16 @@ final class CoinListVM: ObservableObject {
         
         // 💰 PRICE CHANGE DETECTION: Check if prices changed for current displayed coins
         let currentDisplayedCoins = currentCoins
-        let changedCoinIds = findChangedCoins(current: currentDisplayedCoins, updated: initialCoins)
+        let changedCoinIds = tracer.measure(.tickDiff, parent: tick) {
+            findChangedCoins(current: currentDisplayedCoins, updated: initialCoins)
+        }
         
         // Update UI
-        coinsSubject.send(initialCoins)
+        tracer.measure(.tickPublish, parent: tick) { coinsSubject.send(initialCoins) }
+        if let tick = tick {
+            // Tick-to-publish stops here; the root span carries on through the logo stage
+            Metrics.tickToPublish.record(milliseconds: tracer.elapsedMilliseconds(since: tick))
+        }
         canLoadMore = sortedCoins.count > pageSize
         
         // 🎯 TRIGGER ANIMATIONS: If prices changed, trigger UI animations
@@ -292,7 +326,10 @@ final class CoinListVM: ObservableObject {
         
         // 🖼️ FETCH LOGOS: Start downloading coin images for visible coins
         let displayedIds = initialCoins.map { $0.id }
-        fetchCoinLogosIfNeeded(forIDs: displayedIds)
+        tracer.measure(.tickLogos, parent: tick) { fetchCoinLogosIfNeeded(forIDs: displayedIds) }
+        if let tick = tick {
+            tracer.end(tick)
+        }
         
         AppLogger.ui("CoinListVM: Updated UI with \(initialCoins.count) coins from shared data")
     }
@@ -325,7 +362,62 @@ final class CoinListVM: ObservableObject {
         
         // PriceChangeFilter is just for time period display, not for filtering coins
         // All coins are shown regardless of the price change filter
-        return topCoins
+        
+        // Pattern filter: keep coins whose recent candles show one of the selected patterns
+        let patterns = currentFilterState.patternFilter.patterns
+        guard !patterns.isEmpty else { return topCoins }
+        screenPatternsIfNeeded(for: topCoins)
+        return topCoins.filter { coin in
+            patternMatches[coin.id].map { !$0.isDisjoint(with: patterns) } ?? false
+        }
+    }
+    
+    /// Screens cached candles of the top coins for patterns; re-applies filters when results change
+    private func screenPatternsIfNeeded(for coins: [Coin]) {
+        let screenedCoins = Array(coins.prefix(maxPatternScreenCoins))
+        let coinIds = screenedCoins.map { $0.id }
+        if let last = lastPatternScreen,
+           last.coinIds == coinIds,
+           Date().timeIntervalSince(last.date) < patternRescreenInterval {
+            return
+        }
+        guard !isScreeningPatterns else { return }
+        isScreeningPatterns = true
+        lastPatternScreen = (coinIds, Date())
+        
+        // CoinGecko IDs come from CMC slugs (same mapping as CoinDetailsVM)
+        let geckoIds: [(coinId: Int, geckoId: String)] = screenedCoins.compactMap { coin in
+            guard let slug = coin.slug, !slug.isEmpty else { return nil }
+            return (coin.id, slug.lowercased())
+        }
+        let cacheService = self.cacheService
+        let startTime = CFAbsoluteTimeGetCurrent()
+        
+        patternScreenQueue.async { [weak self] in
+            var series: [Int: [OHLCData]] = [:]
+            for (coinId, geckoId) in geckoIds {
+                for days in Self.patternScreenDays {
+                    if let candles = cacheService.getOHLCData(for: geckoId, currency: "usd", days: days), !candles.isEmpty {
+                        series[coinId] = candles
+                        break
+                    }
+                }
+            }
+            let matches = CandlePatternScanner.screen(series)
+            
+            DispatchQueue.main.async {
+                guard let self = self else { return }
+                self.isScreeningPatterns = false
+                let elapsedMs = (CFAbsoluteTimeGetCurrent() - startTime) * 1000
+                AppLogger.performance("Pattern screen | \(series.count)/\(geckoIds.count) coins with candles | \(matches.values.filter { !$0.isEmpty }.count) with patterns | \(String(format: "%.1f", elapsedMs))ms")
+                
+                guard matches != self.patternMatches else { return }
+                self.patternMatches = matches
+                if !self.currentFilterState.patternFilter.patterns.isEmpty {
+                    self.handleSharedDataUpdate(self.sharedCoinDataManager.currentCoins)
+                }
+            }
+        }
     }
 
     // MARK: - Filter Management
@@ -337,7 +429,8 @@ final class CoinListVM: ObservableObject {
     func updateTopCoinsFilter(_ filter: TopCoinsFilter) {
         let newState = FilterState(
             priceChangeFilter: currentFilterState.priceChangeFilter,
-            topCoinsFilter: filter
+            topCoinsFilter: filter,
+            patternFilter: currentFilterState.patternFilter
         )
         updateFilter(to: newState)
     }
@@ -345,11 +438,18 @@ final class CoinListVM: ObservableObject {
     func updatePriceChangeFilter(_ filter: PriceChangeFilter) {
         let newState = FilterState(
             priceChangeFilter: filter,
-            topCoinsFilter: currentFilterState.topCoinsFilter
+            topCoinsFilter: currentFilterState.topCoinsFilter,
+            patternFilter: currentFilterState.patternFilter
         )
         updateFilter(to: newState)
     }
     
+    func updatePatternFilter(_ filter: PatternFilter) {
+        var newState = currentFilterState
+        newState.patternFilter = filter
+        updateFilter(to: newState)
+    }
+    
     private func updateFilter(to newState: FilterState) {
         guard newState != currentFilterState else { return }
         
@@ -427,6 +527,7 @@ final class CoinListVM: ObservableObject {
      * It maintains pagination by showing only the first page after sorting.
      */
     private func applySortingToCurrentData() {
+        restoreFullFilteredCoinsIfReleased()
         AppLogger.performance("applySortingToCurrentData | fullFilteredCoins: \(fullFilteredCoins.count), coins: \(currentCoins.count)")
         
         // Fallback: If we have no full dataset, use currently displayed coins
@@ -814,6 +915,10 @@ final class CoinListVM: ObservableObject {
      * PERFORMANCE: Operates on arrays in memory for instant response
      */
     private func sortCoins(_ coins: [Coin]) -> [Coin] {
+        return Metrics.coinSort.time { sortedByCurrentColumn(coins) }
+    }
+    
+    private func sortedByCurrentColumn(_ coins: [Coin]) -> [Coin] {
         return coins.sorted { coin1, coin2 in
             let ascending = (currentSortOrder == .ascending)
         
@@ -916,6 +1021,7 @@ final class CoinListVM: ObservableObject {
         }
 
         // PAGINATION CALCULATION: Calculate if more data is available
+        restoreFullFilteredCoinsIfReleased()
         let currentCount = currentCoins.count
         let totalAvailable = fullFilteredCoins.count
         
@@ -1154,18 +1260,20 @@ final class CoinListVM: ObservableObject {
      * OPTIMIZATION: Only fetches prices for coins currently visible on screen
      * EFFICIENCY: Reduces API calls by 60-80% compared to updating all coins
      * USAGE: Called by the auto-refresh timer with visible coin IDs
+     * COMPLETION: `fetched` is true only when quotes were actually fetched (false when the
+     * update was skipped because another operation was running, or the request failed)
      */
-    func fetchPriceUpdatesForVisibleCoins(_ visibleIds: [Int], completion: @escaping () -> Void) {
+    func fetchPriceUpdatesForVisibleCoins(_ visibleIds: [Int], completion: @escaping (_ fetched: Bool) -> Void) {
         // RESPECT LOADING STATES + PREVENT RACE CONDITIONS
         guard !currentIsLoading && !isLoadingMoreSubject.value && !isUpdatingPrices else {
             AppLogger.performance("Visible price updates blocked - operations in progress")
-            completion()
+            completion(false)
             return
         }
         
         // VALIDATION
         guard !visibleIds.isEmpty else {
-            completion()
+            completion(false)
             return
         }
 
@@ -1180,8 +1288,10 @@ final class CoinListVM: ObservableObject {
                     if !error.localizedDescription.contains("throttled") {
                         self?.errorMessageSubject.send(error.localizedDescription)
                     }
+                    completion(false)
+                    return
                 }
-                completion()
+                completion(true)
             },
             receiveValue: { [weak self] updatedQuotes in
                 guard let self = self else { return }
@@ -1336,3 +1446,32 @@ final class CoinListVM: ObservableObject {
         cancellables.removeAll()
     }
 }
+
+// MARK: - Memory Accounting
+
+extension CoinListVM: MemoryAccountable {
+    
+    func memoryFootprint() -> MemoryFootprint {
+        MemoryFootprint(name: "CoinListVM", children: [
+            MemoryFootprint(name: "displayedCoins", bytes: MemoryEstimate.coins(currentCoins.count)),
+            MemoryFootprint(name: "fullFilteredCoins", bytes: MemoryEstimate.coins(fullFilteredCoins.count), tier: .derived)
+        ])
+    }
+    
+    /// The pagination dataset is a filtered, sorted copy of shared data; pages already shown stay
+    func releaseMemory(for tier: MemoryPressureTier) -> Int {
+        guard tier == .derived, !fullFilteredCoins.isEmpty else { return 0 }
+        let freed = MemoryEstimate.coins(fullFilteredCoins.count)
+        fullFilteredCoins = []
+        fullFilteredCoinsReleased = true
+        return freed
+    }
+    
+    /// Rebuilds the pagination dataset from shared data after `releaseMemory(for:)` dropped it
+    private func restoreFullFilteredCoinsIfReleased() {
+        guard fullFilteredCoinsReleased else { return }
+        let source = sharedCoinDataManager.currentCoins
+        fullFilteredCoins = source.isEmpty ? currentCoins : sortCoins(applyCurrentFilters(to: source))
+        AppLogger.performance("Rebuilt fullFilteredCoins after memory pressure (\(fullFilteredCoins.count) coins)")
+    }
+}
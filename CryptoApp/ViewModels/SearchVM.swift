@@ -113,12 +113,17 @@ final class SearchVM: ObservableObject {
     // MARK: - Public Properties for Cache Access
     
     /**
-     * Access to cached coin data for improved recent search functionality
+     * Access to cached coin data for improved recent search functionality.
+     * Empty while a corpus released under memory pressure is reloading in the background.
      */
     var cachedCoins: [Coin] {
+        reloadCoinsIfReleased()
         return allCoins
     }
     
+    /// True while the released search corpus is being reloaded from persistence
+    private(set) var isReloadingCoins = false
+    
     // MARK: - Private Properties
     
     private var cancellables = Set<AnyCancellable>()
@@ -126,7 +131,10 @@ final class SearchVM: ObservableObject {
     private let coinManager: CoinManagerProtocol
     private let sharedCoinDataManager: SharedCoinDataManagerProtocol
     private let persistenceService: PersistenceServiceProtocol
-    private var allCoins: [Coin] = []
+    private var allCoins: [Coin] = [] {
+        didSet { allCoinsReleased = false }
+    }
+    private var allCoinsReleased = false // Dropped under memory pressure, reloaded from persistence on next use
     private let debounceInterval: TimeInterval = 0.3 // 300ms debounce
     
     // MARK: - Popular Coins Caching
@@ -196,6 +204,7 @@ final class SearchVM: ObservableObject {
         setupCacheUpdateListener()
         setupSharedCoinDataListener()
         setupErrorHandling()
+        MemoryAccountant.shared.register(self)
     }
     
     // MARK: - Cache Update Listener
@@ -326,6 +335,8 @@ final class SearchVM: ObservableObject {
             return
         }
         
+        // The search re-runs once a released corpus is back
+        guard !reloadCoinsIfReleased() else { return }
         AppLogger.search("Search: Searching for '\(trimmedText)' in \(allCoins.count) cached coins")
         
         // Perform filtering on background queue for better performance
@@ -787,4 +798,57 @@ final class SearchVM: ObservableObject {
         cancellables.removeAll() // Remove persistent search subscriptions
         apiRequestCancellables.removeAll() // Remove API request subscriptions
     }
-} 
+}
+
+// MARK: - Memory Accounting
+
+extension SearchVM: MemoryAccountable {
+    
+    func memoryFootprint() -> MemoryFootprint {
+        let popularCount = cachedPopularCoinsData.count + cachedTopGainers.count + cachedTopLosers.count
+        return MemoryFootprint(name: "SearchVM", children: [
+            MemoryFootprint(name: "allCoins", bytes: MemoryEstimate.coins(allCoins.count), tier: .derived),
+            MemoryFootprint(name: "popularCoinsCache", bytes: MemoryEstimate.coins(popularCount), tier: .derived),
+            MemoryFootprint(name: "searchResults", bytes: MemoryEstimate.coins(currentSearchResults.count))
+        ])
+    }
+    
+    /// The search corpus is a copy of the persisted coin list; popular coins are recomputed on expiry
+    func releaseMemory(for tier: MemoryPressureTier) -> Int {
+        guard tier == .derived else { return 0 }
+        let popularCount = cachedPopularCoinsData.count + cachedTopGainers.count + cachedTopLosers.count
+        let freed = MemoryEstimate.coins(allCoins.count) + MemoryEstimate.coins(popularCount)
+        allCoins = []
+        allCoinsReleased = true
+        cachedPopularCoinsData = []
+        cachedTopGainers = []
+        cachedTopLosers = []
+        popularCoinsCacheTimestamp = nil
+        return freed
+    }
+    
+    /**
+     * Reloads a released corpus from persistence off main and publishes it on main, then
+     * re-runs the current search. Returns true while the corpus is unavailable (reload pending).
+     */
+    @discardableResult
+    private func reloadCoinsIfReleased() -> Bool {
+        guard allCoinsReleased else { return false }
+        guard !isReloadingCoins else { return true }
+        isReloadingCoins = true
+        
+        let persistenceService = self.persistenceService
+        DispatchQueue.global(qos: .userInitiated).async { [weak self] in
+            let coins = persistenceService.loadCoinList() ?? []
+            DispatchQueue.main.async { [weak self] in
+                guard let self = self else { return }
+                self.isReloadingCoins = false
+                // refreshSearchData may have installed a newer list while this one was loading
+                guard self.allCoinsReleased else { return }
+                self.allCoins = coins
+                self.performSearch(for: self.currentSearchText)
+            }
+        }
+        return true
+    }
+}
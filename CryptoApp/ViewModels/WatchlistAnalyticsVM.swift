@@ -0,0 +1,263 @@
+import Foundation
+import Combine
+
+// MARK: - Watchlist Analytics Model
+
+/// Published result of a correlation / beta / volatility pass over the watchlist
+struct WatchlistAnalytics {
+
+    struct CoinMetrics {
+        let coinId: Int
+        let symbol: String
+        /// Beta against BTC over the whole window (nil for BTC itself or without data)
+        let beta: Double?
+        /// Most recent rolling beta against BTC
+        let rollingBeta: Double?
+        /// Annualised realised volatility (0.65 = 65%)
+        let volatility: Double
+    }
+
+    let range: String
+    let coins: [CoinMetrics]
+    /// Row-major correlation matrix in `coins` order
+    let correlation: [Double]
+    let sampleCount: Int
+    let computedAt: Date
+
+    func correlation(_ i: Int, _ j: Int) -> Double {
+        correlation[i * coins.count + j]
+    }
+}
+
+/**
+ * WATCHLIST ANALYTICS VIEW MODEL
+ *
+ * Cross-coin statistics for the watchlist: correlation matrix, beta vs BTC and realised volatility.
+ *
+ * Data flow:
+ * - Price series come from CoinManager.fetchChartData (cache-first, low priority, deduplicated
+ *   by RequestManager), so coins already viewed in detail don't hit the network again
+ * - CorrelationEngine runs on a background queue; results are published on main
+ * - Live shared price updates are appended incrementally once per sampling interval,
+ *   sliding the window in O(k²) instead of recomputing the full matrix
+ */
+final class WatchlistAnalyticsVM {
+
+    // MARK: - Private Subjects
+
+    private let analyticsSubject = CurrentValueSubject<WatchlistAnalytics?, Never>(nil)
+    private let isLoadingSubject = CurrentValueSubject<Bool, Never>(false)
+    private let errorMessageSubject = CurrentValueSubject<String?, Never>(nil)
+
+    // MARK: - Published AnyPublisher Properties
+
+    var analytics: AnyPublisher<WatchlistAnalytics?, Never> {
+        analyticsSubject.eraseToAnyPublisher()
+    }
+
+    var isLoading: AnyPublisher<Bool, Never> {
+        isLoadingSubject.eraseToAnyPublisher()
+    }
+
+    var errorMessage: AnyPublisher<String?, Never> {
+        errorMessageSubject.eraseToAnyPublisher()
+    }
+
+    var currentAnalytics: WatchlistAnalytics? {
+        analyticsSubject.value
+    }
+
+    // MARK: - Dependencies
+
+    private let watchlistManager: WatchlistManagerProtocol
+    private let coinManager: CoinManagerProtocol
+    private let sharedCoinDataManager: SharedCoinDataManagerProtocol
+    private var cancellables = Set<AnyCancellable>()
+    private var loadCancellable: AnyCancellable?
+
+    // MARK: - Engine State (computeQueue only)
+
+    private let computeQueue = DispatchQueue(label: "watchlist.analytics", qos: .userInitiated)
+    private var engine: CorrelationEngine?
+    private var engineSymbols: [String] = []
+    private var engineRange = ""
+    private var lastAppendDate = Date.distantPast
+    /// Engine coin IDs mirrored on the main thread, so shared prices are read there
+    private var trackedCoinIds: [Int] = []
+
+    private(set) var currentRange = "30"
+
+    // MARK: - Constants
+
+    static let benchmarkGeckoId = "bitcoin"
+    static let benchmarkCoinId = 1  // CoinMarketCap ID for BTC
+    static let rollingBetaWindow = 30
+
+    // MARK: - Dependency Injection Initializer
+
+    init(
+        watchlistManager: WatchlistManagerProtocol,
+        coinManager: CoinManagerProtocol,
+        sharedCoinDataManager: SharedCoinDataManagerProtocol
+    ) {
+        self.watchlistManager = watchlistManager
+        self.coinManager = coinManager
+        self.sharedCoinDataManager = sharedCoinDataManager
+        bindSharedData()
+    }
+
+    deinit {
+        loadCancellable?.cancel()
+        cancellables.removeAll()
+    }
+
+    // MARK: - Loading
+
+    /**
+     * Fetches (or reuses cached) chart series for every watched coin plus BTC and rebuilds the engine.
+     * Coins whose series fail to load are skipped rather than failing the whole pass.
+     * Call on the main thread (reads the shared coin store).
+     */
+    func loadAnalytics(range: String) {
+        currentRange = range
+        var coins = watchlistManager.getWatchlistCoins()
+        if !coins.contains(where: { $0.id == Self.benchmarkCoinId }),
+           let btc = sharedCoinDataManager.getCoinsForIds([Self.benchmarkCoinId]).first {
+            coins.insert(btc, at: 0)
+        }
+        guard coins.count > 1 else {
+            analyticsSubject.send(nil)
+            errorMessageSubject.send("Add at least two coins to compare")
+            return
+        }
+
+        isLoadingSubject.send(true)
+        errorMessageSubject.send(nil)
+
+        let requests = coins.map { coin -> AnyPublisher<(Coin, [Double]), Never> in
+            coinManager.fetchChartData(for: coin.slug?.lowercased() ?? coin.name.lowercased(), range: range, currency: "usd", priority: .low)
+                .map { (coin, $0) }
+                .replaceError(with: (coin, []))
+                .eraseToAnyPublisher()
+        }
+
+        loadCancellable = Publishers.MergeMany(requests)
+            .collect()
+            .receive(on: computeQueue)
+            .map { [weak self] results -> WatchlistAnalytics? in
+                self?.rebuildEngine(with: results, coinOrder: coins.map { $0.id }, range: range)
+            }
+            .receive(on: DispatchQueue.main)
+            .sink { [weak self] analytics in
+                guard let self = self else { return }
+                self.trackedCoinIds = analytics?.coins.map { $0.coinId } ?? []
+                self.isLoadingSubject.send(false)
+                if analytics == nil {
+                    self.errorMessageSubject.send("Not enough price history to compare")
+                }
+                self.analyticsSubject.send(analytics)
+            }
+    }
+
+    func cancelLoading() {
+        loadCancellable?.cancel()
+        isLoadingSubject.send(false)
+    }
+
+    // MARK: - Engine
+
+    private func rebuildEngine(with results: [(Coin, [Double])], coinOrder: [Int], range: String) -> WatchlistAnalytics? {
+        let byId = Dictionary(results.map { ($0.0.id, $0) }, uniquingKeysWith: { first, _ in first })
+        let usable = coinOrder.compactMap { byId[$0] }.filter { $0.1.count > 2 }
+        guard usable.count > 1 else {
+            engine = nil
+            return nil
+        }
+
+        let ids = usable.map { $0.0.id }
+        engine = CorrelationEngine(
+            coinIds: ids,
+            series: usable.map { $0.1 },
+            benchmarkIndex: ids.firstIndex(of: Self.benchmarkCoinId),
+            periodsPerYear: Self.periodsPerYear(for: range)
+        )
+        engineSymbols = usable.map { $0.0.symbol }
+        engineRange = range
+        lastAppendDate = Date()
+        return makeAnalytics()
+    }
+
+    private func makeAnalytics() -> WatchlistAnalytics? {
+        guard let engine = engine else { return nil }
+        let snapshot = engine.snapshot()
+        let rolling = engine.rollingBeta(window: Self.rollingBetaWindow)
+
+        let coins = engine.coinIds.indices.map { i in
+            WatchlistAnalytics.CoinMetrics(
+                coinId: engine.coinIds[i],
+                symbol: engineSymbols[i],
+                beta: engine.coinIds[i] == Self.benchmarkCoinId ? nil : snapshot.beta[i],
+                rollingBeta: rolling[safe: i]?.last.flatMap { $0.isFinite ? $0 : nil },
+                volatility: snapshot.volatility[i]
+            )
+        }
+        return WatchlistAnalytics(
+            range: engineRange,
+            coins: coins,
+            correlation: snapshot.correlation,
+            sampleCount: snapshot.sampleCount,
+            computedAt: Date()
+        )
+    }
+
+    // MARK: - Incremental Updates
+
+    /// Appends live shared prices as a new point once per sampling interval of the loaded range.
+    /// SharedCoinDataManager mutates its store on main, so prices are read there and only the
+    /// plain ID → price map crosses to the compute queue.
+    private func bindSharedData() {
+        sharedCoinDataManager.allCoins
+            .filter { !$0.isEmpty }
+            .receive(on: DispatchQueue.main)
+            .compactMap { [weak self] _ -> [Int: Double]? in
+                guard let self = self, !self.trackedCoinIds.isEmpty else { return nil }
+                let coins = self.sharedCoinDataManager.getCoinsForIds(self.trackedCoinIds)
+                return Dictionary(coins.compactMap { coin in coin.priceTick.map { (coin.id, $0.price) } },
+                                  uniquingKeysWith: { first, _ in first })
+            }
+            .receive(on: computeQueue)
+            .compactMap { [weak self] prices -> WatchlistAnalytics? in
+                self?.appendLatestPricesIfDue(prices: prices)
+            }
+            .receive(on: DispatchQueue.main)
+            .sink { [weak self] analytics in
+                self?.analyticsSubject.send(analytics)
+            }
+            .store(in: &cancellables)
+    }
+
+    /// computeQueue only
+    private func appendLatestPricesIfDue(prices priceById: [Int: Double], now: Date = Date()) -> WatchlistAnalytics? {
+        guard let engine = engine,
+              now.timeIntervalSince(lastAppendDate) >= Self.samplingInterval(for: engineRange) else { return nil }
+
+        engine.append(prices: engine.coinIds.map { priceById[$0] ?? 0 })
+        lastAppendDate = now
+        return makeAnalytics()
+    }
+
+    // MARK: - Range Helpers
+
+    /// CoinGecko granularity: 5-minute for 1 day, hourly up to 90 days, daily beyond
+    static func samplingInterval(for range: String) -> TimeInterval {
+        switch Int(range) ?? 30 {
+        case ...1: return 300
+        case ...90: return 3600
+        default: return 86400
+        }
+    }
+
+    static func periodsPerYear(for range: String) -> Double {
+        (365 * 86400) / samplingInterval(for: range)
+    }
+}
@@ -128,7 +128,6 @@ final class WatchlistVM: ObservableObject {
      */
     
     private var lastPriceUpdate: Date = Date()
-    private let priceUpdateInterval: TimeInterval = 30.0
     private var isPriceUpdateInProgress = false
     
     // Cache for reducing API calls
@@ -168,6 +167,17 @@ final class WatchlistVM: ObservableObject {
             storeIn: &cancellables
         )
         
+        // 💰 SUBSCRIBE TO WATCHED QUOTES: Batched prices for watched coins outside the shared refresh set
+        sharedCoinDataManager.watchedQuotes
+            .dropFirst()
+            .sinkForUI(
+                { [weak self] _ in
+                    guard let self = self else { return }
+                    self.handleSharedDataUpdate(self.sharedCoinDataManager.currentCoins)
+                },
+                storeIn: &cancellables
+            )
+        
         // 🚨 SUBSCRIBE TO SHARED ERRORS: Listen to errors from shared data manager
         sharedCoinDataManager.errors.sinkForUI(
             { [weak self] error in
@@ -219,6 +229,7 @@ final class WatchlistVM: ObservableObject {
     func loadInitialData() {
         // Get watchlist coin IDs from manager
         let coins = watchlistManager.getWatchlistCoins()
+        sharedCoinDataManager.setWatchedCoinIds(Set(coins.map { $0.id }))
         
         if coins.isEmpty {
             DispatchQueue.main.async { [weak self] in
@@ -352,6 +363,9 @@ final class WatchlistVM: ObservableObject {
         
         // Only update if there's an actual change
         if oldCoinIds != newCoinIds {
+            // Register with the shared store so coins outside its refresh set are priced in its cycle
+            sharedCoinDataManager.setWatchedCoinIds(newCoinIds)
+            
             // Use SharedCoinDataManager data instead of separate API calls
             if !newCoins.isEmpty {
                 let sharedCoins = sharedCoinDataManager.currentCoins
@@ -405,7 +419,9 @@ final class WatchlistVM: ObservableObject {
      *
      * Performance Improvements:
      * - Uses SharedCoinDataManager (no direct API calls)
-     * - Filters shared data for watchlist coins
+     * - Indexed lookups for watchlist coins instead of filtering the full shared array
+     * - Watched coins outside the shared top-200 refresh are priced by the shared manager's
+     *   single batched low-priority request, so each coin is fetched once per cycle
      * - Smart change detection
      * - Non-blocking UI updates
      */
@@ -425,20 +441,19 @@ final class WatchlistVM: ObservableObject {
     private func handleSharedDataUpdate(_ allCoins: [Coin]) {
         guard !allCoins.isEmpty else { return }
         
-        // Get watchlist coin IDs
-        let watchlistCoinIds = watchlistManager.getWatchlistCoins().map { $0.id }
-        guard !watchlistCoinIds.isEmpty else { 
+        // Get watchlist coins
+        let watchlist = watchlistManager.getWatchlistCoins()
+        guard !watchlist.isEmpty else { 
             watchlistCoinsSubject.send([])
             return 
         }
         
         let timestamp = Date().timeIntervalSince1970
         let btcPrice = allCoins.first(where: { $0.symbol == "BTC" })?.quote?["USD"]?.price ?? 0
-        AppLogger.data("WatchlistVM: Received shared data update - filtering for \(watchlistCoinIds.count) watchlist coins at \(timestamp) | BTC: $\(String(format: "%.2f", btcPrice))")
+        AppLogger.data("WatchlistVM: Received shared data update - resolving \(watchlist.count) watchlist coins at \(timestamp) | BTC: $\(String(format: "%.2f", btcPrice))")
         
-        // Filter shared data for watchlist coins
-        let idSet = Set(watchlistCoinIds)
-        let watchlistCoins = allCoins.filter { idSet.contains($0.id) }
+        // Read watchlist coins from the shared store
+        let watchlistCoins = resolveWatchlistCoins(watchlist)
         
         AppLogger.data("WatchlistVM: Found \(watchlistCoins.count) watchlist coins in shared data")
         
@@ -455,6 +470,7 @@ final class WatchlistVM: ObservableObject {
         
         // If prices changed, trigger animation updates
         if !changedCoinIds.isEmpty {
+            lastPriceUpdate = Date()
             updatedCoinIdsSubject.send(changedCoinIds)
             AppLogger.price("WatchlistVM: \(changedCoinIds.count) coins had price changes - triggering UI animations")
             
@@ -484,14 +500,20 @@ final class WatchlistVM: ObservableObject {
 
     }
     
-    private func fetchPriceUpdates(for coinIds: [Int], completion: @escaping ([Coin]) -> Void) {
-        // 🌐 NOW USING SHARED DATA: Just get from shared manager instead of API call
-        let watchlistCoins = sharedCoinDataManager.getCoinsForIds(coinIds)
+    /// Shared-store coins first; watched coins missing from the shared list use their stored
+    /// metadata plus the batched watched quote. Coins without any quote yet are held back.
+    private func resolveWatchlistCoins(_ watchlist: [Coin]) -> [Coin] {
+        var resolved = sharedCoinDataManager.getCoinsForIds(watchlist.map { $0.id })
+        guard resolved.count < watchlist.count else { return resolved }
         
-        AppLogger.data("WatchlistVM: Using shared data for \(watchlistCoins.count) coins")
-        
-        isPriceUpdateInProgress = false
-        completion(watchlistCoins)
+        let found = Set(resolved.map { $0.id })
+        let watchedQuotes = sharedCoinDataManager.currentWatchedQuotes
+        for var coin in watchlist where !found.contains(coin.id) {
+            guard let quote = watchedQuotes[coin.id] else { continue }
+            coin.quote = ["USD": quote]
+            resolved.append(coin)
+        }
+        return resolved
     }
     
     /**
@@ -575,63 +597,6 @@ final class WatchlistVM: ObservableObject {
     
 
     
-    // Skips updates if nothing has changed or another fetch is in progress
-    // Only updates watchlistCoins if prices actually changed
-    
-    private func updatePricesIfNeeded(force: Bool = false) {
-        // Prevent overlapping updates
-        guard !isPriceUpdateInProgress else { return }
-        
-        // Only update if we have coins and not currently loading
-        guard !currentWatchlistCoins.isEmpty && !currentIsLoading else { return }
-        
-        // Check if enough time has passed (unless forced)
-        let timeSinceLastUpdate = Date().timeIntervalSince(lastPriceUpdate)
-        guard force || timeSinceLastUpdate >= priceUpdateInterval else { return }
-        
-        isPriceUpdateInProgress = true
-        let coinIds = currentWatchlistCoins.map { $0.id }
-        
-        // Background price update
-        DispatchQueue.global(qos: .utility).async { [weak self] in
-            guard let self = self else { return }
-            
-            self.fetchPriceUpdates(for: coinIds) { [weak self] updatedCoins in
-                DispatchQueue.main.async {
-                    guard let self = self else { return }
-                    
-                    // Efficient change detection
-                    let changedCoinIds = self.findChangedCoins(
-                        current: self.currentWatchlistCoins,
-                        updated: updatedCoins
-                    )
-                    
-                    if !changedCoinIds.isEmpty {
-                        self.watchlistCoinsSubject.send(updatedCoins)
-                        self.updatedCoinIdsSubject.send(changedCoinIds)
-                        self.lastPriceUpdate = Date()
-                        
-                        // Apply current sorting after periodic price update
-                        self.applySortingToWatchlist()
-                        
-                        #if DEBUG
-                        AppLogger.price("Periodic update: \(changedCoinIds.count) coins updated")
-                        
-                        // Show detailed price changes for coins that actually changed
-                        let changedCoins = updatedCoins.filter { changedCoinIds.contains($0.id) }
-                        if !changedCoins.isEmpty {
-                            AppLogger.price("Detected \(changedCoins.count) price changes in watchlist")
-                        }
-                        #endif
-                    }
-                    
-                    self.isPriceUpdateInProgress = false
-                }
-            }
-        }
-    }
-    
-    
     private func findChangedCoins(current: [Coin], updated: [Coin]) -> Set<Int> {
         var changedIds = Set<Int>()
         
@@ -860,7 +825,8 @@ final class WatchlistVM: ObservableObject {
             "lastPriceUpdate": lastPriceUpdate.timeIntervalSince1970,
             "isPriceUpdateInProgress": isPriceUpdateInProgress,
             "isLoading": currentIsLoading,
-            "watchlistManagerMetrics": watchlistManager.getPerformanceMetrics()
+            "watchlistManagerMetrics": watchlistManager.getPerformanceMetrics(),
+            "registry": MetricsRegistry.shared.snapshot()
         ]
     }
     
@@ -27,6 +27,24 @@ final class ChartConfigurationHelperTests: XCTestCase {
         XCTAssertNotNil(chart.rightAxis.valueFormatter)
         XCTAssertNotNil(chart.xAxis.valueFormatter)
     }
-}
 
+    func testExpandAxisIfNeededOnlyWidensFixedAxes() {
+        let chart = LineChartView(frame: .init(x: 0, y: 0, width: 320, height: 200))
+        chart.rightAxis.axisMinimum = 90
+        chart.rightAxis.axisMaximum = 110
+
+        // Inside the bounds → untouched
+        XCTAssertFalse(ChartConfigurationHelper.expandAxisIfNeeded(chart.rightAxis, low: 95, high: 105))
+        XCTAssertEqual(chart.rightAxis.axisMaximum, 110)
 
+        // Escaping above → widened with padding
+        XCTAssertTrue(ChartConfigurationHelper.expandAxisIfNeeded(chart.rightAxis, low: 100, high: 120))
+        XCTAssertEqual(chart.rightAxis.axisMaximum, 121, accuracy: 1e-9)
+        XCTAssertEqual(chart.rightAxis.axisMinimum, 90)
+
+        // Autoscaled axis → never touched
+        chart.rightAxis.resetCustomAxisMin()
+        chart.rightAxis.resetCustomAxisMax()
+        XCTAssertFalse(ChartConfigurationHelper.expandAxisIfNeeded(chart.rightAxis, low: 0, high: 1_000))
+    }
+}
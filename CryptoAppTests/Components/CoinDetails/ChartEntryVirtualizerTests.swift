@@ -0,0 +1,200 @@
+//
+//  ChartEntryVirtualizerTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Unit tests for ChartEntryVirtualizer covering window sizing around the visible range,
+//  slide thresholds, entry reuse through the pool, skipped (NaN) indices and resets.
+//  Patterns:
+//  - Source series is a plain [Double] where y == index unless a test injects NaN
+//  - Entry identity (===) is used to prove recycling instead of allocation
+//
+
+import XCTest
+import DGCharts
+@testable import CryptoApp
+
+final class ChartEntryVirtualizerTests: XCTestCase {
+
+    private var values: [Double] = []
+    private var allocations = 0
+
+    private func makeVirtualizer(count: Int, minimumMargin: Int = 10) -> ChartEntryVirtualizer<ChartDataEntry> {
+        values = (0..<count).map(Double.init)
+        allocations = 0
+        let virtualizer = ChartEntryVirtualizer<ChartDataEntry>(
+            minimumMargin: minimumMargin,
+            makeEntry: { [unowned self] in
+                self.allocations += 1
+                return ChartDataEntry()
+            },
+            configure: { [unowned self] entry, index in
+                guard self.values[index].isFinite else { return false }
+                entry.x = Double(index)
+                entry.y = self.values[index]
+                return true
+            }
+        )
+        virtualizer.reset(sourceCount: count)
+        return virtualizer
+    }
+
+    // MARK: - Window Sizing
+
+    func testWindowCoversVisibleRangePlusMarginOnly() {
+        // Given
+        let virtualizer = makeVirtualizer(count: 10_000)
+
+        // When
+        // 50 visible points → margin of 50 on each side
+        virtualizer.update(visibleLower: 5_000, visibleUpper: 5_049)
+
+        // Then
+        XCTAssertEqual(virtualizer.window, 4_950..<5_100)
+        XCTAssertEqual(virtualizer.entries.count, 150)
+        XCTAssertEqual(virtualizer.entries.first?.x, 4_950)
+        XCTAssertEqual(virtualizer.entries.last?.x, 5_099)
+    }
+
+    func testWindowIsClampedToSeriesBounds() {
+        let virtualizer = makeVirtualizer(count: 100)
+        virtualizer.update(visibleLower: 80, visibleUpper: 120)
+        XCTAssertEqual(virtualizer.window.upperBound, 100)
+        XCTAssertEqual(virtualizer.entries.last?.x, 99)
+    }
+
+    // MARK: - Sliding
+
+    func testSmallPansInsideTheWindowDoNotRebuild() {
+        // Given
+        let virtualizer = makeVirtualizer(count: 10_000)
+        virtualizer.update(visibleLower: 5_000, visibleUpper: 5_049)
+
+        // When
+        let changed = virtualizer.update(visibleLower: 5_010, visibleUpper: 5_059)
+
+        // Then
+        XCTAssertFalse(changed)
+        XCTAssertEqual(virtualizer.window, 4_950..<5_100)
+    }
+
+    func testSlidingReusesOverlapAndRecyclesLeavingEntries() {
+        // Given
+        let virtualizer = makeVirtualizer(count: 10_000)
+        virtualizer.update(visibleLower: 5_000, visibleUpper: 5_049)
+        let before = virtualizer.entries
+        let allocationsBefore = allocations
+
+        // When
+        // Pan right close to the window edge
+        let changed = virtualizer.update(visibleLower: 5_040, visibleUpper: 5_089)
+
+        // Then
+        XCTAssertTrue(changed)
+        XCTAssertEqual(virtualizer.window, 4_990..<5_140)
+        // Overlapping entries are the same objects
+        let overlapStart = before.firstIndex { $0.x == 4_990 }!
+        XCTAssertTrue(virtualizer.entries[0] === before[overlapStart])
+        // Entries for new indices came from the pool, not fresh allocations
+        XCTAssertEqual(allocations, allocationsBefore)
+        XCTAssertEqual(virtualizer.entries.map(\.x), (4_990..<5_140).map(Double.init))
+        XCTAssertEqual(virtualizer.entries.map(\.y), (4_990..<5_140).map(Double.init))
+    }
+
+    func testZoomingInShrinksTheWindow() {
+        let virtualizer = makeVirtualizer(count: 10_000)
+        virtualizer.update(visibleLower: 4_000, visibleUpper: 5_999)
+        XCTAssertTrue(virtualizer.update(visibleLower: 5_000, visibleUpper: 5_019))
+        XCTAssertEqual(virtualizer.window, 4_980..<5_040)
+        XCTAssertLessThanOrEqual(virtualizer.pooledCount, virtualizer.entries.count)
+    }
+
+    func testFollowMatchesAnotherWindowExactly() {
+        // Given
+        let price = makeVirtualizer(count: 10_000)
+        price.update(visibleLower: 5_000, visibleUpper: 5_049)
+        let overlay = makeVirtualizer(count: 10_000)
+
+        // When
+        let changed = overlay.follow(price.window)
+
+        // Then
+        XCTAssertTrue(changed)
+        XCTAssertEqual(overlay.window, price.window)
+        XCTAssertEqual(overlay.entries.map(\.x), price.entries.map(\.x))
+        XCTAssertFalse(overlay.follow(price.window))
+    }
+
+    // MARK: - Skipped Indices & Reset
+
+    func testNonFiniteValuesAreSkipped() {
+        // Given
+        let virtualizer = makeVirtualizer(count: 100)
+        values[5] = .nan
+
+        // When
+        virtualizer.update(visibleLower: 0, visibleUpper: 9, force: true)
+
+        // Then
+        XCTAssertFalse(virtualizer.entries.contains { $0.x == 5 })
+        XCTAssertEqual(virtualizer.entries.count, virtualizer.window.count - 1)
+    }
+
+    func testResetPoolsEntriesForTheNextSeries() {
+        // Given
+        let virtualizer = makeVirtualizer(count: 1_000)
+        virtualizer.update(visibleLower: 900, visibleUpper: 949)
+        let allocationsBefore = allocations
+
+        // When
+        virtualizer.reset(sourceCount: 1_000)
+        virtualizer.update(visibleLower: 0, visibleUpper: 49)
+
+        // Then
+        XCTAssertEqual(virtualizer.entries.first?.x, 0)
+        XCTAssertEqual(allocations, allocationsBefore)
+    }
+
+    // MARK: - Incremental Source Changes
+
+    func testAppendSourceMaterialisesWhenWindowReachesTheEnd() {
+        // Given
+        let virtualizer = makeVirtualizer(count: 100)
+        virtualizer.update(visibleLower: 80, visibleUpper: 99)
+
+        // When
+        values.append(100)
+        let entry = virtualizer.appendSource()
+
+        // Then
+        XCTAssertEqual(entry?.x, 100)
+        XCTAssertEqual(virtualizer.sourceCount, 101)
+        XCTAssertEqual(virtualizer.window.upperBound, 101)
+        XCTAssertTrue(virtualizer.entries.last === entry)
+    }
+
+    func testAppendSourceIsDeferredWhenScrolledAwayFromTheEnd() {
+        let virtualizer = makeVirtualizer(count: 1_000)
+        virtualizer.update(visibleLower: 0, visibleUpper: 49)
+        values.append(1_000)
+        XCTAssertNil(virtualizer.appendSource())
+        XCTAssertEqual(virtualizer.sourceCount, 1_001)
+        XCTAssertEqual(virtualizer.window, 0..<100)
+    }
+
+    func testRefreshSourceRewritesTheExistingEntryInPlace() {
+        // Given
+        let virtualizer = makeVirtualizer(count: 100)
+        virtualizer.update(visibleLower: 80, visibleUpper: 99)
+        let last = virtualizer.entries.last
+
+        // When
+        values[99] = 500
+        let refreshed = virtualizer.refreshSource(at: 99)
+
+        // Then
+        XCTAssertTrue(refreshed === last)
+        XCTAssertEqual(last?.y, 500)
+        XCTAssertNil(virtualizer.refreshSource(at: 0))
+    }
+}
@@ -112,9 +112,9 @@ final class ChartLabelManagerTests: XCTestCase {
 
     // MARK: - Integrated updates
     func testUpdateLabelsAtPositionAndAllLabels() {
-        let sma = LineChartDataSet(entries: [ChartDataEntry(x: 0, y: 10), ChartDataEntry(x: 1, y: 20)], label: "SMA")
-        let ema = LineChartDataSet(entries: [ChartDataEntry(x: 0, y: 8), ChartDataEntry(x: 1, y: 18)], label: "EMA")
-        let rsi = TechnicalIndicators.RSIResult(values: [45.0, 60.0], period: 14, overboughtLevel: 70, oversoldLevel: 30)
+        let sma = TechnicalIndicators.IndicatorBuffer(values: [10, 20], period: 20)
+        let ema = TechnicalIndicators.IndicatorBuffer(values: [8, 18], period: 12)
+        let rsi = TechnicalIndicators.IndicatorBuffer(values: [45.0, 60.0], period: 14)
         var settings = TechnicalIndicators.IndicatorSettings()
         settings.showSMA = true
         settings.showEMA = true
@@ -122,18 +122,18 @@ final class ChartLabelManagerTests: XCTestCase {
 
         manager.updateLabelsAtPosition(
             xIndex: 1,
-            smaDataSet: sma,
-            emaDataSet: ema,
-            rsiResult: rsi,
+            sma: sma,
+            ema: ema,
+            rsi: rsi,
             settings: settings,
             theme: .classic,
             dataPointCount: 2
         )
 
         manager.updateAllLabels(
-            smaDataSet: sma,
-            emaDataSet: ema,
-            rsiResult: rsi,
+            sma: sma,
+            ema: ema,
+            rsi: rsi,
             settings: settings,
             theme: .classic,
             rsiAreaTop: 200,
@@ -141,6 +141,32 @@ final class ChartLabelManagerTests: XCTestCase {
             dataPointCount: 2
         )
     }
-}
 
+    func testUpdateLabelsAtPositionReadsIndexAlignedValues() {
+        // Given
+        // SMA(3) over 5 points: warm-up at indices 0-1
+        let sma = TechnicalIndicators.IndicatorBuffer(values: [nil, nil, 2, 3, 4], period: 3)
+        var settings = TechnicalIndicators.IndicatorSettings()
+        settings.showSMA = true
+        settings.smaPeriod = 3
+        let smaLabel = topLabels().first
+
+        // When
+        manager.updateLabelsAtPosition(xIndex: 3, sma: sma, ema: nil, rsi: nil, settings: settings, theme: .classic, dataPointCount: 5)
+
+        // Then
+        XCTAssertEqual(smaLabel?.text, "SMA(3): $3.00")
 
+        // When
+        // Crosshair inside the warm-up period
+        manager.updateLabelsAtPosition(xIndex: 1, sma: sma, ema: nil, rsi: nil, settings: settings, theme: .classic, dataPointCount: 5)
+
+        // Then
+        XCTAssertEqual(smaLabel?.text, "SMA(3): Not visible")
+    }
+
+    private func topLabels() -> [UILabel] {
+        let stack = parentChart.subviews.first { $0 is UIStackView } as? UIStackView
+        return stack?.arrangedSubviews.compactMap { $0 as? UILabel } ?? []
+    }
+}
@@ -0,0 +1,82 @@
+//
+//  ChartViewportTrackerTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Unit tests for ChartViewportTracker covering per-frame coalescing of viewport changes,
+//  pausing the display link once motion stops, explicit flushes and teardown.
+//  Patterns:
+//  - Bursts of viewportDidChange() stand in for DGCharts pan/zoom/deceleration callbacks
+//  - Frames are driven by the real main-thread CADisplayLink (short expectation timeouts)
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class ChartViewportTrackerTests: XCTestCase {
+
+    func testBurstOfChangesIsDeliveredOncePerFrame() {
+        // Given
+        var deliveries = 0
+        let delivered = expectation(description: "onChange delivered")
+        let tracker = ChartViewportTracker {
+            deliveries += 1
+            delivered.fulfill()
+        }
+
+        // When
+        // Many delegate callbacks within the same frame
+        for _ in 0..<50 {
+            tracker.viewportDidChange()
+        }
+
+        // Then
+        wait(for: [delivered], timeout: 1)
+        XCTAssertEqual(deliveries, 1)
+        tracker.stop()
+    }
+
+    func testDisplayLinkPausesWhenViewportIsIdle() {
+        // Given
+        let tracker = ChartViewportTracker {}
+        tracker.viewportDidChange()
+        XCTAssertTrue(tracker.isRunning)
+
+        // When
+        // Wait well past the idle frame budget
+        let idle = expectation(description: "idle")
+        DispatchQueue.main.asyncAfter(deadline: .now() + 0.3) { idle.fulfill() }
+        wait(for: [idle], timeout: 1)
+
+        // Then
+        XCTAssertFalse(tracker.isRunning)
+        tracker.stop()
+    }
+
+    func testFlushDeliversPendingChangeImmediately() {
+        var deliveries = 0
+        let tracker = ChartViewportTracker { deliveries += 1 }
+        tracker.viewportDidChange()
+        tracker.flush()
+        tracker.flush()
+        XCTAssertEqual(deliveries, 1)
+        tracker.stop()
+    }
+
+    func testStopDropsPendingChange() {
+        // Given
+        var deliveries = 0
+        let tracker = ChartViewportTracker { deliveries += 1 }
+        tracker.viewportDidChange()
+
+        // When
+        tracker.stop()
+        let settled = expectation(description: "settled")
+        DispatchQueue.main.asyncAfter(deadline: .now() + 0.1) { settled.fulfill() }
+        wait(for: [settled], timeout: 1)
+
+        // Then
+        XCTAssertEqual(deliveries, 0)
+        XCTAssertFalse(tracker.isRunning)
+    }
+}
@@ -0,0 +1,94 @@
+//
+//  SparklineGeometryCacheTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Unit tests for SparklineGeometryCache covering point normalisation, key versioning,
+//  cache reuse, off-main builds for long series and shared gradients.
+//  Patterns:
+//  - Dedicated cache instances per test (never the shared one)
+//  - Geometry is checked through its Float32 point buffer
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class SparklineGeometryCacheTests: XCTestCase {
+
+    private let size = CGSize(width: 60, height: 20)
+
+    func testGeometryNormalisesIntoViewBounds() {
+        // Given
+        let values = [10.0, 20.0, 15.0]
+
+        // When
+        let geometry = SparklineGeometryCache.Geometry(values: values, size: size)
+
+        // Then
+        XCTAssertEqual(geometry?.pointCount, 3)
+        XCTAssertEqual(Array(geometry?.points ?? []), [0, 20, 30, 0, 60, 10])
+    }
+
+    func testFlatOrShortSeriesHaveNoGeometry() {
+        XCTAssertNil(SparklineGeometryCache.Geometry(values: [5, 5, 5], size: size))
+        XCTAssertNil(SparklineGeometryCache.Geometry(values: [5], size: size))
+        XCTAssertNil(SparklineGeometryCache.Geometry(values: [1, 2], size: .zero))
+    }
+
+    func testKeyChangesWithDataAndPixelSize() {
+        let key = SparklineGeometryCache.Key(values: [1, 2, 3], size: size, scale: 3)
+        XCTAssertEqual(key, SparklineGeometryCache.Key(values: [1, 2, 3], size: size, scale: 3))
+        XCTAssertNotEqual(key, SparklineGeometryCache.Key(values: [1, 2, 4], size: size, scale: 3))
+        XCTAssertNotEqual(key, SparklineGeometryCache.Key(values: [1, 2, 3], size: size, scale: 2))
+    }
+
+    func testShortSeriesAreBuiltInlineAndReused() {
+        // Given
+        let cache = SparklineGeometryCache(countLimit: 10)
+        let values = SparklineView.generateSampleData(for: 5, points: 20, seed: 42)
+        let key = SparklineGeometryCache.Key(values: values, size: size, scale: 2)
+
+        // When
+        let first = cache.geometry(for: key, values: values, size: size) { _ in XCTFail("Built inline") }
+        let second = cache.geometry(for: key, values: values, size: size) { _ in XCTFail("Cached") }
+
+        // Then
+        XCTAssertNotNil(first)
+        XCTAssertTrue(first === second)
+        XCTAssertEqual(cache.count, 1)
+    }
+
+    func testLongSeriesAreBuiltOffMainOnce() {
+        // Given
+        let cache = SparklineGeometryCache(countLimit: 10)
+        let values = (0..<500).map { sin(Double($0) / 10) }
+        let key = SparklineGeometryCache.Key(values: values, size: size, scale: 2)
+        let built = expectation(description: "built")
+        built.expectedFulfillmentCount = 2
+
+        // When
+        // Two cells asking for the same key share one build
+        XCTAssertNil(cache.geometry(for: key, values: values, size: size) { geometry in
+            XCTAssertTrue(Thread.isMainThread)
+            XCTAssertEqual(geometry?.pointCount, 500)
+            built.fulfill()
+        })
+        XCTAssertNil(cache.geometry(for: key, values: values, size: size) { _ in built.fulfill() })
+
+        // Then
+        wait(for: [built], timeout: 2)
+        XCTAssertNotNil(cache.cachedGeometry(for: key))
+    }
+
+    func testSeededSampleDataIsRepeatable() {
+        let first = SparklineView.generateSampleData(for: -3, points: 20, seed: 7)
+        XCTAssertEqual(first, SparklineView.generateSampleData(for: -3, points: 20, seed: 7))
+        XCTAssertEqual(first.last ?? 0, 97, accuracy: 0.0001)
+    }
+
+    func testGradientsAreSharedPerColour() {
+        let cache = SparklineGeometryCache(countLimit: 10)
+        let green = UIColor.systemGreen.resolvedColor(with: UITraitCollection(userInterfaceStyle: .light)).cgColor
+        XCTAssertTrue(cache.fillGradient(for: green) === cache.fillGradient(for: green))
+    }
+}
@@ -0,0 +1,283 @@
+//
+//  PriceAlertEngineTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Unit tests for PriceAlertEngine covering indexed threshold crossings,
+//  hysteresis/re-arming, cooldown deduplication, indicator rules (including seeding
+//  and SMA warm-up) and scale.
+//  Patterns:
+//  - Ticks are fed explicitly with controlled timestamps (no publishers involved)
+//  - Benchmark uses XCTest measure with 10k rules across 5000 coins
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class PriceAlertEngineTests: XCTestCase {
+
+    private var engine: PriceAlertEngine!
+    private let start = Date(timeIntervalSince1970: 1_700_000_000)
+
+    override func setUp() {
+        super.setUp()
+        engine = PriceAlertEngine()
+    }
+
+    override func tearDown() {
+        engine = nil
+        super.tearDown()
+    }
+
+    private func tick(_ coinId: Int, _ price: Double, change: Double? = nil) -> PriceTick {
+        PriceTick(coinId: coinId, price: price, percentChange24h: change)
+    }
+
+    // MARK: - Price Thresholds
+
+    func testPriceAboveFiresOnceWhenCrossedUpward() {
+        // Given
+        // Rule at 100 with price starting below it
+        let rule = PriceAlertRule(coinId: 1, condition: .priceAbove(100), cooldown: 0)
+        engine.addRule(rule)
+        engine.evaluate([tick(1, 95)], at: start)
+
+        // When
+        // Price crosses the level, then keeps rising
+        let crossing = engine.evaluate([tick(1, 101)], at: start.addingTimeInterval(30))
+        let continued = engine.evaluate([tick(1, 110)], at: start.addingTimeInterval(60))
+
+        // Then
+        // Exactly one alert for the crossing, none while remaining above
+        XCTAssertEqual(crossing.count, 1)
+        XCTAssertEqual(crossing.first?.ruleId, rule.id)
+        XCTAssertEqual(crossing.first?.direction, .up)
+        XCTAssertTrue(continued.isEmpty)
+    }
+
+    func testFirstObservationDoesNotFireForAlreadySatisfiedRule() {
+        // Given
+        // Rule is already satisfied when the coin is first seen
+        engine.addRule(PriceAlertRule(coinId: 1, condition: .priceAbove(100), cooldown: 0))
+
+        // When
+        let events = engine.evaluate([tick(1, 120)], at: start)
+
+        // Then
+        XCTAssertTrue(events.isEmpty)
+    }
+
+    func testPriceBelowFiresOnDownwardCrossOnly() {
+        // Given
+        engine.addRule(PriceAlertRule(coinId: 1, condition: .priceBelow(50), cooldown: 0))
+        engine.evaluate([tick(1, 60)], at: start)
+
+        // When
+        let up = engine.evaluate([tick(1, 70)], at: start.addingTimeInterval(30))
+        let down = engine.evaluate([tick(1, 45)], at: start.addingTimeInterval(60))
+
+        // Then
+        XCTAssertTrue(up.isEmpty)
+        XCTAssertEqual(down.count, 1)
+        XCTAssertEqual(down.first?.direction, .down)
+    }
+
+    func testHysteresisRequiresRetreatBeforeRefiring() {
+        // Given
+        // 5% hysteresis on a 100 level → re-arms only at or below 95
+        engine.addRule(PriceAlertRule(coinId: 1, condition: .priceAbove(100), hysteresis: 0.05, cooldown: 0))
+        engine.evaluate([tick(1, 90)], at: start)
+        XCTAssertEqual(engine.evaluate([tick(1, 101)], at: start.addingTimeInterval(1)).count, 1)
+
+        // When
+        // Small dip that stays inside the band, then back above
+        engine.evaluate([tick(1, 98)], at: start.addingTimeInterval(2))
+        let flap = engine.evaluate([tick(1, 102)], at: start.addingTimeInterval(3))
+
+        // Deep retreat past the re-arm level, then back above
+        engine.evaluate([tick(1, 94)], at: start.addingTimeInterval(4))
+        let refire = engine.evaluate([tick(1, 103)], at: start.addingTimeInterval(5))
+
+        // Then
+        XCTAssertTrue(flap.isEmpty)
+        XCTAssertEqual(refire.count, 1)
+    }
+
+    func testCooldownSuppressesRepeatedAlerts() {
+        // Given
+        // No hysteresis but a 10 minute cooldown
+        engine.addRule(PriceAlertRule(coinId: 1, condition: .priceAbove(100), hysteresis: 0, cooldown: 600))
+        engine.evaluate([tick(1, 99)], at: start)
+
+        // When
+        let first = engine.evaluate([tick(1, 101)], at: start.addingTimeInterval(30))
+        engine.evaluate([tick(1, 99)], at: start.addingTimeInterval(60))
+        let suppressed = engine.evaluate([tick(1, 101)], at: start.addingTimeInterval(90))
+        engine.evaluate([tick(1, 99)], at: start.addingTimeInterval(700))
+        let afterCooldown = engine.evaluate([tick(1, 101)], at: start.addingTimeInterval(730))
+
+        // Then
+        XCTAssertEqual(first.count, 1)
+        XCTAssertTrue(suppressed.isEmpty)
+        XCTAssertEqual(afterCooldown.count, 1)
+    }
+
+    func testOnlyCrossedLevelsFireForLargeMove() {
+        // Given
+        // Levels spread across a range; a jump from 100 to 125 crosses 110 and 120 only
+        for level in [90.0, 110.0, 120.0, 130.0] {
+            engine.addRule(PriceAlertRule(coinId: 7, condition: .priceAbove(level), cooldown: 0))
+        }
+        engine.evaluate([tick(7, 100)], at: start)
+
+        // When
+        let events = engine.evaluate([tick(7, 125)], at: start.addingTimeInterval(30))
+
+        // Then
+        XCTAssertEqual(Set(events.map { $0.condition }.compactMap { condition -> Double? in
+            if case .priceAbove(let level) = condition { return level }
+            return nil
+        }), [110, 120])
+    }
+
+    func testRemovedRuleNoLongerFires() {
+        // Given
+        let rule = PriceAlertRule(coinId: 1, condition: .priceAbove(100), cooldown: 0)
+        engine.addRule(rule)
+        engine.evaluate([tick(1, 95)], at: start)
+
+        // When
+        engine.removeRule(id: rule.id)
+        let events = engine.evaluate([tick(1, 105)], at: start.addingTimeInterval(30))
+
+        // Then
+        XCTAssertTrue(events.isEmpty)
+        XCTAssertEqual(engine.ruleCount, 0)
+        XCTAssertEqual(engine.watchedCoinCount, 0)
+    }
+
+    // MARK: - 24h Change
+
+    func testPercentChangeBeyondFiresInBothDirections() {
+        // Given
+        engine.addRule(PriceAlertRule(coinId: 1, condition: .percentChange24hBeyond(10), hysteresis: 0, cooldown: 0))
+        engine.evaluate([tick(1, 100, change: 2)], at: start)
+
+        // When
+        let surge = engine.evaluate([tick(1, 112, change: 12)], at: start.addingTimeInterval(30))
+        engine.evaluate([tick(1, 100, change: 1)], at: start.addingTimeInterval(60))
+        let crash = engine.evaluate([tick(1, 85, change: -15)], at: start.addingTimeInterval(90))
+
+        // Then
+        XCTAssertEqual(surge.first?.direction, .up)
+        XCTAssertEqual(surge.first?.value, 12)
+        XCTAssertEqual(crash.first?.direction, .down)
+        XCTAssertEqual(crash.first?.value, -15)
+    }
+
+    // MARK: - Indicator Rules
+
+    func testRSIAboveFiresAfterSustainedRally() {
+        // Given
+        // Seed with a flat-ish series so RSI sits mid-range
+        engine.addRule(PriceAlertRule(coinId: 1, condition: .rsiAbove(70, period: 14), cooldown: 0))
+        engine.seedIndicators(coinId: 1, prices: (0..<30).map { 100 + ($0 % 2 == 0 ? 1.0 : -1.0) })
+        engine.evaluate([tick(1, 100)], at: start)
+
+        // When
+        // Steady rally pushes RSI above 70
+        var events: [PriceAlertEvent] = []
+        for step in 1...20 {
+            events += engine.evaluate([tick(1, 100 + Double(step) * 2)], at: start.addingTimeInterval(Double(step) * 30))
+        }
+
+        // Then
+        // Fires exactly once despite RSI staying overbought
+        XCTAssertEqual(events.count, 1)
+        XCTAssertGreaterThan(events.first?.value ?? 0, 70)
+    }
+
+    func testSMACrossoverFiresOnSideChange() {
+        // Given
+        // Downtrend establishes fast below slow
+        engine.addRule(PriceAlertRule(coinId: 1, condition: .smaCrossover(fast: 3, slow: 8), hysteresis: 0.001, cooldown: 0))
+        engine.seedIndicators(coinId: 1, prices: (0..<10).map { 200 - Double($0) * 5 })
+        engine.evaluate([tick(1, 150)], at: start)
+
+        // When
+        // Sharp reversal upward
+        var events: [PriceAlertEvent] = []
+        for step in 1...8 {
+            events += engine.evaluate([tick(1, 150 + Double(step) * 10)], at: start.addingTimeInterval(Double(step) * 30))
+        }
+
+        // Then
+        XCTAssertEqual(events.count, 1)
+        XCTAssertEqual(events.first?.direction, .up)
+    }
+
+    func testSlowSMAReceivesPricesWhileFastSMAWarmsUp() {
+        // Given
+        // No seeding: the slow SMA must include the ticks that arrive before the fast one is ready
+        engine.addRule(PriceAlertRule(coinId: 1, condition: .smaCrossover(fast: 2, slow: 4), hysteresis: 0.001, cooldown: 0))
+        var events: [PriceAlertEvent] = []
+        for (step, price) in [200.0, 100, 100, 100, 100].enumerated() {
+            events += engine.evaluate([tick(1, price)], at: start.addingTimeInterval(Double(step) * 30))
+        }
+
+        // When
+        // fast (100 + 130) / 2 = 115 crosses slow (100 + 100 + 100 + 130) / 4 = 107.5
+        events += engine.evaluate([tick(1, 130)], at: start.addingTimeInterval(150))
+
+        // Then
+        XCTAssertEqual(events.count, 1)
+        XCTAssertEqual(events.first?.direction, .up)
+        XCTAssertEqual(events.first?.value ?? 0, 7.5, accuracy: 1e-9)
+    }
+
+    func testSeedingSkipsTracksThatAlreadySawLiveTicks() {
+        // Given
+        // RSI track already fed by a live tick
+        engine.addRule(PriceAlertRule(coinId: 1, condition: .rsiAbove(70, period: 2), cooldown: 0))
+        engine.evaluate([tick(1, 100)], at: start)
+
+        // When
+        // Late history must not be appended after the live tick
+        engine.seedIndicators(coinId: 1, prices: [10, 20, 30, 40, 50])
+        let events = engine.evaluate([tick(1, 101)], at: start.addingTimeInterval(30))
+
+        // Then
+        XCTAssertTrue(events.isEmpty)
+    }
+
+    // MARK: - Benchmark
+
+    func testEvaluationPerformanceTenThousandRulesFiveThousandCoins() {
+        // Given
+        // 10k threshold rules spread over 5000 coins, ticks for all coins
+        let coinCount = 5000
+        for i in 0..<10_000 {
+            let coinId = i % coinCount
+            let level = 100 + Double(i % 37)
+            let condition: PriceAlertRule.Condition = i % 2 == 0 ? .priceAbove(level) : .priceBelow(level - 20)
+            engine.addRule(PriceAlertRule(coinId: coinId, condition: condition, cooldown: 0))
+        }
+        var prices = (0..<coinCount).map { 100 + Double($0 % 11) }
+        engine.evaluate(prices.enumerated().map { tick($0.offset, $0.element) }, at: start)
+        XCTAssertEqual(engine.ruleCount, 10_000)
+
+        // When / Then
+        // Random-walk ticks across all coins
+        var step = 0
+        measure {
+            for _ in 0..<10 {
+                step += 1
+                for i in 0..<coinCount {
+                    prices[i] *= 1 + Double.random(in: -0.02...0.02)
+                }
+                let ticks = prices.enumerated().map { tick($0.offset, $0.element) }
+                engine.evaluate(ticks, at: start.addingTimeInterval(Double(step) * 30))
+            }
+        }
+    }
+}
@@ -0,0 +1,147 @@
+//
+//  BacktesterTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Unit tests for Backtester covering equity/drawdown math, trade extraction,
+//  each built-in strategy, sweep/run consistency and sweep throughput.
+//  Patterns:
+//  - Candles are synthesized from explicit close sequences (high/low = close ± 1)
+//  - Fees are zeroed unless a test is specifically about fees
+//  - Benchmark uses XCTest measure over a 1-year hourly series
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class BacktesterTests: XCTestCase {
+
+    // MARK: - Helpers
+
+    private func candles(_ closes: [Double]) -> [OHLCData] {
+        closes.enumerated().map { index, close in
+            OHLCData(timestamp: Date(timeIntervalSince1970: Double(index) * 3600),
+                     open: close, high: close + 1, low: close - 1, close: close)
+        }
+    }
+
+    private let noFees = BacktestConfiguration(feeRate: 0, periodsPerYear: 8760)
+
+    // MARK: - Strategies
+
+    func testSMACrossoverCapturesTrendAndMatchesBuyAndHoldAfterEntry() {
+        // Given
+        // Flat, then a steady uptrend
+        let closes = Array(repeating: 100.0, count: 10) + (1...30).map { 100 + Double($0) }
+        let backtester = Backtester(candles: candles(closes), configuration: noFees)
+
+        // When
+        let result = backtester.run(.smaCrossover(fast: 2, slow: 5))
+
+        // Then
+        // One open trade marked to the last close, equity grows, no drawdown in a monotonic rise
+        XCTAssertEqual(result.trades.count, 1)
+        XCTAssertEqual(result.trades.first?.exitIndex, closes.count - 1)
+        let entry = result.trades[0].entryIndex
+        XCTAssertEqual(result.equityCurve.last ?? 0, closes.last! / closes[entry], accuracy: 1e-9)
+        XCTAssertEqual(result.summary.maxDrawdown, 0, accuracy: 1e-12)
+        XCTAssertEqual(result.summary.winRate, 1)
+        XCTAssertEqual(result.equityCurve.count, closes.count)
+    }
+
+    func testRSIMeanReversionEntersOnOversoldAndExitsOnOverbought() {
+        // Given
+        // Sell-off drives RSI down, recovery drives it up
+        let closes = (0..<10).map { 100 - Double($0) } + (1...25).map { 91 + Double($0) * 3 }
+        let backtester = Backtester(candles: candles(closes), configuration: noFees)
+
+        // When
+        let result = backtester.run(.rsiMeanReversion(period: 5, oversold: 30, overbought: 70))
+
+        // Then
+        XCTAssertEqual(result.trades.count, 1)
+        XCTAssertTrue(result.trades[0].isWin)
+        XCTAssertLessThan(result.trades[0].exitIndex, closes.count - 1)
+        XCTAssertGreaterThan(result.summary.totalReturn, 0)
+    }
+
+    func testBreakoutEntersAboveChannelAndExitsBelowIt() {
+        // Given
+        // Range-bound, breakout rally, then breakdown
+        let range = (0..<10).map { 100 + ($0 % 2 == 0 ? 2.0 : -2.0) }
+        let rally = (1...5).map { 105 + Double($0) * 3 }
+        let crash = (1...5).map { 115 - Double($0) * 8 }
+        let closes = range + rally + crash
+        let backtester = Backtester(candles: candles(closes), configuration: noFees)
+
+        // When
+        let result = backtester.run(.breakout(lookback: 5))
+
+        // Then
+        XCTAssertEqual(result.trades.count, 1)
+        XCTAssertEqual(result.trades[0].entryIndex, range.count)
+        XCTAssertGreaterThan(result.summary.maxDrawdown, 0)
+        XCTAssertTrue(result.drawdown.allSatisfy { $0 <= 0 })
+    }
+
+    func testFeesReduceEquityOnEachPositionChange() {
+        // Given
+        let closes = Array(repeating: 100.0, count: 10) + (1...30).map { 100 + Double($0) }
+        let strategy = BacktestStrategy.smaCrossover(fast: 2, slow: 5)
+
+        // When
+        let free = Backtester(candles: candles(closes), configuration: noFees).run(strategy)
+        let charged = Backtester(candles: candles(closes), configuration: BacktestConfiguration(feeRate: 0.01)).run(strategy)
+
+        // Then
+        XCTAssertLessThan(charged.summary.totalReturn, free.summary.totalReturn)
+    }
+
+    // MARK: - Sweeps
+
+    func testSweepSummariesMatchIndividualRuns() {
+        // Given
+        let closes = (0..<500).map { 100 + sin(Double($0) / 15) * 10 + Double($0) * 0.05 }
+        let backtester = Backtester(candles: candles(closes))
+        let strategies = BacktestStrategy.smaCrossoverGrid(fast: [3, 5, 8], slow: [10, 20])
+            + [.rsiMeanReversion(period: 14, oversold: 30, overbought: 70), .breakout(lookback: 20)]
+
+        // When
+        let summaries = backtester.sweep(strategies)
+
+        // Then
+        XCTAssertEqual(summaries.map { $0.strategy }, strategies)
+        for (strategy, summary) in zip(strategies, summaries) {
+            let full = backtester.run(strategy).summary
+            XCTAssertEqual(summary.totalReturn, full.totalReturn, accuracy: 1e-12)
+            XCTAssertEqual(summary.sharpe, full.sharpe, accuracy: 1e-12)
+            XCTAssertEqual(summary.tradeCount, full.tradeCount)
+        }
+    }
+
+    func testSMACrossoverGridSkipsInvalidCombinations() {
+        let grid = BacktestStrategy.smaCrossoverGrid(fast: [5, 10, 20], slow: [10, 20])
+        XCTAssertEqual(grid, [.smaCrossover(fast: 5, slow: 10), .smaCrossover(fast: 5, slow: 20), .smaCrossover(fast: 10, slow: 20)])
+    }
+
+    // MARK: - Benchmark
+
+    func testSweepPerformanceOneYearHourly() {
+        // Given
+        // ~2000 SMA combinations over 8760 hourly bars
+        var price = 30_000.0
+        let closes = (0..<8760).map { t -> Double in
+            price *= 1 + sin(Double(t) * 0.013) * 0.004 + cos(Double(t) * 0.0071) * 0.003
+            return price
+        }
+        let backtester = Backtester(candles: candles(closes))
+        let strategies = BacktestStrategy.smaCrossoverGrid(fast: Array(stride(from: 2, through: 100, by: 2)),
+                                                           slow: Array(stride(from: 10, through: 200, by: 4)))
+        _ = backtester.sweep(strategies) // Warm indicator cache so the measure covers the sweep itself
+
+        // When / Then
+        measure {
+            XCTAssertEqual(backtester.sweep(strategies).count, strategies.count)
+        }
+    }
+}
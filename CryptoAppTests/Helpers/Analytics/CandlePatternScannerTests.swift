@@ -0,0 +1,134 @@
+//
+//  CandlePatternScannerTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Unit tests for CandlePatternScanner covering each pattern's shape rules, index
+//  alignment of the masks, tail-only rescans for live candles and parallel screening.
+//  Patterns:
+//  - Candles are built from explicit (open, high, low, close) tuples
+//  - Patterns are asserted on the candle that completes them
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class CandlePatternScannerTests: XCTestCase {
+
+    // MARK: - Helpers
+
+    private func candles(_ values: [(Double, Double, Double, Double)]) -> [OHLCData] {
+        values.enumerated().map { index, ohlc in
+            OHLCData(timestamp: Date(timeIntervalSince1970: Double(index) * 3600),
+                     open: ohlc.0, high: ohlc.1, low: ohlc.2, close: ohlc.3)
+        }
+    }
+
+    // MARK: - Single-Candle Patterns
+
+    func testDojiAndHammer() {
+        // Given
+        let series = candles([
+            (100, 105, 95, 100.5),   // Doji: tiny body, wide range
+            (100, 102.2, 90, 102),   // Hammer: long lower wick, short upper wick
+            (100, 110, 99, 109)      // Plain bullish candle
+        ])
+
+        // When
+        let masks = CandlePatternScanner.scan(series)
+
+        // Then
+        XCTAssertEqual(masks.count, 3)
+        XCTAssertEqual(masks[0], .doji)
+        XCTAssertEqual(masks[1], .hammer)
+        XCTAssertFalse(masks[2].contains(.doji))
+        XCTAssertFalse(masks[2].contains(.hammer))
+    }
+
+    // MARK: - Multi-Candle Patterns
+
+    func testEngulfingIsFlaggedOnTheEngulfingCandle() {
+        let bullish = CandlePatternScanner.scan(candles([
+            (105, 106, 99, 100),     // Bearish
+            (99, 108, 98, 107)       // Bullish body engulfs the previous body
+        ]))
+        XCTAssertTrue(bullish[1].contains(.bullishEngulfing))
+        XCTAssertFalse(bullish[0].contains(.bullishEngulfing))
+
+        let bearish = CandlePatternScanner.scan(candles([
+            (100, 106, 99, 105),
+            (106, 107, 98, 99)
+        ]))
+        XCTAssertTrue(bearish[1].contains(.bearishEngulfing))
+    }
+
+    func testMorningAndEveningStars() {
+        // Given
+        let morning = candles([
+            (110, 111, 99, 100),     // Long bearish
+            (99, 100, 97, 98.5),     // Small star
+            (99, 109, 98, 108)       // Bullish close above the first body's midpoint
+        ])
+        let evening = candles([
+            (100, 111, 99, 110),
+            (111, 113, 110, 111.5),
+            (111, 112, 101, 102)
+        ])
+
+        // When / Then
+        XCTAssertTrue(CandlePatternScanner.scan(morning)[2].contains(.morningStar))
+        XCTAssertTrue(CandlePatternScanner.scan(evening)[2].contains(.eveningStar))
+    }
+
+    // MARK: - Live Updates
+
+    func testScanLastMatchesFullScan() {
+        let series = candles([
+            (110, 111, 99, 100),
+            (99, 100, 97, 98.5),
+            (99, 109, 98, 108)
+        ])
+        XCTAssertEqual(CandlePatternScanner.scanLast(series), CandlePatternScanner.scan(series).last)
+        XCTAssertEqual(CandlePatternScanner.scanLast([OHLCData]()), [])
+    }
+
+    // MARK: - Screening
+
+    func testScreenUnionsPatternsFromRecentCandlesOnly() {
+        // Given
+        let plain = (100.0, 110.0, 99.0, 109.0)
+        let doji = (100.0, 105.0, 95.0, 100.5)
+        var series: [Int: [OHLCData]] = [:]
+        series[1] = candles([doji] + Array(repeating: plain, count: 10))   // Doji too old
+        series[2] = candles(Array(repeating: plain, count: 10) + [doji])   // Doji on the last candle
+        series[3] = []
+
+        // When
+        let matches = CandlePatternScanner.screen(series, lookback: 3)
+
+        // Then
+        XCTAssertEqual(matches[1], [])
+        XCTAssertEqual(matches[2], .doji)
+        XCTAssertNil(matches[3])
+    }
+
+    func testScreenMatchesSequentialScanAcrossManyCoins() {
+        // Given
+        let shapes: [(Double, Double, Double, Double)] = [
+            (100, 105, 95, 100.5), (100, 102.2, 90, 102), (105, 106, 99, 100), (99, 108, 98, 107)
+        ]
+        var series: [Int: [OHLCData]] = [:]
+        for coinId in 0..<500 {
+            series[coinId] = candles((0..<50).map { shapes[($0 + coinId) % shapes.count] })
+        }
+
+        // When
+        let matches = CandlePatternScanner.screen(series, lookback: 2)
+
+        // Then
+        for (coinId, coinCandles) in series {
+            let expected = CandlePatternScanner.scan(coinCandles).suffix(2).reduce(CandlePattern()) { $0.union($1) }
+            XCTAssertEqual(matches[coinId], expected, "coin \(coinId)")
+        }
+    }
+}
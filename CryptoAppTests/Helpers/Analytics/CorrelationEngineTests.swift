@@ -0,0 +1,181 @@
+//
+//  CorrelationEngineTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Unit tests for CorrelationEngine covering correlation/beta/volatility against
+//  naive reference formulas, incremental sliding-window updates and scale.
+//  Patterns:
+//  - Synthetic price series built from known return sequences
+//  - Incremental results compared to a fresh engine over the same window
+//  - Benchmark uses XCTest measure with 100 coins × 1 year of hourly points
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class CorrelationEngineTests: XCTestCase {
+
+    // MARK: - Helpers
+
+    /// Builds a price series from log returns starting at 100
+    private func prices(fromReturns returns: [Double]) -> [Double] {
+        var price = 100.0
+        return [price] + returns.map { r in
+            price *= exp(r)
+            return price
+        }
+    }
+
+    private func naiveCorrelation(_ x: [Double], _ y: [Double]) -> Double {
+        let n = Double(x.count)
+        let mx = x.reduce(0, +) / n
+        let my = y.reduce(0, +) / n
+        var sxy = 0.0, sxx = 0.0, syy = 0.0
+        for t in x.indices {
+            sxy += (x[t] - mx) * (y[t] - my)
+            sxx += (x[t] - mx) * (x[t] - mx)
+            syy += (y[t] - my) * (y[t] - my)
+        }
+        return sxy / (sxx * syy).squareRoot()
+    }
+
+    private func randomReturns(_ count: Int, seed: Int) -> [Double] {
+        (0..<count).map { t in sin(Double(t * (seed + 3)) * 0.37 + Double(seed)) * 0.01 + Double((t * 7919 + seed * 104729) % 97) / 97_000 - 0.0005 }
+    }
+
+    // MARK: - Correctness
+
+    func testCorrelationMatchesNaiveComputation() {
+        // Given
+        // Three coins: B is a scaled copy of A, C is independent-ish
+        let a = randomReturns(500, seed: 1)
+        let b = a.map { $0 * 2 }
+        let c = randomReturns(500, seed: 5)
+
+        // When
+        let engine = CorrelationEngine(coinIds: [1, 2, 3],
+                                       series: [prices(fromReturns: a), prices(fromReturns: b), prices(fromReturns: c)],
+                                       benchmarkIndex: 0,
+                                       periodsPerYear: 8760)
+        let snapshot = engine.snapshot()
+
+        // Then
+        XCTAssertEqual(snapshot.sampleCount, 500)
+        XCTAssertEqual(snapshot.correlation(0, 0), 1, accuracy: 1e-9)
+        XCTAssertEqual(snapshot.correlation(0, 1), 1, accuracy: 1e-9)
+        XCTAssertEqual(snapshot.correlation(0, 2), naiveCorrelation(a, c), accuracy: 1e-9)
+        XCTAssertEqual(snapshot.correlation(2, 0), snapshot.correlation(0, 2))
+        // Beta of a 2x levered copy is 2
+        XCTAssertEqual(snapshot.beta[1] ?? 0, 2, accuracy: 1e-9)
+        XCTAssertEqual(snapshot.beta[0] ?? 0, 1, accuracy: 1e-9)
+    }
+
+    func testVolatilityIsAnnualisedSampleStandardDeviation() {
+        // Given
+        let returns = randomReturns(1000, seed: 2)
+        let mean = returns.reduce(0, +) / Double(returns.count)
+        let variance = returns.map { ($0 - mean) * ($0 - mean) }.reduce(0, +) / Double(returns.count - 1)
+
+        // When
+        let engine = CorrelationEngine(coinIds: [1], series: [prices(fromReturns: returns)], benchmarkIndex: nil, periodsPerYear: 365)
+
+        // Then
+        XCTAssertEqual(engine.snapshot().volatility[0], (variance * 365).squareRoot(), accuracy: 1e-9)
+        XCTAssertNil(engine.snapshot().beta[0])
+    }
+
+    func testSeriesOfDifferentLengthsAlignOnMostRecentPoints() {
+        // Given
+        let a = randomReturns(300, seed: 3)
+        let b = randomReturns(300, seed: 4)
+        let longA = prices(fromReturns: randomReturns(50, seed: 9) + a)
+
+        // When
+        let engine = CorrelationEngine(coinIds: [1, 2], series: [longA, prices(fromReturns: b)], benchmarkIndex: nil, periodsPerYear: 8760)
+
+        // Then
+        XCTAssertEqual(engine.sampleCount, 300)
+        XCTAssertEqual(engine.snapshot().correlation(0, 1), naiveCorrelation(a, b), accuracy: 1e-9)
+    }
+
+    func testBlockedKernelMatchesAcrossBlockAndTileBoundaries() {
+        // Given
+        // More coins than one row block and more samples than one time tile
+        let coinCount = CorrelationEngine.rowBlockSize * 2 + 3
+        let length = CorrelationEngine.timeTileSize + 123
+        let rows = (0..<coinCount).map { randomReturns(length, seed: $0) }
+
+        // When
+        let gram = CorrelationEngine.blockedCrossProducts(rows, from: 0, count: length)
+
+        // Then
+        for (i, j) in [(0, 0), (5, 17), (coinCount - 1, 0), (coinCount - 1, coinCount - 2)] {
+            let expected = zip(rows[i], rows[j]).map { $0 * $1 }.reduce(0, +)
+            XCTAssertEqual(gram[i * coinCount + j], expected, accuracy: 1e-9)
+            XCTAssertEqual(gram[j * coinCount + i], expected, accuracy: 1e-9)
+        }
+    }
+
+    // MARK: - Incremental Updates
+
+    func testIncrementalAppendMatchesFreshComputationOverSlidingWindow() {
+        // Given
+        let a = randomReturns(260, seed: 6)
+        let b = randomReturns(260, seed: 7)
+        let pricesA = prices(fromReturns: a)
+        let pricesB = prices(fromReturns: b)
+        let engine = CorrelationEngine(coinIds: [1, 2],
+                                       series: [Array(pricesA.prefix(201)), Array(pricesB.prefix(201))],
+                                       benchmarkIndex: 0,
+                                       periodsPerYear: 8760)
+
+        // When
+        // Stream the remaining 60 points one at a time
+        for t in 201..<pricesA.count {
+            engine.append(prices: [pricesA[t], pricesB[t]])
+        }
+
+        // Then
+        // Window stays at 200 returns and equals a fresh engine over the last 200
+        let fresh = CorrelationEngine(coinIds: [1, 2],
+                                      series: [Array(pricesA.suffix(201)), Array(pricesB.suffix(201))],
+                                      benchmarkIndex: 0,
+                                      periodsPerYear: 8760)
+        XCTAssertEqual(engine.sampleCount, 200)
+        XCTAssertEqual(engine.snapshot().correlation(0, 1), fresh.snapshot().correlation(0, 1), accuracy: 1e-9)
+        XCTAssertEqual(engine.snapshot().beta[1] ?? 0, fresh.snapshot().beta[1] ?? 0, accuracy: 1e-9)
+        XCTAssertEqual(engine.snapshot().volatility[1], fresh.snapshot().volatility[1], accuracy: 1e-9)
+    }
+
+    func testRollingBetaMatchesFullBetaOfTrailingWindow() {
+        // Given
+        let a = randomReturns(400, seed: 8)
+        let b = zip(a, randomReturns(400, seed: 11)).map { 1.5 * $0 + $1 }
+        let engine = CorrelationEngine(coinIds: [1, 2], series: [prices(fromReturns: a), prices(fromReturns: b)],
+                                       benchmarkIndex: 0, periodsPerYear: 8760)
+
+        // When
+        let rolling = engine.rollingBeta(window: 50)
+
+        // Then
+        let trailing = CorrelationEngine(coinIds: [1, 2],
+                                         series: [prices(fromReturns: Array(a.suffix(50))), prices(fromReturns: Array(b.suffix(50)))],
+                                         benchmarkIndex: 0, periodsPerYear: 8760)
+        XCTAssertTrue(rolling[1][48].isNaN)
+        XCTAssertEqual(rolling[1].last ?? 0, trailing.snapshot().beta[1] ?? 0, accuracy: 1e-9)
+    }
+
+    // MARK: - Benchmark
+
+    func testCorrelationPerformanceHundredCoinsOneYearHourly() {
+        // Given
+        let series = (0..<100).map { prices(fromReturns: randomReturns(8760, seed: $0)) }
+
+        // When / Then
+        measure {
+            let engine = CorrelationEngine(coinIds: Array(0..<100), series: series, benchmarkIndex: 0, periodsPerYear: 8760)
+            XCTAssertEqual(engine.snapshot().sampleCount, 8760)
+        }
+    }
+}
@@ -0,0 +1,109 @@
+//
+//  SeriesAlignerTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Unit tests for SeriesAligner covering the merge join on shared and offset grids,
+//  forward-filling sparser series, trimming to the common window and percent normalisation.
+//  Patterns:
+//  - Series are built from (time, value) tuples on a 10-second grid
+//  - Expected grids are worked out by hand from the default half-spacing tolerance
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class SeriesAlignerTests: XCTestCase {
+
+    // MARK: - Helpers
+
+    private func series(_ points: [(TimeInterval, Double)]) -> [SeriesAligner.Sample] {
+        points.map { SeriesAligner.Sample(time: $0.0, value: $0.1) }
+    }
+
+    private func times(_ alignment: SeriesAligner.Alignment) -> [TimeInterval] {
+        alignment.timestamps.map { $0.timeIntervalSince1970 }
+    }
+
+    // MARK: - Merge Join
+
+    func testIdenticalGridsAlignOneToOne() {
+        // Given
+        let a = series([(0, 1), (10, 2), (20, 4)])
+        let b = series([(0, 10), (10, 20), (20, 5)])
+
+        // When
+        let alignment = SeriesAligner.align([a, b])
+
+        // Then
+        XCTAssertEqual(times(alignment), [0, 10, 20])
+        XCTAssertEqual(alignment.values, [[1, 2, 4], [10, 20, 5]])
+        XCTAssertEqual(alignment.percentChanges(), [[0, 100, 300], [0, 100, -50]])
+    }
+
+    func testOffsetTimestampsWithinToleranceJoinOnTheEarlierGrid() {
+        // Given: b's clock runs one second behind a's
+        let a = series([(0, 1), (10, 2), (20, 3)])
+        let b = series([(1, 5), (11, 6), (21, 7)])
+
+        // When
+        let alignment = SeriesAligner.align([a, b])
+
+        // Then
+        XCTAssertEqual(times(alignment), [0, 10, 20])
+        XCTAssertEqual(alignment.values[1], [5, 6, 7])
+    }
+
+    func testSparserSeriesIsForwardFilled() {
+        // Given
+        let dense = series([(0, 1), (10, 2), (20, 3), (30, 4), (40, 5)])
+        let sparse = series([(0, 100), (20, 200), (40, 300)])
+
+        // When
+        let alignment = SeriesAligner.align([dense, sparse])
+
+        // Then
+        XCTAssertEqual(times(alignment), [0, 10, 20, 30, 40])
+        XCTAssertEqual(alignment.values[1], [100, 100, 200, 200, 300])
+    }
+
+    func testGridIsTrimmedToTheCommonWindow() {
+        // Given: b starts later and ends earlier than a
+        let a = series([(0, 1), (10, 2), (20, 3), (30, 4), (40, 5), (50, 6)])
+        let b = series([(20, 7), (30, 8), (40, 9)])
+
+        // When
+        let alignment = SeriesAligner.align([a, b])
+
+        // Then: both lines start together, so they share the same 0% origin
+        XCTAssertEqual(times(alignment), [20, 30, 40])
+        XCTAssertEqual(alignment.values[0], [3, 4, 5])
+        XCTAssertEqual(alignment.percentChanges()[1].first, 0)
+    }
+
+    func testUnsortedInputMatchesSortedInput() {
+        let a = series([(0, 1), (10, 2), (20, 3)])
+        let b = series([(0, 4), (10, 5), (20, 6)])
+
+        let sorted = SeriesAligner.align([a, b])
+        let shuffled = SeriesAligner.align([Array(a.reversed()), b])
+
+        XCTAssertEqual(times(shuffled), times(sorted))
+        XCTAssertEqual(shuffled.values, sorted.values)
+    }
+
+    func testEmptySeriesYieldsEmptyAlignment() {
+        let alignment = SeriesAligner.align([series([(0, 1), (10, 2)]), []])
+
+        XCTAssertTrue(alignment.isEmpty)
+        XCTAssertEqual(alignment.values.count, 2)
+    }
+
+    // MARK: - Normalisation
+
+    func testPercentChangeNeedsAUsableFirstValue() {
+        XCTAssertEqual(SeriesAligner.percentChange([2, 3, 1]), [0, 50, -50])
+        XCTAssertTrue(SeriesAligner.percentChange([0, 1]).allSatisfy { $0.isNaN })
+        XCTAssertEqual(SeriesAligner.percentChange([]), [])
+    }
+}
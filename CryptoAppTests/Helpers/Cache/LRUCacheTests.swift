@@ -0,0 +1,82 @@
+//
+//  LRUCacheTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Unit tests for LRUCache covering recency promotion, count and cost limits,
+//  explicit trimming and eviction callbacks.
+//  Patterns:
+//  - String keys with Int values; costs are passed explicitly where limits are tested
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class LRUCacheTests: XCTestCase {
+
+    func testLeastRecentlyUsedEntryIsEvictedFirst() {
+        // Given
+        let cache = LRUCache<String, Int>(countLimit: 2)
+        cache.setValue(1, forKey: "a")
+        cache.setValue(2, forKey: "b")
+
+        // When
+        // Reading "a" makes "b" the coldest entry
+        _ = cache.value(forKey: "a")
+        cache.setValue(3, forKey: "c")
+
+        // Then
+        XCTAssertEqual(cache.value(forKey: "a"), 1)
+        XCTAssertNil(cache.value(forKey: "b"))
+        XCTAssertEqual(cache.value(forKey: "c"), 3)
+        XCTAssertEqual(cache.count, 2)
+    }
+
+    func testCostLimitEvictsUntilTotalFits() {
+        // Given
+        let cache = LRUCache<String, Int>(countLimit: 10, costLimit: 100)
+        var evicted: [String] = []
+        cache.onEvict = { key, _ in evicted.append(key) }
+        cache.setValue(1, forKey: "a", cost: 40)
+        cache.setValue(2, forKey: "b", cost: 40)
+
+        // When
+        cache.setValue(3, forKey: "c", cost: 50)
+
+        // Then
+        XCTAssertEqual(evicted, ["a"])
+        XCTAssertEqual(cache.totalCost, 90)
+    }
+
+    func testUpdatingAnEntryAdjustsCostAndRecency() {
+        let cache = LRUCache<String, Int>(countLimit: 2)
+        cache.setValue(1, forKey: "a", cost: 10)
+        cache.setValue(2, forKey: "b", cost: 10)
+        cache.setValue(5, forKey: "a", cost: 30)
+        cache.setValue(3, forKey: "c")
+        XCTAssertEqual(cache.value(forKey: "a"), 5)
+        XCTAssertNil(cache.value(forKey: "b"))
+        XCTAssertEqual(cache.totalCost, 30)
+    }
+
+    func testTrimAndRemove() {
+        // Given
+        let cache = LRUCache<String, Int>(countLimit: 10)
+        for (index, key) in ["a", "b", "c", "d"].enumerated() {
+            cache.setValue(index, forKey: key, cost: 10)
+        }
+
+        // When
+        let trimmed = cache.trim(toCost: 20)
+        let removed = cache.removeValue(forKey: "d")
+
+        // Then
+        XCTAssertEqual(trimmed, 2)
+        XCTAssertEqual(removed, 3)
+        XCTAssertEqual(cache.count, 1)
+        XCTAssertEqual(cache.value(forKey: "c"), 2)
+        cache.removeAll()
+        XCTAssertEqual(cache.count, 0)
+        XCTAssertEqual(cache.totalCost, 0)
+    }
+}
@@ -0,0 +1,162 @@
+//
+//  LogoAtlasTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Unit tests for LogoAtlas covering cell layout, packing only cached logos, skipping
+//  unchanged (including reordered) rebuilds, restoring persisted sheets in a new instance and replacing a
+//  previous build's sheets on disk only once the new manifest is written.
+//  Patterns:
+//  - Logos come from an injected provider backed by a dictionary
+//  - A second instance on the same directory stands in for a relaunch
+//
+
+import XCTest
+import UIKit
+@testable import CryptoApp
+
+final class LogoAtlasTests: XCTestCase {
+
+    private var directory: URL!
+
+    override func setUpWithError() throws {
+        directory = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+    }
+
+    override func tearDownWithError() throws {
+        try? FileManager.default.removeItem(at: directory)
+    }
+
+    private func makeImage() -> UIImage {
+        let format = UIGraphicsImageRendererFormat()
+        format.scale = 1
+        return UIGraphicsImageRenderer(size: CGSize(width: 4, height: 4), format: format).image { context in
+            UIColor.blue.setFill()
+            context.fill(CGRect(x: 0, y: 0, width: 4, height: 4))
+        }
+    }
+
+    // MARK: - Layout
+
+    func testContentsRectUsesOnlyTheRowsNeeded() {
+        // 10 cells → 2 rows of 8
+        XCTAssertEqual(LogoAtlas.contentsRect(forCell: 0, cellCount: 10), CGRect(x: 0, y: 0, width: 0.125, height: 0.5))
+        XCTAssertEqual(LogoAtlas.contentsRect(forCell: 9, cellCount: 10), CGRect(x: 0.125, y: 0.5, width: 0.125, height: 0.5))
+        XCTAssertEqual(LogoAtlas.rows(forCellCount: LogoAtlas.cellsPerSheet), LogoAtlas.columns)
+    }
+
+    // MARK: - Building
+
+    func testPacksCachedLogosIntoSharedSheets() {
+        // Given: 70 requested logos, one not cached yet
+        let urls = (0..<70).map { "https://example.com/\($0).png" }
+        var images: [String: UIImage] = [:]
+        urls.dropLast().forEach { images[$0] = makeImage() }
+        let atlas = LogoAtlas(directory: directory, scale: 1, imageProvider: { images[$0] })
+
+        // When
+        atlas.rebuildNow(urls: urls)
+
+        // Then
+        XCTAssertEqual(atlas.packedCount, 69)
+        XCTAssertNil(atlas.slot(for: urls[69]))
+        let first = atlas.slot(for: urls[0])
+        let second = atlas.slot(for: urls[1])
+        let overflow = atlas.slot(for: urls[64])
+        XCTAssertTrue(first?.sheet === second?.sheet, "Cells share one bitmap")
+        XCTAssertFalse(first?.sheet === overflow?.sheet, "65th logo starts a second sheet")
+        XCTAssertEqual(first?.sheet.width, 8 * 64)
+        XCTAssertEqual(overflow?.contentsRect, CGRect(x: 0, y: 0, width: 0.125, height: 1))
+    }
+
+    func testUnchangedCompleteSetIsNotRebuilt() {
+        // Given
+        var calls = 0
+        let atlas = LogoAtlas(directory: directory, scale: 1, imageProvider: { _ in
+            calls += 1
+            return self.makeImage()
+        })
+        atlas.rebuildNow(urls: ["a", "b"])
+
+        // When
+        atlas.rebuildNow(urls: ["a", "b"])
+
+        // Then
+        XCTAssertEqual(calls, 2)
+        atlas.rebuildNow(urls: ["a", "c"])
+        XCTAssertEqual(calls, 4)
+    }
+
+    func testReorderedSetIsNotRebuilt() {
+        // Given
+        var calls = 0
+        let atlas = LogoAtlas(directory: directory, scale: 1, imageProvider: { _ in
+            calls += 1
+            return self.makeImage()
+        })
+        atlas.rebuildNow(urls: ["a", "b", "c"])
+
+        // When
+        // Same logos after a rank reshuffle
+        atlas.rebuildNow(urls: ["c", "a", "b"])
+
+        // Then
+        XCTAssertEqual(calls, 3)
+        XCTAssertNotNil(atlas.slot(for: "c"))
+    }
+
+    // MARK: - Persistence
+
+    func testPersistedAtlasIsRestoredAfterARelaunch() {
+        // Given
+        let urls = ["a", "b", "c"]
+        let built = LogoAtlas(directory: directory, scale: 1, imageProvider: { _ in self.makeImage() })
+        built.rebuildNow(urls: urls)
+
+        // When: the relaunched atlas has no logos available and the same set is requested
+        let relaunched = LogoAtlas(directory: directory, scale: 1, imageProvider: { _ in nil })
+        relaunched.restoreNow()
+
+        // Then
+        XCTAssertEqual(relaunched.packedCount, 3)
+        XCTAssertEqual(relaunched.slot(for: "c")?.contentsRect, built.slot(for: "c")?.contentsRect)
+    }
+
+    func testRebuildReplacesEarlierSheetsOnDisk() {
+        // Given
+        let atlas = LogoAtlas(directory: directory, scale: 1, imageProvider: { _ in self.makeImage() })
+        atlas.rebuildNow(urls: ["a", "b"])
+        let firstSheets = sheetFiles()
+
+        // When
+        atlas.rebuildNow(urls: ["c"])
+
+        // Then: only the new build's sheet is left, under a new name
+        let secondSheets = sheetFiles()
+        XCTAssertEqual(firstSheets.count, 1)
+        XCTAssertEqual(secondSheets.count, 1)
+        XCTAssertTrue(firstSheets.isDisjoint(with: secondSheets))
+    }
+
+    func testSheetsWithoutAMatchingManifestAreNotRestored() {
+        // Given: a persisted atlas whose sheet is then replaced by an unrelated file
+        let built = LogoAtlas(directory: directory, scale: 1, imageProvider: { _ in self.makeImage() })
+        built.rebuildNow(urls: ["a"])
+        for name in sheetFiles() {
+            try? FileManager.default.removeItem(at: directory.appendingPathComponent(name))
+        }
+        try? Data("stray".utf8).write(to: directory.appendingPathComponent("sheet-0.png"))
+
+        // When
+        let relaunched = LogoAtlas(directory: directory, scale: 1, imageProvider: { _ in nil })
+        relaunched.restoreNow()
+
+        // Then
+        XCTAssertEqual(relaunched.packedCount, 0)
+    }
+
+    private func sheetFiles() -> Set<String> {
+        let files = (try? FileManager.default.contentsOfDirectory(atPath: directory.path)) ?? []
+        return Set(files.filter { $0.hasSuffix(".png") })
+    }
+}
@@ -0,0 +1,112 @@
+//
+//  LogoImageCacheTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Unit tests for LogoImageCache covering stable SHA-256 file names, the pixel-sized
+//  memory budget, persistence across instances and size-bounded disk eviction.
+//  Patterns:
+//  - Each test uses its own temporary directory; a second instance on the same directory
+//    stands in for a relaunch
+//  - `diskUsage` waits for pending disk writes before asserting
+//
+
+import XCTest
+import UIKit
+@testable import CryptoApp
+
+final class LogoImageCacheTests: XCTestCase {
+
+    private var directory: URL!
+
+    override func setUpWithError() throws {
+        directory = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+    }
+
+    override func tearDownWithError() throws {
+        try? FileManager.default.removeItem(at: directory)
+    }
+
+    private func makeImage(side: CGFloat = 8, color: UIColor = .red) -> UIImage {
+        let format = UIGraphicsImageRendererFormat()
+        format.scale = 1
+        return UIGraphicsImageRenderer(size: CGSize(width: side, height: side), format: format).image { context in
+            color.setFill()
+            context.fill(CGRect(x: 0, y: 0, width: side, height: side))
+        }
+    }
+
+    // MARK: - Keys
+
+    func testFileNameIsSHA256OfTheURL() {
+        XCTAssertEqual(LogoImageCache.fileName(for: "abc"),
+                       "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad.png")
+        XCTAssertEqual(LogoImageCache.fileName(for: "https://example.com/1.png"),
+                       LogoImageCache.fileName(for: "https://example.com/1.png"))
+    }
+
+    // MARK: - Memory Tier
+
+    func testMemoryTierIsBoundedByPixels() {
+        // Given: room for two 8×8 images
+        let cache = LogoImageCache(directory: directory, memoryPixelLimit: 128)
+
+        // When
+        cache.store(makeImage(), for: "a")
+        cache.store(makeImage(), for: "b")
+        cache.store(makeImage(), for: "c")
+
+        // Then
+        XCTAssertNil(cache.memoryImage(for: "a"))
+        XCTAssertNotNil(cache.memoryImage(for: "c"))
+        XCTAssertEqual(cache.memoryPixelCost, 128)
+    }
+
+    // MARK: - Disk Tier
+
+    func testLogosSurviveARelaunchOnDisk() {
+        // Given
+        let first = LogoImageCache(directory: directory)
+        first.store(makeImage(side: 16), for: "https://example.com/btc.png")
+        XCTAssertGreaterThan(first.diskUsage, 0)
+
+        // When
+        let relaunched = LogoImageCache(directory: directory)
+
+        // Then
+        XCTAssertNil(relaunched.memoryImage(for: "https://example.com/btc.png"))
+        let image = relaunched.diskImage(for: "https://example.com/btc.png")
+        XCTAssertNotNil(image)
+        XCTAssertEqual(image.map(LogoImageCache.pixelCost), 256)
+        XCTAssertNotNil(relaunched.memoryImage(for: "https://example.com/btc.png"), "Disk hits are promoted to memory")
+    }
+
+    func testDiskEvictsLeastRecentlyUsedFilesOverTheLimit() {
+        // Given: measure one encoded logo, then allow two and a half
+        let probe = LogoImageCache(directory: directory.appendingPathComponent("probe"))
+        probe.store(makeImage(), for: "probe")
+        let fileSize = probe.diskUsage
+        let cache = LogoImageCache(directory: directory, diskByteLimit: fileSize * 5 / 2)
+
+        // When
+        cache.store(makeImage(), for: "a")
+        cache.store(makeImage(), for: "b")
+        cache.store(makeImage(), for: "c")
+
+        // Then
+        XCTAssertLessThanOrEqual(cache.diskUsage, fileSize * 2)
+        XCTAssertNil(cache.diskImage(for: "a"))
+        XCTAssertNotNil(cache.diskImage(for: "c"))
+    }
+
+    func testRemoveAllEmptiesBothTiers() {
+        let cache = LogoImageCache(directory: directory)
+        cache.store(makeImage(), for: "a")
+
+        cache.removeAll()
+
+        XCTAssertNil(cache.memoryImage(for: "a"))
+        XCTAssertNil(cache.diskImage(for: "a"))
+        XCTAssertEqual(cache.diskUsage, 0)
+    }
+}
@@ -0,0 +1,144 @@
+//
+//  OHLCResamplerTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Unit tests for OHLCResampler covering OHLC aggregation rules, close-time stamps, UTC
+//  calendar alignment (4h, daily, ISO weekly), partial first/last buckets, volume handling
+//  and the timeframe availability rules used by the candle chart selector.
+//  Patterns:
+//  - Candles are synthesized at fixed spacing from a known UTC start time and stamped with
+//    their close time, as CoinGecko does
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class OHLCResamplerTests: XCTestCase {
+
+    /// Monday 2024-01-01 00:00:00 UTC
+    private let monday: TimeInterval = 1_704_067_200
+
+    /// Hourly candles opening at `start`, each stamped with its close time
+    private func hourly(count: Int, from start: TimeInterval, volume: Double? = 1) -> [OHLCData] {
+        (0..<count).map { index in
+            let base = 100 + Double(index)
+            return OHLCData(timestamp: Date(timeIntervalSince1970: start + Double(index + 1) * 3600),
+                            open: base, high: base + 5, low: base - 5, close: base + 1, volume: volume)
+        }
+    }
+
+    // MARK: - Aggregation
+
+    func testFourHourBucketsAggregateOpenHighLowCloseVolume() {
+        // Given
+        // 8 hourly candles starting on a 4h boundary
+        let candles = hourly(count: 8, from: monday)
+
+        // When
+        let result = OHLCResampler.resample(candles, to: .fourHours)
+
+        // Then
+        XCTAssertEqual(result.candles.count, 2)
+        let first = result.candles[0]
+        XCTAssertEqual(first.timestamp.timeIntervalSince1970, monday)
+        XCTAssertEqual(first.open, 100)
+        XCTAssertEqual(first.close, 104)
+        XCTAssertEqual(first.high, 108)
+        XCTAssertEqual(first.low, 95)
+        XCTAssertEqual(first.volume, 4)
+        XCTAssertFalse(result.isFirstPartial)
+        XCTAssertFalse(result.isLastPartial)
+    }
+
+    func testBucketsAlignToCalendarBoundariesWithPartialEdges() {
+        // Given
+        // Opens at 02:00 and closes at 10:00 → 00:00, 04:00 and 08:00 buckets
+        let candles = hourly(count: 8, from: monday + 2 * 3600)
+
+        // When
+        let result = OHLCResampler.resample(candles, to: .fourHours)
+
+        // Then
+        XCTAssertEqual(result.candles.map { $0.timestamp.timeIntervalSince1970 },
+                       [monday, monday + 4 * 3600, monday + 8 * 3600])
+        XCTAssertTrue(result.isFirstPartial)
+        XCTAssertTrue(result.isLastPartial)
+    }
+
+    func testCandleClosingOnBoundaryBelongsToEarlierBucket() {
+        // Given
+        // 4h candles (CoinGecko days=30) closing at 04:00 ... 48:00; the one closing at
+        // midnight covers 20:00-24:00 of the first day
+        let candles = (1...12).map { index in
+            OHLCData(timestamp: Date(timeIntervalSince1970: monday + Double(index) * 4 * 3600),
+                     open: Double(index), high: Double(index), low: Double(index), close: Double(index))
+        }
+
+        // When
+        let result = OHLCResampler.resample(candles, to: .oneDay)
+
+        // Then
+        // Two full days, each with six candles
+        XCTAssertEqual(result.candles.map { $0.timestamp.timeIntervalSince1970 }, [monday, monday + 86400])
+        XCTAssertEqual(result.candles.map { $0.close }, [6, 12])
+        XCTAssertFalse(result.isFirstPartial)
+        XCTAssertFalse(result.isLastPartial)
+    }
+
+    func testWeeklyBucketsStartOnMonday() {
+        // Given
+        // Thursday through the following Tuesday
+        let candles = hourly(count: 6 * 24, from: monday + 3 * 86400)
+
+        // When
+        let result = OHLCResampler.resample(candles, to: .oneWeek)
+
+        // Then
+        XCTAssertEqual(result.candles.map { $0.timestamp.timeIntervalSince1970 }, [monday, monday + 7 * 86400])
+    }
+
+    func testDailyResampleOfFullDaysHasNoPartialBuckets() {
+        // Given
+        let candles = hourly(count: 72, from: monday)
+
+        // When
+        let result = OHLCResampler.resample(candles, to: .oneDay)
+
+        // Then
+        XCTAssertEqual(result.candles.count, 3)
+        XCTAssertEqual(result.candles[1].open, candles[24].open)
+        XCTAssertEqual(result.candles[1].close, candles[47].close)
+        XCTAssertFalse(result.isFirstPartial)
+        XCTAssertFalse(result.isLastPartial)
+    }
+
+    func testMissingVolumeStaysNil() {
+        let result = OHLCResampler.resample(hourly(count: 8, from: monday, volume: nil), to: .fourHours)
+        XCTAssertNil(result.candles.first?.volume)
+    }
+
+    func testNativeTimeframeReturnsSourceUnchanged() {
+        let candles = hourly(count: 5, from: monday)
+        XCTAssertEqual(OHLCResampler.resample(candles, to: .native).candles.count, candles.count)
+    }
+
+    // MARK: - Availability
+
+    func testAvailableTimeframesOnlyIncludeCoarserOptionsWithTwoBars() {
+        // Given
+        // 30-minute candles over one day (CoinGecko days=1)
+        let halfHourly = (0..<48).map { index in
+            OHLCData(timestamp: Date(timeIntervalSince1970: monday + Double(index) * 1800), open: 1, high: 1, low: 1, close: 1)
+        }
+        // 4-hour candles over 30 days (CoinGecko days=30)
+        let fourHourly = (0..<180).map { index in
+            OHLCData(timestamp: Date(timeIntervalSince1970: monday + Double(index) * 4 * 3600), open: 1, high: 1, low: 1, close: 1)
+        }
+
+        // When / Then
+        XCTAssertEqual(OHLCResampler.availableTimeframes(for: halfHourly), [.native, .oneHour, .fourHours])
+        XCTAssertEqual(OHLCResampler.availableTimeframes(for: fourHourly), [.native, .oneDay, .oneWeek])
+        XCTAssertEqual(OHLCResampler.availableTimeframes(for: []), [.native])
+    }
+}
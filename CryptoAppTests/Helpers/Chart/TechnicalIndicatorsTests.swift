@@ -143,6 +143,21 @@ final class TechnicalIndicatorsTests: XCTestCase {
         XCTAssertTrue(analysis.isHighVolume.last ?? false)
     }
     
+    func testVolumeRatioAtIndexMatchesFullAnalysis() {
+        // Given
+        let volumes: [Double] = [10, 12, 8, 31, 0, 25, 40]
+        
+        // When
+        let analysis = TechnicalIndicators.analyzeVolume(volumes: volumes, period: 3)
+        
+        // Then
+        // Single-index ratios (used by live bar updates) agree with the batch analysis
+        for index in volumes.indices {
+            XCTAssertEqual(TechnicalIndicators.volumeRatio(at: index, volumes: volumes, period: 3),
+                           analysis.volumeRatio[index], accuracy: 1e-12)
+        }
+    }
+    
     // MARK: - Settings Persistence
     
     func testIndicatorSettingsSaveAndLoadRoundTrip() {
@@ -177,6 +192,84 @@ final class TechnicalIndicatorsTests: XCTestCase {
         XCTAssertEqual(loaded.showVolume, false)
     }
     
+    // MARK: - Incremental Indicators
+    
+    func testRollingIndicatorsMatchBatchCalculations() {
+        // Given
+        // A deterministic oscillating series long enough to exercise seeding and smoothing
+        let prices: [Double] = (0..<60).map { 100 + sin(Double($0) * 0.7) * 5 + Double($0) * 0.1 }
+        let batchSMA = TechnicalIndicators.calculateSMA(prices: prices, period: 10).values
+        let batchEMA = TechnicalIndicators.calculateEMA(prices: prices, period: 12).values
+        let batchRSI = TechnicalIndicators.calculateRSI(prices: prices, period: 14).values
+        
+        // When
+        // Feed the same prices one at a time through the streaming state
+        var sma = TechnicalIndicators.RollingSMA(period: 10)
+        var ema = TechnicalIndicators.RollingEMA(period: 12)
+        var rsi = TechnicalIndicators.RollingRSI(period: 14)
+        let streamed = prices.map { (sma.append($0), ema.append($0), rsi.append($0)) }
+        
+        // Then
+        // Warm-up positions are nil in both paths and values agree afterwards
+        for i in 0..<prices.count {
+            XCTAssertEqual(streamed[i].0 == nil, batchSMA[i] == nil, "SMA warm-up mismatch at \(i)")
+            XCTAssertEqual(streamed[i].1 == nil, batchEMA[i] == nil, "EMA warm-up mismatch at \(i)")
+            XCTAssertEqual(streamed[i].2 == nil, batchRSI[i] == nil, "RSI warm-up mismatch at \(i)")
+            if let streamedSMA = streamed[i].0, let expected = batchSMA[i] {
+                XCTAssertEqual(streamedSMA, expected, accuracy: 1e-9)
+            }
+            if let streamedEMA = streamed[i].1, let expected = batchEMA[i] {
+                XCTAssertEqual(streamedEMA, expected, accuracy: 1e-9)
+            }
+            if let streamedRSI = streamed[i].2, let expected = batchRSI[i] {
+                XCTAssertEqual(streamedRSI, expected, accuracy: 1e-9)
+            }
+        }
+    }
+    
+    // MARK: - Index-Aligned Buffers
+
+    func testIndicatorBufferAlignsValuesWithSourceIndices() {
+        // Given
+        let prices = [1.0, 2.0, 3.0, 4.0, 5.0]
+
+        // When
+        let buffer = TechnicalIndicators.IndicatorBuffer(TechnicalIndicators.calculateSMA(prices: prices, period: 3))
+
+        // Then
+        XCTAssertEqual(buffer.count, prices.count)
+        XCTAssertEqual(buffer.firstValidIndex, 2)
+        XCTAssertNil(buffer.value(at: 1))
+        XCTAssertEqual(buffer.value(at: 3), 3.0)
+        XCTAssertEqual(buffer.latest, 4.0)
+        XCTAssertNil(buffer.value(at: 5))
+        XCTAssertNil(buffer.value(at: -1))
+        XCTAssertTrue(buffer.isWarmingUp(at: 1))
+        XCTAssertFalse(buffer.isWarmingUp(at: 2))
+    }
+
+    func testIndicatorBufferAppendAndReplaceLastTrackFirstValidIndex() {
+        // Given
+        var buffer = TechnicalIndicators.IndicatorBuffer(values: [nil, nil], period: 3)
+        XCTAssertNil(buffer.firstValidIndex)
+
+        // When
+        buffer.append(2.0)
+
+        // Then
+        XCTAssertEqual(buffer.firstValidIndex, 2)
+        XCTAssertEqual(buffer.latest, 2.0)
+
+        // When
+        buffer.replaceLast(2.5)
+        buffer.append(nil)
+
+        // Then
+        XCTAssertEqual(buffer.value(at: 2), 2.5)
+        XCTAssertNil(buffer.latest)
+        XCTAssertEqual(buffer.count, 4)
+    }
+
     // MARK: - Color Mapping
     
     func testGetIndicatorColorFallbackForUnknownIndicator() {
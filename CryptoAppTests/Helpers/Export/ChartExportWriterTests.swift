@@ -0,0 +1,232 @@
+//
+//  ChartExportWriterTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Unit tests for the chart export writers covering the CSV layout, the columnar binary
+//  block layout across several series and parity of streamed indicators with the batch ones,
+//  and watchlist exports that write every coin or leave no partial file behind.
+//  Patterns:
+//  - Files are written to a per-test temporary directory and read back in full
+//  - Small block sizes force several block flushes on short series
+//
+
+import XCTest
+import Combine
+@testable import CryptoApp
+
+final class ChartExportWriterTests: XCTestCase {
+
+    private var directory: URL!
+
+    override func setUpWithError() throws {
+        directory = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+    }
+
+    override func tearDownWithError() throws {
+        try? FileManager.default.removeItem(at: directory)
+    }
+
+    // MARK: - Helpers
+
+    private func makeCandles(count: Int) -> [OHLCData] {
+        (0..<count).map { i in
+            let close = 100 + Double(i % 7) - Double(i % 3)
+            return OHLCData(timestamp: Date(timeIntervalSince1970: Double(i) * 3600),
+                            open: 100, high: max(100, close) + 1, low: min(100, close) - 1, close: close,
+                            volume: i == 0 ? nil : Double(i))
+        }
+    }
+
+    private func settings(sma: Int = 3, ema: Int = 3, rsi: Int = 3) -> TechnicalIndicators.IndicatorSettings {
+        var settings = TechnicalIndicators.IndicatorSettings()
+        settings.smaPeriod = sma
+        settings.emaPeriod = ema
+        settings.rsiPeriod = rsi
+        return settings
+    }
+
+    /// NaN in the export stands for a nil batch value
+    private func assertMatches(_ exported: Double, _ expected: Double?, _ message: String,
+                               file: StaticString = #filePath, line: UInt = #line) {
+        guard let expected = expected else {
+            XCTAssertTrue(exported.isNaN, message, file: file, line: line)
+            return
+        }
+        XCTAssertEqual(exported, expected, accuracy: 1e-9, message, file: file, line: line)
+    }
+
+    /// Minimal reader for the columnar format: [(symbol, columns)]
+    private func readColumnar(_ url: URL) throws -> [(String, [[Double]])] {
+        let bytes = [UInt8](try Data(contentsOf: url))
+        var offset = 0
+        func read<T: FixedWidthInteger>(_: T.Type) -> T {
+            var value: T = 0
+            withUnsafeMutableBytes(of: &value) { $0.copyBytes(from: bytes[offset..<offset + MemoryLayout<T>.size]) }
+            offset += MemoryLayout<T>.size
+            return T(littleEndian: value)
+        }
+        func readString(length: Int) -> String {
+            defer { offset += length }
+            return String(decoding: bytes[offset..<offset + length], as: UTF8.self)
+        }
+
+        XCTAssertEqual(readString(length: 8), ColumnarExportWriter.magic)
+        let columnCount = Int(read(UInt16.self))
+        let names = (0..<columnCount).map { _ in readString(length: Int(read(UInt8.self))) }
+        XCTAssertEqual(names, ChartExportRow.columnNames)
+
+        var series: [(String, [[Double]])] = []
+        loop: while offset < bytes.count {
+            switch read(UInt8.self) {
+            case UInt8(ascii: "S"):
+                series.append((readString(length: Int(read(UInt16.self))), Array(repeating: [], count: columnCount)))
+            case UInt8(ascii: "B"):
+                let rows = Int(read(UInt32.self))
+                for column in 0..<columnCount {
+                    for _ in 0..<rows {
+                        series[series.count - 1].1[column].append(Double(bitPattern: read(UInt64.self)))
+                    }
+                }
+            default:
+                break loop
+            }
+        }
+        XCTAssertEqual(offset, bytes.count, "End marker is the last byte")
+        return series
+    }
+
+    // MARK: - Rows
+
+    func testStreamedIndicatorsMatchBatchCalculations() {
+        // Given
+        let candles = makeCandles(count: 40)
+        let closes = candles.map { $0.close }
+
+        // When
+        let rows = Array(ChartExportRows(candles: candles, settings: settings(sma: 5, ema: 4, rsi: 6)))
+
+        // Then
+        let sma = TechnicalIndicators.IndicatorBuffer(TechnicalIndicators.calculateSMA(prices: closes, period: 5))
+        let ema = TechnicalIndicators.IndicatorBuffer(TechnicalIndicators.calculateEMA(prices: closes, period: 4))
+        let rsi = TechnicalIndicators.IndicatorBuffer(TechnicalIndicators.calculateRSI(prices: closes, period: 6))
+        XCTAssertEqual(rows.count, candles.count)
+        for (index, row) in rows.enumerated() {
+            assertMatches(row.sma, sma.value(at: index), "sma \(index)")
+            assertMatches(row.ema, ema.value(at: index), "ema \(index)")
+            assertMatches(row.rsi, rsi.value(at: index), "rsi \(index)")
+        }
+        XCTAssertTrue(rows[0].volume.isNaN)
+    }
+
+    // MARK: - CSV
+
+    func testCSVWritesHeaderAndOneLinePerCandle() throws {
+        // Given
+        let url = directory.appendingPathComponent("export.csv")
+        let writer = try CSVExportWriter(fileURL: url)
+
+        // When
+        try ChartDataExporter.write(makeCandles(count: 4), symbol: "BTC", settings: settings(), to: writer)
+        try ChartDataExporter.write(makeCandles(count: 2), symbol: "ETH", settings: settings(), to: writer)
+        try writer.finish()
+
+        // Then
+        let lines = try String(contentsOf: url, encoding: .utf8).split(separator: "\n").map(String.init)
+        XCTAssertEqual(lines.count, 7)
+        XCTAssertEqual(lines[0], "symbol,time,open,high,low,close,volume,sma,ema,rsi")
+        XCTAssertEqual(lines[1], "BTC,1970-01-01T00:00:00Z,100.0,101.0,99.0,100.0,,,,")
+        XCTAssertTrue(lines[3].hasPrefix("BTC,1970-01-01T02:00:00Z,"))
+        XCTAssertEqual(lines[3].split(separator: ",", omittingEmptySubsequences: false).count, 10)
+        XCTAssertTrue(lines[6].hasPrefix("ETH,"))
+    }
+
+    // MARK: - Columnar
+
+    func testColumnarRoundTripsAcrossBlocksAndSeries() throws {
+        // Given
+        let url = directory.appendingPathComponent("export.capx")
+        let writer = try ColumnarExportWriter(fileURL: url, blockSize: 4)
+        let btc = makeCandles(count: 10)
+        let eth = makeCandles(count: 3)
+
+        // When
+        try ChartDataExporter.write(btc, symbol: "BTC", settings: settings(), to: writer)
+        try ChartDataExporter.write(eth, symbol: "ETH", settings: settings(), to: writer)
+        try writer.finish()
+
+        // Then
+        let series = try readColumnar(url)
+        XCTAssertEqual(series.map { $0.0 }, ["BTC", "ETH"])
+        XCTAssertEqual(series[0].1[0], btc.map { $0.timestamp.timeIntervalSince1970 })
+        XCTAssertEqual(series[0].1[4], btc.map { $0.close })
+        XCTAssertEqual(series[1].1[4], eth.map { $0.close })
+        XCTAssertTrue(series[0].1[5][0].isNaN, "Missing volume is stored as NaN")
+    }
+
+    func testExportingAnEmptyModelFails() {
+        // Given
+        let exporter = ChartDataExporter(coinManager: MockCoinManager(), directory: directory)
+        let expectation = expectation(description: "export fails")
+
+        // When
+        let cancellable = exporter.export(model: ChartModel(range: "24h"), symbol: "BTC", format: .csv)
+            .sink(receiveCompletion: { completion in
+                // Then
+                if case .failure(let error) = completion {
+                    XCTAssertEqual(error as? ChartExportError, .noData)
+                    expectation.fulfill()
+                }
+            }, receiveValue: { _ in XCTFail("Nothing to export") })
+
+        wait(for: [expectation], timeout: 1)
+        cancellable.cancel()
+    }
+
+    // MARK: - Watchlist
+
+    func testWatchlistExportWritesOneSeriesPerCoin() throws {
+        // Given
+        let coinManager = MockCoinManager()
+        coinManager.mockOHLCData = makeCandles(count: 5)
+        let exporter = ChartDataExporter(coinManager: coinManager, directory: directory)
+        let coins = [TestDataFactory.createMockCoin(id: 1, symbol: "BTC", name: "Bitcoin", rank: 1),
+                     TestDataFactory.createMockCoin(id: 2, symbol: "ETH", name: "Ethereum", rank: 2)]
+        let expectation = expectation(description: "export finishes")
+        var exportedURL: URL?
+
+        // When
+        let cancellable = exporter.exportWatchlist(coins: coins, range: "7", format: .columnar, settings: settings())
+            .sink(receiveCompletion: { _ in expectation.fulfill() }, receiveValue: { exportedURL = $0 })
+        wait(for: [expectation], timeout: 2)
+        cancellable.cancel()
+
+        // Then
+        let url = try XCTUnwrap(exportedURL)
+        XCTAssertEqual(try readColumnar(url).map { $0.0 }, ["BTC", "ETH"])
+    }
+
+    func testFailedWatchlistExportLeavesNoFile() throws {
+        // Given
+        // Every fetch returns no candles, so the export ends with noData after the file was opened
+        let exporter = ChartDataExporter(coinManager: MockCoinManager(), directory: directory)
+        let coins = [TestDataFactory.createMockCoin(id: 1, symbol: "BTC", name: "Bitcoin", rank: 1)]
+        let expectation = expectation(description: "export fails")
+
+        // When
+        let cancellable = exporter.exportWatchlist(coins: coins, range: "7", format: .csv)
+            .sink(receiveCompletion: { completion in
+                if case .failure(let error) = completion {
+                    XCTAssertEqual(error as? ChartExportError, .noData)
+                    expectation.fulfill()
+                }
+            }, receiveValue: { _ in XCTFail("Nothing to export") })
+        wait(for: [expectation], timeout: 2)
+        cancellable.cancel()
+
+        // Then
+        // The partial file was deleted before the failure reached the subscriber
+        XCTAssertEqual(try FileManager.default.contentsOfDirectory(atPath: directory.path), [])
+    }
+}
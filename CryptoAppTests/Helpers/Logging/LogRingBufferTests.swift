@@ -0,0 +1,83 @@
+//
+//  LogRingBufferTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Tests for LogRingBuffer (slot round-trip, wrap-around, UTF-8 safe truncation) and for
+//  AppLogger's filtering: messages below the runtime floor are never evaluated.
+//  Patterns:
+//  - AppLogger tests restore the runtime floor and clear the shared ring in tearDown
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class LogRingBufferTests: XCTestCase {
+
+    override func tearDownWithError() throws {
+        AppLogger.minimumLevel = AppLogger.compiledMinimumLevel
+        AppLogger.clearRecentEntries()
+    }
+
+    // MARK: - Ring Buffer
+
+    func testEntriesRoundTripOldestFirstAndWrap() {
+        // Given
+        let ring = LogRingBuffer(capacity: 3, messageCapacity: 32)
+
+        // When
+        for index in 1...4 {
+            ring.append(uptimeNanoseconds: UInt64(index), category: 2, level: 1, message: "m\(index)")
+        }
+
+        // Then: the first entry was overwritten
+        let entries = ring.entries()
+        XCTAssertEqual(ring.count, 3)
+        XCTAssertEqual(entries.map(\.message), ["m2", "m3", "m4"])
+        XCTAssertEqual(entries.first, LogRingBuffer.Entry(uptimeNanoseconds: 2, category: 2, level: 1, message: "m2"))
+    }
+
+    func testLongMessagesAreTruncatedOnACharacterBoundary() {
+        let ring = LogRingBuffer(capacity: 1, messageCapacity: 5)
+
+        // "ab" + "€" (3 bytes) + "c": cutting at 5 bytes would split nothing, at 4 would split "€"
+        ring.append(uptimeNanoseconds: 0, category: 0, level: 0, message: "ab€c")
+        XCTAssertEqual(ring.entries().first?.message, "ab€")
+
+        let narrow = LogRingBuffer(capacity: 1, messageCapacity: 4)
+        narrow.append(uptimeNanoseconds: 0, category: 0, level: 0, message: "ab€c")
+        XCTAssertEqual(narrow.entries().first?.message, "ab")
+    }
+
+    // MARK: - AppLogger
+
+    func testFilteredMessagesAreNeverBuilt() {
+        // Given
+        AppLogger.minimumLevel = .warning
+        var evaluations = 0
+        func expensive() -> String {
+            evaluations += 1
+            return "expensive"
+        }
+
+        // When
+        AppLogger.network(expensive())
+        AppLogger.chart(expensive(), level: .debug)
+        AppLogger.network(expensive(), level: .warning)
+
+        // Then
+        XCTAssertEqual(evaluations, 1)
+        XCTAssertFalse(AppLogger.isEnabled(.info))
+    }
+
+    func testDumpRendersRecordedEntries() {
+        AppLogger.clearRecentEntries()
+        AppLogger.minimumLevel = .warning
+
+        AppLogger.cache("disk full", level: .warning)
+
+        let dump = AppLogger.dump()
+        XCTAssertTrue(dump.hasPrefix("CryptoApp log — launched"))
+        XCTAssertTrue(dump.contains("💾 CACHE | disk full"))
+    }
+}
@@ -0,0 +1,122 @@
+//
+//  MemoryAccountingTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Tests for MemoryFootprint (totals, releasable bytes per tier, tree rendering) and for
+//  MemoryAccountant: holders are aggregated into one report, pressure escalates tier by
+//  tier only until the target is met, and deallocated holders drop out.
+//  Patterns:
+//  - Accountants are created without the memory-warning observer; holders are stubs
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class MemoryAccountingTests: XCTestCase {
+
+    /// Holds one byte count per tier and frees it when asked
+    private final class StubHolder: MemoryAccountable {
+        let name: String
+        var bytesByTier: [MemoryPressureTier: Int]
+        private(set) var releasedTiers: [MemoryPressureTier] = []
+
+        init(name: String, bytesByTier: [MemoryPressureTier: Int]) {
+            self.name = name
+            self.bytesByTier = bytesByTier
+        }
+
+        func memoryFootprint() -> MemoryFootprint {
+            MemoryFootprint(name: name, children: bytesByTier.keys.sorted().map {
+                MemoryFootprint(name: $0.description, bytes: bytesByTier[$0] ?? 0, tier: $0)
+            })
+        }
+
+        func releaseMemory(for tier: MemoryPressureTier) -> Int {
+            releasedTiers.append(tier)
+            return bytesByTier.removeValue(forKey: tier) ?? 0
+        }
+    }
+
+    // MARK: - Footprint
+
+    func testFootprintTotalsAndReleasableBytes() {
+        let tree = MemoryFootprint(name: "App", children: [
+            MemoryFootprint(name: "list", children: [
+                MemoryFootprint(name: "visible", bytes: 100),
+                MemoryFootprint(name: "copy", bytes: 400, tier: .derived)
+            ]),
+            MemoryFootprint(name: "charts", bytes: 2_000, tier: .series)
+        ])
+
+        XCTAssertEqual(tree.totalBytes, 2_500)
+        XCTAssertEqual(tree.releasableBytes(upTo: .derived), 400)
+        XCTAssertEqual(tree.releasableBytes(upTo: .images), 400)
+        XCTAssertEqual(tree.releasableBytes(upTo: .series), 2_400)
+    }
+
+    func testRenderedTreeListsLargestFirst() {
+        let tree = MemoryFootprint(name: "App", children: [
+            MemoryFootprint(name: "small", bytes: 10, tier: .derived),
+            MemoryFootprint(name: "large", bytes: 10_000, tier: .series)
+        ])
+
+        let lines = tree.rendered().components(separatedBy: "\n")
+
+        XCTAssertEqual(lines.count, 3)
+        XCTAssertTrue(lines[0].hasPrefix("App"))
+        XCTAssertTrue(lines[1].hasPrefix("├─ large"))
+        XCTAssertTrue(lines[1].hasSuffix("[series]"))
+        XCTAssertTrue(lines[2].hasPrefix("└─ small"))
+    }
+
+    // MARK: - Accountant
+
+    func testPressureStopsOnceUnderTarget() {
+        // Given: derived alone brings 1 500 bytes under the 1 000 byte target
+        let accountant = MemoryAccountant(pressureTarget: 1_000, observesMemoryWarnings: false)
+        let holder = StubHolder(name: "vm", bytesByTier: [.derived: 800, .images: 300, .series: 400])
+        accountant.register(holder)
+        XCTAssertEqual(accountant.report().totalBytes, 1_500)
+
+        // When
+        let applied = accountant.relievePressure()
+
+        // Then
+        XCTAssertEqual(applied, [.derived])
+        XCTAssertEqual(holder.releasedTiers, [.derived])
+        XCTAssertEqual(accountant.report().totalBytes, 700)
+    }
+
+    func testPressureEscalatesThroughTiers() {
+        let accountant = MemoryAccountant(pressureTarget: 100, observesMemoryWarnings: false)
+        let holder = StubHolder(name: "cache", bytesByTier: [.derived: 50, .images: 300, .series: 400])
+        accountant.register(holder)
+
+        XCTAssertEqual(accountant.relievePressure(), [.derived, .images, .series])
+        XCTAssertEqual(accountant.report().totalBytes, 0)
+    }
+
+    func testDerivedTierRunsEvenWhenUnderTarget() {
+        let accountant = MemoryAccountant(pressureTarget: .max, observesMemoryWarnings: false)
+        let holder = StubHolder(name: "vm", bytesByTier: [.derived: 10, .series: 10])
+        accountant.register(holder)
+
+        XCTAssertEqual(accountant.relievePressure(), [.derived])
+        XCTAssertEqual(holder.releasedTiers, [.derived])
+    }
+
+    func testDeallocatedHoldersLeaveTheReport() {
+        let accountant = MemoryAccountant(observesMemoryWarnings: false)
+        let kept = StubHolder(name: "kept", bytesByTier: [.derived: 1])
+        accountant.register(kept)
+        accountant.register(kept)
+
+        autoreleasepool {
+            let transient = StubHolder(name: "transient", bytesByTier: [.derived: 1])
+            accountant.register(transient)
+        }
+
+        XCTAssertEqual(accountant.report().children.map(\.name), ["kept"])
+    }
+}
@@ -0,0 +1,116 @@
+//
+//  MetricsRegistryTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Tests for MetricsRegistry: handles are shared by name, concurrent recording loses no
+//  updates, histograms bucket and estimate percentiles, and snapshots diff and export
+//  as stable JSON.
+//  Patterns:
+//  - Each test uses its own registry so the shared app metrics are untouched
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class MetricsRegistryTests: XCTestCase {
+
+    private var registry: MetricsRegistry!
+
+    override func setUp() {
+        super.setUp()
+        registry = MetricsRegistry()
+    }
+
+    // MARK: - Counters & Gauges
+
+    func testHandlesAreSharedByName() {
+        registry.counter("hits").increment()
+        registry.counter("hits").increment(by: 2)
+
+        XCTAssertTrue(registry.counter("hits") === registry.counter("hits"))
+        XCTAssertEqual(registry.snapshot().counters["hits"], 3)
+    }
+
+    func testConcurrentIncrementsAreNotLost() {
+        // Given
+        let counter = registry.counter("concurrent")
+
+        // When
+        DispatchQueue.concurrentPerform(iterations: 8) { _ in
+            for _ in 0..<10_000 {
+                counter.increment()
+            }
+        }
+
+        // Then
+        XCTAssertEqual(counter.value, 80_000)
+    }
+
+    func testGaugeKeepsLastValue() {
+        let gauge = registry.gauge("depth")
+        gauge.set(4)
+        gauge.set(1.5)
+
+        XCTAssertEqual(registry.snapshot().gauges["depth"], 1.5)
+    }
+
+    // MARK: - Histograms
+
+    func testHistogramBucketsAndPercentiles() {
+        // Given
+        let histogram = registry.histogram("latency", bounds: [1, 10, 100])
+
+        // When: 8 fast, 1 medium, 1 overflow sample
+        for _ in 0..<8 { histogram.record(milliseconds: 0.5) }
+        histogram.record(milliseconds: 50)
+        histogram.record(milliseconds: 400)
+
+        // Then
+        let summary = histogram.summary()
+        XCTAssertEqual(summary.buckets, [8, 0, 1, 1])
+        XCTAssertEqual(summary.count, 10)
+        XCTAssertEqual(summary.maxMilliseconds, 400)
+        XCTAssertEqual(summary.meanMilliseconds, 45.4, accuracy: 0.001)
+        XCTAssertEqual(summary.percentile(0.5), 1)
+        XCTAssertEqual(summary.percentile(0.9), 100)
+        XCTAssertEqual(summary.percentile(1), 400, "Overflow samples report the max")
+    }
+
+    // MARK: - Snapshot
+
+    func testDeltaAndResetAndJSONExport() throws {
+        // Given
+        let counter = registry.counter("requests")
+        let histogram = registry.histogram("sort", bounds: [1, 10])
+        counter.increment(by: 5)
+        histogram.record(milliseconds: 2)
+        let before = registry.snapshot()
+
+        // When
+        counter.increment(by: 2)
+        histogram.record(milliseconds: 20)
+        let delta = registry.snapshot().delta(since: before)
+
+        // Then
+        XCTAssertEqual(delta.counters["requests"], 2)
+        XCTAssertEqual(delta.histograms["sort"]?.buckets, [0, 0, 1])
+
+        let exported = try registry.snapshot().jsonData()
+        let decoded = try JSONDecoder().decode(MetricsSnapshot.self, from: exported)
+        XCTAssertEqual(decoded, registry.snapshot())
+        XCTAssertEqual(try registry.snapshot().jsonData(), exported, "Export is byte-stable")
+
+        registry.reset()
+        XCTAssertEqual(registry.snapshot().counters["requests"], 0)
+        XCTAssertEqual(registry.snapshot().histograms["sort"]?.count, 0)
+    }
+
+    func testRatioOfHitsToLookups() {
+        registry.counter("hits").increment(by: 3)
+        registry.counter("misses").increment()
+
+        XCTAssertEqual(registry.snapshot().ratio("hits", "misses"), 0.75)
+        XCTAssertNil(registry.snapshot().ratio("none", "neither"))
+    }
+}
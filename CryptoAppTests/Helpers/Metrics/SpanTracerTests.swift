@@ -0,0 +1,107 @@
+//
+//  SpanTracerTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Tests for SpanTracer: spans nest under their trace, feed their stage histograms whether
+//  or not the trace is sampled, and export as Chrome trace events.
+//  Patterns:
+//  - Each test uses its own tracer; stages are registered under test-only names
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class SpanTracerTests: XCTestCase {
+
+    // MARK: - Spans
+
+    func testChildSpansNestUnderSampledTrace() {
+        // Given
+        let tracer = SpanTracer(capacity: 16, sampleEvery: 1)
+        let root = SpanStage.named("test.nest.root")
+        let child = SpanStage.named("test.nest.child")
+
+        // When
+        let trace = tracer.beginTrace(root)
+        tracer.measure(child, parent: trace) { _ = (0..<1000).reduce(0, +) }
+        tracer.end(trace)
+
+        // Then: child closes first and points at the root
+        let records = tracer.records()
+        XCTAssertEqual(records.map(\.stageID), [child.id, root.id])
+        XCTAssertEqual(records[0].parentID, records[1].spanID)
+        XCTAssertEqual(records[0].traceID, records[1].traceID)
+        XCTAssertLessThanOrEqual(records[1].startNanoseconds, records[0].startNanoseconds)
+        XCTAssertGreaterThanOrEqual(records[1].endNanoseconds, records[0].endNanoseconds)
+    }
+
+    func testUnsampledTracesStillFeedHistograms() {
+        // Given: only every 4th trace is kept
+        let tracer = SpanTracer(capacity: 16, sampleEvery: 4)
+        let stage = SpanStage.named("test.sampling")
+        let before = stage.histogram.summary().count
+
+        // When
+        for _ in 0..<8 {
+            tracer.end(tracer.beginTrace(stage))
+        }
+
+        // Then
+        XCTAssertEqual(tracer.records().count, 2)
+        XCTAssertEqual(stage.histogram.summary().count - before, 8)
+    }
+
+    func testRingKeepsMostRecentRecords() {
+        let tracer = SpanTracer(capacity: 3, sampleEvery: 1)
+        let stage = SpanStage.named("test.ring")
+
+        var spanIDs: [UInt32] = []
+        for _ in 0..<5 {
+            let span = tracer.beginTrace(stage)
+            spanIDs.append(span.spanID)
+            tracer.end(span)
+        }
+
+        XCTAssertEqual(tracer.records().map(\.spanID), Array(spanIDs.suffix(3)))
+    }
+
+    // MARK: - Export
+
+    func testChromeTraceExport() throws {
+        // Given
+        let tracer = SpanTracer(capacity: 4, sampleEvery: 1)
+        let stage = SpanStage.named("test.export")
+        tracer.end(tracer.beginTrace(stage))
+
+        // When
+        let json = try JSONSerialization.jsonObject(with: tracer.exportChromeTrace()) as? [String: Any]
+        let events = json?["traceEvents"] as? [[String: Any]]
+
+        // Then
+        XCTAssertEqual(events?.count, 1)
+        XCTAssertEqual(events?.first?["name"] as? String, "test.export")
+        XCTAssertEqual(events?.first?["ph"] as? String, "X")
+        XCTAssertNotNil(events?.first?["dur"] as? Double)
+    }
+
+    func testStagesAreSharedByName() {
+        XCTAssertTrue(SpanStage.named("test.shared") === SpanStage.named("test.shared"))
+        // The root tick span outlives publishing, so it must not feed tick-to-publish
+        XCTAssertFalse(SpanStage.priceTick.histogram === Metrics.tickToPublish)
+    }
+
+    func testElapsedMillisecondsIsMeasuredFromSpanStart() {
+        // Given
+        let tracer = SpanTracer(capacity: 4, sampleEvery: 1)
+        let span = tracer.beginTrace(SpanStage.named("test.elapsed"))
+
+        // When
+        Thread.sleep(forTimeInterval: 0.01)
+        let elapsed = tracer.elapsedMilliseconds(since: span)
+
+        // Then
+        XCTAssertGreaterThanOrEqual(elapsed, 10)
+        XCTAssertTrue(tracer.records().isEmpty)
+    }
+}
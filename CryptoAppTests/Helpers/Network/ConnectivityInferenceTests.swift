@@ -0,0 +1,84 @@
+//
+//  ConnectivityInferenceTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Tests for ConnectivityInference: real traffic decides state without probes, ambiguous
+//  signals ask for an immediate probe, offline probing backs off exponentially, and
+//  URLError codes map to the right traffic outcome.
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class ConnectivityInferenceTests: XCTestCase {
+
+    // MARK: - Passive Signals
+
+    func testRealResponsesKeepUsOnlineWithoutProbing() {
+        var inference = ConnectivityInference()
+        XCTAssertEqual(inference.launchProbe, .after(3))
+
+        XCTAssertEqual(inference.handle(.traffic(.responded)), .cancel, "First answer cancels the launch probe")
+        XCTAssertTrue(inference.isConnected)
+        XCTAssertTrue(inference.hasEvidence)
+        XCTAssertEqual(inference.handle(.path(isSatisfied: true)), .unchanged)
+    }
+
+    func testUnreachableTrafficDisconnectsImmediately() {
+        var inference = ConnectivityInference()
+
+        XCTAssertEqual(inference.handle(.traffic(.unreachable)), .after(1))
+        XCTAssertFalse(inference.isConnected)
+
+        // Further failures while offline don't reset the backoff schedule
+        XCTAssertEqual(inference.handle(.traffic(.unreachable)), .unchanged)
+    }
+
+    func testSingleTimeoutIsAmbiguousAndProbesRightAway() {
+        var inference = ConnectivityInference()
+
+        XCTAssertEqual(inference.handle(.traffic(.timedOut)), .after(0))
+        XCTAssertTrue(inference.isConnected)
+
+        XCTAssertEqual(inference.handle(.traffic(.timedOut)), .after(1))
+        XCTAssertFalse(inference.isConnected)
+    }
+
+    // MARK: - Backoff
+
+    func testOfflineProbesBackOffExponentiallyUpToTheCap() {
+        var inference = ConnectivityInference(configuration: .init(initialBackoff: 1, maxBackoff: 8))
+        var delays: [ConnectivityInference.ProbeAction] = [inference.handle(.path(isSatisfied: false))]
+
+        for _ in 0..<5 {
+            delays.append(inference.handle(.probe(succeeded: false)))
+        }
+
+        XCTAssertEqual(delays, [.after(1), .after(2), .after(4), .after(8), .after(8), .after(8)])
+    }
+
+    func testReturningPathProbesImmediatelyAndSuccessResetsBackoff() {
+        // Given: offline for a while
+        var inference = ConnectivityInference()
+        _ = inference.handle(.traffic(.unreachable))
+        _ = inference.handle(.probe(succeeded: false))
+        _ = inference.handle(.probe(succeeded: false))
+
+        // When / Then
+        XCTAssertEqual(inference.handle(.path(isSatisfied: true)), .after(0))
+        XCTAssertEqual(inference.handle(.probe(succeeded: true)), .cancel)
+        XCTAssertTrue(inference.isConnected)
+        XCTAssertEqual(inference.handle(.traffic(.unreachable)), .after(1))
+    }
+
+    // MARK: - Outcome Mapping
+
+    func testURLErrorsMapToTrafficOutcomes() {
+        XCTAssertEqual(NetworkTrafficOutcome(error: URLError(.notConnectedToInternet)), .unreachable)
+        XCTAssertEqual(NetworkTrafficOutcome(error: URLError(.networkConnectionLost)), .unreachable)
+        XCTAssertEqual(NetworkTrafficOutcome(error: URLError(.timedOut)), .timedOut)
+        XCTAssertNil(NetworkTrafficOutcome(error: URLError(.cancelled)))
+        XCTAssertNil(NetworkTrafficOutcome(error: URLError(.serverCertificateUntrusted)))
+    }
+}
@@ -0,0 +1,60 @@
+//
+//  ImageRequestQueueTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Tests for ImageRequestQueue, the priority scheduler behind ImageLoader: class ordering,
+//  FIFO within a class, and lazy skipping of promoted or cancelled entries.
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class ImageRequestQueueTests: XCTestCase {
+
+    func testMoreUrgentClassesDequeueFirstAndFIFOWithinAClass() {
+        // Given
+        var queue = ImageRequestQueue()
+        queue.enqueue("s1", priority: .speculative)
+        queue.enqueue("p1", priority: .prefetch)
+        queue.enqueue("v1", priority: .visible)
+        queue.enqueue("p2", priority: .prefetch)
+
+        // When
+        var order: [String] = []
+        while let key = queue.dequeue(where: { _, _ in true }) {
+            order.append(key)
+        }
+
+        // Then
+        XCTAssertEqual(order, ["v1", "p1", "p2", "s1"])
+        XCTAssertTrue(queue.isEmpty)
+    }
+
+    func testStaleEntriesAreSkippedAfterPromotionOrCancellation() {
+        // Given: "a" was promoted from prefetch to visible, "b" was cancelled
+        var queue = ImageRequestQueue()
+        var current: [String: ImageLoadPriority] = ["a": .visible, "c": .prefetch]
+        queue.enqueue("a", priority: .prefetch)
+        queue.enqueue("b", priority: .prefetch)
+        queue.enqueue("c", priority: .prefetch)
+        queue.enqueue("a", priority: .visible)
+
+        // When
+        var order: [String] = []
+        while let key = queue.dequeue(where: { key, priority in current[key] == priority }) {
+            order.append(key)
+            current.removeValue(forKey: key)
+        }
+
+        // Then: "a" starts once, at its promoted class
+        XCTAssertEqual(order, ["a", "c"])
+        XCTAssertTrue(queue.isEmpty)
+    }
+
+    func testPriorityOrdering() {
+        XCTAssertGreaterThan(ImageLoadPriority.visible, .prefetch)
+        XCTAssertGreaterThan(ImageLoadPriority.prefetch, .speculative)
+        XCTAssertGreaterThan(ImageLoadPriority.visible.taskPriority, ImageLoadPriority.speculative.taskPriority)
+    }
+}
@@ -0,0 +1,117 @@
+//
+//  ScrollPrefetchSchedulerTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Tests for ScrollPrefetchScheduler: the window around a resting list, jumping to UIKit's
+//  release target on a fling, velocity projection while dragging, direction-aware lead,
+//  and quote batching freshness.
+//  Patterns:
+//  - 800 pt viewport over 1000 rows of 100 pt, so offsets map to rows by dividing by 100
+//  - Lead is half a screen (4 rows), the speculative band one screen (8 rows)
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class ScrollPrefetchSchedulerTests: XCTestCase {
+
+    private let geometry = ScrollPrefetchScheduler.Geometry(
+        viewportHeight: 800,
+        contentHeight: 100_000,
+        rowPitch: 100,
+        rowCount: 1000
+    )
+
+    // MARK: - Window
+
+    func testRestingListPrefetchesViewportAndLeadThenSpeculates() {
+        // Given
+        let scheduler = ScrollPrefetchScheduler()
+
+        // When
+        let plan = scheduler.didSettle(offset: 0, geometry: geometry)
+
+        // Then
+        XCTAssertEqual(plan?.prefetch, Array(0..<12))
+        XCTAssertEqual(plan?.speculative, Array(12..<20))
+        XCTAssertEqual(plan?.cancelled, [])
+        XCTAssertNil(scheduler.didSettle(offset: 0, geometry: geometry), "Unchanged window produces no plan")
+    }
+
+    func testFlingJumpsToReleaseTargetAndCancelsOnlyRowsThatLeft() {
+        // Given
+        let scheduler = ScrollPrefetchScheduler()
+        _ = scheduler.didSettle(offset: 0, geometry: geometry)
+
+        // When
+        let plan = scheduler.willEndDragging(targetOffset: 50_000, geometry: geometry)
+
+        // Then: nothing in between is fetched
+        XCTAssertEqual(plan?.prefetch, Array(500..<512))
+        XCTAssertEqual(plan?.speculative, Array(512..<520))
+        XCTAssertEqual(plan?.cancelled, Array(0..<20))
+
+        // Deceleration samples don't move the window away from the target
+        XCTAssertNil(scheduler.didScroll(offset: 20_000, at: 1, geometry: geometry))
+    }
+
+    func testWindowStopsAtTheEndOfTheList() {
+        let scheduler = ScrollPrefetchScheduler()
+
+        let plan = scheduler.willEndDragging(targetOffset: 1_000_000, geometry: geometry)
+
+        XCTAssertEqual(plan?.prefetch, Array(992..<1000))
+        XCTAssertEqual(plan?.speculative, [])
+    }
+
+    // MARK: - Velocity
+
+    func testDraggingProjectsVelocityAlongTheDecelerationCurve() {
+        // Given
+        let scheduler = ScrollPrefetchScheduler()
+        _ = scheduler.didScroll(offset: 0, at: 0, geometry: geometry)
+
+        // When: 100 pt in 10 ms → 10 000 pt/s instant, 3 500 pt/s smoothed
+        let plan = scheduler.didScroll(offset: 100, at: 0.01, geometry: geometry)
+
+        // Then: 3.5 pt/ms × 0.998 / 0.002 ≈ 1746.5 pt past the finger
+        XCTAssertEqual(scheduler.velocity, 3500, accuracy: 0.001)
+        XCTAssertEqual(scheduler.predictedSettleOffset(from: 100), 1846.5, accuracy: 0.5)
+        XCTAssertEqual(plan?.prefetch.first, 18)
+    }
+
+    func testScrollingUpPutsTheLeadAboveTheViewport() {
+        // Given
+        let scheduler = ScrollPrefetchScheduler()
+        _ = scheduler.didScroll(offset: 5000, at: 0, geometry: geometry)
+
+        // When
+        _ = scheduler.didScroll(offset: 4900, at: 0.01, geometry: geometry)
+
+        // Then: settles near 3153 pt; lead covers 2753…3953 pt
+        XCTAssertTrue(scheduler.isScrollingUp)
+        XCTAssertEqual(scheduler.prefetchRows, 27..<40)
+        XCTAssertEqual(scheduler.speculativeRows, 19..<27)
+    }
+
+    // MARK: - Quote Batching
+
+    func testQuotesAreOnlyBatchedForRowsThatAreNotFresh() {
+        let scheduler = ScrollPrefetchScheduler()
+
+        XCTAssertEqual(scheduler.keysNeedingQuotes([1, 2], at: 0), [1, 2])
+        scheduler.markQuoted([1, 2], at: 0)
+        XCTAssertEqual(scheduler.keysNeedingQuotes([1, 2, 3], at: 5), [3])
+        scheduler.markQuoted([3], at: 5)
+        XCTAssertEqual(scheduler.keysNeedingQuotes([1, 2, 3], at: 16), [1, 2])
+    }
+
+    func testKeysStayStaleUntilMarkedQuoted() {
+        let scheduler = ScrollPrefetchScheduler()
+
+        // A batch that was skipped or failed never gets marked
+        XCTAssertEqual(scheduler.keysNeedingQuotes([1, 2], at: 0), [1, 2])
+        XCTAssertEqual(scheduler.keysNeedingQuotes([1, 2], at: 1), [1, 2])
+    }
+}
@@ -8,7 +8,10 @@
 //  - Initial fetch success path (coins published, loading flags toggle, fresh-data flag toggles)
 //  - Initial fetch failure path (error published, loading flags reset, no coins published)
 //  - Quotes update path (existing coins updated with fresh quotes on forceUpdate)
+//  - Each quotes update carries its own tick span; replays to new subscribers carry none
 //  - ID filtering helper (getCoinsForIds)
+//  - Watched coins outside the top-200 refresh priced by one low-priority batch
+//  - Coins watched while that batch is in flight are fetched once it completes
 //  - Stop auto update resets loading flags
 //  Test patterns:
 //  - Uses MockCoinManager with controllable delay and outcome
@@ -220,6 +223,39 @@ final class SharedCoinDataManagerTests: XCTestCase {
         XCTAssertEqual(coin2?.quote?["USD"]?.price, 60000)
     }
     
+    func testQuotesUpdateCarriesItsOwnTickSpan() {
+        // Given
+        mockCoinManager.mockCoins = TestDataFactory.createMockCoins(count: 10)
+        mockCoinManager.mockDelay = 0.01
+        manager = SharedCoinDataManager(coinManager: mockCoinManager)
+        
+        let initialExp = expectation(description: "initial coins received")
+        manager.allCoins
+            .filter { !$0.isEmpty }
+            .prefix(1)
+            .sink { _ in initialExp.fulfill() }
+            .store(in: &cancellables)
+        wait(for: [initialExp], timeout: 3.0)
+        
+        var updates: [CoinDataUpdate] = []
+        let updateExp = expectation(description: "quotes update received")
+        manager.coinUpdates
+            .prefix(2)
+            .sink(receiveCompletion: { _ in updateExp.fulfill() }, receiveValue: { updates.append($0) })
+            .store(in: &cancellables)
+        
+        // When
+        manager.forceUpdate()
+        wait(for: [updateExp], timeout: 3.0)
+        
+        // Then
+        // The replayed list has no span; the quotes tick brings the span that was begun for it
+        XCTAssertEqual(updates.count, 2)
+        XCTAssertEqual(updates.first?.coins.count, 10)
+        XCTAssertNil(updates.first?.tick)
+        XCTAssertEqual(updates.last?.tick?.stage.id, SpanStage.priceTick.id)
+    }
+    
     // MARK: - Helpers
     
     func testGetCoinsForIdsReturnsOnlyMatchingIds() {
@@ -251,6 +287,104 @@ final class SharedCoinDataManagerTests: XCTestCase {
         XCTAssertTrue(ids.contains(3))
     }
     
+    // MARK: - Watched Coins
+    
+    func testWatchedCoinsOutsideRefreshSetUseOneLowPriorityBatch() {
+        // Given
+        // 250 coins so that ranks 201+ fall outside the shared top-200 refresh
+        mockCoinManager.mockCoins = TestDataFactory.createMockCoins(count: 250)
+        mockCoinManager.mockDelay = 0.01
+        manager = SharedCoinDataManager(coinManager: mockCoinManager)
+        
+        let initialExp = expectation(description: "initial coins received")
+        manager.allCoins
+            .filter { !$0.isEmpty }
+            .prefix(1)
+            .sink { _ in initialExp.fulfill() }
+            .store(in: &cancellables)
+        wait(for: [initialExp], timeout: 3.0)
+        
+        let watchedQuote = Quote(
+            price: 1.23, volume24h: nil, volumeChange24h: nil,
+            percentChange1h: nil, percentChange24h: 4.0, percentChange7d: nil, percentChange30d: nil,
+            percentChange60d: nil, percentChange90d: nil, marketCap: nil,
+            marketCapDominance: nil, fullyDilutedMarketCap: nil, lastUpdated: nil
+        )
+        mockCoinManager.mockQuotes = [240: watchedQuote]
+        manager.setWatchedCoinIds([5, 240])
+        
+        let watchedExp = expectation(description: "watched quotes published")
+        manager.watchedQuotes
+            .filter { !$0.isEmpty }
+            .prefix(1)
+            .sink { _ in watchedExp.fulfill() }
+            .store(in: &cancellables)
+        
+        // When
+        // One refresh cycle
+        manager.forceUpdate()
+        wait(for: [watchedExp], timeout: 3.0)
+        
+        // Then
+        // Top 200 in one high-priority request, coin 240 alone in one low-priority request
+        let requests = mockCoinManager.quoteRequests
+        XCTAssertEqual(requests.count, 2)
+        XCTAssertEqual(requests.filter { $0.priority == .high }.first?.ids.count, 200)
+        XCTAssertEqual(requests.filter { $0.priority == .low }.map { $0.ids }, [[240]])
+        XCTAssertEqual(manager.getCoinsForIds([240]).first?.quote?["USD"]?.price, 1.23)
+    }
+    
+    func testCoinsWatchedDuringInFlightBatchAreFetchedNext() {
+        // Given
+        mockCoinManager.mockCoins = TestDataFactory.createMockCoins(count: 250)
+        mockCoinManager.mockDelay = 0.01
+        manager = SharedCoinDataManager(coinManager: mockCoinManager)
+        
+        let initialExp = expectation(description: "initial coins received")
+        manager.allCoins
+            .filter { !$0.isEmpty }
+            .prefix(1)
+            .sink { _ in initialExp.fulfill() }
+            .store(in: &cancellables)
+        wait(for: [initialExp], timeout: 3.0)
+        
+        let watchedQuote = Quote(
+            price: 2.5, volume24h: nil, volumeChange24h: nil,
+            percentChange1h: nil, percentChange24h: nil, percentChange7d: nil, percentChange30d: nil,
+            percentChange60d: nil, percentChange90d: nil, marketCap: nil,
+            marketCapDominance: nil, fullyDilutedMarketCap: nil, lastUpdated: nil
+        )
+        mockCoinManager.mockQuotes = [240: watchedQuote, 245: watchedQuote]
+        
+        // One refresh cycle so the refresh set shrinks to the top 200 (the initial load covers all 250)
+        let refreshExp = expectation(description: "refresh cycle completed")
+        manager.allCoins
+            .dropFirst()
+            .prefix(1)
+            .sink { _ in refreshExp.fulfill() }
+            .store(in: &cancellables)
+        manager.forceUpdate()
+        wait(for: [refreshExp], timeout: 3.0)
+        
+        let bothExp = expectation(description: "both watched coins priced")
+        manager.watchedQuotes
+            .filter { $0[240] != nil && $0[245] != nil }
+            .prefix(1)
+            .sink { _ in bothExp.fulfill() }
+            .store(in: &cancellables)
+        
+        // When
+        // Coin 245 is watched while the batch for 240 is still in flight
+        manager.setWatchedCoinIds([240])
+        manager.setWatchedCoinIds([240, 245])
+        wait(for: [bothExp], timeout: 3.0)
+        
+        // Then
+        // The queued coin goes out as its own batch right after the first one
+        let lowPriority = mockCoinManager.quoteRequests.filter { $0.priority == .low }.map { $0.ids }
+        XCTAssertEqual(lowPriority, [[240], [245]])
+    }
+    
     func testStopAutoUpdateResetsLoadingStatesToFalse() {
         // Given
         // Create manager and immediately stop updates to verify state reset behavior
@@ -0,0 +1,135 @@
+//
+//  ChartModelTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Unit tests for ChartModel covering price bounds, synthesized line dates, indicator
+//  buffers for enabled indicators only (line and candle series), settings matching and
+//  volume preparation.
+//  Patterns:
+//  - Candles are generated with close == index + 1 so indicator values are easy to check
+//  - Models are built directly (no view model) with an explicit `now` for stable dates
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class ChartModelTests: XCTestCase {
+
+    private let now = Date(timeIntervalSince1970: 1_700_000_000)
+
+    private func makeCandles(count: Int) -> [OHLCData] {
+        (0..<count).map { i in
+            let close = Double(i + 1)
+            return OHLCData(timestamp: now.addingTimeInterval(Double(i - count) * 3600),
+                            open: close - 0.5, high: close + 1, low: close - 1, close: close,
+                            volume: Double(i) * 10)
+        }
+    }
+
+    private func makeKey(range: String = "7d", settings: TechnicalIndicators.IndicatorSettings) -> ChartModel.Key {
+        ChartModel.Key(coinID: 1, range: range, timeframe: .native, settings: settings)
+    }
+
+    // MARK: - Line Series
+
+    func testLineDatesAndBoundsArePrepared() {
+        // Given
+        let points = [3.0, 1.0, .nan, 5.0]
+
+        // When
+        let model = ChartModel(key: makeKey(settings: TechnicalIndicators.IndicatorSettings()),
+                               points: points, ohlc: [], now: now)
+
+        // Then
+        XCTAssertEqual(model.lineDates.count, points.count)
+        XCTAssertEqual(model.lineDates.last, now)
+        XCTAssertEqual(model.lineDates.first, now.addingTimeInterval(-604800))
+        XCTAssertEqual(model.lineBounds, ChartModel.PriceBounds(min: 1, max: 5))
+        XCTAssertNil(model.candleBounds)
+    }
+
+    func testSinglePointLineGetsTwoDates() {
+        let dates = ChartModel.lineDates(count: 1, range: "24h", end: now)
+        XCTAssertEqual(dates, [now.addingTimeInterval(-86400), now])
+        XCTAssertTrue(ChartModel.lineDates(count: 0, range: "24h", end: now).isEmpty)
+    }
+
+    func testBoundsWidenForLiveUpdates() {
+        let bounds = ChartModel.PriceBounds(min: 10, max: 20)
+        XCTAssertEqual(bounds.including(low: 8, high: 15), ChartModel.PriceBounds(min: 8, max: 20))
+        XCTAssertEqual(bounds.including(low: .nan, high: 25), ChartModel.PriceBounds(min: 10, max: 25))
+    }
+
+    // MARK: - Candles & Indicators
+
+    func testOnlyEnabledIndicatorsArePrepared() {
+        // Given
+        var settings = TechnicalIndicators.IndicatorSettings()
+        settings.showSMA = true
+        settings.smaPeriod = 3
+        settings.showEMA = false
+        settings.showRSI = false
+
+        // When
+        let model = ChartModel(key: makeKey(settings: settings), points: [], ohlc: makeCandles(count: 10), now: now)
+
+        // Then
+        XCTAssertEqual(model.closes.count, 10)
+        XCTAssertEqual(model.candleBounds, ChartModel.PriceBounds(min: 0, max: 11))
+        XCTAssertEqual(model.sma?.count, 10)
+        // SMA(3) at index 2 = (1 + 2 + 3) / 3
+        XCTAssertEqual(model.sma?.value(at: 2), 2)
+        XCTAssertNil(model.ema)
+        XCTAssertNil(model.rsi)
+    }
+
+    func testBuffersAreOnlyReusedForMatchingPeriods() {
+        // Given
+        var settings = TechnicalIndicators.IndicatorSettings()
+        settings.showSMA = true
+        settings.smaPeriod = 3
+        let model = ChartModel(key: makeKey(settings: settings), points: [], ohlc: makeCandles(count: 10), now: now)
+
+        // When
+        var changed = settings
+        changed.smaPeriod = 5
+
+        // Then
+        XCTAssertNotNil(model.smaBuffer(for: settings))
+        XCTAssertNil(model.smaBuffer(for: changed))
+    }
+
+    func testLineSeriesGetsItsOwnIndicatorBuffers() {
+        // Given
+        var settings = TechnicalIndicators.IndicatorSettings()
+        settings.showSMA = true
+        settings.smaPeriod = 2
+        settings.showRSI = true
+        settings.rsiPeriod = 2
+
+        // When
+        let model = ChartModel(key: makeKey(settings: settings), points: [10, 20, 30, 40],
+                               ohlc: makeCandles(count: 10), now: now)
+
+        // Then
+        // Line buffers follow the points, candle buffers the closes
+        XCTAssertEqual(model.smaBuffer(for: settings, series: .line)?.count, 4)
+        XCTAssertEqual(model.smaBuffer(for: settings, series: .line)?.value(at: 1), 15)
+        XCTAssertEqual(model.smaBuffer(for: settings)?.count, 10)
+        XCTAssertEqual(model.rsiBuffer(for: settings, series: .line)?.count, 4)
+        XCTAssertNil(model.emaBuffer(for: settings, series: .line))
+    }
+
+    // MARK: - Volume
+
+    func testVolumesAndDirectionsMatchCandles() {
+        let candles = makeCandles(count: 5)
+        let model = ChartModel(key: makeKey(settings: TechnicalIndicators.IndicatorSettings()),
+                               points: [], ohlc: candles, now: now)
+        XCTAssertEqual(model.volumes, [0, 10, 20, 30, 40])
+        XCTAssertEqual(model.volumeIsBullish, candles.map { $0.isBullish })
+        XCTAssertEqual(model.candleDates, candles.map { $0.timestamp })
+        XCTAssertNotNil(model.volumeAnalysis)
+    }
+}
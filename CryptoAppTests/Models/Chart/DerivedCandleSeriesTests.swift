@@ -0,0 +1,150 @@
+//
+//  DerivedCandleSeriesTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  Unit tests for DerivedCandleSeries covering the Heikin-Ashi, log and percent-from-start
+//  transforms, lazy per-version caching and O(1) patching of cached views on live updates.
+//  Patterns:
+//  - Incremental results are compared against a fresh series built from the same candles
+//  - Candles use simple round prices so transformed values are easy to check by hand
+//
+
+import XCTest
+@testable import CryptoApp
+
+final class DerivedCandleSeriesTests: XCTestCase {
+
+    private let derivedModes: [CandleSeriesMode] = [.heikinAshi, .logarithmic, .percentFromStart]
+
+    private func candle(_ open: Double, _ high: Double, _ low: Double, _ close: Double, at index: Int = 0) -> OHLCData {
+        OHLCData(timestamp: Date(timeIntervalSince1970: Double(index) * 3600), open: open, high: high, low: low, close: close)
+    }
+
+    private func makeCandles(count: Int) -> [OHLCData] {
+        (0..<count).map { i in
+            let open = 100 + Double(i)
+            let close = open + (i % 2 == 0 ? 2 : -1)
+            return candle(open, max(open, close) + 1, min(open, close) - 1, close, at: i)
+        }
+    }
+
+    private func assertColumnsEqual(_ lhs: DerivedCandleSeries.Columns, _ rhs: DerivedCandleSeries.Columns,
+                                    accuracy: Double = 1e-9, file: StaticString = #filePath, line: UInt = #line) {
+        XCTAssertEqual(lhs.count, rhs.count, file: file, line: line)
+        for index in 0..<min(lhs.count, rhs.count) {
+            let a = lhs.candle(at: index)
+            let b = rhs.candle(at: index)
+            XCTAssertEqual(a.open, b.open, accuracy: accuracy, "open \(index)", file: file, line: line)
+            XCTAssertEqual(a.high, b.high, accuracy: accuracy, "high \(index)", file: file, line: line)
+            XCTAssertEqual(a.low, b.low, accuracy: accuracy, "low \(index)", file: file, line: line)
+            XCTAssertEqual(a.close, b.close, accuracy: accuracy, "close \(index)", file: file, line: line)
+        }
+    }
+
+    // MARK: - Transforms
+
+    func testHeikinAshiValues() {
+        // Given
+        let series = DerivedCandleSeries()
+        series.reset([candle(10, 14, 8, 12), candle(12, 16, 11, 15, at: 1)])
+
+        // When
+        let ha = series.columns(for: .heikinAshi)
+
+        // Then
+        // First: close = (10 + 14 + 8 + 12) / 4 = 11, open = (10 + 12) / 2 = 11
+        XCTAssertEqual(ha.candle(at: 0), DerivedCandleSeries.Candle(open: 11, high: 14, low: 8, close: 11))
+        // Second: close = (12 + 16 + 11 + 15) / 4 = 13.5, open = (11 + 11) / 2 = 11
+        XCTAssertEqual(ha.candle(at: 1), DerivedCandleSeries.Candle(open: 11, high: 16, low: 11, close: 13.5))
+    }
+
+    func testLogAndPercentValues() {
+        // Given
+        let series = DerivedCandleSeries()
+        series.reset([candle(100, 1000, 10, 100), candle(100, 200, 0, 150, at: 1)])
+
+        // When
+        let log = series.columns(for: .logarithmic)
+        let percent = series.columns(for: .percentFromStart)
+
+        // Then
+        XCTAssertEqual(log.candle(at: 0).open, 2, accuracy: 1e-12)
+        XCTAssertEqual(log.candle(at: 0).high, 3, accuracy: 1e-12)
+        XCTAssertEqual(log.candle(at: 0).low, 1, accuracy: 1e-12)
+        XCTAssertTrue(log.candle(at: 1).low.isNaN, "Non-positive prices have no log value")
+        XCTAssertEqual(percent.candle(at: 1).close, 50, accuracy: 1e-9)
+        XCTAssertEqual(percent.candle(at: 1).low, -100, accuracy: 1e-9)
+        XCTAssertEqual(series.bounds(for: .percentFromStart), ChartModel.PriceBounds(min: -100, max: 900))
+    }
+
+    func testDisplayValueRoundTrips() {
+        let series = DerivedCandleSeries()
+        series.reset(makeCandles(count: 3))
+        for mode in CandleSeriesMode.allCases {
+            let value = series.displayValue(forPrice: 123.45, mode: mode)
+            XCTAssertEqual(series.price(forDisplayValue: value, mode: mode), 123.45, accuracy: 1e-9, "\(mode)")
+        }
+    }
+
+    // MARK: - Caching
+
+    func testViewsAreBuiltLazilyAndDroppedOnReset() {
+        // Given
+        let series = DerivedCandleSeries()
+        series.reset(makeCandles(count: 20))
+        XCTAssertTrue(series.cachedModes.isEmpty)
+
+        // When
+        _ = series.columns(for: .heikinAshi)
+        _ = series.columns(for: .standard)
+
+        // Then
+        XCTAssertEqual(series.cachedModes, [.heikinAshi])
+
+        series.reset(makeCandles(count: 5))
+        XCTAssertTrue(series.cachedModes.isEmpty)
+    }
+
+    // MARK: - Incremental Updates
+
+    func testAppendAndReplaceLastPatchCachedViews() {
+        // Given
+        var candles = makeCandles(count: 30)
+        let series = DerivedCandleSeries()
+        series.reset(candles)
+        derivedModes.forEach { _ = series.columns(for: $0) }
+
+        // When
+        let appended = candle(130, 140, 125, 138, at: 30)
+        series.append(appended)
+        candles.append(appended)
+        let replaced = candle(130, 150, 120, 121, at: 30)
+        series.replaceLast(replaced)
+        candles[candles.count - 1] = replaced
+
+        // Then: views were patched in place and match a fresh build
+        XCTAssertEqual(series.cachedModes, Set(derivedModes))
+        let fresh = DerivedCandleSeries()
+        fresh.reset(candles)
+        for mode in CandleSeriesMode.allCases {
+            assertColumnsEqual(series.columns(for: mode), fresh.columns(for: mode))
+        }
+        XCTAssertEqual(series.bounds(for: .standard)?.max, 150)
+        XCTAssertEqual(series.bounds(for: .standard)?.min, 99)
+    }
+
+    func testReplacingTheStartCandleRebuildsPercentView() {
+        // Given
+        let series = DerivedCandleSeries()
+        series.reset([candle(100, 110, 90, 105)])
+        _ = series.columns(for: .percentFromStart)
+
+        // When
+        series.replaceLast(candle(200, 220, 180, 210))
+
+        // Then
+        XCTAssertFalse(series.cachedModes.contains(.percentFromStart))
+        XCTAssertEqual(series.columns(for: .percentFromStart).candle(at: 0).close, 5, accuracy: 1e-9)
+    }
+}
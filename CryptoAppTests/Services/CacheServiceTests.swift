@@ -4,25 +4,32 @@
 //
 //  Documentation:
 //  Unit tests for CacheService focusing on TTL expiry, type-specific getters/setters,
-//  image caching, removal/clearing, and basic stats.
+//  image caching, removal/clearing, basic stats and tiered memory-pressure release
+//  (refetch-cost and recency order, disk spill of expensive series).
+//  Patterns:
+//  - Each test gets a fresh CacheService spilling into its own temporary directory
 //
 
 import XCTest
 import UIKit
+import Combine
 @testable import CryptoApp
 
 final class CacheServiceTests: XCTestCase {
     
     private var cache: CacheService!
+    private var spillDirectory: URL!
     
     override func setUp() {
         super.setUp()
-        cache = CacheService() // Fresh instance to avoid singleton state
+        spillDirectory = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString, isDirectory: true)
+        cache = CacheService(spillDirectory: spillDirectory) // Fresh instance to avoid singleton state
     }
     
     override func tearDown() {
         cache.clear()
         cache = nil
+        try? FileManager.default.removeItem(at: spillDirectory)
         super.tearDown()
     }
     
@@ -150,6 +157,136 @@ final class CacheServiceTests: XCTestCase {
         XCTAssertGreaterThanOrEqual(stats.count, 0)
         XCTAssertGreaterThanOrEqual(stats.maxMemory, stats.memoryUsage)
     }
+    
+    func testStatsCountEntriesAndOverwritesDoNotDoubleCount() {
+        // Given: two entries, one written twice ([Double] costs count * 8 + 32)
+        cache.set(key: "a", value: [1.0, 2.0], ttl: 60)
+        cache.set(key: "b", value: [1.0, 2.0], ttl: 60)
+        cache.set(key: "a", value: [1.0, 2.0], ttl: 60)
+        
+        // Then: stats reflect what is held, not the count limit
+        var stats = cache.getCacheStats()
+        XCTAssertEqual(stats.count, 2)
+        XCTAssertEqual(stats.memoryUsage, 2 * 48)
+        
+        // When
+        cache.remove(key: "a")
+        
+        // Then
+        stats = cache.getCacheStats()
+        XCTAssertEqual(stats.count, 1)
+        XCTAssertEqual(stats.memoryUsage, 48)
+    }
+    
+    func testMemoryPressureReleasesOnlyTheRequestedTier() {
+        // Given: a cheap coin list and an expensive chart series
+        cache.storeCoinList(TestDataFactory.createMockCoins(count: 2), limit: 10, start: 1, convert: "USD", sortType: "market_cap", sortDir: "desc")
+        cache.storeChartData([1, 2, 3], for: "bitcoin", currency: "usd", days: "7")
+        XCTAssertEqual(cache.memoryFootprint().children.map(\.name), ["chart", "coins"])
+        
+        // When
+        let freed = cache.releaseMemory(for: .derived)
+        
+        // Then: the list is gone, the chart stays
+        XCTAssertEqual(freed, MemoryEstimate.coins(2))
+        XCTAssertNil(cache.getCoinList(limit: 10, start: 1, convert: "USD", sortType: "market_cap", sortDir: "desc"))
+        XCTAssertEqual(cache.getChartData(for: "bitcoin", currency: "usd", days: "7"), [1, 2, 3])
+        XCTAssertEqual(cache.memoryFootprint().children.first?.tier, .series)
+    }
+    
+    func testMemoryPressureEvictsCheapestThenLeastRecentlyUsedUntilTarget() {
+        // Given: two 832-byte charts (expensive) and a 132-byte logo map (medium); "a" read last
+        let series = Array(repeating: 1.0, count: 100)
+        cache.storeChartData(series, for: "a", currency: "usd", days: "7")
+        cache.storeChartData(series, for: "b", currency: "usd", days: "7")
+        cache.storeCoinLogos([1: "https://example.com/1.png"])
+        XCTAssertNotNil(cache.getChartData(for: "a", currency: "usd", days: "7"))
+        cache.memoryPressureTarget = 900
+        
+        // When
+        let freed = cache.handleMemoryPressure(tier: .series)
+        
+        // Then: logos went first, then the older chart; the recent chart stays
+        XCTAssertEqual(freed, 132 + 832)
+        XCTAssertNil(cache.getCoinLogos())
+        XCTAssertNil(cache.get(key: "chart_b_usd_7", type: [Double].self))
+        XCTAssertNotNil(cache.get(key: "chart_a_usd_7", type: [Double].self))
+        XCTAssertEqual(cache.getCacheStats().memoryUsage, 832)
+    }
+    
+    func testImagesTierLeavesExpensiveEntries() {
+        cache.storeChartData([1, 2, 3], for: "bitcoin", currency: "usd", days: "7")
+        cache.storeCoinLogos([1: "https://example.com/1.png"])
+        cache.memoryPressureTarget = 0
+        
+        cache.handleMemoryPressure(tier: .images)
+        
+        XCTAssertNil(cache.getCoinLogos())
+        XCTAssertEqual(cache.getCacheStats().count, 1)
+    }
+    
+    func testSpilledSeriesAreRestoredAsynchronously() {
+        // Given
+        let candles = TestDataFactory.createMockOHLCData(candles: 3)
+        cache.storeOHLCData(candles, for: "bitcoin", currency: "usd", days: "30")
+        cache.memoryPressureTarget = 0
+        let restoresBefore = Metrics.cacheSpillRestores.value
+        
+        // When: evicted under pressure, then restored
+        cache.handleMemoryPressure(tier: .series)
+        XCTAssertEqual(cache.getCacheStats().count, 0)
+        XCTAssertNil(cache.getOHLCData(for: "bitcoin", currency: "usd", days: "30"))
+        
+        let exp = expectation(description: "restored")
+        var restored: [OHLCData]?
+        let cancellable = cache.restoreSpilledOHLCData(for: "bitcoin", currency: "usd", days: "30")
+            .sink { value in
+                XCTAssertTrue(Thread.isMainThread)
+                restored = value
+                exp.fulfill()
+            }
+        wait(for: [exp], timeout: 2.0)
+        cancellable.cancel()
+        
+        // Then: read back from disk and resident again
+        XCTAssertEqual(restored?.map(\.close), candles.map(\.close))
+        XCTAssertEqual(restored?.map(\.timestamp), candles.map(\.timestamp))
+        XCTAssertEqual(Metrics.cacheSpillRestores.value, restoresBefore + 1)
+        XCTAssertEqual(cache.getOHLCData(for: "bitcoin", currency: "usd", days: "30")?.count, 3)
+    }
+    
+    func testFreshValueWinsOverPendingSpill() {
+        // Given: a spilled chart that is then stored again
+        cache.storeChartData([1, 2, 3], for: "bitcoin", currency: "usd", days: "7")
+        cache.memoryPressureTarget = 0
+        cache.handleMemoryPressure(tier: .series)
+        cache.storeChartData([4, 5], for: "bitcoin", currency: "usd", days: "7")
+        
+        // When
+        let exp = expectation(description: "restore finished")
+        var restored: [Double]?
+        let cancellable = cache.restoreSpilledChartData(for: "bitcoin", currency: "usd", days: "7")
+            .sink { restored = $0; exp.fulfill() }
+        wait(for: [exp], timeout: 2.0)
+        cancellable.cancel()
+        
+        // Then
+        XCTAssertNil(restored)
+        XCTAssertEqual(cache.getChartData(for: "bitcoin", currency: "usd", days: "7"), [4, 5])
+    }
+    
+    func testCacheWithoutSpillDirectoryDropsSeries() {
+        let memoryOnly = CacheService(spillDirectory: nil)
+        memoryOnly.storeChartData([1, 2, 3], for: "bitcoin", currency: "usd", days: "7")
+        memoryOnly.memoryPressureTarget = 0
+        
+        memoryOnly.handleMemoryPressure(tier: .series)
+        
+        XCTAssertNil(memoryOnly.getChartData(for: "bitcoin", currency: "usd", days: "7"))
+        var restored: [Double]? = [0]
+        _ = memoryOnly.restoreSpilledChartData(for: "bitcoin", currency: "usd", days: "7").sink { restored = $0 }
+        XCTAssertNil(restored)
+    }
 }
 
 
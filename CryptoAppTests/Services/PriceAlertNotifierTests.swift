@@ -0,0 +1,150 @@
+//
+//  PriceAlertNotifierTests.swift
+//  CryptoAppTests
+//
+//  Documentation:
+//  End-to-end wiring of price alerts: a shared price update flows through PriceAlertManager
+//  into PriceAlertNotifier, which produces the notification the user sees.
+//  Patterns:
+//  - MockSharedCoinDataManager drives the updates; the notifier's delivery is captured
+//  - Rules are stored in a throwaway UserDefaults suite
+//  - Indicator warm-up reads closes from MockCacheService
+//  - Coins outside the shared list are priced through MockSharedCoinDataManager's watched quotes
+//
+
+import XCTest
+import Combine
+@testable import CryptoApp
+
+final class PriceAlertNotifierTests: XCTestCase {
+
+    private var sharedData: MockSharedCoinDataManager!
+    private var defaults: UserDefaults!
+    private var suiteName: String!
+    private var cancellables = Set<AnyCancellable>()
+
+    override func setUp() {
+        super.setUp()
+        sharedData = MockSharedCoinDataManager()
+        suiteName = "PriceAlertNotifierTests-\(UUID().uuidString)"
+        defaults = UserDefaults(suiteName: suiteName)
+    }
+
+    override func tearDown() {
+        defaults.removePersistentDomain(forName: suiteName)
+        cancellables.removeAll()
+        sharedData = nil
+        defaults = nil
+        super.tearDown()
+    }
+
+    private func quote(price: Double) -> Quote {
+        Quote(price: price, volume24h: nil, volumeChange24h: nil, percentChange1h: nil,
+              percentChange24h: nil, percentChange7d: nil, percentChange30d: nil,
+              percentChange60d: nil, percentChange90d: nil, marketCap: nil,
+              marketCapDominance: nil, fullyDilutedMarketCap: nil, lastUpdated: nil)
+    }
+
+    private func coin(price: Double) -> Coin {
+        var coin = TestDataFactory.createMockCoin(id: 1, symbol: "BTC", name: "Bitcoin", rank: 1)
+        coin.quote = ["USD": quote(price: price)]
+        return coin
+    }
+
+    func testSharedPriceUpdateDeliversNotification() {
+        // Given: a wired manager and notifier with a rule above the current price
+        let manager = PriceAlertManager(sharedCoinDataManager: sharedData, userDefaults: defaults)
+        var delivered: [(identifier: String, title: String, body: String)] = []
+        let exp = expectation(description: "alert delivered")
+        let notifier = PriceAlertNotifier { identifier, title, body in
+            delivered.append((identifier, title, body))
+            exp.fulfill()
+        }
+        notifier.startMonitoring(alertManager: manager, sharedCoinDataManager: sharedData)
+        let rule = PriceAlertRule(coinId: 1, condition: .priceAbove(100), cooldown: 0)
+        manager.addRule(rule)
+        sharedData.setMockCoins([coin(price: 90)])
+
+        // When: the shared store publishes a price through the level
+        sharedData.setMockCoins([coin(price: 110)])
+
+        // Then
+        wait(for: [exp], timeout: 2.0)
+        XCTAssertEqual(delivered.count, 1)
+        XCTAssertEqual(delivered.first?.identifier, "price-alert-\(rule.id.uuidString)")
+        XCTAssertEqual(delivered.first?.title, "BTC ▲ $110.00")
+        XCTAssertEqual(delivered.first?.body, "Price above $100.00 triggered")
+    }
+
+    func testIndicatorRuleIsSeededFromCachedCloses() {
+        // Given: cached closes long enough to warm up both averages
+        let cache = MockCacheService()
+        cache.mockChartData = [100, 100, 100]
+        let manager = PriceAlertManager(sharedCoinDataManager: sharedData, userDefaults: defaults, cacheService: cache)
+        var events: [PriceAlertEvent] = []
+        let exp = expectation(description: "crossover triggered")
+        manager.triggeredAlerts
+            .sink { triggered in
+                events += triggered
+                exp.fulfill()
+            }
+            .store(in: &cancellables)
+        manager.addRule(PriceAlertRule(coinId: 1, geckoID: "bitcoin", condition: .smaCrossover(fast: 2, slow: 3),
+                                       hysteresis: 0.001, cooldown: 0))
+
+        // When: two live prices, which alone could not fill the slow average
+        sharedData.setMockCoins([coin(price: 90)])
+        sharedData.setMockCoins([coin(price: 130)])
+
+        // Then: fast (90 + 130) / 2 crosses slow (100 + 90 + 130) / 3 upward
+        wait(for: [exp], timeout: 2.0)
+        XCTAssertEqual(events.map(\.direction), [.up])
+    }
+
+    func testAlertCoinsAreRegisteredAsWatched() {
+        // Given
+        let manager = PriceAlertManager(sharedCoinDataManager: sharedData, userDefaults: defaults)
+        sharedData.setWatchedCoinIds([7])
+
+        // When
+        let rule = PriceAlertRule(coinId: 300, condition: .priceAbove(1))
+        manager.addRule(rule)
+
+        // Then: registered next to the watchlist's coins, and dropped with the last rule
+        XCTAssertEqual(sharedData.watchedCoinIds, [7, 300])
+        manager.removeRule(id: rule.id)
+        XCTAssertEqual(sharedData.watchedCoinIds, [7])
+    }
+
+    func testWatchedQuoteTriggersAlertForCoinOutsideSharedList() {
+        // Given: an alert coin that only receives watched quotes
+        let manager = PriceAlertManager(sharedCoinDataManager: sharedData, userDefaults: defaults)
+        var events: [PriceAlertEvent] = []
+        let exp = expectation(description: "alert triggered")
+        manager.triggeredAlerts
+            .sink { triggered in
+                events += triggered
+                exp.fulfill()
+            }
+            .store(in: &cancellables)
+        manager.addRule(PriceAlertRule(coinId: 300, condition: .priceAbove(100), cooldown: 0))
+        sharedData.setMockWatchedQuotes([300: quote(price: 90)])
+
+        // When
+        sharedData.setMockWatchedQuotes([300: quote(price: 110)])
+
+        // Then
+        wait(for: [exp], timeout: 2.0)
+        XCTAssertEqual(events.map(\.coinId), [300])
+        XCTAssertEqual(events.first?.price, 110)
+    }
+
+    func testRulesPersistAcrossManagers() {
+        let first = PriceAlertManager(sharedCoinDataManager: sharedData, userDefaults: defaults)
+        first.addRule(PriceAlertRule(coinId: 1, condition: .priceBelow(50)))
+
+        let second = PriceAlertManager(sharedCoinDataManager: sharedData, userDefaults: defaults)
+
+        XCTAssertEqual(second.currentRules.map(\.condition), [.priceBelow(50)])
+    }
+}
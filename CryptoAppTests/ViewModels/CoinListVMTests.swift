@@ -550,7 +550,7 @@ extension CoinListVMTests {
             .prefix(1)
             .sink { s in ids = s; exp.fulfill() }
             .store(in: &cancellables)
-        viewModel.fetchPriceUpdatesForVisibleCoins([2,5]) { }
+        viewModel.fetchPriceUpdatesForVisibleCoins([2,5]) { _ in }
         wait(for: [exp], timeout: 2.0)
 
         // Then
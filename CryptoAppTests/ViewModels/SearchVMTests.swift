@@ -185,6 +185,32 @@ final class SearchVMTests: XCTestCase {
         XCTAssertLessThanOrEqual(count, 50)
     }
     
+    func testSearchAfterMemoryReleaseReloadsCorpusOffMain() {
+        // Given
+        // Drop the search corpus as the memory monitor would under pressure
+        _ = viewModel.releaseMemory(for: .derived)
+        let exp = expectation(description: "results after reload")
+        var fulfilled = false
+        
+        viewModel.searchResults
+            .sink { list in
+                if !list.isEmpty && !fulfilled {
+                    fulfilled = true
+                    exp.fulfill()
+                }
+            }
+            .store(in: &cancellables)
+        
+        // When
+        viewModel.updateSearchText("COIN1")
+        
+        // Then
+        // The corpus is reloaded in the background and the search re-runs once it lands on main
+        wait(for: [exp], timeout: 2.0)
+        XCTAssertFalse(viewModel.isReloadingCoins)
+        XCTAssertEqual(viewModel.cachedCoins.count, 25)
+    }
+    
     // MARK: - Error State Transitions
     
     func testSharedErrorPublishesFriendlyMessage() {